@@ -218,6 +218,7 @@ IF (NOT WINDOWS)
   CHECK_LIBRARY_EXISTS_CONCAT ("dl" dlopen     H5_HAVE_LIBDL)
   CHECK_LIBRARY_EXISTS_CONCAT ("ws2_32" WSAStartup  H5_HAVE_LIBWS2_32)
   CHECK_LIBRARY_EXISTS_CONCAT ("wsock32" gethostbyname H5_HAVE_LIBWSOCK32)
+  CHECK_LIBRARY_EXISTS_CONCAT ("pthread" pthread_self H5_HAVE_LIBPTHREAD)
 ENDIF (NOT WINDOWS)
 
 CHECK_LIBRARY_EXISTS_CONCAT ("ucb"    gethostname  H5_HAVE_LIBUCB)
@@ -643,6 +644,11 @@ CHECK_FUNCTION_EXISTS (getpwuid          H5_HAVE_GETPWUID)
 CHECK_FUNCTION_EXISTS (getrusage         H5_HAVE_GETRUSAGE)
 CHECK_FUNCTION_EXISTS (lstat             H5_HAVE_LSTAT)
 
+CHECK_FUNCTION_EXISTS (pread             H5_HAVE_PREAD)
+CHECK_FUNCTION_EXISTS (preadv            H5_HAVE_PREADV)
+CHECK_FUNCTION_EXISTS (pwrite            H5_HAVE_PWRITE)
+CHECK_FUNCTION_EXISTS (pwritev           H5_HAVE_PWRITEV)
+
 CHECK_FUNCTION_EXISTS (rand_r            H5_HAVE_RAND_R)
 CHECK_FUNCTION_EXISTS (random            H5_HAVE_RANDOM)
 CHECK_FUNCTION_EXISTS (setsysinfo        H5_HAVE_SETSYSINFO)
@@ -809,6 +815,26 @@ IF (NOT WINDOWS)
   ENDIF (HDF5_ENABLE_DIRECT_VFD)
 ENDIF (NOT WINDOWS)
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring I/O driver can be built
+#-----------------------------------------------------------------------------
+IF (NOT WINDOWS)
+  OPTION (HDF5_ENABLE_IOURING_VFD "Build the Linux io_uring Virtual File Driver" OFF)
+  IF (HDF5_ENABLE_IOURING_VFD)
+    HDF5_FUNCTION_TEST (HAVE_IOURING)
+  ENDIF (HDF5_ENABLE_IOURING_VFD)
+ENDIF (NOT WINDOWS)
+
+#-----------------------------------------------------------------------------
+#  Check if the read-only mmap driver can be built
+#-----------------------------------------------------------------------------
+IF (NOT WINDOWS)
+  OPTION (HDF5_ENABLE_MMAP_VFD "Build the read-only mmap Virtual File Driver" ON)
+  IF (HDF5_ENABLE_MMAP_VFD)
+    HDF5_FUNCTION_TEST (HAVE_MMAP_VFD)
+  ENDIF (HDF5_ENABLE_MMAP_VFD)
+ENDIF (NOT WINDOWS)
+
 #-----------------------------------------------------------------------------
 #  Check for the Stream VFD driver
 #-----------------------------------------------------------------------------
@@ -344,6 +344,41 @@ int main(void)
        SIMPLE_TEST(posix_memalign());
 #endif
 
+#ifdef HAVE_IOURING
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+int main(void)
+{
+    struct io_uring_params p;
+    struct io_uring_sqe sqe;
+    unsigned tail = 0;
+
+    sqe.opcode = IORING_OP_WRITEV;
+    __atomic_store_n(&tail, __atomic_load_n(&tail, __ATOMIC_ACQUIRE) + 1, __ATOMIC_RELEASE);
+    (void)mmap(0, 0, PROT_READ, MAP_SHARED, -1, IORING_OFF_SQES);
+    return (int)(syscall(__NR_io_uring_setup, 1, &p) + syscall(__NR_io_uring_enter, -1, 0, 0, IORING_ENTER_GETEVENTS, NULL, 0));
+}
+#endif
+
+#ifdef HAVE_MMAP_VFD
+#include <sys/types.h>
+#include <sys/mman.h>
+
+int main(void)
+{
+    void *p = mmap(0, 1, PROT_READ, MAP_SHARED, -1, 0);
+
+    if(MAP_FAILED != p)
+        munmap(p, 1);
+    return 0;
+}
+#endif
+
 #ifdef TEST_LFS_WORKS
 /* Return 0 when LFS is available and 1 otherwise.  */
 #define _LARGEFILE_SOURCE
@@ -135,3 +135,152 @@ done:
 
     return ret_value;
 }
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5DOread_chunk
+ *
+ * Purpose:     Reads an entire chunk from the file directly, as it is
+ *		stored there, without running it through the filter
+ *		pipeline.  The chunk's filter mask is returned in FILTERS.
+ *		BUF must be large enough for the chunk's stored size (see
+ *		H5Dget_chunk_storage_size).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOread_chunk(hid_t dset_id, hid_t dxpl_id, const hsize_t *offset,
+         uint32_t *filters, void *buf)
+{
+    void *bufs[1];
+    herr_t  ret_value = SUCCEED;  /* Return value */
+
+    if(!buf) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    bufs[0] = buf;
+    if(H5DOread_chunks(dset_id, dxpl_id, (size_t)1, offset, filters, bufs) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+done:
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	H5DOread_chunks
+ *
+ * Purpose:     Reads NCHUNKS entire chunks from the file directly, as
+ *		they are stored there.  The offset of chunk U is held in
+ *		the RANK values at OFFSETS[U*RANK]; it is read into BUFS[U]
+ *		and its filter mask is returned in FILTERS[U].  The chunks
+ *		are read in the order they are stored in the file, so that
+ *		chunks next to each other are read together.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DOread_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+         const hsize_t *offsets, uint32_t *filters, void *bufs[])
+{
+    hbool_t created_dxpl = FALSE;
+    herr_t  ret_value = SUCCEED;  /* Return value */
+
+    if(dset_id < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(!bufs) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(!offsets) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(!filters) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(H5P_DEFAULT == dxpl_id) {
+	if((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) {
+            ret_value = FAIL;
+            goto done;
+        }
+
+        created_dxpl = TRUE;
+    }
+
+    if(H5DO_read_chunks(dset_id, dxpl_id, nchunks, offsets, filters, bufs) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+done:
+    if(created_dxpl) {
+        if(H5Pclose(dxpl_id) < 0)
+            ret_value = FAIL;
+    }
+
+    return ret_value;
+}
+
+/*-------------------------------------------------------------------------
+ * Function:	H5DO_read_chunks
+ *
+ * Purpose:     Private function for H5DOread_chunk and H5DOread_chunks
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5DO_read_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+         const hsize_t *offsets, uint32_t *filters, void *bufs[])
+{
+    hbool_t do_direct_read = TRUE;
+    herr_t  ret_value = SUCCEED;  /* Return value */
+
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &do_direct_read) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_NAME, &nchunks) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, &offsets) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME, &filters) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+    if(H5Dread(dset_id, 0, H5S_ALL, H5S_ALL, dxpl_id, bufs) < 0) {
+        ret_value = FAIL;
+        goto done;
+    }
+
+done:
+    do_direct_read = FALSE;
+    if(H5Pset(dxpl_id, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &do_direct_read) < 0)
+        ret_value = FAIL;
+
+    return ret_value;
+}
@@ -34,4 +34,11 @@ H5_HLDLL herr_t H5DO_write_chunk(hid_t dset_id,
          		size_t data_size, 
 			const void *buf);
 
+H5_HLDLL herr_t H5DO_read_chunks(hid_t dset_id,
+			hid_t dxpl_id,
+			size_t nchunks,
+			const hsize_t *offsets,
+			uint32_t *filters,
+			void *bufs[]);
+
 #endif
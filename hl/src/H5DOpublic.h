@@ -34,6 +34,26 @@ H5_HLDLL herr_t H5DOwrite_chunk(hid_t dset_id,
          		size_t data_size, 
 			const void *buf);
 
+/*-------------------------------------------------------------------------
+ *
+ * Direct chunk read functions
+ *
+ *-------------------------------------------------------------------------
+ */
+
+H5_HLDLL herr_t H5DOread_chunk(hid_t dset_id,
+			hid_t dxpl_id,
+			const hsize_t *offset,
+			uint32_t *filters,
+			void *buf);
+
+H5_HLDLL herr_t H5DOread_chunks(hid_t dset_id,
+			hid_t dxpl_id,
+			size_t nchunks,
+			const hsize_t *offsets,
+			uint32_t *filters,
+			void *bufs[]);
+
 #ifdef __cplusplus
 }
 #endif
@@ -35,6 +35,7 @@
 #define DATASETNAME4        "data_conv"
 #define DATASETNAME5        "contiguous_dset"
 #define DATASETNAME6        "invalid_argue"
+#define DATASETNAME7        "direct_read"
 #define RANK         2
 #define NX     16
 #define NY     16
@@ -1090,6 +1091,201 @@ error:
     return 1;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:	test_direct_chunk_read
+ *
+ * Purpose:	Test the basic functionality of H5DOread_chunk and
+ *              H5DOread_chunks
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_direct_chunk_read(hid_t file)
+{
+    hid_t       dataspace = -1, dataset = -1;
+    hid_t       mem_space = -1;
+    hid_t       cparms = -1, dxpl = -1;
+    hsize_t     dims[2]  = {NX, NY};
+    hsize_t     chunk_dims[2] ={CHUNK_NX, CHUNK_NY};
+    int         data[NX][NY];
+    int         i, j, n;
+
+    uint32_t    filter_mask = 0;
+    uint32_t    filters[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    int         direct_buf[CHUNK_NX][CHUNK_NY];
+    hsize_t     offset[2] = {0, 0};
+    hsize_t     offsets[(NX/CHUNK_NX)*(NY/CHUNK_NY)][2];
+    hsize_t     chunk_nbytes = 0;
+    size_t      buf_size = CHUNK_NX*CHUNK_NY*sizeof(int);
+    unsigned char read_buf[(NX/CHUNK_NX)*(NY/CHUNK_NY)][CHUNK_NX*CHUNK_NY*sizeof(int)+4];
+    void        *bufs[(NX/CHUNK_NX)*(NY/CHUNK_NY)];
+    size_t      nchunks = (NX/CHUNK_NX)*(NY/CHUNK_NY);
+    size_t      u;
+
+    hsize_t start[2];  /* Start of hyperslab */
+    hsize_t count[2];  /* Block count */
+
+    TESTING("basic functionality of H5DOread_chunk");
+
+    /*
+     * Create a dataset whose chunks get a checksum appended
+     */
+    if((dataspace = H5Screate_simple(RANK, dims, NULL)) < 0)
+        goto error;
+
+    if((mem_space = H5Screate_simple(RANK, chunk_dims, NULL)) < 0)
+        goto error;
+
+    if((cparms = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        goto error;
+
+    if(H5Pset_chunk(cparms, RANK, chunk_dims) < 0)
+        goto error;
+
+    if(H5Pset_fletcher32(cparms) < 0)
+        goto error;
+
+    if((dataset = H5Dcreate2(file, DATASETNAME7, H5T_NATIVE_INT, dataspace, H5P_DEFAULT,
+			cparms, H5P_DEFAULT)) < 0)
+        goto error;
+
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        goto error;
+
+    /* Reading a chunk which hasn't been written should fail */
+    H5E_BEGIN_TRY {
+        if(H5DOread_chunk(dataset, dxpl, offset, &filter_mask, read_buf[0]) != FAIL)
+            goto error;
+    } H5E_END_TRY;
+
+    /* Write the whole dataset */
+    for(i = n = 0; i < NX; i++)
+        for(j = 0; j < NY; j++)
+	    data[i][j] = n++;
+
+    if(H5Dwrite(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, data) < 0)
+        goto error;
+
+    /*
+     * Read the chunks back as they are stored, in reverse order.  The data
+     * is still dirty in the chunk cache, so it must be written out first.
+     */
+    for(i = n = 0; i < NX/CHUNK_NX; i++)
+        for(j = 0; j < NY/CHUNK_NY; j++, n++) {
+            offsets[nchunks - 1 - (size_t)n][0] = (hsize_t)(i * CHUNK_NX);
+            offsets[nchunks - 1 - (size_t)n][1] = (hsize_t)(j * CHUNK_NY);
+        }
+    for(u = 0; u < nchunks; u++) {
+        bufs[u] = read_buf[u];
+        filters[u] = (uint32_t)-1;
+    }
+
+    if(H5DOread_chunks(dataset, dxpl, nchunks, &offsets[0][0], filters, bufs) < 0)
+        goto error;
+
+    for(u = 0; u < nchunks; u++) {
+        if(H5Dget_chunk_storage_size(dataset, offsets[u], &chunk_nbytes) < 0)
+            goto error;
+        if(chunk_nbytes != buf_size + 4)
+            goto error;
+        if(filters[u] != 0)
+            goto error;
+
+        /* The checksum follows the chunk's data */
+        memcpy(direct_buf, read_buf[u], buf_size);
+        for(i = 0; i < CHUNK_NX; i++)
+            for(j = 0; j < CHUNK_NY; j++)
+                if(direct_buf[i][j] != data[offsets[u][0] + (hsize_t)i][offsets[u][1] + (hsize_t)j]) {
+                    printf("    1. Read different values than written.");
+                    printf("    At index %d,%d\n", i, j);
+                    goto error;
+                }
+    }
+
+    /* Overwrite one chunk through the cache and read it back directly */
+    start[0] = CHUNK_NX; start[1] = 2 * CHUNK_NY;
+    count[0] = CHUNK_NX; count[1] = CHUNK_NY;
+    if(H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        goto error;
+    for(i = n = 0; i < CHUNK_NX; i++)
+        for(j = 0; j < CHUNK_NY; j++)
+	    direct_buf[i][j] = -(n++);
+    if(H5Dwrite(dataset, H5T_NATIVE_INT, mem_space, dataspace, dxpl, direct_buf) < 0)
+        goto error;
+
+    memset(read_buf[0], 0, sizeof(read_buf[0]));
+    if(H5DOread_chunk(dataset, dxpl, start, &filter_mask, read_buf[0]) < 0)
+        goto error;
+    if(filter_mask != 0 || memcmp(read_buf[0], direct_buf, buf_size))
+        goto error;
+
+    /* Write a chunk directly, skipping the checksum, and read it back */
+    offset[0] = 2 * CHUNK_NX; offset[1] = CHUNK_NY;
+    if(H5DOwrite_chunk(dataset, dxpl, (uint32_t)1, offset, buf_size, direct_buf) < 0)
+        goto error;
+
+    if(H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) < 0)
+        goto error;
+    if(chunk_nbytes != buf_size)
+        goto error;
+
+    memset(read_buf[0], 0, sizeof(read_buf[0]));
+    if(H5DOread_chunk(dataset, H5P_DEFAULT, offset, &filter_mask, read_buf[0]) < 0)
+        goto error;
+    if(filter_mask != 1 || memcmp(read_buf[0], direct_buf, buf_size))
+        goto error;
+
+    /* Offsets which aren't on a chunk boundary or are outside the dataset
+     * should fail */
+    offset[0] = 1; offset[1] = 0;
+    H5E_BEGIN_TRY {
+        if(H5DOread_chunk(dataset, dxpl, offset, &filter_mask, read_buf[0]) != FAIL)
+            goto error;
+        if(H5Dget_chunk_storage_size(dataset, offset, &chunk_nbytes) != FAIL)
+            goto error;
+    } H5E_END_TRY;
+    offset[0] = NX; offset[1] = 0;
+    H5E_BEGIN_TRY {
+        if(H5DOread_chunk(dataset, dxpl, offset, &filter_mask, read_buf[0]) != FAIL)
+            goto error;
+    } H5E_END_TRY;
+
+    /* Ordinary reads must not be affected */
+    if(H5Dread(dataset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, data) < 0)
+        goto error;
+    if(data[CHUNK_NX][2 * CHUNK_NY + 1] != -1)
+        goto error;
+
+    if(H5Dclose(dataset) < 0)
+        goto error;
+
+    /*
+     * Close/release resources.
+     */
+    H5Sclose(mem_space);
+    H5Sclose(dataspace);
+    H5Pclose(cparms);
+    H5Pclose(dxpl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dataset);
+        H5Sclose(mem_space);
+        H5Sclose(dataspace);
+        H5Pclose(cparms);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
 /*-------------------------------------------------------------------------
  * Function:	Main function
  *
@@ -1123,6 +1319,7 @@ int main( void )
     nerrors += test_skip_compress_write2(file_id);
     nerrors += test_data_conv(file_id);
     nerrors += test_invalid_parameters(file_id);
+    nerrors += test_direct_chunk_read(file_id);
 
     if(H5Fclose(file_id) < 0)
         goto error;
@@ -223,6 +223,13 @@ H5_term_library(void)
     if(!(H5_INIT_GLOBAL))
 	goto done;
 
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+    /* Wait for any raw data reads running without the API lock, as their
+     * objects are about to be closed (see H5F_block_readv)
+     */
+    H5TS_readers_wait(NULL);
+#endif
+
     /* Check if we should display error output */
     (void)H5Eget_auto2(H5E_DEFAULT, &func, NULL);
 
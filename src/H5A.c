@@ -41,6 +41,9 @@
 /* Local Macros */
 /****************/
 
+/* Largest alignment of the values packed by H5Aread_all() */
+#define H5A_PACKED_ALIGN        16
+
 
 /******************/
 /* Local Typedefs */
@@ -53,6 +56,18 @@ typedef struct H5A_iter_cb1 {
     int idx;
 } H5A_iter_cb1;
 
+/* User data for the H5Aread_all() attribute callback */
+typedef struct {
+    H5F_t *f;                   /* File the attributes are in */
+    hid_t dxpl_id;              /* DXPL for operation */
+    size_t nentries;            /* Number of entries to fill */
+    H5A_packed_t *entries;      /* Entries to fill */
+    uint8_t *buf;               /* Buffer for names and values */
+    size_t buf_size;            /* Size of buffer */
+    size_t buf_used;            /* Bytes needed so far */
+    size_t nattrs;              /* Number of attributes visited */
+} H5A_read_all_ud_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -66,6 +81,7 @@ typedef struct H5A_iter_cb1 {
 static herr_t H5A_open_common(const H5G_loc_t *loc, H5A_t *attr);
 static herr_t H5A_write(H5A_t *attr, const H5T_t *mem_type, const void *buf, hid_t dxpl_id);
 static herr_t H5A_read(const H5A_t *attr, const H5T_t *mem_type, void *buf, hid_t dxpl_id);
+static herr_t H5A_read_all_cb(const H5A_t *attr, void *_udata);
 
 
 /*********************/
@@ -1198,6 +1214,276 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5A_read() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5Aread_all
+ PURPOSE
+    Read all the attributes of an object into one buffer
+ USAGE
+    ssize_t H5Aread_all (loc_id, obj_name, idx_type, order, nentries,
+            entries, buf_size, buf, lapl_id)
+        hid_t loc_id;             IN: Base location for object
+        const char *obj_name;     IN: Name of object relative to location
+        H5_index_t idx_type;      IN: Type of index to use
+        H5_iter_order_t order;    IN: Order to read attributes in
+        size_t nentries;          IN: Number of entries in ENTRIES
+        H5A_packed_t entries[];   OUT: Description of each attribute
+        size_t *buf_size;         IN/OUT: Size of BUF, then size needed
+        void *buf;                OUT: Buffer for names and values
+        hid_t lapl_id;            IN: Link access property list
+ RETURNS
+    Number of attributes on the object on success, negative on failure
+
+ DESCRIPTION
+        This function decodes all the attributes of an object in one pass
+    over its object header or dense attribute storage, without creating
+    an ID for any attribute.  The first NENTRIES attributes, in ORDER on
+    IDX_TYPE, are described in ENTRIES.  Their names and values are packed
+    into BUF and the entries point there.
+
+        Integer and floating-point values are converted to the matching
+    native type.  Fixed-length strings are returned as stored and
+    variable-length strings as an array of "char *" pointing into BUF.
+    Values of other classes are not read and their DATA is NULL; use
+    H5Aopen_by_name and H5Aread for those.
+
+        On return, *BUF_SIZE holds the size needed for all the attributes
+    in ORDER.  If that is more than was passed in, the attributes that did
+    not fit have NULL names and values.  Values are aligned relative to
+    the start of BUF, so BUF should be allocated with malloc.
+--------------------------------------------------------------------------*/
+ssize_t
+H5Aread_all(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
+    H5_iter_order_t order, size_t nentries, H5A_packed_t entries[],
+    size_t *buf_size, void *buf, hid_t lapl_id)
+{
+    H5G_loc_t	loc;	        /* Object location */
+    H5G_loc_t   obj_loc;        /* Location of object to read */
+    H5G_name_t  obj_path;       /* Object's group hier. path */
+    H5O_loc_t   obj_oloc;       /* Object's object location */
+    hbool_t     loc_found = FALSE;      /* Entry at 'obj_name' found */
+    H5A_read_all_ud_t udata;    /* User data for attribute callback */
+    ssize_t	ret_value;      /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE9("Zs", "i*sIiIoz*x*z*xi", loc_id, obj_name, idx_type, order, nentries,
+             entries, buf_size, buf, lapl_id);
+
+    /* check arguments */
+    if(H5I_ATTR == H5I_get_type(loc_id))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location is not valid for an attribute")
+    if(H5G_loc(loc_id, &loc) < 0)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    if(!obj_name || !*obj_name)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no object name")
+    if(idx_type <= H5_INDEX_UNKNOWN || idx_type >= H5_INDEX_N)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid index type specified")
+    if(order <= H5_ITER_UNKNOWN || order >= H5_ITER_N)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid iteration order specified")
+    if(nentries > 0 && !entries)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no entries")
+    if(!buf_size)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no buffer size")
+    if(*buf_size > 0 && !buf)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no buffer")
+    if(H5P_DEFAULT == lapl_id)
+        lapl_id = H5P_LINK_ACCESS_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(lapl_id, H5P_LINK_ACCESS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not link access property list ID")
+
+    /* Set up opened group location to fill in */
+    obj_loc.oloc = &obj_oloc;
+    obj_loc.path = &obj_path;
+    H5G_loc_reset(&obj_loc);
+
+    /* Find the object's location */
+    if(H5G_loc_find(&loc, obj_name, &obj_loc/*out*/, lapl_id, H5AC_ind_dxpl_id) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_NOTFOUND, FAIL, "object not found")
+    loc_found = TRUE;
+
+    /* Set up user data for the attribute callback */
+    udata.f = obj_loc.oloc->file;
+    udata.dxpl_id = H5AC_ind_dxpl_id;
+    udata.nentries = nentries;
+    udata.entries = entries;
+    udata.buf = (uint8_t *)buf;
+    udata.buf_size = *buf_size;
+    udata.buf_used = 0;
+    udata.nattrs = 0;
+
+    /* Visit the attributes, without opening the object.  In native order,
+     *  compact attributes are read straight from the object header.
+     */
+    if(order == H5_ITER_NATIVE) {
+        if(H5O_attr_iterate_native(obj_loc.oloc, H5AC_ind_dxpl_id, idx_type, H5A_read_all_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+    } /* end if */
+    else {
+        H5A_attr_iter_op_t attr_op;     /* Attribute operator */
+
+        attr_op.op_type = H5A_ATTR_OP_LIB;
+        attr_op.u.lib_op = H5A_read_all_cb;
+        if(H5O_attr_iterate_real((hid_t)-1, obj_loc.oloc, H5AC_ind_dxpl_id, idx_type, order, (hsize_t)0, NULL, &attr_op, &udata) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_READERROR, FAIL, "unable to read attributes")
+    } /* end else */
+
+    /* Set the return values */
+    *buf_size = udata.buf_used;
+    ret_value = (ssize_t)udata.nattrs;
+
+done:
+    /* Release resources */
+    if(loc_found && H5G_loc_free(&obj_loc) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTRELEASE, FAIL, "can't free location")
+
+    FUNC_LEAVE_API(ret_value)
+} /* H5Aread_all() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5A_read_all_cb
+ *
+ * Purpose:	Describe one attribute for H5Aread_all() and pack its name
+ *              and values into the caller's buffer, if they fit.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5A_read_all_cb(const H5A_t *attr, void *_udata)
+{
+    H5A_read_all_ud_t *udata = (H5A_read_all_ud_t *)_udata;   /* User data */
+    H5A_packed_t *entry = NULL;         /* Entry for attribute */
+    H5T_t *mem_type = NULL;             /* Memory datatype for values */
+    char **vl_strs = NULL;              /* Variable-length strings read */
+    H5T_class_t type_class;             /* Class of attribute's datatype */
+    hssize_t snelmts;                   /* Elements in attribute */
+    size_t nelmts;                      /* Elements in attribute */
+    size_t elmt_size;                   /* Size of each element in memory */
+    size_t name_size;                   /* Size of name, with terminator */
+    size_t data_size = 0;               /* Size of values in memory */
+    size_t str_size = 0;                /* Size of variable-length strings */
+    size_t align;                       /* Alignment of values */
+    size_t data_off;                    /* Offset of values in buffer */
+    size_t end_off;                     /* Offset just past attribute in buffer */
+    hbool_t fits;                       /* Whether attribute fits in buffer */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = H5_ITER_CONT;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* check arguments */
+    HDassert(attr);
+    HDassert(udata);
+
+    /* Get the size of the attribute */
+    if((snelmts = H5S_GET_EXTENT_NPOINTS(attr->shared->ds)) < 0)
+        HGOTO_ERROR(H5E_ATTR, H5E_CANTCOUNT, H5_ITER_ERROR, "dataspace is invalid")
+    H5_ASSIGN_OVERFLOW(nelmts, snelmts, hssize_t, size_t);
+    if(H5T_NO_CLASS == (type_class = H5T_get_class(attr->shared->dt, FALSE)))
+        HGOTO_ERROR(H5E_ATTR, H5E_BADTYPE, H5_ITER_ERROR, "invalid datatype class")
+
+    /* Pick the memory datatype, for the classes that are read here */
+    if(type_class == H5T_INTEGER || type_class == H5T_FLOAT || type_class == H5T_STRING) {
+        if(NULL == (mem_type = H5T_get_native_type(attr->shared->dt, H5T_DIR_ASCEND, NULL, NULL, NULL)))
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, H5_ITER_ERROR, "can't get native datatype")
+        elmt_size = H5T_GET_SIZE(mem_type);
+        data_size = nelmts * elmt_size;
+    } /* end if */
+    else
+        elmt_size = H5T_GET_SIZE(attr->shared->dt);
+
+    /* Read variable-length strings up front, to learn their size */
+    if(data_size > 0 && H5T_is_variable_str(mem_type)) {
+        if(NULL == (vl_strs = (char **)H5MM_calloc(nelmts * sizeof(char *))))
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTALLOC, H5_ITER_ERROR, "memory allocation failed")
+
+        /* Mark datatype as being on disk, so the strings can be found */
+        if(H5T_set_loc(attr->shared->dt, udata->f, H5T_LOC_DISK) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTINIT, H5_ITER_ERROR, "invalid datatype location")
+        if(attr->shared->data && H5A_read(attr, mem_type, vl_strs, udata->dxpl_id) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_READERROR, H5_ITER_ERROR, "unable to read attribute")
+        for(u = 0; u < nelmts; u++)
+            if(vl_strs[u])
+                str_size += HDstrlen(vl_strs[u]) + 1;
+    } /* end if */
+
+    /* Lay out the name, then the values at their natural alignment */
+    name_size = HDstrlen(attr->shared->name) + 1;
+    for(align = 1; align < H5A_PACKED_ALIGN && (elmt_size % (align * 2)) == 0; align *= 2)
+        ;
+    data_off = udata->buf_used + name_size;
+    if(data_size > 0)
+        data_off += (align - (data_off % align)) % align;
+    end_off = data_off + data_size + str_size;
+    fits = (hbool_t)(end_off <= udata->buf_size);
+
+    /* Describe the attribute, if there's an entry for it */
+    if(udata->nattrs < udata->nentries) {
+        entry = &udata->entries[udata->nattrs];
+        entry->name = NULL;
+        entry->type_class = type_class;
+        entry->sign = (type_class == H5T_INTEGER ? H5T_get_sign(mem_type) : H5T_SGN_ERROR);
+        entry->type_size = elmt_size;
+        entry->is_vl_str = (hbool_t)(vl_strs != NULL);
+        entry->nelmts = (hsize_t)nelmts;
+        entry->data = NULL;
+    } /* end if */
+
+    /* Pack the name and values */
+    if(fits) {
+        HDmemcpy(udata->buf + udata->buf_used, attr->shared->name, name_size);
+        if(entry)
+            entry->name = (const char *)(udata->buf + udata->buf_used);
+
+        if(data_size > 0) {
+            uint8_t *data = udata->buf + data_off;      /* Values in buffer */
+
+            if(vl_strs) {
+                char **strs = (char **)data;            /* String pointers in buffer */
+                char *str = (char *)(data + data_size); /* Strings in buffer */
+
+                for(u = 0; u < nelmts; u++)
+                    if(vl_strs[u]) {
+                        size_t len = HDstrlen(vl_strs[u]) + 1;
+
+                        HDmemcpy(str, vl_strs[u], len);
+                        strs[u] = str;
+                        str += len;
+                    } /* end if */
+                    else
+                        strs[u] = NULL;
+            } /* end if */
+            else if(!attr->shared->data)
+                HDmemset(data, 0, data_size);
+            else if(H5A_read(attr, mem_type, data, udata->dxpl_id) < 0)
+                HGOTO_ERROR(H5E_ATTR, H5E_READERROR, H5_ITER_ERROR, "unable to read attribute")
+
+            if(entry)
+                entry->data = data;
+        } /* end if */
+    } /* end if */
+
+    /* Advance past the attribute */
+    udata->buf_used = end_off;
+    udata->nattrs++;
+
+done:
+    /* Release resources */
+    if(vl_strs) {
+        for(u = 0; u < nelmts; u++)
+            H5MM_xfree(vl_strs[u]);
+        H5MM_xfree(vl_strs);
+    } /* end if */
+    if(mem_type && H5T_close(mem_type) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CLOSEERROR, H5_ITER_ERROR, "unable to release datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5A_read_all_cb() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -1749,6 +1749,36 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_dump_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_iterate
+ *
+ * Purpose:     Wrapper function for H5C_iterate().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_iterate(const H5F_t *f, H5AC_iterate_func_t op, void *udata)
+{
+    herr_t              ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+
+    if ( H5C_iterate(f->shared->cache, op, udata) < 0 ) {
+
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTNEXT, FAIL, "H5C_iterate() failed.")
+    }
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_iterate() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_get_cache_auto_resize_config
@@ -125,6 +125,7 @@ typedef H5C_flush_func_t	H5AC_flush_func_t;
 typedef H5C_dest_func_t		H5AC_dest_func_t;
 typedef H5C_clear_func_t	H5AC_clear_func_t;
 typedef H5C_size_func_t		H5AC_size_func_t;
+typedef H5C_iterate_func_t	H5AC_iterate_func_t;
 
 typedef H5C_class_t			H5AC_class_t;
 
@@ -275,6 +276,14 @@ extern hid_t H5AC_ind_dxpl_id;
 }
 #endif /* H5_HAVE_PARALLEL */
 
+/* Default cache image configuration. */
+
+#define H5AC__DEFAULT_CACHE_IMAGE_CONFIG                                      \
+{                                                                             \
+  /* int         version                = */ H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION, \
+  /* hbool_t     generate_image         = */ FALSE                            \
+}
+
 
 /*
  * Library prototypes.
@@ -346,6 +355,9 @@ H5_DLL herr_t H5AC_stats(const H5F_t *f);
 
 H5_DLL herr_t H5AC_dump_cache(const H5F_t *f);
 
+H5_DLL herr_t H5AC_iterate(const H5F_t *f, H5AC_iterate_func_t op,
+                           void *udata);
+
 H5_DLL herr_t H5AC_get_cache_auto_resize_config(const H5AC_t * cache_ptr,
                                                H5AC_cache_config_t *config_ptr);
 
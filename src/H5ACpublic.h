@@ -502,6 +502,47 @@ typedef struct H5AC_cache_config_t
 } H5AC_cache_config_t;
 
 
+/****************************************************************************
+ *
+ * structure H5AC_cache_image_config_t
+ *
+ * H5AC_cache_image_config_t is a public structure intended for use in
+ * public APIs.  At least in its initial incarnation, it is a copy of
+ * the configuration used to control metadata cache images.  When a file
+ * is closed with a cache image enabled, the extents of the metadata in
+ * the metadata cache are recorded in a file next to it, and on the next open of
+ * the file that metadata is read back with a few large I/Os instead of
+ * entry by entry.
+ *
+ * The fields of the structure are discussed individually below:
+ *
+ * version: Integer field containing the version number of this version
+ *      of the H5AC_cache_image_config_t structure.  Any instance of
+ *      H5AC_cache_image_config_t passed to the cache must have a known
+ *      version number, or an error will be flagged.
+ *
+ * generate_image: Boolean flag indicating whether a cache image should
+ *      be recorded when the file is closed.  An image is stored in a
+ *      separate file, named after the HDF5 file with ".mdci" appended,
+ *      and is not part of the HDF5 file format.  Images are only looked
+ *      for when a file is opened or created with this flag set: an image
+ *      found on open is used, and is removed when the file is opened with
+ *      write access; one found on create is removed.  Images are only
+ *      kept for files opened with the sec2, stdio, log, io_uring or mmap
+ *      file drivers, which store the file as one file under its name;
+ *      the flag has no effect with other drivers.
+ *
+ ****************************************************************************/
+
+#define H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION 	1
+
+typedef struct H5AC_cache_image_config_t
+{
+    int                      version;
+    hbool_t                  generate_image;
+} H5AC_cache_image_config_t;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -83,6 +83,8 @@ H5_DLL herr_t H5O_attr_iterate_real(hid_t loc_id, const H5O_loc_t *loc,
 H5_DLL herr_t H5O_attr_iterate(hid_t loc_id, hid_t dxpl_id, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t skip, hsize_t *last_attr,
     const H5A_attr_iter_op_t *op, void *op_data);
+H5_DLL herr_t H5O_attr_iterate_native(const H5O_loc_t *loc, hid_t dxpl_id,
+    H5_index_t idx_type, H5A_lib_iterate_t op, void *op_data);
 
 #endif /* _H5Aprivate_H */
 
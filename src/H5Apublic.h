@@ -40,6 +40,17 @@ typedef struct {
 typedef herr_t (*H5A_operator2_t)(hid_t location_id/*in*/,
     const char *attr_name/*in*/, const H5A_info_t *ainfo/*in*/, void *op_data/*in,out*/);
 
+/* Description of one attribute read by H5Aread_all() */
+typedef struct {
+    const char          *name;          /* Attribute name, in the buffer  */
+    H5T_class_t         type_class;     /* Class of attribute's datatype  */
+    H5T_sign_t          sign;           /* Sign of integer values         */
+    size_t              type_size;      /* Size of each element in memory */
+    hbool_t             is_vl_str;      /* Elements are "char *" strings  */
+    hsize_t             nelmts;         /* Number of elements             */
+    const void          *data;          /* Elements, in the buffer        */
+} H5A_packed_t;
+
 /* Public function prototypes */
 H5_DLL hid_t   H5Acreate2(hid_t loc_id, const char *attr_name, hid_t type_id,
     hid_t space_id, hid_t acpl_id, hid_t aapl_id);
@@ -53,6 +64,9 @@ H5_DLL hid_t   H5Aopen_by_idx(hid_t loc_id, const char *obj_name,
     hid_t lapl_id);
 H5_DLL herr_t  H5Awrite(hid_t attr_id, hid_t type_id, const void *buf);
 H5_DLL herr_t  H5Aread(hid_t attr_id, hid_t type_id, void *buf);
+H5_DLL ssize_t H5Aread_all(hid_t loc_id, const char *obj_name,
+    H5_index_t idx_type, H5_iter_order_t order, size_t nentries,
+    H5A_packed_t entries[], size_t *buf_size, void *buf, hid_t lapl_id);
 H5_DLL herr_t  H5Aclose(hid_t attr_id);
 H5_DLL hid_t   H5Aget_space(hid_t attr_id);
 H5_DLL hid_t   H5Aget_type(hid_t attr_id);
@@ -315,6 +315,68 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_load
+ *
+ * Purpose:	Fills an empty B-tree with NREC records in one pass, instead
+ *		of inserting them one at a time.
+ *
+ *		The OP callback is called with the index of each record in
+ *		turn and must fill in UDATA for it, as for H5B2_insert().  The
+ *		records must be in strictly increasing order.
+ *
+ *		Nodes below the root are filled to FILL_PERCENT of their
+ *		capacity (limited by the split & merge thresholds), so a value
+ *		below 100 leaves room for later insertions without splits.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_bulk_load(H5B2_t *bt2, hid_t dxpl_id, hsize_t nrec, unsigned fill_percent,
+    H5B2_bulk_t op, void *udata)
+{
+    H5B2_hdr_t	*hdr;                   /* Pointer to the B-tree header */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments. */
+    HDassert(bt2);
+    HDassert(op);
+    HDassert(udata);
+
+    if(fill_percent == 0 || fill_percent > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "fill percent must be between 1 and 100")
+
+    /* Set the shared v2 B-tree header's file context for this operation */
+    bt2->hdr->f = bt2->f;
+
+    /* Get the v2 B-tree header */
+    hdr = bt2->hdr;
+
+    /* Only an empty B-tree can be bulk-loaded */
+    if(H5F_addr_defined(hdr->root.addr))
+        HGOTO_ERROR(H5E_BTREE, H5E_EXISTS, FAIL, "B-tree is not empty")
+
+    /* Nothing to do for no records */
+    if(nrec == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Build the B-tree nodes */
+    if(H5B2_bulk_build(hdr, dxpl_id, nrec, fill_percent, op, udata) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to bulk-load records into B-tree")
+
+    /* Mark B-tree header as dirty */
+    if(H5B2_hdr_dirty(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTMARKDIRTY, FAIL, "unable to mark B-tree header dirty")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5B2_bulk_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2_get_addr
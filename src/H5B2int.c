@@ -37,6 +37,7 @@
 #include "H5B2pkg.h"		/* v2 B-trees				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5MFprivate.h"	/* File memory management		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Vprivate.h"		/* Vectors and arrays 			*/
 
 /****************/
@@ -46,10 +47,33 @@
 /* Uncomment this macro to enable extra sanity checking */
 /* #define H5B2_DEBUG */
 
+/* Max. depth of a bulk-loaded B-tree (each level at least doubles the
+ *  number of leaves, so this covers any number of records)
+ */
+#define H5B2_BULK_MAX_DEPTH     64
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Information for bulk-loading records into a B-tree */
+typedef struct H5B2_bulk_info_t {
+    H5B2_bulk_t op;             /* Callback to retrieve records */
+    void *udata;                /* User data for callback */
+    hsize_t next;               /* Index of next record to retrieve */
+    unsigned leaf_nrec;         /* # of records in smaller leaves */
+    unsigned leaf_extra;        /* # of leaves with one more record */
+    hsize_t next_leaf;          /* Index of next leaf to create */
+
+    /* Limits for non-root nodes at each depth */
+    unsigned lo_nrec[H5B2_BULK_MAX_DEPTH];      /* Min. # of records in node */
+    unsigned fill_nrec[H5B2_BULK_MAX_DEPTH];    /* Target # of records in node */
+    unsigned hi_nrec[H5B2_BULK_MAX_DEPTH];      /* Max. # of records in node */
+    hsize_t lo_leaves[H5B2_BULK_MAX_DEPTH];     /* Min. # of leaves below node */
+    hsize_t fill_leaves[H5B2_BULK_MAX_DEPTH];   /* Target # of leaves below node */
+    hsize_t hi_leaves[H5B2_BULK_MAX_DEPTH];     /* Max. # of leaves below node */
+} H5B2_bulk_info_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -61,6 +85,19 @@
 /********************/
 
 /* Helper functions */
+static herr_t H5B2_add_depth(H5B2_hdr_t *hdr);
+static hsize_t H5B2_bulk_mult(hsize_t a, hsize_t b);
+static void H5B2_bulk_level(const H5B2_hdr_t *hdr, H5B2_bulk_info_t *info,
+    unsigned fill_percent, unsigned depth);
+static herr_t H5B2_bulk_nchild(const H5B2_bulk_info_t *info, unsigned depth,
+    hsize_t nleaves, hbool_t is_root, unsigned *nchild);
+static herr_t H5B2_bulk_check(const H5B2_bulk_info_t *info, unsigned depth,
+    hsize_t nleaves, hbool_t is_root);
+static herr_t H5B2_bulk_next(const H5B2_hdr_t *hdr, H5B2_bulk_info_t *info,
+    void *native);
+static herr_t H5B2_bulk_node(H5B2_hdr_t *hdr, hid_t dxpl_id,
+    H5B2_bulk_info_t *info, unsigned depth, hsize_t nleaves, hbool_t is_root,
+    H5B2_node_ptr_t *node_ptr);
 static herr_t H5B2_create_internal(H5B2_hdr_t *hdr, hid_t dxpl_id,
     H5B2_node_ptr_t *node_ptr, unsigned depth);
 static herr_t H5B2_split1(H5B2_hdr_t *hdr, hid_t dxpl_id, unsigned depth,
@@ -345,25 +382,20 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5B2_split_root
+ * Function:	H5B2_add_depth
  *
- * Purpose:	Split the root node
+ * Purpose:	Increase the depth of the B-tree by one level and set up the
+ *		node info for the new level.  The caller is responsible for
+ *		creating the new root node.
  *
  * Return:	Success:	Non-negative
  *		Failure:	Negative
  *
- * Programmer:	Quincey Koziol
- *		koziol@ncsa.uiuc.edu
- *		Feb  3 2005
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5B2_split_root(H5B2_hdr_t *hdr, hid_t dxpl_id)
+static herr_t
+H5B2_add_depth(H5B2_hdr_t *hdr)
 {
-    H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
-    unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
-    H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
     size_t sz_max_nrec;                 /* Temporary variable for range checking */
     unsigned u_max_nrec_size;           /* Temporary variable for range checking */
     herr_t ret_value = SUCCEED;         /* Return value */
@@ -394,6 +426,42 @@ H5B2_split_root(H5B2_hdr_t *hdr, hid_t dxpl_id)
     if(NULL == (hdr->node_info[hdr->depth].node_ptr_fac = H5FL_fac_init(sizeof(H5B2_node_ptr_t) * (hdr->node_info[hdr->depth].max_nrec + 1))))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't create internal 'branch' node node pointer block factory")
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_add_depth() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_split_root
+ *
+ * Purpose:	Split the root node
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ * Programmer:	Quincey Koziol
+ *		koziol@ncsa.uiuc.edu
+ *		Feb  3 2005
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_split_root(H5B2_hdr_t *hdr, hid_t dxpl_id)
+{
+    H5B2_internal_t *new_root = NULL;   /* Pointer to new root node */
+    unsigned new_root_flags = H5AC__NO_FLAGS_SET;   /* Cache flags for new root node */
+    H5B2_node_ptr_t old_root_ptr;       /* Old node pointer to root node in B-tree */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments. */
+    HDassert(hdr);
+
+    /* Add a level to the B-tree */
+    if(H5B2_add_depth(hdr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to increase depth of B-tree")
+
     /* Keep old root node pointer info */
     old_root_ptr = hdr->root;
 
@@ -2980,6 +3048,411 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5B2_node_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_mult
+ *
+ * Purpose:	Multiply two counts, saturating instead of overflowing.
+ *
+ * Return:	Product (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5B2_bulk_mult(hsize_t a, hsize_t b)
+{
+    hsize_t ret_value;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(a > 0 && b > HSIZET_MAX / a)
+        ret_value = HSIZET_MAX;
+    else
+        ret_value = a * b;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_bulk_mult() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_level
+ *
+ * Purpose:	Compute the minimum, target and maximum number of records
+ *		for non-root nodes at a depth of the B-tree, and the number
+ *		of leaves below such nodes.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5B2_bulk_level(const H5B2_hdr_t *hdr, H5B2_bulk_info_t *info,
+    unsigned fill_percent, unsigned depth)
+{
+    const H5B2_node_info_t *node_info = &hdr->node_info[depth]; /* Node info for this depth */
+    unsigned fill_nrec;                 /* # of records to fill nodes to */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check arguments. */
+    HDassert(depth < H5B2_BULK_MAX_DEPTH);
+
+    /* Nodes must not be small enough to merge or large enough to split on
+     *  the next removal or insertion that reaches them.
+     */
+    info->lo_nrec[depth] = MAX(node_info->merge_nrec, 1);
+    info->hi_nrec[depth] = node_info->split_nrec;
+    fill_nrec = (node_info->max_nrec * fill_percent) / 100;
+    info->fill_nrec[depth] = MIN(MAX(fill_nrec, info->lo_nrec[depth]), info->hi_nrec[depth]);
+
+    /* Compute # of leaves below nodes at this depth */
+    if(depth == 0) {
+        info->lo_leaves[0] = 1;
+        info->fill_leaves[0] = 1;
+        info->hi_leaves[0] = 1;
+    } /* end if */
+    else {
+        info->lo_leaves[depth] = H5B2_bulk_mult((hsize_t)info->lo_nrec[depth] + 1, info->lo_leaves[depth - 1]);
+        info->fill_leaves[depth] = H5B2_bulk_mult((hsize_t)info->fill_nrec[depth] + 1, info->fill_leaves[depth - 1]);
+        info->hi_leaves[depth] = H5B2_bulk_mult((hsize_t)info->hi_nrec[depth] + 1, info->hi_leaves[depth - 1]);
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5B2_bulk_level() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_nchild
+ *
+ * Purpose:	Choose the number of children for an internal node with
+ *		NLEAVES leaves below it, as close to the fill target as the
+ *		node size limits of this depth and the ones below allow.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2_bulk_nchild(const H5B2_bulk_info_t *info, unsigned depth, hsize_t nleaves,
+    hbool_t is_root, unsigned *nchild)
+{
+    hsize_t lo, hi;                     /* Range of # of children allowed */
+    hsize_t child_leaves;               /* # of leaves below a child */
+    hsize_t pref;                       /* Preferred # of children */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments. */
+    HDassert(info);
+    HDassert(depth > 0);
+    HDassert(nchild);
+
+    /* Limits from the number of records allowed in this node */
+    lo = is_root ? 2 : (hsize_t)info->lo_nrec[depth] + 1;
+    hi = (hsize_t)info->hi_nrec[depth] + 1;
+
+    /* Limits from the number of leaves allowed below each child */
+    child_leaves = info->hi_leaves[depth - 1];
+    lo = MAX(lo, (nleaves / child_leaves) + ((nleaves % child_leaves) ? 1 : 0));
+    hi = MIN(hi, nleaves / info->lo_leaves[depth - 1]);
+    if(lo > hi)
+        HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't distribute leaves among child nodes")
+
+    /* Use as few children as possible while filling them to the target */
+    child_leaves = info->fill_leaves[depth - 1];
+    pref = (nleaves / child_leaves) + ((nleaves % child_leaves) ? 1 : 0);
+    H5_ASSIGN_OVERFLOW(/* To: */ *nchild, /* From: */ MIN(MAX(pref, lo), hi), /* From: */ hsize_t, /* To: */ unsigned)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_bulk_nchild() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_check
+ *
+ * Purpose:	Verify that NLEAVES leaves can be spread over a subtree
+ *		rooted at DEPTH, without building it.
+ *
+ * Note:	Children of a node differ by at most one leaf, so only two
+ *		child sizes need to be checked at each level.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2_bulk_check(const H5B2_bulk_info_t *info, unsigned depth, hsize_t nleaves,
+    hbool_t is_root)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments. */
+    HDassert(info);
+
+    if(depth > 0) {
+        unsigned nchild;                /* # of children for node */
+        hsize_t child_leaves;           /* # of leaves below smaller children */
+
+        if(H5B2_bulk_nchild(info, depth, nleaves, is_root, &nchild) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't determine number of child nodes")
+        child_leaves = nleaves / nchild;
+
+        if(H5B2_bulk_check(info, depth - 1, child_leaves, FALSE) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't distribute leaves among child nodes")
+        if(nleaves % nchild)
+            if(H5B2_bulk_check(info, depth - 1, child_leaves + 1, FALSE) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't distribute leaves among child nodes")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_bulk_check() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_next
+ *
+ * Purpose:	Retrieve the next record from the application and store it
+ *		in native form.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2_bulk_next(const H5B2_hdr_t *hdr, H5B2_bulk_info_t *info, void *native)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(info);
+    HDassert(native);
+
+    if((info->op)(info->next, info->udata) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CALLBACK, FAIL, "can't retrieve record")
+    if((hdr->cls->store)(native, info->udata) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to store record")
+    info->next++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_bulk_next() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_node
+ *
+ * Purpose:	Create a node at DEPTH with the next NLEAVES leaves below it,
+ *		creating its children recursively.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5B2_bulk_node(H5B2_hdr_t *hdr, hid_t dxpl_id, H5B2_bulk_info_t *info,
+    unsigned depth, hsize_t nleaves, hbool_t is_root, H5B2_node_ptr_t *node_ptr)
+{
+    H5B2_leaf_t *leaf = NULL;           /* Pointer to leaf node */
+    H5B2_internal_t *internal = NULL;   /* Pointer to internal node */
+    hsize_t first = info->next;         /* Index of first record below node */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(info);
+    HDassert(node_ptr);
+
+    if(depth == 0) {
+        unsigned nrec;                  /* # of records in leaf */
+        unsigned u;                     /* Local index variable */
+
+        /* Leaves differ by at most one record */
+        HDassert(nleaves == 1);
+        nrec = info->leaf_nrec + (info->next_leaf < info->leaf_extra ? 1 : 0);
+        info->next_leaf++;
+
+        /* Create & protect new leaf node */
+        if(H5B2_create_leaf(hdr, dxpl_id, node_ptr) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create new leaf node")
+        if(NULL == (leaf = H5B2_protect_leaf(hdr, dxpl_id, node_ptr->addr, 0, H5AC_WRITE)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree leaf node")
+
+        /* Fill leaf with records */
+        for(u = 0; u < nrec; u++)
+            if(H5B2_bulk_next(hdr, info, H5B2_LEAF_NREC(leaf, hdr, u)) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to add record to leaf node")
+        leaf->nrec = (uint16_t)nrec;
+        node_ptr->node_nrec = (uint16_t)nrec;
+    } /* end if */
+    else {
+        unsigned nchild;                /* # of children for node */
+        hsize_t child_leaves;           /* # of leaves below smaller children */
+        unsigned extra;                 /* # of children with one more leaf */
+        unsigned u;                     /* Local index variable */
+
+        /* Decide how to split the leaves among the children */
+        if(H5B2_bulk_nchild(info, depth, nleaves, is_root, &nchild) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't determine number of child nodes")
+        child_leaves = nleaves / nchild;
+        extra = (unsigned)(nleaves % nchild);
+
+        /* Create & protect new internal node */
+        if(H5B2_create_internal(hdr, dxpl_id, node_ptr, depth) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create new internal node")
+        if(NULL == (internal = H5B2_protect_internal(hdr, dxpl_id, node_ptr->addr, 0, depth, H5AC_WRITE)))
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTPROTECT, FAIL, "unable to protect B-tree internal node")
+
+        /* Build children, with a record from the stream between each pair */
+        for(u = 0; u < nchild; u++) {
+            if(H5B2_bulk_node(hdr, dxpl_id, info, depth - 1, child_leaves + (u < extra ? 1 : 0), FALSE, &(internal->node_ptrs[u])) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to create child node")
+            if(u < (nchild - 1))
+                if(H5B2_bulk_next(hdr, info, H5B2_INT_NREC(internal, hdr, u)) < 0)
+                    HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to add record to internal node")
+        } /* end for */
+        internal->nrec = (uint16_t)(nchild - 1);
+        node_ptr->node_nrec = (uint16_t)(nchild - 1);
+    } /* end else */
+    node_ptr->all_nrec = info->next - first;
+
+done:
+    if(leaf && H5AC_unprotect(hdr->f, dxpl_id, H5AC_BT2_LEAF, node_ptr->addr, leaf, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree leaf node")
+    if(internal && H5AC_unprotect(hdr->f, dxpl_id, H5AC_BT2_INT, node_ptr->addr, internal, H5AC__DIRTIED_FLAG) < 0)
+        HDONE_ERROR(H5E_BTREE, H5E_CANTUNPROTECT, FAIL, "unable to release B-tree internal node")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_bulk_node() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_bulk_build
+ *
+ * Purpose:	Build an empty B-tree from NREC records that the OP callback
+ *		supplies in increasing order, filling nodes to FILL_PERCENT
+ *		of their capacity.
+ *
+ *		The tree uses as few leaves as the fill target allows, with
+ *		the records spread evenly over them, and the leaves spread
+ *		evenly over the internal nodes above them.  The records are
+ *		checked for order before anything is allocated, so a bad
+ *		stream leaves the B-tree empty.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_bulk_build(H5B2_hdr_t *hdr, hid_t dxpl_id, hsize_t nrec,
+    unsigned fill_percent, H5B2_bulk_t op, void *udata)
+{
+    H5B2_bulk_info_t info;              /* Bulk-load info */
+    H5B2_node_ptr_t root_ptr;           /* Node pointer for new root node */
+    hsize_t nleaves;                    /* # of leaves in B-tree */
+    hsize_t leaf_nrec;                  /* # of records in smaller leaves */
+    void *prev = NULL;                  /* Previous record, in native form */
+    hsize_t u;                          /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments. */
+    HDassert(hdr);
+    HDassert(!H5F_addr_defined(hdr->root.addr));
+    HDassert(hdr->depth == 0);
+    HDassert(nrec > 0 && nrec < HSIZET_MAX);
+    HDassert(fill_percent > 0 && fill_percent <= 100);
+    HDassert(op);
+
+    /* Check that the records are in increasing order */
+    if(NULL == (prev = H5MM_malloc(hdr->cls->nrec_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    for(u = 0; u < nrec; u++) {
+        if((op)(u, udata) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CALLBACK, FAIL, "can't retrieve record")
+        if(u > 0 && (hdr->cls->compare)(udata, prev) <= 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADVALUE, FAIL, "records not in increasing order")
+        if((hdr->cls->store)(prev, udata) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_CANTINSERT, FAIL, "unable to store record")
+    } /* end for */
+
+    /* Set up info for bulk-loading */
+    HDmemset(&info, 0, sizeof(info));
+    info.op = op;
+    info.udata = udata;
+    H5B2_bulk_level(hdr, &info, fill_percent, 0);
+
+    /* Use the root node as the only leaf, if possible */
+    if(nrec <= info.hi_nrec[0]) {
+        nleaves = 1;
+        leaf_nrec = nrec;
+    } /* end if */
+    else {
+        /* Use as few leaves as possible, each separated by a record in an
+         *  internal node, and spread the records evenly over them.
+         */
+        nleaves = (nrec / ((hsize_t)info.fill_nrec[0] + 1)) + 1;
+        leaf_nrec = (nrec - (nleaves - 1)) / nleaves;
+        H5_ASSIGN_OVERFLOW(/* To: */ info.leaf_extra, /* From: */ (nrec - (nleaves - 1)) % nleaves, /* From: */ hsize_t, /* To: */ unsigned)
+        if(leaf_nrec < info.lo_nrec[0])
+            HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't distribute records among leaf nodes")
+
+        /* Add levels until the root node can hold the leaves, with the nodes
+         *  below it filled to the target.
+         */
+        do {
+            if((unsigned)hdr->depth + 1 >= H5B2_BULK_MAX_DEPTH)
+                HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "too many records for B-tree")
+            if(H5B2_add_depth(hdr) < 0)
+                HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to increase depth of B-tree")
+            H5B2_bulk_level(hdr, &info, fill_percent, hdr->depth);
+        } while(nleaves > H5B2_bulk_mult((hsize_t)info.hi_nrec[hdr->depth] + 1, info.fill_leaves[hdr->depth - 1]));
+        if(H5B2_bulk_check(&info, hdr->depth, nleaves, TRUE) < 0)
+            HGOTO_ERROR(H5E_BTREE, H5E_BADRANGE, FAIL, "can't distribute leaves among B-tree nodes")
+    } /* end else */
+    H5_ASSIGN_OVERFLOW(/* To: */ info.leaf_nrec, /* From: */ leaf_nrec, /* From: */ hsize_t, /* To: */ unsigned)
+    HDassert(info.leaf_nrec + (info.leaf_extra ? 1 : 0) <= info.hi_nrec[0]);
+
+    /* Build the nodes */
+    if(H5B2_bulk_node(hdr, dxpl_id, &info, hdr->depth, nleaves, TRUE, &root_ptr) < 0)
+        HGOTO_ERROR(H5E_BTREE, H5E_CANTINIT, FAIL, "unable to build B-tree nodes")
+    HDassert(info.next == nrec);
+    hdr->root = root_ptr;
+
+done:
+    if(prev)
+        prev = H5MM_xfree(prev);
+
+    /* Drop any levels added for a failed build */
+    if(ret_value < 0 && !H5F_addr_defined(hdr->root.addr))
+        while(hdr->depth > 0) {
+            if(hdr->node_info[hdr->depth].nat_rec_fac)
+                if(H5FL_fac_term(hdr->node_info[hdr->depth].nat_rec_fac) < 0)
+                    HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't destroy node's native record block factory")
+            if(hdr->node_info[hdr->depth].node_ptr_fac)
+                if(H5FL_fac_term(hdr->node_info[hdr->depth].node_ptr_fac) < 0)
+                    HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't destroy node's node pointer block factory")
+            hdr->depth--;
+        } /* end while */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5B2_bulk_build() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2_internal_free
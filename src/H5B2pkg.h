@@ -295,6 +295,8 @@ H5_DLL H5B2_internal_t *H5B2_protect_internal(H5B2_hdr_t *hdr, hid_t dxpl_id,
 H5_DLL herr_t H5B2_split_root(H5B2_hdr_t *hdr, hid_t dxpl_id);
 H5_DLL herr_t H5B2_create_leaf(H5B2_hdr_t *hdr, hid_t dxpl_id,
     H5B2_node_ptr_t *node_ptr);
+H5_DLL herr_t H5B2_bulk_build(H5B2_hdr_t *hdr, hid_t dxpl_id, hsize_t nrec,
+    unsigned fill_percent, H5B2_bulk_t op, void *udata);
 
 /* Routines for releasing structures */
 H5_DLL herr_t H5B2_hdr_free(H5B2_hdr_t *hdr);
@@ -69,6 +69,12 @@ typedef herr_t (*H5B2_modify_t)(void *record, void *op_data, hbool_t *changed);
 /* Define the 'remove' callback function pointer for H5B2_remove() & H5B2_delete() */
 typedef herr_t (*H5B2_remove_t)(const void *record, void *op_data);
 
+/* Define the 'bulk' callback function pointer for H5B2_bulk_load() */
+/* (fills in the user data for the idx'th record, in the form taken by the
+ *  class 'store' callback)
+ */
+typedef herr_t (*H5B2_bulk_t)(hsize_t idx, void *udata);
+
 /* Comparisons for H5B2_neighbor() call */
 typedef enum H5B2_compare_t {
     H5B2_COMPARE_LESS,            /* Records with keys less than query value */
@@ -130,6 +136,8 @@ H5_DLL H5B2_t *H5B2_create(H5F_t *f, hid_t dxpl_id, const H5B2_create_t *cparam,
 H5_DLL H5B2_t *H5B2_open(H5F_t *f, hid_t dxpl_id, haddr_t addr, void *ctx_udata);
 H5_DLL herr_t H5B2_get_addr(const H5B2_t *bt2, haddr_t *addr/*out*/);
 H5_DLL herr_t H5B2_insert(H5B2_t *bt2, hid_t dxpl_id, void *udata);
+H5_DLL herr_t H5B2_bulk_load(H5B2_t *bt2, hid_t dxpl_id, hsize_t nrec,
+    unsigned fill_percent, H5B2_bulk_t op, void *udata);
 H5_DLL herr_t H5B2_iterate(H5B2_t *bt2, hid_t dxpl_id, H5B2_operator_t op,
     void *op_data);
 H5_DLL htri_t H5B2_find(H5B2_t *bt2, hid_t dxpl_id, void *udata,
@@ -2382,6 +2382,71 @@ done:
 
 } /* H5C_get_evictions_enabled() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_iterate()
+ *
+ * Purpose:     Call op for each entry in the cache, passing it the
+ *              address, size and type id of the entry.  Entries are
+ *              visited in hash table order, not address order.
+ *
+ *              Iteration stops early if op returns a non-zero value,
+ *              which is treated as a failure if it is negative.  op
+ *              must not modify the cache.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_iterate(const H5C_t * cache_ptr,
+            H5C_iterate_func_t op,
+            void * udata)
+{
+    int                 i;
+    int                 cb_ret = 0;
+    H5C_cache_entry_t * entry_ptr;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if ( ( cache_ptr == NULL ) || ( cache_ptr->magic != H5C__H5C_T_MAGIC ) ) {
+
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+    }
+
+    if ( op == NULL ) {
+
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad op on entry.")
+    }
+
+    for ( i = 0; ( i < H5C__HASH_TABLE_LEN ) && ( cb_ret == 0 ); i++ ) {
+
+        entry_ptr = cache_ptr->index[i];
+
+        while ( ( entry_ptr != NULL ) && ( cb_ret == 0 ) ) {
+
+            HDassert( entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC );
+
+            cb_ret = op(entry_ptr->addr, entry_ptr->size,
+                        entry_ptr->type->id, udata);
+
+            entry_ptr = entry_ptr->ht_next;
+        }
+    }
+
+    if ( cb_ret < 0 ) {
+
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTNEXT, FAIL, \
+                    "iteration operator failed")
+    }
+
+done:
+
+    FUNC_LEAVE_NOAPI(ret_value)
+
+} /* H5C_iterate() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_get_trace_file_ptr
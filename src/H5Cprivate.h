@@ -174,6 +174,11 @@ typedef herr_t (*H5C_log_flush_func_t)(H5C_t * cache_ptr,
                                        unsigned flags,
                                        int type_id);
 
+typedef int (*H5C_iterate_func_t)(haddr_t addr,
+                                  size_t size,
+                                  int type_id,
+                                  void * udata);
+
 /* Upper and lower limits on cache size.  These limits are picked
  * out of a hat -- you should be able to change them as necessary.
  *
@@ -1064,6 +1069,10 @@ H5_DLL herr_t H5C_get_entry_status(const H5F_t *f,
 H5_DLL herr_t H5C_get_evictions_enabled(const H5C_t * cache_ptr,
                                         hbool_t * evictions_enabled_ptr);
 
+H5_DLL herr_t H5C_iterate(const H5C_t * cache_ptr,
+                          H5C_iterate_func_t op,
+                          void * udata);
+
 H5_DLL herr_t H5C_get_trace_file_ptr(const H5C_t *cache_ptr,
     FILE **trace_file_ptr_ptr);
 H5_DLL herr_t H5C_get_trace_file_ptr_from_entry(const H5C_cache_entry_t *entry_ptr,
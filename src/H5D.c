@@ -766,12 +766,21 @@ H5Dget_access_plist(hid_t dset_id)
 
     /* If the dataset is chunked then copy the rdcc parameters */
     if (dset->shared->layout.type == H5D_CHUNKED) {
-        if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &(dset->shared->cache.chunk.nslots)) < 0)
+        /* (The table itself may have grown past the configured size) */
+        if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME, &(dset->shared->cache.chunk.nslots_conf)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache number of slots")
-        if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &(dset->shared->cache.chunk.nbytes_max)) < 0)
-            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
+        /* (A dataset drawing on the file's shared cache keeps the default) */
+        if (NULL == dset->shared->cache.chunk.pool)
+            if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &(dset->shared->cache.chunk.nbytes_max)) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
         if (H5P_set(new_plist, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &(dset->shared->cache.chunk.w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+        if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_POLICY_NAME, &(dset->shared->cache.chunk.policy)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache eviction policy")
+        if (H5P_set(new_plist, H5D_ACS_DATA_CACHE_PREFETCH_NAME, &(dset->shared->cache.chunk.prefetch.nchunks)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of chunks to read ahead")
+        if (H5P_set(new_plist, H5D_ACS_CHUNK_ADDR_MAP_NAME, &(dset->shared->cache.chunk.addr.load)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk address loading")
     } /* end if */
 
     /* Set the return value */
@@ -1146,3 +1155,195 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dset_extent() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_chunk_cache_stats
+ *
+ * Purpose:	Retrieves the raw data chunk cache statistics for a chunked
+ *		dataset: the number of cache hits, misses, chunk creations,
+ *		flushes and preemptions since the dataset was opened (or
+ *		the statistics were last reset) and the current number of
+ *		chunks and bytes in the cache.
+ *
+ * Return:	Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_cache_stats(hid_t dset_id, H5D_chunk_cache_stats_t *stats/*out*/)
+{
+    H5D_t *dset;                /* Dataset for this operation */
+    const H5D_rdcc_t *rdcc;     /* Dataset's raw data chunk cache */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dset_id, stats);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(!stats)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no stats struct")
+
+    /* Copy the statistics */
+    rdcc = &(dset->shared->cache.chunk);
+    stats->nhits = rdcc->stats.nhits;
+    stats->nmisses = rdcc->stats.nmisses;
+    stats->ninits = rdcc->stats.ninits;
+    stats->nflushes = rdcc->stats.nflushes;
+    stats->nevictions = rdcc->stats.nevicts;
+    stats->nprefetches = rdcc->stats.nprefetches;
+    stats->nused = (size_t)rdcc->nused;
+    stats->nbytes_used = rdcc->nbytes_used;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_cache_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dreset_chunk_cache_stats
+ *
+ * Purpose:	Resets the raw data chunk cache statistics counters of a
+ *		chunked dataset.
+ *
+ * Return:	Non-negative on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dreset_chunk_cache_stats(hid_t dset_id)
+{
+    H5D_t *dset;                /* Dataset for this operation */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", dset_id);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+    /* Reset the counters */
+    HDmemset(&dset->shared->cache.chunk.stats, 0, sizeof(dset->shared->cache.chunk.stats));
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dreset_chunk_cache_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dchunk_iter
+ *
+ * Purpose:	Iterates over the chunks of a chunked dataset that have
+ *		space allocated in the file, in the order of its chunk
+ *		index, calling OP with each chunk's logical offset (in
+ *		elements), filter mask, file address and stored size.
+ *		Chunks waiting in the chunk cache are written to the file
+ *		first, so the addresses and sizes are final.
+ *
+ *		OP returns zero to continue the iteration, a positive
+ *		value to stop it early (which is returned), or a negative
+ *		value to stop it with a failure.
+ *
+ * Return:	Success:	Last value returned by OP (zero if the
+ *				iteration completed)
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dchunk_iter(hid_t dset_id, hid_t dxpl_id, H5D_chunk_iter_op_t op,
+    void *op_data)
+{
+    H5D_t *dset;                /* Dataset for this operation */
+    herr_t ret_value;           /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "iix*x", dset_id, dxpl_id, op, op_data);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(!op)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no operator specified")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Iterate over the chunks */
+    if((ret_value = H5D__chunk_iter(dset, dxpl_id, op, op_data)) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunks")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dchunk_iter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dget_chunk_storage_size
+ *
+ * Purpose:	Returns the size in the file of the chunk at OFFSET in
+ *		CHUNK_NBYTES, as it is stored there (i.e. after the filter
+ *		pipeline).  This is the size of buffer that H5DOread_chunk
+ *		needs for the chunk.  Chunks which have not been written
+ *		have a size of zero.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset,
+    hsize_t *chunk_nbytes/*out*/)
+{
+    H5D_t       *dset;                  /* Dataset for this operation */
+    hsize_t     dims[H5O_LAYOUT_NDIMS]; /* Dataset's dimensions */
+    hsize_t     internal_offset[H5O_LAYOUT_NDIMS];  /* Offset terminated with a zero */
+    int         ndims;                  /* Dataset's rank */
+    int         i;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*hx", dset_id, offset, chunk_nbytes);
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(!offset)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk offset specified")
+    if(!chunk_nbytes)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk size pointer specified")
+
+    /* The library's chunking code requires the offset terminates with a zero */
+    if((ndims = H5S_get_simple_extent_dims(dset->shared->space, dims, NULL)) < 0)
+	HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't retrieve dataspace extent dims")
+    for(i = 0; i < ndims; i++) {
+        if(offset[i] >= dims[i])
+	    HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "offset exceeds dimensions of dataset")
+        if(offset[i] % dset->shared->layout.u.chunk.dim[i])
+	    HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "offset doesn't fall on chunks's boundary")
+        internal_offset[i] = offset[i];
+    } /* end for */
+    internal_offset[ndims] = 0;
+
+    /* Get the size of the chunk */
+    if(H5D__chunk_get_storage_size(dset, H5AC_ind_dxpl_id, internal_offset, chunk_nbytes) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk's storage size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dget_chunk_storage_size() */
+
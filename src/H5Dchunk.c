@@ -97,6 +97,19 @@
 
 /*#define H5D_CHUNK_DEBUG */
 
+/* Number of chunks per thread to filter at once, when running the filter
+ * pipeline on several threads */
+#define H5D_CHUNK_FILTER_BATCH  4
+
+/* Number of cache misses in a row at the same distance from each other,
+ * after the first, before chunks are read ahead */
+#define H5D_CHUNK_PREFETCH_NSEQ 2
+
+/* Number of entries in each data block of a dataset's chunk address table,
+ * and the number of chunks (by linear index) the table covers */
+#define H5D_CHUNK_ADDR_DBLK_NELMTS 256
+#define H5D_CHUNK_ADDR_MAX_NELMTS ((hsize_t)1 << 22)
+
 
 /******************/
 /* Local Typedefs */
@@ -161,6 +174,26 @@ typedef struct H5D_chunk_it_ud4_t {
     unsigned            ndims;                  /* Number of dimensions for chunk/dataset */
 } H5D_chunk_it_ud4_t;
 
+/* Callback info for iteration to load chunk addresses */
+typedef struct H5D_chunk_it_ud5_t {
+    H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
+    const H5D_t         *dset;          /* Dataset whose chunk addresses are loaded */
+} H5D_chunk_it_ud5_t;
+
+/* Callback info for iteration to report chunks to an application */
+typedef struct H5D_chunk_it_ud6_t {
+    H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
+    H5D_chunk_iter_op_t op;             /* Application's operator */
+    void                *op_data;       /* Application's data for operator */
+} H5D_chunk_it_ud6_t;
+
+/* Information about one chunk of a direct chunk read */
+typedef struct H5D_chunk_direct_rd_t {
+    haddr_t     addr;                   /* Address of chunk in file */
+    size_t      nbytes;                 /* Size of chunk in file */
+    void        *buf;                   /* Application's buffer for chunk */
+} H5D_chunk_direct_rd_t;
+
 /* Callback info for nonexistent readvv operation */
 typedef struct H5D_chunk_readvv_ud_t {
     unsigned char *rbuf;        /* Read buffer to initialize */
@@ -168,6 +201,19 @@ typedef struct H5D_chunk_readvv_ud_t {
     hid_t dxpl_id;              /* DXPL for operation */
 } H5D_chunk_readvv_ud_t;
 
+/* Chunk read & unfiltered ahead of time, when filtering with several threads */
+typedef struct H5D_chunk_preread_t {
+    H5D_chunk_ud_t udata;       /* Index info for chunk */
+    void *chunk;                /* Unfiltered chunk, or NULL if not pre-read */
+} H5D_chunk_preread_t;
+
+/* Chunk read into the cache ahead of sequential access */
+typedef struct H5D_chunk_prefetch_t {
+    H5D_chunk_ud_t udata;       /* Index info for chunk */
+    hsize_t offset[H5O_LAYOUT_NDIMS];   /* Chunk's logical offset */
+    hsize_t index;              /* Chunk's index in the dataset */
+} H5D_chunk_prefetch_t;
+
 
 /********************/
 /* Local Prototypes */
@@ -205,18 +251,69 @@ static herr_t H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last,
     const H5D_chunk_ud_t *udata);
 static hbool_t H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last,
     H5D_chunk_ud_t *udata);
+static hbool_t H5D__chunk_addr_index(const H5O_layout_chunk_t *layout,
+    const hsize_t *offset, hsize_t *idx);
+static herr_t H5D__chunk_addr_reset(H5D_rdcc_t *rdcc);
+static herr_t H5D__chunk_addr_update(const H5D_t *dset,
+    const H5D_chunk_ud_t *udata);
+static hbool_t H5D__chunk_addr_found(const H5D_t *dset,
+    H5D_chunk_ud_t *udata);
+static int H5D__chunk_addr_load_cb(const H5D_chunk_rec_t *chunk_rec,
+    void *_udata);
+static herr_t H5D__chunk_addr_load(const H5D_t *dset, hid_t dxpl_id);
+static herr_t H5D__chunk_lookup_index(const H5D_t *dset, hid_t dxpl_id,
+    H5D_chunk_ud_t *udata);
+static herr_t H5D__chunk_direct_lookup(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, const hsize_t *offset,
+    H5D_chunk_ud_t *udata);
+static int H5D__chunk_direct_cmp(const void *_rd1, const void *_rd2);
+static int H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
 static herr_t H5D__free_chunk_info(void *item, void *key, void *opdata);
 static herr_t H5D__create_chunk_map_single(H5D_chunk_map_t *fm,
     const H5D_io_info_t *io_info);
 static herr_t H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm,
     const H5D_io_info_t *io_info);
+static htri_t H5D__create_chunk_file_map_regular(H5D_chunk_map_t *fm,
+    const H5S_hyper_dim_t *fsel);
+static hbool_t H5D__chunk_clip_regular(const H5S_hyper_dim_t *sel,
+    hsize_t lo, hsize_t hi, hsize_t *start, hsize_t *stride, hsize_t *count,
+    hsize_t *block);
+static htri_t H5D__chunk_map_found(H5D_rdcc_t *rdcc, const H5D_chunk_map_t *fm,
+    const H5S_hyper_dim_t *fsel, const hsize_t *m_dims, const hsize_t *m_start);
 static herr_t H5D__create_chunk_mem_map_hyper(const H5D_chunk_map_t *fm);
 static herr_t H5D__chunk_file_cb(void *elem, hid_t type_id, unsigned ndims,
     const hsize_t *coords, void *fm);
 static herr_t H5D__chunk_mem_cb(void *elem, hid_t type_id, unsigned ndims,
     const hsize_t *coords, void *fm);
+static herr_t H5D__chunk_filter_threads(const H5D_t *dset,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t nchunks, unsigned *nthreads);
+static herr_t H5D__chunk_preread(const H5D_io_info_t *io_info,
+    const H5D_chunk_map_t *fm, H5SL_node_t *chunk_node, unsigned nthreads,
+    size_t nbatch, H5D_chunk_preread_t *batch, H5Z_pipeline_job_t *jobs,
+    size_t *nused);
+static hbool_t H5D__chunk_prefetch_note(H5D_rdcc_t *rdcc, hsize_t chunk_idx);
+static herr_t H5D__chunk_prefetch(const H5D_io_info_t *io_info);
+static herr_t H5D__chunk_write_entry(const H5D_t *dset, hid_t dxpl_id,
+    H5D_rdcc_ent_t *ent, H5D_chunk_ud_t *udata, hbool_t must_insert,
+    const void *buf);
 static herr_t H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t reset);
+static herr_t H5D__chunk_flush_entries(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t **ents, size_t nents,
+    hbool_t reset, unsigned nthreads);
+static herr_t H5D__chunk_cache_grow(H5D_rdcc_t *rdcc);
+static void H5D__chunk_cache_unhash(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static void H5D__chunk_cache_touch(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent);
+static H5D_rdcc_ghost_t *H5D__chunk_cache_ghost_find(const H5D_rdcc_t *rdcc,
+    hsize_t chunk_idx);
+static void H5D__chunk_cache_ghost_remove(H5D_rdcc_t *rdcc,
+    H5D_rdcc_ghost_t *ghost);
+static herr_t H5D__chunk_cache_ghost_add(H5D_rdcc_t *rdcc, unsigned list,
+    hsize_t chunk_idx, size_t max_ghosts);
+static void H5D__chunk_cache_ghost_clear(H5D_rdcc_t *rdcc);
+static H5D_rdcc_ent_t *H5D__chunk_cache_victim(const H5D_rdcc_t *rdcc);
+static void H5D__chunk_pool_unlink(H5D_rdcc_t *rdcc);
+static void H5D__chunk_pool_append(H5D_rdcc_t *rdcc);
 static herr_t H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t flush);
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
@@ -275,6 +372,18 @@ H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ent_ptr_t);
 /* Declare a free list to manage H5D_rdcc_ent_t objects */
 H5FL_DEFINE_STATIC(H5D_rdcc_ent_t);
 
+/* Declare a free list to manage the H5D_rdcc_ghost_ptr_t sequence information */
+H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ghost_ptr_t);
+
+/* Declare a free list to manage H5D_rdcc_ghost_t objects */
+H5FL_DEFINE_STATIC(H5D_rdcc_ghost_t);
+
+/* Declare a free list to manage the H5D_rdcc_addr_ptr_t sequence information */
+H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_addr_ptr_t);
+
+/* Declare a free list to manage the H5D_rdcc_addr_t sequence information */
+H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_addr_t);
+
 /* Declare a free list to manage the H5D_chunk_info_t struct */
 H5FL_DEFINE(H5D_chunk_info_t);
 
@@ -304,7 +413,6 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters, hsiz
     hsize_t chunk_idx;
     H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
     H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
-    const H5D_rdcc_t       *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
     int         space_ndims;    /* Dataset's space rank */
     hsize_t     space_dim[H5O_LAYOUT_NDIMS];    /* Dataset's dataspace dimensions */
     herr_t ret_value = SUCCEED; /* Return value */
@@ -360,6 +468,11 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters, hsiz
 	/* Make sure the address of the chunk is returned. */
 	if(!H5F_addr_defined(udata.addr))
 	    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
+
+        /* Cache the new chunk information */
+        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+        if(H5D__chunk_addr_update(dset, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't update chunk address table")
     } /* end if */
 
     /* Fill the DXPL cache values for later use */
@@ -368,9 +481,9 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters, hsiz
 
     /* Evict the entry from the cache if present, but do not flush
      * it to disk */
-    if(UINT_MAX != udata.idx_hint) {
+    if(udata.ent) {
         if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache,
-	    rdcc->slot[udata.idx_hint], FALSE) < 0)
+	    udata.ent, FALSE) < 0)
 	    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
     } /* end if */
 
@@ -383,6 +496,237 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_lookup
+ *
+ * Purpose:	Retrieves the file address, size and filter mask of the
+ *		chunk at OFFSET (terminated with a zero) as it is stored in
+ *		the file.  If the chunk is dirty in the raw data chunk cache
+ *		it is written out first, so that the file holds its current
+ *		contents.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_direct_lookup(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, const hsize_t *offset,
+    H5D_chunk_ud_t *udata)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    hsize_t     chunk_idx;              /* Linear index of the chunk */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(offset);
+    HDassert(udata);
+
+    /* Calculate the index of this chunk */
+    if(H5V_chunk_index(layout->u.chunk.ndims - 1, offset, layout->u.chunk.dim,
+            layout->u.chunk.down_chunks, &chunk_idx) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't get chunk index")
+
+    /* Find out the file address of the chunk */
+    if(H5D__chunk_lookup(dset, dxpl_id, offset, chunk_idx, udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* A cached chunk only carries its address, so write it out if it is
+     * dirty and then get the rest of its information from the index */
+    if(udata->ent) {
+        if(udata->ent->dirty)
+            if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, udata->ent, FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "cannot flush indexed storage buffer")
+
+        udata->ent = NULL;
+        udata->nbytes = 0;
+        udata->filter_mask = 0;
+        udata->addr = HADDR_UNDEF;
+        if(H5D__chunk_lookup_index(dset, dxpl_id, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_cmp
+ *
+ * Purpose:	Compares two chunks of a direct chunk read by their address
+ *		in the file, for sorting.
+ *
+ * Return:	-1, 0 or 1 as the first chunk is before, at or after the
+ *		second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_cmp(const void *_rd1, const void *_rd2)
+{
+    const H5D_chunk_direct_rd_t *rd1 = (const H5D_chunk_direct_rd_t *)_rd1;
+    const H5D_chunk_direct_rd_t *rd2 = (const H5D_chunk_direct_rd_t *)_rd2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(rd1->addr, rd2->addr))
+} /* end H5D__chunk_direct_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_direct_read
+ *
+ * Purpose:	Internal routine to read NCHUNKS chunks directly from the
+ *		file, as they are stored there, bypassing the filter
+ *		pipeline.  Chunk U is at the offset held in the NDIMS+1
+ *		values at OFFSETS[U*(NDIMS+1)] (each terminated with a zero)
+ *		and is read into BUFS[U], which must be large enough for
+ *		the chunk's stored size.  The chunk's filter mask is
+ *		returned in FILTERS[U].
+ *
+ *		The chunks are read in order of their address in the file,
+ *		with one vector request, so that the file driver can read
+ *		chunks which are next to each other in the file together.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_read(const H5D_t *dset, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, uint32_t *filters, void *bufs[])
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_chunk_direct_rd_t *rd = NULL;   /* Chunks to read */
+    haddr_t     *addr = NULL;           /* Addresses of chunks, sorted */
+    size_t      *size = NULL;           /* Sizes of chunks, in address order */
+    void        **buf = NULL;           /* Buffers for chunks, in address order */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == layout->type);
+    HDassert(0 == nchunks || (offsets && filters && bufs));
+
+    /* The no-op case */
+    if(0 == nchunks)
+        HGOTO_DONE(SUCCEED)
+
+    /* No chunks can have been written if there is no storage */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, FAIL, "chunk storage is not allocated")
+
+    /* Fill the DXPL cache values for later use */
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+    /* Allocate the lists of chunks */
+    if(NULL == (rd = (H5D_chunk_direct_rd_t *)H5MM_malloc(nchunks * sizeof(H5D_chunk_direct_rd_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk list")
+    if(NULL == (addr = (haddr_t *)H5MM_malloc(nchunks * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk addresses")
+    if(NULL == (size = (size_t *)H5MM_malloc(nchunks * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk sizes")
+    if(NULL == (buf = (void **)H5MM_malloc(nchunks * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk buffers")
+
+    /* Look up each chunk */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_ud_t udata;           /* User data for querying chunk info */
+
+        if(H5D__chunk_direct_lookup(dset, dxpl_id, dxpl_cache,
+                offsets + (u * layout->u.chunk.ndims), &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if(!H5F_addr_defined(udata.addr))
+            HGOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, FAIL, "chunk is not allocated")
+        HDassert(udata.nbytes > 0);
+
+        rd[u].addr = udata.addr;
+        rd[u].nbytes = udata.nbytes;
+        rd[u].buf = bufs[u];
+        filters[u] = udata.filter_mask;
+    } /* end for */
+
+    /* Read the chunks in address order */
+    if(nchunks > 1)
+        HDqsort(rd, nchunks, sizeof(H5D_chunk_direct_rd_t), H5D__chunk_direct_cmp);
+    for(u = 0; u < nchunks; u++) {
+        addr[u] = rd[u].addr;
+        size[u] = rd[u].nbytes;
+        buf[u] = rd[u].buf;
+    } /* end for */
+    if(H5F_block_readv(dset->oloc.file, H5FD_MEM_DRAW, nchunks, addr, size, dxpl_id, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to read raw data chunks")
+
+done:
+    if(rd)
+        H5MM_xfree(rd);
+    if(addr)
+        H5MM_xfree(addr);
+    if(size)
+        H5MM_xfree(size);
+    if(buf)
+        H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_get_storage_size
+ *
+ * Purpose:	Retrieves the size in the file of the chunk at OFFSET
+ *		(terminated with a zero), as it is stored there.  Chunks
+ *		which have not been written have a size of zero.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_get_storage_size(const H5D_t *dset, hid_t dxpl_id,
+    const hsize_t *offset, hsize_t *storage_size)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_chunk_ud_t udata;               /* User data for querying chunk info */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == layout->type);
+    HDassert(offset);
+    HDassert(storage_size);
+
+    *storage_size = 0;
+
+    /* No chunks can have been written if there is no storage */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Fill the DXPL cache values for later use */
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+    if(H5D__chunk_direct_lookup(dset, dxpl_id, dxpl_cache, offset, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+    if(H5F_addr_defined(udata.addr))
+        *storage_size = udata.nbytes;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_get_storage_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_set_info_real
@@ -443,6 +787,7 @@ herr_t
 H5D__chunk_set_info(const H5D_t *dset)
 {
     hsize_t curr_dims[H5O_LAYOUT_NDIMS];    /* Curr. size of dataset dimensions */
+    hsize_t old_down_chunks[H5O_LAYOUT_NDIMS];  /* Previous "down" sizes of # of chunks */
     int sndims;                 /* Rank of dataspace */
     unsigned ndims;             /* Rank of dataspace */
     herr_t ret_value = SUCCEED; /* Return value */
@@ -458,9 +803,15 @@ H5D__chunk_set_info(const H5D_t *dset)
     H5_ASSIGN_OVERFLOW(ndims, sndims, int, unsigned);
 
     /* Set the base layout information */
+    HDmemcpy(old_down_chunks, dset->shared->layout.u.chunk.down_chunks, sizeof(old_down_chunks));
     if(H5D__chunk_set_info_real(&dset->shared->layout.u.chunk, ndims, curr_dims) < 0)
 	HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set layout's chunk info")
 
+    /* The chunk address table is indexed by linear chunk index, which
+     * changes unless only the slowest-changing dimension was resized */
+    if(HDmemcmp(old_down_chunks, dset->shared->layout.u.chunk.down_chunks, ndims * sizeof(hsize_t)))
+        H5D__chunk_addr_reset(&dset->shared->cache.chunk);
+
     /* Call the index's "resize" callback */
     if(dset->shared->layout.storage.u.chunk.ops->resize && (dset->shared->layout.storage.u.chunk.ops->resize)(&dset->shared->layout.u.chunk) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to resize chunk index information")
@@ -580,6 +931,7 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
     H5D_chk_idx_info_t idx_info;        /* Chunked index info */
     H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);   /* Convenience pointer to dataset's chunk cache */
     H5P_genplist_t *dapl;               /* Data access property list object pointer */
+    H5F_rdcc_pool_t *pool = NULL;       /* File's shared cache budget, if used */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -596,24 +948,47 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get data cache number of slots");
     if(rdcc->nslots == H5D_CHUNK_CACHE_NSLOTS_DEFAULT)
         rdcc->nslots = H5F_RDCC_NSLOTS(f);
+    rdcc->nslots_conf = rdcc->nslots;
 
     if(H5P_get(dapl, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc->nbytes_max) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get data cache byte size");
-    if(rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
-        rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+    if(rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT) {
+        /* Draw on the file's shared cache, if there is one */
+        if(H5F_RDCC_POOL(f)->nbytes_max > 0) {
+            pool = H5F_RDCC_POOL(f);
+            rdcc->nbytes_max = pool->nbytes_max;
+        } /* end if */
+        else
+            rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+    } /* end if */
 
     if(H5P_get(dapl, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &rdcc->w0) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get preempt read chunks");
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_POLICY_NAME, &rdcc->policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get data cache eviction policy");
+
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_PREFETCH_NAME, &rdcc->prefetch.nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get number of chunks to read ahead");
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
-    if(!rdcc->nbytes_max || !rdcc->nslots)
+    if(!rdcc->nbytes_max || !rdcc->nslots) {
         rdcc->nbytes_max = rdcc->nslots = 0;
+        pool = NULL;
+    } /* end if */
     else {
+        /* (nslots is only the initial number of hash buckets, the table
+         *  grows as chunks are added to the cache) */
         rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
         if(NULL == rdcc->slot)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy) {
+            rdcc->arc.slot = H5FL_SEQ_CALLOC(H5D_rdcc_ghost_ptr_t, rdcc->nslots);
+            if(NULL == rdcc->arc.slot)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        } /* end if */
 
         /* Reset any cached chunk info for this dataset */
         H5D__chunk_cinfo_cache_reset(&(rdcc->last));
@@ -634,6 +1009,20 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
     if(H5D__chunk_set_info(dset) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to set # of chunks for dataset")
 
+    /* Load the addresses of all the chunks, if requested */
+    if(H5P_get(dapl, H5D_ACS_CHUNK_ADDR_MAP_NAME, &rdcc->addr.load) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk address loading");
+    if(rdcc->addr.load && H5D__chunk_addr_load(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to load chunk addresses")
+
+    /* Start sharing the file's cache budget */
+    /* (Last, so that the cache is only attached once nothing can fail) */
+    if(pool) {
+        rdcc->pool = pool;
+        rdcc->pool_dset = dset;
+        H5D__chunk_pool_append(rdcc);
+    } /* end if */
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_init() */
@@ -706,6 +1095,7 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     /* Get layout for dataset */
     fm->layout = &(dataset->shared->layout);
     fm->nelmts = nelmts;
+    fm->keep_map = FALSE;
 
     /* Check if the memory space is scalar & make equivalent memory space */
     if((sm_ndims = H5S_GET_EXTENT_NDIMS(mem_space)) < 0)
@@ -813,6 +1203,72 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         if((fm->msel_type = H5S_GET_SELECT_TYPE(mem_space)) < H5S_SEL_NONE)
             HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
 
+        /* Regular hyperslabs in the file that match the memory selection's
+         * shape (the usual case when reading or writing a "window" into the
+         * dataset) reuse the chunk map kept from the last I/O when it was on
+         * the same selections, even if the file selection has moved by whole
+         * chunks since, and otherwise map each chunk's piece of the selection
+         * directly from its start, stride, count & block.
+         */
+        if(fsel_type == H5S_SEL_HYPERSLABS && fm->m_ndims == f_ndims
+#ifdef H5_HAVE_PARALLEL
+                && !(io_info->using_mpi_vfd)
+#endif /* H5_HAVE_PARALLEL */
+                ) {
+            H5D_rdcc_t *rdcc = &(dataset->shared->cache.chunk);    /* Dataset's chunk cache */
+            H5S_hyper_dim_t fsel[H5O_LAYOUT_NDIMS];     /* Regular file selection */
+            hsize_t m_dims[H5O_LAYOUT_NDIMS];           /* Memory dataspace dimensions */
+            hsize_t m_start[H5O_LAYOUT_NDIMS];          /* Low bound of memory selection */
+            hsize_t m_end[H5O_LAYOUT_NDIMS];            /* High bound of memory selection */
+            htri_t regular;             /* Whether the file selection is regular */
+            htri_t shape_same;          /* Whether the selections are the same shape */
+            htri_t mapped;              /* Whether the chunk map has been made */
+
+            if((regular = H5S_hyper_get_regular(file_space, fsel)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get regular file selection")
+            if(regular && (shape_same = H5S_select_shape_same(file_space, mem_space)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to compare selection shapes")
+            if(regular && shape_same) {
+                if(H5S_get_simple_extent_dims(mem_space, m_dims, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get dimensionality")
+                if(H5S_SELECT_BOUNDS(mem_space, m_start, m_end) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory selection bound info")
+
+                if(!(mapped = H5D__chunk_map_found(rdcc, fm, fsel, m_dims, m_start))) {
+                    /* Release the map kept from the last I/O */
+                    if(H5D__chunk_map_reset(rdcc) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk map")
+
+                    /* Build the file selection for each chunk */
+                    if((mapped = H5D__create_chunk_file_map_regular(fm, fsel)) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create file chunk selections")
+                    if(mapped) {
+                        /* Build the memory selection for each chunk */
+                        fm->mchunk_tmpl = NULL;
+                        if(H5D__create_chunk_mem_map_hyper(fm) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to create memory chunk selections")
+
+                        /* Keep the map for the next I/O */
+                        rdcc->map.valid = TRUE;
+                        HDmemcpy(rdcc->map.down_chunks, fm->layout->u.chunk.down_chunks, f_ndims * sizeof(hsize_t));
+                        HDmemcpy(rdcc->map.fsel, fsel, f_ndims * sizeof(H5S_hyper_dim_t));
+                        HDmemcpy(rdcc->map.m_dims, m_dims, f_ndims * sizeof(hsize_t));
+                        HDmemcpy(rdcc->map.m_start, m_start, f_ndims * sizeof(hsize_t));
+                    } /* end if */
+                } /* end if */
+
+                if(mapped) {
+                    fm->keep_map = TRUE;
+                    HGOTO_DONE(SUCCEED)
+                } /* end if */
+            } /* end if */
+        } /* end if */
+
+        /* Release any map kept from the last I/O, the selections for this
+         * I/O are built in the same skip list below */
+        if(H5D__chunk_map_reset(&(dataset->shared->cache.chunk)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk map")
+
         /* If the selection is NONE or POINTS, set the flag to FALSE */
         if(fsel_type == H5S_SEL_POINTS || fsel_type == H5S_SEL_NONE)
             sel_hyper_flag = FALSE;
@@ -1463,91 +1919,392 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_file_cb
+ * Function:	H5D__chunk_clip_regular
  *
- * Purpose:	Callback routine for file selection iterator.  Used when
- *              creating selections in file for each point selected.
+ * Purpose:	Clip one dimension of a regular hyperslab selection to the
+ *              range [LO, HI] (a chunk's extent in that dimension).
  *
- * Return:	Non-negative on success/Negative on failure
+ *              A COUNT of zero is returned when the selection doesn't
+ *              touch the range.
  *
- * Programmer:	Quincey Koziol
- *		Wednesday, July 23, 2003
+ * Return:	TRUE if the clipped selection is regular, FALSE if it isn't
+ *              (a block cut short by the range next to whole blocks)
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_file_cb(void UNUSED *elem, hid_t UNUSED type_id, unsigned ndims, const hsize_t *coords, void *_fm)
+static hbool_t
+H5D__chunk_clip_regular(const H5S_hyper_dim_t *sel, hsize_t lo, hsize_t hi,
+    hsize_t *start, hsize_t *stride, hsize_t *count, hsize_t *block)
 {
-    H5D_chunk_map_t      *fm = (H5D_chunk_map_t *)_fm;  /* File<->memory chunk mapping info */
-    H5D_chunk_info_t *chunk_info;               /* Chunk information for current chunk */
-    hsize_t    coords_in_chunk[H5O_LAYOUT_NDIMS];        /* Coordinates of element in chunk */
-    hsize_t     chunk_index;                    /* Chunk index */
-    unsigned    u;                              /* Local index variable */
-    herr_t	ret_value = SUCCEED;            /* Return value		*/
+    hsize_t first, last;        /* First & last blocks touching the range */
+    hsize_t first_start;        /* Start of the first block */
+    hsize_t last_end;           /* End of the last block */
+    hbool_t ret_value = TRUE;   /* Return value */
 
-    FUNC_ENTER_STATIC
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Calculate the index of this chunk */
-    if(H5V_chunk_index(ndims, coords, fm->layout->u.chunk.dim, fm->layout->u.chunk.down_chunks, &chunk_index) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "can't get chunk index")
+    *count = 0;
+    if(hi < sel->start)
+        HGOTO_DONE(TRUE)
 
-    /* Find correct chunk in file & memory skip list */
-    if(chunk_index==fm->last_index) {
-        /* If the chunk index is the same as the last chunk index we used,
-         * get the cached info to operate on.
-         */
-        chunk_info=fm->last_chunk_info;
+    /* Find the blocks that touch the range */
+    first = 0;
+    if(lo > sel->start) {
+        first = MIN((lo - sel->start) / sel->stride, sel->count - 1);
+        if(lo > sel->start + first * sel->stride + sel->block - 1)
+            first++;
     } /* end if */
-    else {
-        /* If the chunk index is not the same as the last chunk index we used,
-         * find the chunk in the skip list.
-         */
-        /* Get the chunk node from the skip list */
-        if(NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_index))) {
-            H5S_t *fspace;                      /* Memory chunk's dataspace */
+    last = MIN((hi - sel->start) / sel->stride, sel->count - 1);
+    if(first > last)
+        HGOTO_DONE(TRUE)
 
-            /* Allocate the file & memory chunk information */
-            if (NULL==(chunk_info = H5FL_MALLOC (H5D_chunk_info_t)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+    first_start = sel->start + first * sel->stride;
+    last_end = sel->start + last * sel->stride + sel->block - 1;
+    if(first == last) {
+        /* One block, possibly cut by the range on either side */
+        *start = MAX(first_start, lo);
+        *stride = 1;
+        *count = 1;
+        *block = (MIN(last_end, hi) - *start) + 1;
+    } /* end if */
+    else if(first_start >= lo && last_end <= hi) {
+        /* Whole blocks */
+        *start = first_start;
+        *stride = sel->stride;
+        *count = (last - first) + 1;
+        *block = sel->block;
+    } /* end if */
+    else
+        ret_value = FALSE;
 
-            /* Initialize the chunk information */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_clip_regular() */
 
-            /* Set the chunk index */
-            chunk_info->index=chunk_index;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__create_chunk_file_map_regular
+ *
+ * Purpose:	Create all chunk selections in file for a regular hyperslab
+ *              selection, by clipping its start, stride, count & block to
+ *              each chunk instead of intersecting span trees.
+ *
+ * Return:	TRUE if the chunk selections were created, FALSE if some
+ *              chunk's piece of the selection isn't regular (and none were
+ *              created), negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__create_chunk_file_map_regular(H5D_chunk_map_t *fm, const H5S_hyper_dim_t *fsel)
+{
+    hsize_t     sel_end[H5O_LAYOUT_NDIMS];  /* Offset of high bound of file selection */
+    hsize_t     sel_points;                 /* Number of elements in file selection */
+    hsize_t     start_coords[H5O_LAYOUT_NDIMS];   /* Starting coordinates of selection */
+    hsize_t     coords[H5O_LAYOUT_NDIMS];   /* Current coordinates of chunk */
+    hsize_t     start[H5O_LAYOUT_NDIMS];    /* Chunk's piece of the selection */
+    hsize_t     stride[H5O_LAYOUT_NDIMS];
+    hsize_t     count[H5O_LAYOUT_NDIMS];
+    hsize_t     block[H5O_LAYOUT_NDIMS];
+    hsize_t     chunk_index;                /* Index of chunk */
+    int         curr_dim;                   /* Current dimension to increment */
+    unsigned    u;                          /* Local index variable */
+    htri_t	ret_value = TRUE;           /* Return value */
 
-            /* Create a dataspace for the chunk */
-            if((fspace = H5S_create_simple(fm->f_ndims,fm->chunk_dim,NULL))==NULL) {
-                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk")
-            } /* end if */
+    FUNC_ENTER_STATIC
 
-            /* De-select the chunk space */
-            if(H5S_select_none(fspace) < 0) {
-                (void)H5S_close(fspace);
-                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select dataspace")
-            } /* end if */
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
 
-            /* Set the file chunk dataspace */
-            chunk_info->fspace = fspace;
-            chunk_info->fspace_shared = FALSE;
+    /* Get number of elements selected in file */
+    sel_points = fm->nelmts;
 
-            /* Set the memory chunk dataspace */
-            chunk_info->mspace = NULL;
-            chunk_info->mspace_shared = FALSE;
+    /* Set initial chunk location & bounds of selection */
+    for(u = 0; u < fm->f_ndims; u++) {
+        sel_end[u] = fsel[u].start + (fsel[u].count - 1) * fsel[u].stride + fsel[u].block - 1;
+        start_coords[u] = (fsel[u].start / fm->chunk_dim[u]) * fm->chunk_dim[u];
+        coords[u] = start_coords[u];
+    } /* end for */
 
-            /* Set the number of selected elements in chunk to zero */
-            chunk_info->chunk_points = 0;
+    /* Calculate the index of this chunk */
+    if(H5V_chunk_index(fm->f_ndims, coords, fm->layout->u.chunk.dim, fm->layout->u.chunk.down_chunks, &chunk_index) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "can't get chunk index")
 
-            /* Compute the chunk's coordinates */
-            for(u = 0; u < fm->f_ndims; u++) {
-                H5_CHECK_OVERFLOW(fm->layout->u.chunk.dim[u], hsize_t, hssize_t);
-                chunk_info->coords[u] = (coords[u] / (hssize_t)fm->layout->u.chunk.dim[u]) * (hssize_t)fm->layout->u.chunk.dim[u];
-            } /* end for */
-            chunk_info->coords[fm->f_ndims] = 0;
+    /* Iterate through each chunk in the selection's bounding box */
+    while(sel_points) {
+        hsize_t schunk_points = 1;      /* Number of elements in chunk selection */
+
+        /* Clip the selection to the chunk */
+        for(u = 0; u < fm->f_ndims && schunk_points > 0; u++) {
+            if(!H5D__chunk_clip_regular(&fsel[u], coords[u], (coords[u] + fm->chunk_dim[u]) - 1, &start[u], &stride[u], &count[u], &block[u])) {
+                /* Release the chunk selections made so far */
+                if(H5SL_free(fm->sel_chunks, H5D__free_chunk_info, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASPACE, H5E_CANTFREE, FAIL, "can't release chunk selections")
+                HGOTO_DONE(FALSE)
+            } /* end if */
+            start[u] -= coords[u];
+            schunk_points *= count[u] * block[u];
+        } /* end for */
 
-            /* Insert the new chunk into the skip list */
-            if(H5SL_insert(fm->sel_chunks,chunk_info,&chunk_info->index) < 0) {
+        if(schunk_points > 0) {
+            H5S_t *tmp_fchunk;                  /* Temporary file dataspace */
+            H5D_chunk_info_t *new_chunk_info;   /* chunk information to insert into skip list */
+
+            /* Create the chunk's dataspace & select its piece of the selection */
+            if(NULL == (tmp_fchunk = H5S_create_simple(fm->f_ndims, fm->chunk_dim, NULL)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create chunk dataspace")
+            if(H5S_select_hyperslab(tmp_fchunk, H5S_SELECT_SET, start, stride, count, block) < 0) {
+                (void)H5S_close(tmp_fchunk);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create chunk selection")
+            } /* end if */
+
+            /* Allocate the file & memory chunk information */
+            if(NULL == (new_chunk_info = H5FL_MALLOC(H5D_chunk_info_t))) {
+                (void)H5S_close(tmp_fchunk);
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+            } /* end if */
+
+            /* Initialize the chunk information */
+            new_chunk_info->index = chunk_index;
+            new_chunk_info->fspace = tmp_fchunk;
+            new_chunk_info->fspace_shared = FALSE;
+            new_chunk_info->mspace = NULL;
+            new_chunk_info->mspace_shared = FALSE;
+            for(u = 0; u < fm->f_ndims; u++)
+                new_chunk_info->coords[u] = coords[u];
+            new_chunk_info->coords[fm->f_ndims] = 0;
+            H5_ASSIGN_OVERFLOW(new_chunk_info->chunk_points, schunk_points, hsize_t, uint32_t);
+
+            /* Insert the new chunk into the skip list */
+            if(H5SL_insert(fm->sel_chunks, new_chunk_info, &new_chunk_info->index) < 0) {
+                H5D__free_chunk_info(new_chunk_info, NULL, NULL);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINSERT, FAIL, "can't insert chunk into skip list")
+            } /* end if */
+
+            /* Leave if we are done */
+            sel_points -= schunk_points;
+            if(sel_points == 0)
+                HGOTO_DONE(TRUE)
+        } /* end if */
+
+        /* Increment chunk index */
+        chunk_index++;
+
+        /* Increment chunk location in fastest changing dimension */
+        curr_dim = (int)fm->f_ndims - 1;
+        coords[curr_dim] += fm->chunk_dim[curr_dim];
+
+        /* Bring chunk location back into bounds, if necessary */
+        if(coords[curr_dim] > sel_end[curr_dim]) {
+            do {
+                /* Reset current dimension's location to 0 */
+                coords[curr_dim] = start_coords[curr_dim];
+
+                /* Decrement current dimension */
+                curr_dim--;
+
+                /* Increment chunk location in current dimension */
+                coords[curr_dim] += fm->chunk_dim[curr_dim];
+            } while(coords[curr_dim] > sel_end[curr_dim]);
+
+            /* Re-calculate the index of this chunk */
+            if(H5V_chunk_index(fm->f_ndims, coords, fm->layout->u.chunk.dim, fm->layout->u.chunk.down_chunks, &chunk_index) < 0)
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "can't get chunk index")
+        } /* end if */
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_file_map_regular() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_map_found
+ *
+ * Purpose:	Check if the chunk map kept from the last I/O on the dataset
+ *              was made for the same selections as this I/O, allowing the
+ *              file selection to have moved by whole chunks.  If so, move
+ *              the map's chunks along with it.
+ *
+ * Return:	TRUE if the kept map is used for this I/O, FALSE if not
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_map_found(H5D_rdcc_t *rdcc, const H5D_chunk_map_t *fm,
+    const H5S_hyper_dim_t *fsel, const hsize_t *m_dims, const hsize_t *m_start)
+{
+    hssize_t    shift[H5O_LAYOUT_NDIMS];    /* Move of the selection, in chunks */
+    hsize_t     index_shift = 0;            /* Move of the chunk indices */
+    H5SL_node_t *curr_node;                 /* Current node in skip list */
+    unsigned    u;                          /* Local index variable */
+    htri_t      ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(!rdcc->map.valid)
+        HGOTO_DONE(FALSE)
+
+    for(u = 0; u < fm->f_ndims; u++) {
+        hssize_t moved;         /* Move of the selection in this dimension */
+
+        if(rdcc->map.down_chunks[u] != fm->layout->u.chunk.down_chunks[u]
+                || rdcc->map.fsel[u].stride != fsel[u].stride
+                || rdcc->map.fsel[u].count != fsel[u].count
+                || rdcc->map.fsel[u].block != fsel[u].block
+                || rdcc->map.m_dims[u] != m_dims[u]
+                || rdcc->map.m_start[u] != m_start[u])
+            HGOTO_DONE(FALSE)
+
+        moved = (hssize_t)fsel[u].start - (hssize_t)rdcc->map.fsel[u].start;
+        if(moved % (hssize_t)fm->chunk_dim[u])
+            HGOTO_DONE(FALSE)
+        shift[u] = moved / (hssize_t)fm->chunk_dim[u];
+        index_shift += (hsize_t)shift[u] * fm->layout->u.chunk.down_chunks[u];
+    } /* end for */
+
+    /* Move the chunks (which keeps them in order in the skip list) & point
+     * a single chunk at this I/O's memory dataspace */
+    curr_node = H5SL_first(rdcc->sel_chunks);
+    while(curr_node) {
+        H5D_chunk_info_t *chunk_info = (H5D_chunk_info_t *)H5SL_item(curr_node);
+
+        for(u = 0; u < fm->f_ndims; u++)
+            chunk_info->coords[u] += (hsize_t)shift[u] * fm->chunk_dim[u];
+        chunk_info->index += index_shift;
+
+        /* (Casting away const OK -QAK) */
+        if(chunk_info->mspace_shared)
+            chunk_info->mspace = (H5S_t *)fm->mem_space;
+
+        curr_node = H5SL_next(curr_node);
+    } /* end while */
+
+    for(u = 0; u < fm->f_ndims; u++)
+        rdcc->map.fsel[u].start = fsel[u].start;
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_found() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_map_reset
+ *
+ * Purpose:	Release the chunk map kept from the last I/O on a dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_map_reset(H5D_rdcc_t *rdcc)
+{
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(rdcc);
+
+    if(rdcc->map.valid) {
+        rdcc->map.valid = FALSE;
+        if(H5SL_free(rdcc->sel_chunks, H5D__free_chunk_info, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't release chunk selections")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_file_cb
+ *
+ * Purpose:	Callback routine for file selection iterator.  Used when
+ *              creating selections in file for each point selected.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *		Wednesday, July 23, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_file_cb(void UNUSED *elem, hid_t UNUSED type_id, unsigned ndims, const hsize_t *coords, void *_fm)
+{
+    H5D_chunk_map_t      *fm = (H5D_chunk_map_t *)_fm;  /* File<->memory chunk mapping info */
+    H5D_chunk_info_t *chunk_info;               /* Chunk information for current chunk */
+    hsize_t    coords_in_chunk[H5O_LAYOUT_NDIMS];        /* Coordinates of element in chunk */
+    hsize_t     chunk_index;                    /* Chunk index */
+    unsigned    u;                              /* Local index variable */
+    herr_t	ret_value = SUCCEED;            /* Return value		*/
+
+    FUNC_ENTER_STATIC
+
+    /* Calculate the index of this chunk */
+    if(H5V_chunk_index(ndims, coords, fm->layout->u.chunk.dim, fm->layout->u.chunk.down_chunks, &chunk_index) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "can't get chunk index")
+
+    /* Find correct chunk in file & memory skip list */
+    if(chunk_index==fm->last_index) {
+        /* If the chunk index is the same as the last chunk index we used,
+         * get the cached info to operate on.
+         */
+        chunk_info=fm->last_chunk_info;
+    } /* end if */
+    else {
+        /* If the chunk index is not the same as the last chunk index we used,
+         * find the chunk in the skip list.
+         */
+        /* Get the chunk node from the skip list */
+        if(NULL == (chunk_info = (H5D_chunk_info_t *)H5SL_search(fm->sel_chunks, &chunk_index))) {
+            H5S_t *fspace;                      /* Memory chunk's dataspace */
+
+            /* Allocate the file & memory chunk information */
+            if (NULL==(chunk_info = H5FL_MALLOC (H5D_chunk_info_t)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+
+            /* Initialize the chunk information */
+
+            /* Set the chunk index */
+            chunk_info->index=chunk_index;
+
+            /* Create a dataspace for the chunk */
+            if((fspace = H5S_create_simple(fm->f_ndims,fm->chunk_dim,NULL))==NULL) {
+                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, FAIL, "unable to create dataspace for chunk")
+            } /* end if */
+
+            /* De-select the chunk space */
+            if(H5S_select_none(fspace) < 0) {
+                (void)H5S_close(fspace);
+                chunk_info = H5FL_FREE(H5D_chunk_info_t, chunk_info);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to de-select dataspace")
+            } /* end if */
+
+            /* Set the file chunk dataspace */
+            chunk_info->fspace = fspace;
+            chunk_info->fspace_shared = FALSE;
+
+            /* Set the memory chunk dataspace */
+            chunk_info->mspace = NULL;
+            chunk_info->mspace_shared = FALSE;
+
+            /* Set the number of selected elements in chunk to zero */
+            chunk_info->chunk_points = 0;
+
+            /* Compute the chunk's coordinates */
+            for(u = 0; u < fm->f_ndims; u++) {
+                H5_CHECK_OVERFLOW(fm->layout->u.chunk.dim[u], hsize_t, hssize_t);
+                chunk_info->coords[u] = (coords[u] / (hssize_t)fm->layout->u.chunk.dim[u]) * (hssize_t)fm->layout->u.chunk.dim[u];
+            } /* end for */
+            chunk_info->coords[fm->f_ndims] = 0;
+
+            /* Insert the new chunk into the skip list */
+            if(H5SL_insert(fm->sel_chunks,chunk_info,&chunk_info->index) < 0) {
                     H5D__free_chunk_info(chunk_info,NULL,NULL);
                 HGOTO_ERROR(H5E_DATASPACE,H5E_CANTINSERT,FAIL,"can't insert chunk into skip list")
             } /* end if */
@@ -1728,77 +2485,392 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_read
+ * Function:	H5D__chunk_filter_threads
  *
- * Purpose:	Read from a chunked dataset.
+ * Purpose:	Determine how many threads to use for running the dataset's
+ *		filter pipeline over NCHUNKS chunks at once.  This is the
+ *		number set in the DXPL, if the dataset has filters, there's
+ *		more than one chunk and all the filters are registered, and
+ *		one otherwise.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Raymond Lu
- *		Thursday, April 10, 2003
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    hsize_t UNUSED nelmts, const H5S_t UNUSED *file_space, const H5S_t UNUSED *mem_space,
-    H5D_chunk_map_t *fm)
+H5D__chunk_filter_threads(const H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
+    size_t nchunks, unsigned *nthreads)
 {
-    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
-    H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
-    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
-    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
-    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
-    hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
-    herr_t	ret_value = SUCCEED;	/*return value		*/
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    herr_t	ret_value = SUCCEED;	/* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(io_info);
-    HDassert(io_info->u.rbuf);
-    HDassert(type_info);
-    HDassert(fm);
+    HDassert(dxpl_cache);
+    HDassert(nthreads);
 
-    /* Set up "nonexistent" I/O info object */
-    HDmemcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
-    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
+    *nthreads = 1;
+    if(dxpl_cache->filter_threads > 1 && pline->nused > 0 && nchunks > 1) {
+        htri_t avail;           /* Whether the filters are all available */
 
-    /* Set up contiguous I/O info object */
-    HDmemcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
-    ctg_io_info.store = &ctg_store;
-    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+        /* Filters must not be loaded from plugins by the worker threads */
+        if((avail = H5Z_all_filters_avail(pline)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check filter availability")
+        if(avail)
+            *nthreads = dxpl_cache->filter_threads;
+    } /* end if */
 
-    /* Initialize temporary contiguous storage info */
-    H5_ASSIGN_OVERFLOW(ctg_store.contig.dset_size, io_info->dset->shared->layout.u.chunk.size, uint32_t, hsize_t);
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_threads() */
 
-    /* Set up compact I/O info object */
-    HDmemcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
-    cpt_io_info.store = &cpt_store;
-    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_preread
+ *
+ * Purpose:	Looks up the next batch of (up to NBATCH) chunks to read,
+ *		starting with CHUNK_NODE, reads the ones which exist in the
+ *		file but aren't in the chunk cache, and runs them back through
+ *		the filter pipeline together, using NTHREADS threads.  The
+ *		chunk information and unfiltered chunks are returned in BATCH
+ *		and the number of chunks in the batch in NUSED.
+ *
+ *		JOBS is temporary space for NBATCH filter jobs.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_preread(const H5D_io_info_t *io_info, const H5D_chunk_map_t *fm,
+    H5SL_node_t *chunk_node, unsigned nthreads, size_t nbatch,
+    H5D_chunk_preread_t *batch, H5Z_pipeline_job_t *jobs, size_t *nused)
+{
+    const H5D_t *dset = io_info->dset;  /* Dataset to read from */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    size_t      n;                      /* Number of chunks in batch */
+    size_t      u;                      /* Local index variable */
+    herr_t	ret_value = SUCCEED;	/* Return value */
 
-    /* Initialize temporary compact storage info */
-    cpt_store.compact.dirty = &cpt_dirty;
+    FUNC_ENTER_STATIC
 
-    {
-        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill);    /* Fill value info */
-        H5D_fill_value_t fill_status;       /* Fill value status */
+    HDassert(chunk_node);
+    HDassert(nbatch > 0);
+    HDassert(batch);
+    HDassert(jobs);
+    HDassert(nused);
 
-        /* Check the fill value status */
-        if(H5P_is_fill_value_defined(fill, &fill_status) < 0)
-            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+    HDmemset(jobs, 0, nbatch * sizeof(H5Z_pipeline_job_t));
 
-        /* If we are never to return fill values, or if we would return them
-         * but they aren't set, set the flag to skip missing chunks.
-         */
-        if(fill->fill_time == H5D_FILL_TIME_NEVER ||
-                (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED))
-            skip_missing_chunks = TRUE;
+    /* Look up the chunks & read in the ones which aren't cached */
+    for(n = 0; chunk_node && n < nbatch; n++) {
+        H5D_chunk_info_t *chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        H5D_chunk_ud_t *udata = &batch[n].udata;
+
+        batch[n].chunk = NULL;
+        if(H5D__chunk_lookup(dset, io_info->dxpl_id, chunk_info->coords,
+                chunk_info->index, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        if(NULL == udata->ent && H5F_addr_defined(udata->addr)) {
+            H5Z_pipeline_job_t *job = &jobs[n];
+
+            job->filter_mask = udata->filter_mask;
+            H5_ASSIGN_OVERFLOW(job->nbytes, udata->nbytes, uint32_t, size_t);
+            job->buf_size = job->nbytes;
+            if(NULL == (job->buf = H5D__chunk_alloc(job->buf_size, pline)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, udata->addr, job->nbytes, io_info->dxpl_id, job->buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+        } /* end if */
+
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end for */
+
+    /* Unfilter the chunks */
+    if(H5Z_pipeline_mt(pline, H5Z_FLAG_REVERSE, io_info->dxpl_cache->err_detect,
+            io_info->dxpl_cache->filter_cb, nthreads, n, jobs) < 0)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+
+    /* Hand the unfiltered chunks to the caller */
+    for(u = 0; u < n; u++)
+        if(jobs[u].buf) {
+            batch[u].chunk = jobs[u].buf;
+            jobs[u].buf = NULL;
+            batch[u].udata.filter_mask = jobs[u].filter_mask;
+            H5_ASSIGN_OVERFLOW(batch[u].udata.nbytes, jobs[u].nbytes, size_t, uint32_t);
+        } /* end if */
+    *nused = n;
+
+done:
+    if(ret_value < 0)
+        for(u = 0; u < nbatch; u++)
+            if(jobs[u].buf)
+                jobs[u].buf = H5D__chunk_xfree(jobs[u].buf, pline);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_preread() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_prefetch_note
+ *
+ * Purpose:	Records that the chunk with index CHUNK_IDX was missing from
+ *		the cache and had to be read from the file, to detect
+ *		sequential or strided access to the dataset's chunks.
+ *
+ * Return:	TRUE if the chunks after this one should be read ahead,
+ *		FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_prefetch_note(H5D_rdcc_t *rdcc, hsize_t chunk_idx)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+
+    /* Only forward strides are detected */
+    if(rdcc->prefetch.valid && chunk_idx > rdcc->prefetch.last) {
+        if(chunk_idx - rdcc->prefetch.last == rdcc->prefetch.stride)
+            rdcc->prefetch.nseq++;
+        else {
+            rdcc->prefetch.stride = chunk_idx - rdcc->prefetch.last;
+            rdcc->prefetch.nseq = 1;
+        } /* end else */
+    } /* end if */
+    else
+        rdcc->prefetch.nseq = 0;
+    rdcc->prefetch.last = chunk_idx;
+    rdcc->prefetch.valid = TRUE;
+
+    FUNC_LEAVE_NOAPI(rdcc->prefetch.nseq >= H5D_CHUNK_PREFETCH_NSEQ)
+} /* end H5D__chunk_prefetch_note() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_prefetch
+ *
+ * Purpose:	Reads the next chunks of a sequential or strided access
+ *		pattern into the chunk cache, following the last chunk
+ *		recorded with H5D__chunk_prefetch_note().  The chunks that
+ *		exist in the file but aren't cached are read together and
+ *		run back through the filter pipeline on several threads, if
+ *		allowed.  A chunk which fails to unfilter is skipped, since
+ *		the application may never access it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch(const H5D_io_info_t *io_info)
+{
+    const H5D_t *dset = io_info->dset;  /* Dataset to read from */
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    const H5O_layout_chunk_t *layout = &(dset->shared->layout.u.chunk); /* Chunk layout */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_chunk_prefetch_t *ahead = NULL; /* Chunks to read ahead */
+    H5Z_pipeline_job_t *jobs = NULL;    /* Filter jobs for the chunks */
+    size_t      nahead;                 /* Max. number of chunks to read ahead */
+    size_t      n = 0;                  /* Number of chunks read */
+    unsigned    nthreads;               /* Number of threads for filtering */
+    size_t      u;                      /* Local index variable */
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rdcc->prefetch.valid && rdcc->prefetch.stride > 0);
+
+    /* Don't read ahead more than fits in the cache next to the chunk
+     * just accessed */
+    nahead = rdcc->nbytes_max / layout->size;
+    nahead = nahead > 1 ? MIN(nahead - 1, rdcc->prefetch.nchunks) : 0;
+    if(0 == nahead)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (ahead = (H5D_chunk_prefetch_t *)H5MM_malloc(nahead * sizeof(H5D_chunk_prefetch_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunks to read ahead")
+    if(NULL == (jobs = (H5Z_pipeline_job_t *)H5MM_calloc(nahead * sizeof(H5Z_pipeline_job_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter jobs")
+
+    /* Look up the next chunks & read the ones which aren't cached */
+    for(u = 0; u < nahead; u++) {
+        H5D_chunk_prefetch_t *pf = &ahead[n];
+        hsize_t idx;            /* Chunk index */
+        unsigned v;             /* Local index variable */
+
+        /* Stop at the end of the dataset */
+        if(rdcc->prefetch.stride >= layout->nchunks - rdcc->prefetch.last)
+            break;
+        idx = rdcc->prefetch.last += rdcc->prefetch.stride;
+
+        /* Compute the chunk's offset from its index */
+        pf->index = idx;
+        for(v = 0; v < layout->ndims - 1; v++) {
+            pf->offset[v] = (idx / layout->down_chunks[v]) * layout->dim[v];
+            idx %= layout->down_chunks[v];
+        } /* end for */
+        pf->offset[layout->ndims - 1] = 0;
+
+        if(H5D__chunk_lookup(dset, io_info->dxpl_id, pf->offset, pf->index, &pf->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if(NULL == pf->udata.ent && H5F_addr_defined(pf->udata.addr)) {
+            H5Z_pipeline_job_t *job = &jobs[n];
+
+            job->filter_mask = pf->udata.filter_mask;
+            H5_ASSIGN_OVERFLOW(job->nbytes, pf->udata.nbytes, uint32_t, size_t);
+            job->buf_size = job->nbytes;
+            if(NULL == (job->buf = H5D__chunk_alloc(job->buf_size, pline)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, pf->udata.addr, job->nbytes, io_info->dxpl_id, job->buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+            n++;
+        } /* end if */
+    } /* end for */
+
+    /* Unfilter the chunks */
+    if(n > 0 && pline->nused > 0) {
+        if(H5D__chunk_filter_threads(dset, io_info->dxpl_cache, n, &nthreads) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of filter threads")
+        if(H5Z_pipeline_mt(pline, H5Z_FLAG_REVERSE, io_info->dxpl_cache->err_detect,
+                io_info->dxpl_cache->filter_cb, nthreads, n, jobs) < 0)
+            /* (The chunks which failed are skipped below) */
+            H5E_clear_stack(NULL);
+    } /* end if */
+
+    /* Hand the chunks to the cache */
+    for(u = 0; u < n; u++) {
+        H5D_chunk_prefetch_t *pf = &ahead[u];
+        void *chunk;            /* Chunk in the cache */
+
+        if(jobs[u].status < 0) {
+            jobs[u].buf = H5D__chunk_xfree(jobs[u].buf, pline);
+            continue;
+        } /* end if */
+
+        /* (The cache takes over the chunk, even on failure) */
+        pf->udata.filter_mask = jobs[u].filter_mask;
+        H5_ASSIGN_OVERFLOW(pf->udata.nbytes, jobs[u].nbytes, size_t, uint32_t);
+        io_info->store->chunk.offset = pf->offset;
+        io_info->store->chunk.index = pf->index;
+        chunk = H5D__chunk_lock(io_info, &pf->udata, FALSE, jobs[u].buf);
+        jobs[u].buf = NULL;
+        if(NULL == chunk)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+        rdcc->stats.nprefetches++;
+        if(H5D__chunk_unlock(io_info, &pf->udata, FALSE, chunk, (uint32_t)0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+    } /* end for */
+
+done:
+    if(jobs) {
+        for(u = 0; u < n; u++)
+            if(jobs[u].buf)
+                jobs[u].buf = H5D__chunk_xfree(jobs[u].buf, pline);
+        H5MM_xfree(jobs);
+    } /* end if */
+    if(ahead)
+        H5MM_xfree(ahead);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_read
+ *
+ * Purpose:	Read from a chunked dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Raymond Lu
+ *		Thursday, April 10, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    hsize_t UNUSED nelmts, const H5S_t UNUSED *file_space, const H5S_t UNUSED *mem_space,
+    H5D_chunk_map_t *fm)
+{
+    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
+    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
+    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
+    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
+    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
+    hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
+    unsigned    nthreads;               /* Number of threads for filtering */
+    H5D_chunk_preread_t *batch = NULL;  /* Batch of chunks read ahead of time */
+    H5Z_pipeline_job_t *jobs = NULL;    /* Filter jobs for the batch */
+    size_t      nbatch = 0;             /* Max. number of chunks in a batch */
+    size_t      batch_nused = 0;        /* Number of chunks in current batch */
+    size_t      batch_curr = 0;         /* Next chunk to use from current batch */
+    hbool_t     prefetch = FALSE;       /* Whether to read the next chunks ahead */
+    herr_t	ret_value = SUCCEED;	/*return value		*/
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->u.rbuf);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Set up "nonexistent" I/O info object */
+    HDmemcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
+    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
+
+    /* Set up contiguous I/O info object */
+    HDmemcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
+    ctg_io_info.store = &ctg_store;
+    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+
+    /* Initialize temporary contiguous storage info */
+    H5_ASSIGN_OVERFLOW(ctg_store.contig.dset_size, io_info->dset->shared->layout.u.chunk.size, uint32_t, hsize_t);
+
+    /* Set up compact I/O info object */
+    HDmemcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
+    cpt_io_info.store = &cpt_store;
+    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+
+    /* Initialize temporary compact storage info */
+    cpt_store.compact.dirty = &cpt_dirty;
+
+    {
+        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill);    /* Fill value info */
+        H5D_fill_value_t fill_status;       /* Fill value status */
+
+        /* Check the fill value status */
+        if(H5P_is_fill_value_defined(fill, &fill_status) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+        /* If we are never to return fill values, or if we would return them
+         * but they aren't set, set the flag to skip missing chunks.
+         */
+        if(fill->fill_time == H5D_FILL_TIME_NEVER ||
+                (fill->fill_time == H5D_FILL_TIME_IFSET && fill_status != H5D_FILL_VALUE_USER_DEFINED))
+            skip_missing_chunks = TRUE;
     }
 
+    /* Check if the chunks should be unfiltered by several threads, a batch
+     *  at a time
+     */
+    if(H5D__chunk_filter_threads(io_info->dset, io_info->dxpl_cache,
+            (fm->use_single ? (size_t)1 : H5SL_count(fm->sel_chunks)), &nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of filter threads")
+    if(nthreads > 1) {
+        nbatch = (size_t)nthreads * H5D_CHUNK_FILTER_BATCH;
+        if(NULL == (batch = (H5D_chunk_preread_t *)H5MM_malloc(nbatch * sizeof(H5D_chunk_preread_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        if(NULL == (jobs = (H5Z_pipeline_job_t *)H5MM_malloc(nbatch * sizeof(H5Z_pipeline_job_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter jobs")
+    } /* end if */
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
     while(chunk_node) {
@@ -1806,23 +2878,41 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
         void *chunk;                    /* Pointer to locked chunk buffer */
         H5D_chunk_ud_t udata;		/* B-tree pass-through	*/
+        H5D_chunk_preread_t *preread = NULL; /* Chunk's info from the current batch */
         htri_t cacheable;               /* Whether the chunk is cacheable */
 
         /* Get the actual chunk information from the skip list node */
         chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
 
+        /* Read & unfilter the next batch of chunks, when starting on it */
+        if(batch) {
+            if(batch_curr == batch_nused) {
+                if(H5D__chunk_preread(io_info, fm, chunk_node, nthreads, nbatch, batch, jobs, &batch_nused) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+                batch_curr = 0;
+            } /* end if */
+            preread = &batch[batch_curr++];
+        } /* end if */
+
         /* Get the info for the chunk in the file */
-        if(H5D__chunk_lookup(io_info->dset, io_info->dxpl_id,
+        /* (Chunks which weren't pre-read may have entered or left the cache
+         *  since the batch was read, so look them up again)
+         */
+        if(preread && preread->chunk)
+            udata = preread->udata;
+        else if(H5D__chunk_lookup(io_info->dset, io_info->dxpl_id,
                 chunk_info->coords, chunk_info->index, &udata) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
         /* Check for non-existant chunk & skip it if appropriate */
-        if(H5F_addr_defined(udata.addr) || UINT_MAX != udata.idx_hint
+        if(H5F_addr_defined(udata.addr) || NULL != udata.ent
                 || !skip_missing_chunks) {
             /* Load the chunk into cache and lock it. */
             if((cacheable = H5D__chunk_cacheable(io_info, udata.addr, FALSE)) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
             if(cacheable) {
+                hbool_t miss = (hbool_t)(NULL == udata.ent && H5F_addr_defined(udata.addr)); /* Whether the chunk is read from the file */
+
                 /* Pass in chunk's coordinates in a union. */
                 io_info->store->chunk.offset = chunk_info->coords;
                 io_info->store->chunk.index = chunk_info->index;
@@ -1832,9 +2922,17 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
 
                 /* Lock the chunk into the cache */
-                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE)))
+                /* (The cache takes over any pre-read chunk, even on failure) */
+                chunk = H5D__chunk_lock(io_info, &udata, FALSE, (preread ? preread->chunk : NULL));
+                if(preread)
+                    preread->chunk = NULL;
+                if(NULL == chunk)
                     HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
+                /* Watch the misses for a pattern to read ahead of */
+                if(miss && io_info->dset->shared->cache.chunk.prefetch.nchunks > 0)
+                    prefetch = H5D__chunk_prefetch_note(&(io_info->dset->shared->cache.chunk), chunk_info->index);
+
                 /* Set up the storage buffer information for this chunk */
                 cpt_store.compact.buf = chunk;
 
@@ -1873,7 +2971,24 @@ H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
     } /* end while */
 
+    /* Read the chunks the application will likely access next */
+    if(prefetch)
+        if(H5D__chunk_prefetch(io_info) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read chunks ahead")
+
 done:
+    /* Release any chunks pre-read but not used, on error */
+    if(batch) {
+        while(batch_curr < batch_nused) {
+            if(batch[batch_curr].chunk)
+                batch[batch_curr].chunk = H5D__chunk_xfree(batch[batch_curr].chunk, &(io_info->dset->shared->dcpl_cache.pline));
+            batch_curr++;
+        } /* end while */
+        H5MM_xfree(batch);
+    } /* end if */
+    if(jobs)
+        H5MM_xfree(jobs);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_read() */
 
@@ -1902,6 +3017,11 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
     uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
+    unsigned    nthreads;               /* Number of threads for filtering */
+    H5D_rdcc_ent_t *pend = NULL;        /* Whole chunks waiting to be filtered */
+    H5D_rdcc_ent_t **pend_ptr = NULL;   /* Pointers to the pending chunks */
+    size_t      nbatch = 0;             /* Max. number of pending chunks */
+    size_t      npend = 0;              /* Number of pending chunks */
     herr_t	ret_value = SUCCEED;	/* Return value		*/
 
     FUNC_ENTER_STATIC
@@ -1912,6 +3032,20 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDassert(type_info);
     HDassert(fm);
 
+    /* Check if the chunks should be filtered by several threads, a batch
+     *  at a time
+     */
+    if(H5D__chunk_filter_threads(io_info->dset, io_info->dxpl_cache,
+            (fm->use_single ? (size_t)1 : H5SL_count(fm->sel_chunks)), &nthreads) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of filter threads")
+    if(nthreads > 1) {
+        nbatch = (size_t)nthreads * H5D_CHUNK_FILTER_BATCH;
+        if(NULL == (pend = (H5D_rdcc_ent_t *)H5MM_malloc(nbatch * sizeof(H5D_rdcc_ent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+        if(NULL == (pend_ptr = (H5D_rdcc_ent_t **)H5MM_malloc(nbatch * sizeof(H5D_rdcc_ent_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    } /* end if */
+
     /* Set up contiguous I/O info object */
     HDmemcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
     ctg_io_info.store = &ctg_store;
@@ -1936,6 +3070,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
         void *chunk;                    /* Pointer to locked chunk buffer */
         H5D_chunk_ud_t udata;		/* Index pass-through	*/
         htri_t cacheable;               /* Whether the chunk is cacheable */
+        hbool_t pending = FALSE;        /* Whether the chunk is left for a batch */
 
         /* Get the actual chunk information from the skip list node */
         chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
@@ -1963,8 +3098,31 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                     (chunk_info->chunk_points * type_info->src_type_size) != ctg_store.contig.dset_size)
                 entire_chunk = FALSE;
 
+            /* Whole chunks which aren't cached are filtered & written in
+             * batches, bypassing the cache, when using several threads */
+            if(pend && entire_chunk && NULL == udata.ent) {
+                H5D_rdcc_ent_t *ent = &pend[npend];  /* Pending chunk's entry */
+                size_t chunk_size;          /* Size of chunk */
+
+                /* Count as a hit, as for "relaxed" chunk locking */
+                io_info->dset->shared->cache.chunk.stats.nhits++;
+
+                /* Set up a "fake" cache entry for the chunk */
+                H5_ASSIGN_OVERFLOW(chunk_size, io_info->dset->shared->layout.u.chunk.size, uint32_t, size_t);
+                HDmemset(ent, 0, sizeof(*ent));
+                ent->dirty = TRUE;
+                HDmemcpy(ent->offset, chunk_info->coords, io_info->dset->shared->layout.u.chunk.ndims * sizeof(ent->offset[0]));
+                ent->chunk_addr = udata.addr;
+                if(NULL == (ent->chunk = (uint8_t *)H5D__chunk_alloc(chunk_size, &(io_info->dset->shared->dcpl_cache.pline))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+                HDmemset(ent->chunk, 0, chunk_size);
+                pend_ptr[npend++] = ent;
+
+                chunk = ent->chunk;
+                pending = TRUE;
+            } /* end if */
             /* Lock the chunk into the cache */
-            if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk)))
+            else if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, entire_chunk, NULL)))
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
             /* Set up the storage buffer information for this chunk */
@@ -1998,6 +3156,8 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
 
                 /* Cache the new chunk information */
                 H5D__chunk_cinfo_cache_update(&io_info->dset->shared->cache.chunk.last, &udata);
+                if(H5D__chunk_addr_update(io_info->dset, &udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't update chunk address table")
             } /* end if */
 
             /* Set up the storage address information for this chunk */
@@ -2015,15 +3175,44 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                 (hsize_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked write failed")
 
+        /* Filter & write a full batch of pending chunks */
+        if(pending) {
+            if(npend == nbatch) {
+                /* (The chunks are released, even on failure) */
+                npend = 0;
+                if(H5D__chunk_flush_entries(io_info->dset, io_info->dxpl_id, io_info->dxpl_cache, pend_ptr, nbatch, TRUE, nthreads) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data chunks")
+            } /* end if */
+        } /* end if */
         /* Release the cache lock on the chunk. */
-        if(chunk && H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
+        else if(chunk && H5D__chunk_unlock(io_info, &udata, TRUE, chunk, dst_accessed_bytes) < 0)
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
 
         /* Advance to next chunk in list */
         chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
     } /* end while */
 
+    /* Filter & write the last batch of pending chunks */
+    if(npend > 0) {
+        size_t nflush = npend;          /* Number of chunks to flush */
+
+        npend = 0;
+        if(H5D__chunk_flush_entries(io_info->dset, io_info->dxpl_id, io_info->dxpl_cache, pend_ptr, nflush, TRUE, nthreads) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write raw data chunks")
+    } /* end if */
+
 done:
+    /* Release any pending chunks, on error */
+    while(npend > 0) {
+        npend--;
+        if(pend[npend].chunk)
+            pend[npend].chunk = (uint8_t *)H5D__chunk_xfree(pend[npend].chunk, &(io_info->dset->shared->dcpl_cache.pline));
+    } /* end while */
+    if(pend)
+        H5MM_xfree(pend);
+    if(pend_ptr)
+        H5MM_xfree(pend_ptr);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_write() */
 
@@ -2109,8 +3298,9 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
         H5S_select_all(fm->single_space, TRUE);
     } /* end if */
     else {
-        /* Release the nodes on the list of selected chunks */
-        if(fm->sel_chunks)
+        /* Release the nodes on the list of selected chunks, unless they're
+         * kept for the next I/O on the dataset */
+        if(fm->sel_chunks && !fm->keep_map)
             if(H5SL_free(fm->sel_chunks, H5D__free_chunk_info, NULL) < 0)
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTNEXT, FAIL, "can't iterate over chunks")
     } /* end else */
@@ -2278,141 +3468,536 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_create
+ * Function:	H5D__chunk_addr_index
  *
- * Purpose:	Creates a new chunked storage index and initializes the
- *		layout information with information about the storage.  The
- *		layout info should be immediately written to the object header.
+ * Purpose:	Compute the position of a chunk in the dataset's chunk
+ *              address table.
  *
- * Return:	Non-negative on success (with the layout information initialized
- *		and ready to write to an object header). Negative on failure.
+ *              Chunks outside the dataset's current dimensions can share
+ *              a linear index with a chunk inside them, except when they
+ *              are only past the end of the slowest-changing dimension, so
+ *              other chunks are not kept in the table.  Neither are chunks
+ *              past the first H5D_CHUNK_ADDR_MAX_NELMTS.
  *
- * Programmer:	Quincey Koziol
- *		Thursday, May 22, 2008
+ * Return:	TRUE if the chunk has a place in the table, FALSE if not
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_create(H5D_t *dset /*in,out*/, hid_t dxpl_id)
+static hbool_t
+H5D__chunk_addr_index(const H5O_layout_chunk_t *layout, const hsize_t *offset,
+    hsize_t *idx)
 {
-    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
-    herr_t ret_value = SUCCEED;         /* Return value */
-
-    FUNC_ENTER_PACKAGE
+    unsigned    u;                      /* Local index variable */
+    hbool_t     ret_value = TRUE;       /* Return value */
 
-    /* Check args */
-    HDassert(dset);
-    HDassert(H5D_CHUNKED == dset->shared->layout.type);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0 && dset->shared->layout.u.chunk.ndims <= H5O_LAYOUT_NDIMS);
-#ifndef NDEBUG
-{
-    unsigned u;                         /* Local index variable */
+    FUNC_ENTER_STATIC_NOERR
 
-    for(u = 0; u < dset->shared->layout.u.chunk.ndims; u++)
-	HDassert(dset->shared->layout.u.chunk.dim[u] > 0);
-}
-#endif
+    /* Sanity check */
+    HDassert(layout);
+    HDassert(offset);
+    HDassert(idx);
 
-    /* Compose chunked index info struct */
-    idx_info.f = dset->oloc.file;
-    idx_info.dxpl_id = dxpl_id;
-    idx_info.pline = &dset->shared->dcpl_cache.pline;
-    idx_info.layout = &dset->shared->layout.u.chunk;
-    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+    *idx = 0;
+    for(u = 0; u < layout->ndims - 1; u++) {
+        hsize_t scaled = offset[u] / layout->dim[u];    /* Chunk's position in this dimension */
 
-    /* Create the index for the chunks */
-    if((dset->shared->layout.storage.u.chunk.ops->create)(&idx_info) < 0)
-	HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
+        if(u > 0 && scaled >= layout->chunks[u])
+            HGOTO_DONE(FALSE)
+        if(scaled > 0) {
+            if(scaled >= H5D_CHUNK_ADDR_MAX_NELMTS || layout->down_chunks[u] >= H5D_CHUNK_ADDR_MAX_NELMTS)
+                HGOTO_DONE(FALSE)
+            *idx += scaled * layout->down_chunks[u];
+        } /* end if */
+    } /* end for */
+    if(*idx >= H5D_CHUNK_ADDR_MAX_NELMTS)
+        HGOTO_DONE(FALSE)
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_create() */
+} /* H5D__chunk_addr_index() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_lookup
+ * Function:	H5D__chunk_addr_reset
  *
- * Purpose:	Loops up a chunk in cache and on disk, and retrieves
- *              information about that chunk.
+ * Purpose:	Forget every chunk address in the dataset's chunk address
+ *              table.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Albert Cheng
- *              June 27, 1998
- *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *chunk_offset,
-    hsize_t chunk_idx, H5D_chunk_ud_t *udata)
+static herr_t
+H5D__chunk_addr_reset(H5D_rdcc_t *rdcc)
 {
-    H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
-    hbool_t         found = FALSE;      /* In cache? */
-    unsigned        u;                  /* Counter */
-    herr_t	ret_value = SUCCEED;	/* Return value */
-
-    FUNC_ENTER_PACKAGE
-
-    HDassert(dset);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0);
-    HDassert(chunk_offset);
-    HDassert(udata);
-
-    /* Initialize the query information about the chunk we are looking for */
-    udata->common.layout = &(dset->shared->layout.u.chunk);
-    udata->common.storage = &(dset->shared->layout.storage.u.chunk);
-    udata->common.offset = chunk_offset;
-    udata->common.rdcc = &(dset->shared->cache.chunk);
+    size_t      u;                      /* Local index variable */
 
-    /* Reset information about the chunk we are looking for */
-    udata->nbytes = 0;
-    udata->filter_mask = 0;
-    udata->addr = HADDR_UNDEF;
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Check for chunk in cache */
-    if(dset->shared->cache.chunk.nslots > 0) {
-        udata->idx_hint = H5D_CHUNK_HASH(dset->shared, chunk_idx);
-        ent = dset->shared->cache.chunk.slot[udata->idx_hint];
+    /* Sanity check */
+    HDassert(rdcc);
 
-        if(ent)
-            for(u = 0, found = TRUE; u < dset->shared->layout.u.chunk.ndims - 1;
-                    u++)
-                if(chunk_offset[u] != ent->offset[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
+    if(rdcc->addr.block) {
+        for(u = 0; u < rdcc->addr.nblocks; u++)
+            if(rdcc->addr.block[u])
+                rdcc->addr.block[u] = H5FL_SEQ_FREE(H5D_rdcc_addr_t, rdcc->addr.block[u]);
+        rdcc->addr.block = H5FL_SEQ_FREE(H5D_rdcc_addr_ptr_t, rdcc->addr.block);
     } /* end if */
+    rdcc->addr.nblocks = 0;
+    rdcc->addr.complete = FALSE;
 
-    /* Find chunk addr */
-    if(found)
-        udata->addr = ent->chunk_addr;
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5D__chunk_addr_reset() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_addr_update
+ *
+ * Purpose:	Record a chunk's address, size and filter mask in the
+ *              dataset's chunk address table, so later lookups of the chunk
+ *              don't need to search the chunk index.  The table grows a
+ *              data block at a time as chunks are appended to the dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_addr_update(const H5D_t *dset, const H5D_chunk_ud_t *udata)
+{
+    H5D_rdcc_t  *rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5D_rdcc_addr_t *ent;               /* Chunk's entry in the table */
+    hsize_t     idx;                    /* Chunk's position in the table */
+    size_t      blk;                    /* Data block holding the entry */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(udata);
+    HDassert(udata->common.offset);
+
+    if(!H5D__chunk_addr_index(&dset->shared->layout.u.chunk, udata->common.offset, &idx))
+        HGOTO_DONE(SUCCEED)
+    blk = (size_t)(idx / H5D_CHUNK_ADDR_DBLK_NELMTS);
+
+    /* Extend the array of data block pointers, if necessary */
+    if(blk >= rdcc->addr.nblocks) {
+        H5D_rdcc_addr_t **block;        /* New array of data block pointers */
+        size_t  nblocks = MAX(blk + 1, 2 * rdcc->addr.nblocks);  /* New # of data block pointers */
+
+        if(NULL == (block = H5FL_SEQ_REALLOC(H5D_rdcc_addr_ptr_t, rdcc->addr.block, nblocks)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk address table")
+        HDmemset(block + rdcc->addr.nblocks, 0, (nblocks - rdcc->addr.nblocks) * sizeof(H5D_rdcc_addr_t *));
+        rdcc->addr.block = block;
+        rdcc->addr.nblocks = nblocks;
+    } /* end if */
+
+    /* Allocate the data block, if this is the first chunk in it */
+    if(NULL == rdcc->addr.block[blk])
+        if(NULL == (rdcc->addr.block[blk] = H5FL_SEQ_CALLOC(H5D_rdcc_addr_t, (size_t)H5D_CHUNK_ADDR_DBLK_NELMTS)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk address table")
+
+    /* Store the chunk's information */
+    ent = &rdcc->addr.block[blk][idx % H5D_CHUNK_ADDR_DBLK_NELMTS];
+    ent->nbytes = udata->nbytes;
+    ent->filter_mask = udata->filter_mask;
+    ent->addr = udata->addr;
+    ent->valid = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_addr_update() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_addr_found
+ *
+ * Purpose:	Look for a chunk's information in the dataset's chunk
+ *              address table.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_addr_found(const H5D_t *dset, H5D_chunk_ud_t *udata)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    const H5D_rdcc_addr_t *ent;         /* Chunk's entry in the table */
+    hsize_t     idx;                    /* Chunk's position in the table */
+    size_t      blk;                    /* Data block holding the entry */
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(udata);
+    HDassert(udata->common.offset);
+
+    if((0 == rdcc->addr.nblocks && !rdcc->addr.complete) || !H5D__chunk_addr_index(&dset->shared->layout.u.chunk, udata->common.offset, &idx))
+        HGOTO_DONE(FALSE)
+
+    /* Retrieve the information from the table */
+    blk = (size_t)(idx / H5D_CHUNK_ADDR_DBLK_NELMTS);
+    if(blk < rdcc->addr.nblocks && rdcc->addr.block[blk]
+            && (ent = &rdcc->addr.block[blk][idx % H5D_CHUNK_ADDR_DBLK_NELMTS])->valid) {
+        udata->nbytes = ent->nbytes;
+        udata->filter_mask = ent->filter_mask;
+        udata->addr = ent->addr;
+
+        /* Indicate that the data was found */
+        ret_value = TRUE;
+    } /* end if */
+    else if(rdcc->addr.complete) {
+        /* The chunk doesn't exist */
+        udata->nbytes = 0;
+        udata->filter_mask = 0;
+        udata->addr = HADDR_UNDEF;
+        ret_value = TRUE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_addr_found() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_addr_load_cb
+ *
+ * Purpose:	Callback when loading the addresses of all existing chunks
+ *              into the chunk address table
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_addr_load_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_it_ud5_t	*udata = (H5D_chunk_it_ud5_t *)_udata;  /* User data for callback */
+    H5D_chunk_ud_t      chk_udata;      /* Chunk's information */
+    int                 ret_value = H5_ITER_CONT;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    chk_udata.common = udata->common;
+    chk_udata.common.offset = chunk_rec->offset;
+    chk_udata.nbytes = chunk_rec->nbytes;
+    chk_udata.filter_mask = chunk_rec->filter_mask;
+    chk_udata.addr = chunk_rec->chunk_addr;
+    if(H5D__chunk_addr_update(udata->dset, &chk_udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, H5_ITER_ERROR, "can't update chunk address table")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_addr_load_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_addr_load
+ *
+ * Purpose:	Load the addresses of all of a dataset's chunks into its
+ *              chunk address table, in one pass over the chunk index.
+ *              Afterwards, chunks missing from the table are known not to
+ *              exist, until the table is reset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_addr_load(const H5D_t *dset, hid_t dxpl_id)
+{
+    H5D_rdcc_t  *rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_chunk_it_ud5_t udata;          	/* User data for iteration callback */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Start from an empty table */
+    H5D__chunk_addr_reset(rdcc);
+
+    if((*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage)) {
+        /* Set up user data for B-tree callback */
+        HDmemset(&udata, 0, sizeof(udata));
+        udata.common.layout = &dset->shared->layout.u.chunk;
+        udata.common.storage = &dset->shared->layout.storage.u.chunk;
+        udata.common.rdcc = rdcc;
+        udata.dset = dset;
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.dxpl_id = dxpl_id;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+        /* Iterate over chunks to fill in the table */
+        if((dset->shared->layout.storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_addr_load_cb, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index to load chunk addresses")
+    } /* end if */
+
+    /* Every chunk the table has a place for is in it now */
+    rdcc->addr.complete = TRUE;
+
+done:
+    if(ret_value < 0)
+        H5D__chunk_addr_reset(rdcc);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_addr_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_create
+ *
+ * Purpose:	Creates a new chunked storage index and initializes the
+ *		layout information with information about the storage.  The
+ *		layout info should be immediately written to the object header.
+ *
+ * Return:	Non-negative on success (with the layout information initialized
+ *		and ready to write to an object header). Negative on failure.
+ *
+ * Programmer:	Quincey Koziol
+ *		Thursday, May 22, 2008
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_create(H5D_t *dset /*in,out*/, hid_t dxpl_id)
+{
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+    HDassert(dset->shared->layout.u.chunk.ndims > 0 && dset->shared->layout.u.chunk.ndims <= H5O_LAYOUT_NDIMS);
+#ifndef NDEBUG
+{
+    unsigned u;                         /* Local index variable */
+
+    for(u = 0; u < dset->shared->layout.u.chunk.ndims; u++)
+	HDassert(dset->shared->layout.u.chunk.dim[u] > 0);
+}
+#endif
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = dxpl_id;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* Create the index for the chunks */
+    if((dset->shared->layout.storage.u.chunk.ops->create)(&idx_info) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_lookup
+ *
+ * Purpose:	Loops up a chunk in cache and on disk, and retrieves
+ *              information about that chunk.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Albert Cheng
+ *              June 27, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *chunk_offset,
+    hsize_t chunk_idx, H5D_chunk_ud_t *udata)
+{
+    H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
+    hbool_t         found = FALSE;      /* In cache? */
+    unsigned        u;                  /* Counter */
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(dset->shared->layout.u.chunk.ndims > 0);
+    HDassert(chunk_offset);
+    HDassert(udata);
+
+    /* Initialize the query information about the chunk we are looking for */
+    udata->common.layout = &(dset->shared->layout.u.chunk);
+    udata->common.storage = &(dset->shared->layout.storage.u.chunk);
+    udata->common.offset = chunk_offset;
+    udata->common.rdcc = &(dset->shared->cache.chunk);
+
+    /* Reset information about the chunk we are looking for */
+    udata->nbytes = 0;
+    udata->filter_mask = 0;
+    udata->addr = HADDR_UNDEF;
+
+    /* Check for chunk in cache */
+    if(dset->shared->cache.chunk.nslots > 0)
+        for(ent = dset->shared->cache.chunk.slot[H5D_CHUNK_HASH(dset->shared, chunk_idx)];
+                ent; ent = ent->hnext) {
+            /* Skip chunks with a different index */
+            if(ent->chunk_idx != chunk_idx)
+                continue;
+
+            /* (Chunks outside the dataset's current dimensions can share an
+             *  index with a chunk inside them, so compare the offsets too) */
+            for(u = 0, found = TRUE; u < dset->shared->layout.u.chunk.ndims - 1;
+                    u++)
+                if(chunk_offset[u] != ent->offset[u]) {
+                    found = FALSE;
+                    break;
+                } /* end if */
+            if(found)
+                break;
+        } /* end for */
+
+    /* Find chunk addr */
+    if(found) {
+        udata->ent = ent;
+        udata->addr = ent->chunk_addr;
+    } /* end if */
     else {
-        /* Invalidate idx_hint, to signal that the chunk is not in cache */
-        udata->idx_hint = UINT_MAX;
-
-        /* Check for cached information */
-        if(!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
-            H5D_chk_idx_info_t idx_info;        /* Chunked index info */
-
-            /* Compose chunked index info struct */
-            idx_info.f = dset->oloc.file;
-            idx_info.dxpl_id = dxpl_id;
-            idx_info.pline = &dset->shared->dcpl_cache.pline;
-            idx_info.layout = &dset->shared->layout.u.chunk;
-            idx_info.storage = &dset->shared->layout.storage.u.chunk;
-
-            /* Go get the chunk information */
-            if((dset->shared->layout.storage.u.chunk.ops->get_addr)(&idx_info, udata) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
-
-            /* Cache the information retrieved */
-            H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
-        } /* end if */
+        /* Invalidate the entry, to signal that the chunk is not in cache */
+        udata->ent = NULL;
+
+        /* Look the chunk up in the index */
+        if(H5D__chunk_lookup_index(dset, dxpl_id, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
     } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_lookup() */
+} /* H5D__chunk_lookup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_lookup_index
+ *
+ * Purpose:	Retrieves the file address, size and filter mask of the
+ *		chunk set up in UDATA from the cached chunk information or,
+ *		failing that, from the chunk index, bypassing the raw data
+ *		chunk cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_lookup_index(const H5D_t *dset, hid_t dxpl_id, H5D_chunk_ud_t *udata)
+{
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(udata);
+
+    /* Check for cached information */
+    if(!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)
+            && !H5D__chunk_addr_found(dset, udata)) {
+        H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.dxpl_id = dxpl_id;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+        /* Go get the chunk information */
+        if((dset->shared->layout.storage.u.chunk.ops->get_addr)(&idx_info, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
+
+        /* Cache the information retrieved */
+        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+        if(H5D__chunk_addr_update(dset, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't update chunk address table")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_lookup_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_write_entry
+ *
+ * Purpose:	Writes the data for a cache entry, already run through the
+ *		filter pipeline (if any) and described by UDATA, to the file
+ *		and marks the entry clean.  If MUST_INSERT is set, the chunk
+ *		is first created in the index or resized.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_write_entry(const H5D_t *dset, hid_t dxpl_id, H5D_rdcc_ent_t *ent,
+    H5D_chunk_ud_t *udata, hbool_t must_insert, const void *buf)
+{
+    herr_t	ret_value = SUCCEED;	/* Return value			*/
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(ent);
+    HDassert(udata);
+    HDassert(buf);
+
+    /* Check if the chunk needs to be 'inserted' (could exist already and
+     *      the 'insert' operation could resize it)
+     */
+    if(must_insert) {
+        H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.dxpl_id = dxpl_id;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+        /* Create the chunk it if it doesn't exist, or reallocate the chunk
+         *  if its size changed.
+         */
+        if((dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk")
+
+        /* Update the chunk entry's address, in case it was allocated or relocated */
+        ent->chunk_addr = udata->addr;
+    } /* end if */
+
+    /* Write the data to the file */
+    HDassert(H5F_addr_defined(udata->addr));
+    if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata->addr, udata->nbytes, dxpl_id, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+
+    /* Cache the chunk's info, in case it's accessed again shortly */
+    H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+    if(must_insert && H5D__chunk_addr_update(dset, udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't update chunk address table")
+
+    /* Mark cache entry as clean */
+    ent->dirty = FALSE;
+
+    /* Increment # of flushed entries */
+    dset->shared->cache.chunk.stats.nflushes++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_write_entry() */
 
 
 /*-------------------------------------------------------------------------
@@ -2498,78 +4083,617 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
 #endif /* H5_SIZEOF_SIZE_T > 4 */
             H5_ASSIGN_OVERFLOW(udata.nbytes, nbytes, size_t, uint32_t);
 
-            /* Indicate that the chunk must go through 'insert' method */
-            must_insert = TRUE;
-        } /* end if */
-        else if(!H5F_addr_defined(udata.addr))
-            /* Indicate that the chunk must go through 'insert' method */
-            must_insert = TRUE;
+            /* Indicate that the chunk must go through 'insert' method */
+            must_insert = TRUE;
+        } /* end if */
+        else if(!H5F_addr_defined(udata.addr))
+            /* Indicate that the chunk must go through 'insert' method */
+            must_insert = TRUE;
+
+        /* Write the chunk to the file */
+        if(H5D__chunk_write_entry(dset, dxpl_id, ent, &udata, must_insert, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data chunk")
+    } /* end if */
+
+    /* Reset, but do not free or removed from list */
+    if(reset) {
+        point_of_no_return = FALSE;
+        if(buf == ent->chunk)
+            buf = NULL;
+        if(ent->chunk != NULL)
+            ent->chunk = (uint8_t *)H5D__chunk_xfree(ent->chunk, &(dset->shared->dcpl_cache.pline));
+    } /* end if */
+
+done:
+    /* Free the temp buffer only if it's different than the entry chunk */
+    if(buf != ent->chunk)
+        H5MM_xfree(buf);
+
+    /*
+     * If we reached the point of no return then we have no choice but to
+     * reset the entry.  This can only happen if RESET is true but the
+     * output pipeline failed.  Do not free the entry or remove it from the
+     * list.
+     */
+    if(ret_value < 0 && point_of_no_return) {
+        if(ent->chunk)
+            ent->chunk = (uint8_t *)H5D__chunk_xfree(ent->chunk, &(dset->shared->dcpl_cache.pline));
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_flush_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_flush_entries
+ *
+ * Purpose:	Writes the NENTS chunks in ENTS to disk, as
+ *		H5D__chunk_flush_entry() does for one chunk, but runs them all
+ *		through the filter pipeline at once, using NTHREADS threads.
+ *		The dataset must have filters.  The chunks are still written
+ *		to the file one at a time, in order.
+ *
+ *		If RESET is non-zero then the entries' chunks are released,
+ *		even if some of the chunks couldn't be written.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_flush_entries(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t **ents, size_t nents,
+    hbool_t reset, unsigned nthreads)
+{
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5Z_pipeline_job_t *jobs = NULL;    /* Filter jobs for the chunks */
+    size_t	chunk_size;             /* Size of a chunk */
+    size_t	u;                      /* Local index variable */
+    unsigned	nerrors = 0;            /* Count of chunks which couldn't be written */
+    herr_t	ret_value = SUCCEED;	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(dset);
+    HDassert(dxpl_cache);
+    HDassert(ents);
+    HDassert(pline->nused > 0);
+
+    H5_ASSIGN_OVERFLOW(chunk_size, dset->shared->layout.u.chunk.size, uint32_t, size_t);
+
+    if(NULL == (jobs = (H5Z_pipeline_job_t *)H5MM_calloc(nents * sizeof(H5Z_pipeline_job_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+
+    /* Set up a filter job for each dirty chunk */
+    for(u = 0; u < nents; u++) {
+        H5D_rdcc_ent_t *ent = ents[u];
+
+        HDassert(!ent->locked);
+        if(ent->dirty && !ent->deleted) {
+            if(!reset) {
+                /* Filter a copy of the chunk, to keep the original */
+                if(NULL == (jobs[u].buf = H5MM_malloc(chunk_size)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                HDmemcpy(jobs[u].buf, ent->chunk, chunk_size);
+            } /* end if */
+            else {
+                /* (As in H5D__chunk_flush_entry(), there is no way back
+                 *  once the chunk has been through the pipeline)
+                 */
+                jobs[u].buf = ent->chunk;
+                ent->chunk = NULL;
+            } /* end else */
+            jobs[u].nbytes = jobs[u].buf_size = chunk_size;
+        } /* end if */
+    } /* end for */
+
+    /* Filter the chunks (failures are counted below) */
+    if(H5Z_pipeline_mt(pline, 0, dxpl_cache->err_detect, dxpl_cache->filter_cb,
+            nthreads, nents, jobs) < 0)
+        nerrors++;
+
+    /* Write the chunks which were filtered */
+    for(u = 0; u < nents; u++)
+        if(jobs[u].buf && jobs[u].status >= 0) {
+            H5D_chunk_ud_t udata;	/* Pass through to index */
+
+            /* Set up user data for index callbacks */
+            udata.common.layout = &dset->shared->layout.u.chunk;
+            udata.common.storage = &dset->shared->layout.storage.u.chunk;
+            udata.common.offset = ents[u]->offset;
+            udata.common.rdcc = &(dset->shared->cache.chunk);
+            udata.filter_mask = jobs[u].filter_mask;
+            udata.addr = ents[u]->chunk_addr;
+
+#if H5_SIZEOF_SIZE_T > 4
+            /* Check for the chunk expanding too much to encode in a 32-bit value */
+            if(jobs[u].nbytes > ((size_t)0xffffffff)) {
+                nerrors++;
+                continue;
+            } /* end if */
+#endif /* H5_SIZEOF_SIZE_T > 4 */
+            H5_ASSIGN_OVERFLOW(udata.nbytes, jobs[u].nbytes, size_t, uint32_t);
+
+            if(H5D__chunk_write_entry(dset, dxpl_id, ents[u], &udata, TRUE, jobs[u].buf) < 0)
+                nerrors++;
+        } /* end if */
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+
+done:
+    /* Release the filtered chunks */
+    if(jobs) {
+        for(u = 0; u < nents; u++)
+            H5MM_xfree(jobs[u].buf);
+        H5MM_xfree(jobs);
+    } /* end if */
+
+    /* Release the entries' chunks */
+    if(reset)
+        for(u = 0; u < nents; u++)
+            if(ents[u]->chunk)
+                ents[u]->chunk = (uint8_t *)H5D__chunk_xfree(ents[u]->chunk, pline);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_flush_entries() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_grow
+ *
+ * Purpose:     Doubles the number of hash buckets in the raw data chunk
+ *              cache and moves the cached chunks (and the ghost entries of
+ *              an ARC cache) to their new buckets.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_grow(H5D_rdcc_t *rdcc)
+{
+    H5D_rdcc_ent_t **slot = NULL;       /* New chunk hash buckets */
+    H5D_rdcc_ghost_t **ghost_slot = NULL; /* New ghost hash buckets */
+    H5D_rdcc_ent_t *ent;                /* Chunk cache entry */
+    size_t nslots = 2 * rdcc->nslots;   /* New number of hash buckets */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rdcc);
+    HDassert(rdcc->slot);
+
+    /* Allocate the new hash tables */
+    if(NULL == (slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, nslots)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(rdcc->arc.slot)
+        if(NULL == (ghost_slot = H5FL_SEQ_CALLOC(H5D_rdcc_ghost_ptr_t, nslots)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Rehash the cached chunks */
+    for(ent = rdcc->head; ent; ent = ent->next) {
+        ent->idx = H5F_addr_hash(ent->chunk_idx, nslots);
+        ent->hnext = slot[ent->idx];
+        slot[ent->idx] = ent;
+    } /* end for */
+    rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    rdcc->slot = slot;
+    slot = NULL;
+
+    /* Rehash the ghost entries */
+    if(ghost_slot) {
+        H5D_rdcc_ghost_t *ghost;        /* Ghost entry */
+        unsigned u;                     /* Local index variable */
+
+        for(u = 0; u < 2; u++)
+            for(ghost = rdcc->arc.head[u]; ghost; ghost = ghost->next) {
+                ghost->idx = H5F_addr_hash(ghost->chunk_idx, nslots);
+                ghost->hnext = ghost_slot[ghost->idx];
+                ghost_slot[ghost->idx] = ghost;
+            } /* end for */
+        rdcc->arc.slot = H5FL_SEQ_FREE(H5D_rdcc_ghost_ptr_t, rdcc->arc.slot);
+        rdcc->arc.slot = ghost_slot;
+        ghost_slot = NULL;
+    } /* end if */
+
+    rdcc->nslots = nslots;
+
+done:
+    if(slot)
+        slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, slot);
+    if(ghost_slot)
+        ghost_slot = H5FL_SEQ_FREE(H5D_rdcc_ghost_ptr_t, ghost_slot);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_grow() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_unhash
+ *
+ * Purpose:     Removes a chunk's entry from its hash bucket.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_unhash(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    H5D_rdcc_ent_t **pent;              /* Pointer to link to entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+    HDassert(ent->idx < rdcc->nslots);
+
+    for(pent = &rdcc->slot[ent->idx]; *pent != ent; pent = &(*pent)->hnext)
+        HDassert(*pent);
+    *pent = ent->hnext;
+    ent->hnext = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_unhash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_touch
+ *
+ * Purpose:     Updates a cached chunk's position in the eviction order
+ *              when it is accessed again.
+ *
+ *              The W0 policy moves the chunk backward by one position in
+ *              the list, the other policies move it to the most recently
+ *              used end of the list.  ARC also promotes the chunk to its
+ *              "frequent" list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_touch(H5D_rdcc_t *rdcc, H5D_rdcc_ent_t *ent)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ent);
+
+    if(ent->naccess < UINT_MAX)
+        ent->naccess++;
+
+    if(H5D_CHUNK_CACHE_POLICY_W0 == rdcc->policy) {
+        /*
+         * The chunk is not at the beginning of the cache; move it backward
+         * by one slot.  This is how we implement the LRU preemption
+         * algorithm.
+         */
+        if(ent->next) {
+            if(ent->next->next)
+                ent->next->next->prev = ent;
+            else
+                rdcc->tail = ent;
+            ent->next->prev = ent->prev;
+            if(ent->prev)
+                ent->prev->next = ent->next;
+            else
+                rdcc->head = ent->next;
+            ent->prev = ent->next;
+            ent->next = ent->next->next;
+            ent->prev->next = ent;
+        } /* end if */
+    } /* end if */
+    else {
+        if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy && !ent->frequent) {
+            ent->frequent = TRUE;
+            rdcc->arc.nrecent--;
+        } /* end if */
+
+        /* Move the chunk to the tail of the list */
+        if(ent->next) {
+            ent->next->prev = ent->prev;
+            if(ent->prev)
+                ent->prev->next = ent->next;
+            else
+                rdcc->head = ent->next;
+            ent->prev = rdcc->tail;
+            ent->next = NULL;
+            rdcc->tail->next = ent;
+            rdcc->tail = ent;
+        } /* end if */
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_touch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_find
+ *
+ * Purpose:     Looks up a recently preempted chunk in the ghost lists of
+ *              an ARC chunk cache.
+ *
+ * Return:      Success:    Pointer to the chunk's ghost entry
+ *              Failure:    NULL, if the chunk isn't in the ghost lists
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcc_ghost_t *
+H5D__chunk_cache_ghost_find(const H5D_rdcc_t *rdcc, hsize_t chunk_idx)
+{
+    H5D_rdcc_ghost_t *ghost;            /* Ghost entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(rdcc->arc.slot);
+
+    for(ghost = rdcc->arc.slot[H5F_addr_hash(chunk_idx, rdcc->nslots)]; ghost; ghost = ghost->hnext)
+        if(ghost->chunk_idx == chunk_idx)
+            break;
+
+    FUNC_LEAVE_NOAPI(ghost)
+} /* end H5D__chunk_cache_ghost_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_remove
+ *
+ * Purpose:     Removes and frees a ghost entry of an ARC chunk cache.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_remove(H5D_rdcc_t *rdcc, H5D_rdcc_ghost_t *ghost)
+{
+    H5D_rdcc_ghost_t **pghost;          /* Pointer to link to ghost entry */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+    HDassert(ghost);
+    HDassert(ghost->list < 2);
+
+    /* Remove from hash bucket */
+    for(pghost = &rdcc->arc.slot[ghost->idx]; *pghost != ghost; pghost = &(*pghost)->hnext)
+        HDassert(*pghost);
+    *pghost = ghost->hnext;
+
+    /* Remove from ghost list */
+    if(ghost->prev)
+        ghost->prev->next = ghost->next;
+    else
+        rdcc->arc.head[ghost->list] = ghost->next;
+    if(ghost->next)
+        ghost->next->prev = ghost->prev;
+    else
+        rdcc->arc.tail[ghost->list] = ghost->prev;
+    rdcc->arc.nghosts[ghost->list]--;
+
+    ghost = H5FL_FREE(H5D_rdcc_ghost_t, ghost);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_add
+ *
+ * Purpose:     Remembers a chunk preempted from an ARC chunk cache on
+ *              ghost list LIST (0 for "recent" chunks, 1 for "frequent"
+ *              chunks), forgetting the oldest ghost on that list if it
+ *              already holds MAX_GHOSTS chunks.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_ghost_add(H5D_rdcc_t *rdcc, unsigned list, hsize_t chunk_idx,
+    size_t max_ghosts)
+{
+    H5D_rdcc_ghost_t *ghost;            /* New ghost entry */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(rdcc);
+    HDassert(rdcc->arc.slot);
+    HDassert(list < 2);
+
+    /* Make room on the list */
+    while(rdcc->arc.nghosts[list] > 0 && rdcc->arc.nghosts[list] >= max_ghosts)
+        H5D__chunk_cache_ghost_remove(rdcc, rdcc->arc.head[list]);
+
+    /* Create the ghost entry */
+    if(NULL == (ghost = H5FL_MALLOC(H5D_rdcc_ghost_t)))
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate raw data chunk ghost entry")
+    ghost->chunk_idx = chunk_idx;
+    ghost->list = list;
+
+    /* Add it to the hash table */
+    ghost->idx = H5F_addr_hash(chunk_idx, rdcc->nslots);
+    ghost->hnext = rdcc->arc.slot[ghost->idx];
+    rdcc->arc.slot[ghost->idx] = ghost;
+
+    /* Add it to the newest end of the ghost list */
+    ghost->next = NULL;
+    ghost->prev = rdcc->arc.tail[list];
+    if(ghost->prev)
+        ghost->prev->next = ghost;
+    else
+        rdcc->arc.head[list] = ghost;
+    rdcc->arc.tail[list] = ghost;
+    rdcc->arc.nghosts[list]++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_ghost_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_ghost_clear
+ *
+ * Purpose:     Forgets all the chunks on the ghost lists of an ARC chunk
+ *              cache.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_clear(H5D_rdcc_t *rdcc)
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(rdcc);
+
+    if(rdcc->arc.slot)
+        for(u = 0; u < 2; u++)
+            while(rdcc->arc.head[u])
+                H5D__chunk_cache_ghost_remove(rdcc, rdcc->arc.head[u]);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_clear() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_cache_victim
+ *
+ * Purpose:     Chooses the next chunk to preempt from the cache under the
+ *              LRU, LFU or ARC eviction policy.  (A W0 cache drawing on a
+ *              file's shared budget is treated as LRU.)  Locked chunks are
+ *              never chosen.
+ *
+ * Return:      Success:    Pointer to the chunk's cache entry
+ *              Failure:    NULL, if no chunk can be preempted
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_rdcc_ent_t *
+H5D__chunk_cache_victim(const H5D_rdcc_t *rdcc)
+{
+    H5D_rdcc_ent_t *ent;                /* Chunk cache entry */
+    H5D_rdcc_ent_t *ret_value = NULL;   /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
 
-        /* Check if the chunk needs to be 'inserted' (could exist already and
-         *      the 'insert' operation could resize it)
-         */
-        if(must_insert) {
-            H5D_chk_idx_info_t idx_info;        /* Chunked index info */
-
-            /* Compose chunked index info struct */
-            idx_info.f = dset->oloc.file;
-            idx_info.dxpl_id = dxpl_id;
-            idx_info.pline = &dset->shared->dcpl_cache.pline;
-            idx_info.layout = &dset->shared->layout.u.chunk;
-            idx_info.storage = &dset->shared->layout.storage.u.chunk;
-
-            /* Create the chunk it if it doesn't exist, or reallocate the chunk
-             *  if its size changed.
-             */
-            if((dset->shared->layout.storage.u.chunk.ops->insert)(&idx_info, &udata) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert/resize chunk")
+    HDassert(rdcc);
+    HDassert(rdcc->policy != H5D_CHUNK_CACHE_POLICY_W0 || rdcc->pool);
 
-            /* Update the chunk entry's address, in case it was allocated or relocated */
-            ent->chunk_addr = udata.addr;
-        } /* end if */
+    switch(rdcc->policy) {
+        case H5D_CHUNK_CACHE_POLICY_LFU:
+            /* The least often accessed chunk, least recently used first */
+            for(ent = rdcc->head; ent; ent = ent->next)
+                if(!ent->locked && (NULL == ret_value || ent->naccess < ret_value->naccess))
+                    ret_value = ent;
+            break;
 
-        /* Write the data to the file */
-        HDassert(H5F_addr_defined(udata.addr));
-        if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, udata.addr, udata.nbytes, dxpl_id, buf) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+        case H5D_CHUNK_CACHE_POLICY_ARC:
+            {
+                /* Preempt from the "recent" list while it's larger than its target */
+                hbool_t frequent = (hbool_t)(rdcc->arc.nrecent <= rdcc->arc.p);
+
+                /* The least recently used chunk on the chosen list */
+                for(ent = rdcc->head; ent; ent = ent->next)
+                    if(!ent->locked) {
+                        if(ent->frequent == frequent) {
+                            ret_value = ent;
+                            break;
+                        } /* end if */
+                        else if(NULL == ret_value)
+                            /* Fall back to the other list */
+                            ret_value = ent;
+                    } /* end if */
+            }
+            break;
 
-        /* Cache the chunk's info, in case it's accessed again shortly */
-        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+        case H5D_CHUNK_CACHE_POLICY_LRU:
+        case H5D_CHUNK_CACHE_POLICY_W0:
+        case H5D_CHUNK_CACHE_POLICY_ERROR:
+        case H5D_CHUNK_CACHE_POLICY_NTYPES:
+        default:
+            /* The least recently used chunk */
+            for(ent = rdcc->head; ent; ent = ent->next)
+                if(!ent->locked) {
+                    ret_value = ent;
+                    break;
+                } /* end if */
+            break;
+    } /* end switch */
 
-        /* Mark cache entry as clean */
-        ent->dirty = FALSE;
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_victim() */
 
-        /* Increment # of flushed entries */
-        dset->shared->cache.chunk.stats.nflushes++;
-    } /* end if */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_pool_unlink
+ *
+ * Purpose:     Removes a dataset's chunk cache from the access order of
+ *              the file's shared chunk cache budget.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_pool_unlink(H5D_rdcc_t *rdcc)
+{
+    H5F_rdcc_pool_t *pool = rdcc->pool; /* File's shared cache budget */
 
-    /* Reset, but do not free or removed from list */
-    if(reset) {
-        point_of_no_return = FALSE;
-        if(buf == ent->chunk)
-            buf = NULL;
-        if(ent->chunk != NULL)
-            ent->chunk = (uint8_t *)H5D__chunk_xfree(ent->chunk, &(dset->shared->dcpl_cache.pline));
-    } /* end if */
+    FUNC_ENTER_STATIC_NOERR
 
-done:
-    /* Free the temp buffer only if it's different than the entry chunk */
-    if(buf != ent->chunk)
-        H5MM_xfree(buf);
+    HDassert(pool);
 
-    /*
-     * If we reached the point of no return then we have no choice but to
-     * reset the entry.  This can only happen if RESET is true but the
-     * output pipeline failed.  Do not free the entry or remove it from the
-     * list.
-     */
-    if(ret_value < 0 && point_of_no_return) {
-        if(ent->chunk)
-            ent->chunk = (uint8_t *)H5D__chunk_xfree(ent->chunk, &(dset->shared->dcpl_cache.pline));
-    } /* end if */
+    if(rdcc->pool_prev)
+        rdcc->pool_prev->pool_next = rdcc->pool_next;
+    else
+        pool->head = rdcc->pool_next;
+    if(rdcc->pool_next)
+        rdcc->pool_next->pool_prev = rdcc->pool_prev;
+    else
+        pool->tail = rdcc->pool_prev;
+    rdcc->pool_prev = rdcc->pool_next = NULL;
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_flush_entry() */
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_pool_unlink() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_pool_append
+ *
+ * Purpose:     Makes a dataset's chunk cache the most recently accessed
+ *              one drawing on the file's shared chunk cache budget.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_pool_append(H5D_rdcc_t *rdcc)
+{
+    H5F_rdcc_pool_t *pool = rdcc->pool; /* File's shared cache budget */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(pool);
+    HDassert(NULL == rdcc->pool_prev && NULL == rdcc->pool_next);
+
+    rdcc->pool_prev = pool->tail;
+    if(pool->tail)
+        pool->tail->pool_next = rdcc;
+    else
+        pool->head = rdcc;
+    pool->tail = rdcc;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_pool_append() */
 
 
 /*-------------------------------------------------------------------------
@@ -2623,9 +4747,13 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     ent->prev = ent->next = NULL;
 
     /* Remove from cache */
-    rdcc->slot[ent->idx] = NULL;
+    H5D__chunk_cache_unhash(rdcc, ent);
     ent->idx = UINT_MAX;
+    if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy && !ent->frequent)
+        rdcc->arc.nrecent--;
     rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
+    if(rdcc->pool)
+        rdcc->pool->nbytes_used -= dset->shared->layout.u.chunk.size;
     --rdcc->nused;
 
     /* Free */
@@ -2640,7 +4768,12 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
  *
  * Purpose:	Prune the cache by preempting some things until the cache has
  *		room for something which is SIZE bytes.  Only unlocked
- *		entries are considered for preemption.
+ *		entries are considered for preemption, in the order chosen
+ *		by the cache's eviction policy.
+ *
+ *		When the cache draws on the file's shared budget, chunks
+ *		are preempted from the least recently accessed dataset
+ *		first, which may not be DSET.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -2653,7 +4786,7 @@ static herr_t
 H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, size_t size)
 {
-    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
+    H5D_rdcc_t		*rdcc = &(dset->shared->cache.chunk);
     size_t		total = rdcc->nbytes_max;
     const int		nmeth = 2;	/*number of methods		*/
     int		        w[1];		/*weighting as an interval	*/
@@ -2664,6 +4797,61 @@ H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
 
     FUNC_ENTER_STATIC
 
+    if(rdcc->pool) {
+        H5F_rdcc_pool_t *pool = rdcc->pool;     /* File's shared cache budget */
+
+        while((pool->nbytes_used + size) > pool->nbytes_max) {
+            H5D_rdcc_t *vrdcc;          /* Cache to preempt a chunk from */
+            const H5D_t *vdset;         /* Dataset owning that cache */
+
+            /* Find the least recently accessed dataset with a chunk to spare */
+            cur = NULL;
+            for(vrdcc = pool->head; vrdcc; vrdcc = vrdcc->pool_next)
+                if(NULL != (cur = H5D__chunk_cache_victim(vrdcc)))
+                    break;
+            if(NULL == cur)
+                break;
+            vdset = vrdcc->pool_dset;
+            HDassert(vdset);
+
+            /* Remember the chunk for adapting the ARC target size */
+            if(H5D_CHUNK_CACHE_POLICY_ARC == vrdcc->policy)
+                if(H5D__chunk_cache_ghost_add(vrdcc, (unsigned)cur->frequent, cur->chunk_idx,
+                        vrdcc->nbytes_max / vdset->shared->layout.u.chunk.size) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't remember preempted chunk")
+
+            vrdcc->stats.nevicts++;
+            if(H5D__chunk_cache_evict(vdset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
+                nerrors++;
+        } /* end while */
+
+        if(nerrors)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    if(H5D_CHUNK_CACHE_POLICY_W0 != rdcc->policy) {
+        size_t max_ghosts = rdcc->nbytes_max / dset->shared->layout.u.chunk.size;  /* Max. # of ARC ghosts on each list */
+
+        while((rdcc->nbytes_used + size) > total) {
+            if(NULL == (cur = H5D__chunk_cache_victim(rdcc)))
+                break;
+
+            /* Remember the chunk for adapting the ARC target size */
+            if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy)
+                if(H5D__chunk_cache_ghost_add(rdcc, (unsigned)cur->frequent, cur->chunk_idx, max_ghosts) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't remember preempted chunk")
+
+            rdcc->stats.nevicts++;
+            if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
+                nerrors++;
+        } /* end while */
+
+        if(nerrors)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /*
      * Preemption is accomplished by having multiple pointers (currently two)
      * slide down the list beginning at the head. Pointer p(N+1) will start
@@ -2723,6 +4911,7 @@ H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
 		    if(n[j] == cur)
                         n[j] = cur->next;
 		} /* end for */
+                rdcc->stats.nevicts++;
 		if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
                     nerrors++;
 	    } /* end if */
@@ -2749,11 +4938,9 @@ done:
  * Purpose:	Return a pointer to a dataset chunk.  The pointer points
  *		directly into the chunk cache and should not be freed
  *		by the caller but will be valid until it is unlocked.  The
- *		input value IDX_HINT is used to speed up cache lookups and
- *		it's output value should be given to H5D__chunk_unlock().
- *		IDX_HINT is ignored if it is out of range, and if it points
- *		to the wrong entry then we fall back to the normal search
- *		method.
+ *		input value UDATA->ENT is the chunk's cache entry found by
+ *		H5D__chunk_lookup() and it's output value should be given
+ *		to H5D__chunk_unlock().
  *
  *		If RELAX is non-zero and the chunk isn't in the cache then
  *		don't try to read it from the file, but just allocate an
@@ -2761,6 +4948,12 @@ done:
  *		for output functions that are about to overwrite the entire
  *		chunk.
  *
+ *		If PREREAD is non-NULL, it is the chunk (which must not be in
+ *		the cache) already read from the file and run back through
+ *		the filter pipeline by the caller, with UDATA describing the
+ *		unfiltered chunk.  The buffer is taken over by this routine,
+ *		whether or not it succeeds.
+ *
  * Return:	Success:	Ptr to a file chunk.
  *
  *		Failure:	NULL
@@ -2772,7 +4965,7 @@ done:
  */
 void *
 H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
-    hbool_t relax)
+    hbool_t relax, void *preread)
 {
     H5D_t *dset = io_info->dset;                /* Local pointer to the dataset info */
     const H5O_pline_t   *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info - always equal to the pline passed to H5D__chunk_alloc */
@@ -2796,19 +4989,27 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     HDassert(udata);
     HDassert(dset);
     HDassert(TRUE == H5P_isa_class(io_info->dxpl_id, H5P_DATASET_XFER));
+    HDassert(!preread || (NULL == udata->ent && !relax && H5F_addr_defined(udata->addr)));
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
     H5_ASSIGN_OVERFLOW(chunk_size, layout->u.chunk.size, uint32_t, size_t);
 
-    /* Check if the chunk is in the cache */
-    if(UINT_MAX != udata->idx_hint) {
-        /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
-        HDassert(rdcc->slot[udata->idx_hint]);
+    /* Make this the most recently accessed dataset sharing the file's cache
+     * budget, and flush its chunks through this handle from now on */
+    if(rdcc->pool) {
+        rdcc->pool_dset = dset;
+        if(rdcc->pool->tail != rdcc) {
+            H5D__chunk_pool_unlink(rdcc);
+            H5D__chunk_pool_append(rdcc);
+        } /* end if */
+    } /* end if */
 
+    /* Check if the chunk is in the cache */
+    if(udata->ent) {
         /* Get the entry */
-        ent = rdcc->slot[udata->idx_hint];
+        ent = udata->ent;
+        HDassert(ent->idx < rdcc->nslots);
 
 #ifndef NDEBUG
         /* Make sure this is the right chunk */
@@ -2851,22 +5052,27 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
         /* Check if the chunk exists on disk */
         if(H5F_addr_defined(chunk_addr)) {
-            size_t		chunk_alloc = 0;		/*allocated chunk size	*/
-
-            /* Chunk size on disk isn't [likely] the same size as the final chunk
-             * size in memory, so allocate memory big enough. */
-            H5_ASSIGN_OVERFLOW(chunk_alloc, udata->nbytes, uint32_t, size_t);
-            if(NULL == (chunk = H5D__chunk_alloc(chunk_alloc, pline)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
-            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, chunk_alloc, io_info->dxpl_id, chunk) < 0)
-                HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
-
-            if(pline->nused) {
-                if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), io_info->dxpl_cache->err_detect,
-                        io_info->dxpl_cache->filter_cb, &chunk_alloc, &chunk_alloc, &chunk) < 0)
-                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
-                H5_ASSIGN_OVERFLOW(udata->nbytes, chunk_alloc, size_t, uint32_t);
-            } /* end if */
+            if(preread)
+                /* Use the chunk read in by the caller */
+                chunk = preread;
+            else {
+                size_t		chunk_alloc = 0;		/*allocated chunk size	*/
+
+                /* Chunk size on disk isn't [likely] the same size as the final chunk
+                 * size in memory, so allocate memory big enough. */
+                H5_ASSIGN_OVERFLOW(chunk_alloc, udata->nbytes, uint32_t, size_t);
+                if(NULL == (chunk = H5D__chunk_alloc(chunk_alloc, pline)))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
+                if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, chunk_alloc, io_info->dxpl_id, chunk) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
+
+                if(pline->nused) {
+                    if(H5Z_pipeline(pline, H5Z_FLAG_REVERSE, &(udata->filter_mask), io_info->dxpl_cache->err_detect,
+                            io_info->dxpl_cache->filter_cb, &chunk_alloc, &chunk_alloc, &chunk) < 0)
+                        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
+                    H5_ASSIGN_OVERFLOW(udata->nbytes, chunk_alloc, size_t, uint32_t);
+                } /* end if */
+            } /* end else */
 
             /* Increment # of cache misses */
             rdcc->stats.nmisses++;
@@ -2915,79 +5121,87 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     } /* end else */
     HDassert(chunk_size > 0);
 
-    if(ent) {
-        /*
-         * The chunk is not at the beginning of the cache; move it backward
-         * by one slot.  This is how we implement the LRU preemption
-         * algorithm.
-         */
-        HDassert(ent);
-        if(ent->next) {
-            if(ent->next->next)
-                ent->next->next->prev = ent;
-            else
-                rdcc->tail = ent;
-            ent->next->prev = ent->prev;
-            if(ent->prev)
-                ent->prev->next = ent->next;
-            else
-                rdcc->head = ent->next;
-            ent->prev = ent->next;
-            ent->next = ent->next->next;
-            ent->prev->next = ent;
-        } /* end if */
-    } /* end if */
+    if(ent)
+        /* Update the chunk's position in the eviction order */
+        H5D__chunk_cache_touch(rdcc, ent);
     else if(rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
-        /* Calculate the index */
-        udata->idx_hint = H5D_CHUNK_HASH(dset->shared, io_info->store->chunk.index);
-
-        /* Add the chunk to the cache only if the slot is not already locked */
-        ent = rdcc->slot[udata->idx_hint];
-        if(!ent || !ent->locked) {
-            /* Preempt enough things from the cache to make room */
-            if(ent) {
-                if(H5D__chunk_cache_evict(io_info->dset, io_info->dxpl_id, io_info->dxpl_cache, ent, TRUE) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
-            } /* end if */
-            if(H5D__chunk_cache_prune(io_info->dset, io_info->dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
-                HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
-
-            /* Create a new entry */
-            if(NULL == (ent = H5FL_MALLOC(H5D_rdcc_ent_t)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
-
-            ent->locked = 0;
-            ent->dirty = FALSE;
-            ent->deleted = FALSE;
-            ent->chunk_addr = chunk_addr;
-            for(u = 0; u < layout->u.chunk.ndims; u++)
-                ent->offset[u] = io_info->store->chunk.offset[u];
-            H5_ASSIGN_OVERFLOW(ent->rd_count, chunk_size, size_t, uint32_t);
-            H5_ASSIGN_OVERFLOW(ent->wr_count, chunk_size, size_t, uint32_t);
-            ent->chunk = (uint8_t *)chunk;
-
-            /* Add it to the cache */
-            HDassert(NULL == rdcc->slot[udata->idx_hint]);
-            rdcc->slot[udata->idx_hint] = ent;
-            ent->idx = udata->idx_hint;
-            rdcc->nbytes_used += chunk_size;
-            rdcc->nused++;
-
-            /* Add it to the linked list */
-            ent->next = NULL;
-            if(rdcc->tail) {
-                rdcc->tail->next = ent;
-                ent->prev = rdcc->tail;
-                rdcc->tail = ent;
+        hsize_t chunk_idx = io_info->store->chunk.index; /* Chunk's index in dataset */
+        hbool_t frequent = FALSE;       /* Whether the chunk was recently preempted */
+
+        /* Adapt the ARC target size if the chunk was recently preempted */
+        if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy) {
+            H5D_rdcc_ghost_t *ghost;    /* Chunk's ghost entry */
+
+            if(NULL != (ghost = H5D__chunk_cache_ghost_find(rdcc, chunk_idx))) {
+                size_t nrecent = rdcc->arc.nghosts[0]; /* # of preempted "recent" chunks */
+                size_t nfrequent = rdcc->arc.nghosts[1]; /* # of preempted "frequent" chunks */
+
+                /* Favor the list the chunk would have stayed in if it had
+                 * been larger */
+                if(0 == ghost->list)
+                    rdcc->arc.p = MIN(rdcc->arc.p + MAX(nfrequent / nrecent, 1),
+                            rdcc->nbytes_max / chunk_size);
+                else {
+                    size_t delta = MAX(nrecent / nfrequent, 1);
+
+                    rdcc->arc.p = rdcc->arc.p > delta ? rdcc->arc.p - delta : 0;
+                } /* end else */
+                H5D__chunk_cache_ghost_remove(rdcc, ghost);
+                frequent = TRUE;
             } /* end if */
-            else {
-                rdcc->head = rdcc->tail = ent;
-                ent->prev = NULL;
-            } /* end else */
         } /* end if */
-        else
-            /* We did not add the chunk to cache */
-            ent = NULL;
+
+        /* Preempt enough things from the cache to make room */
+        if(H5D__chunk_cache_prune(io_info->dset, io_info->dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
+
+        /* Create a new entry */
+        if(NULL == (ent = H5FL_MALLOC(H5D_rdcc_ent_t)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
+
+        ent->locked = 0;
+        ent->dirty = FALSE;
+        ent->deleted = FALSE;
+        ent->chunk_addr = chunk_addr;
+        for(u = 0; u < layout->u.chunk.ndims; u++)
+            ent->offset[u] = io_info->store->chunk.offset[u];
+        H5_ASSIGN_OVERFLOW(ent->rd_count, chunk_size, size_t, uint32_t);
+        H5_ASSIGN_OVERFLOW(ent->wr_count, chunk_size, size_t, uint32_t);
+        ent->chunk = (uint8_t *)chunk;
+        ent->chunk_idx = chunk_idx;
+        ent->naccess = 1;
+        ent->frequent = frequent;
+        if(H5D_CHUNK_CACHE_POLICY_ARC == rdcc->policy && !frequent)
+            rdcc->arc.nrecent++;
+
+        /* Add it to the cache */
+        ent->idx = H5D_CHUNK_HASH(dset->shared, chunk_idx);
+        ent->hnext = rdcc->slot[ent->idx];
+        rdcc->slot[ent->idx] = ent;
+        rdcc->nbytes_used += chunk_size;
+        if(rdcc->pool)
+            rdcc->pool->nbytes_used += chunk_size;
+        rdcc->nused++;
+
+        /* Add it to the linked list */
+        ent->next = NULL;
+        if(rdcc->tail) {
+            rdcc->tail->next = ent;
+            ent->prev = rdcc->tail;
+            rdcc->tail = ent;
+        } /* end if */
+        else {
+            rdcc->head = rdcc->tail = ent;
+            ent->prev = NULL;
+        } /* end else */
+
+        /* Keep the hash chains short as the cache fills up */
+        if((size_t)rdcc->nused > rdcc->nslots)
+            if(H5D__chunk_cache_grow(rdcc) < 0) {
+                /* (The chunk belongs to the cache now) */
+                chunk = NULL;
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't grow raw data chunk cache")
+            } /* end if */
     } /* end else */
 
     if(!ent)
@@ -2996,7 +5210,9 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
          * reason all those arguments have to be repeated for the unlock
          * function.
          */
-        udata->idx_hint = UINT_MAX;
+        udata->ent = NULL;
+    else
+        udata->ent = ent;
 
     /* Lock the chunk into the cache */
     if(ent) {
@@ -3049,7 +5265,6 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     hbool_t dirty, void *chunk, uint32_t naccessed)
 {
     const H5O_layout_t *layout = &(io_info->dset->shared->layout); /* Dataset layout */
-    const H5D_rdcc_t	*rdcc = &(io_info->dset->shared->cache.chunk);
     herr_t              ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -3057,7 +5272,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     HDassert(io_info);
     HDassert(udata);
 
-    if(UINT_MAX == udata->idx_hint) {
+    if(NULL == udata->ent) {
         /*
          * It's not in the cache, probably because it's too big.  If it's
          * dirty then flush it to disk.  In any case, free the chunk.
@@ -3085,15 +5300,12 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     else {
         H5D_rdcc_ent_t	*ent;   /* Chunk's entry in the cache */
 
-        /* Sanity check */
-	HDassert(udata->idx_hint < rdcc->nslots);
-	HDassert(rdcc->slot[udata->idx_hint]);
-	HDassert(rdcc->slot[udata->idx_hint]->chunk == chunk);
-
         /*
          * It's in the cache so unlock it.
          */
-        ent = rdcc->slot[udata->idx_hint];
+        ent = udata->ent;
+        HDassert(ent->idx < io_info->dset->shared->cache.chunk.nslots);
+        HDassert(ent->chunk == chunk);
         HDassert(ent->locked);
         if(dirty) {
             ent->dirty = TRUE;
@@ -3481,6 +5693,8 @@ H5D__chunk_allocate(H5D_t *dset, hid_t dxpl_id, hbool_t full_overwrite,
             if((ops->insert)(&idx_info, &udata) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert record into chunk index")
             HDassert(H5F_addr_defined(udata.addr));
+            if(H5D__chunk_addr_update(dset, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't update chunk address table")
 
             /* Check if fill values should be written to chunks */
             if(should_fill) {
@@ -3604,7 +5818,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata)
 
     /* If this chunk does not exist in cache or on disk, no need to do anything
      */
-    if(!H5F_addr_defined(chk_udata.addr) && UINT_MAX == chk_udata.idx_hint)
+    if(!H5F_addr_defined(chk_udata.addr) && NULL == chk_udata.ent)
         HGOTO_DONE(SUCCEED)
 
     /* Initialize the fill value buffer, if necessary */
@@ -3634,7 +5848,7 @@ H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to select hyperslab")
 
     /* Lock the chunk into the cache, to get a pointer to the chunk buffer */
-    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE)))
+    if(NULL == (chunk = (void *)H5D__chunk_lock(io_info, &chk_udata, FALSE, NULL)))
         HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to lock raw data chunk")
 
 
@@ -4014,9 +6228,9 @@ H5D__chunk_prune_by_extent(H5D_t *dset, hid_t dxpl_id, const hsize_t *old_dim)
 
                 /* Evict the entry from the cache if present, but do not flush
                  * it to disk */
-                if(UINT_MAX != chk_udata.idx_hint) {
+                if(chk_udata.ent) {
                     if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache,
-                            rdcc->slot[chk_udata.idx_hint], FALSE) < 0)
+                            chk_udata.ent, FALSE) < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
                 } /* end if */
 
@@ -4029,6 +6243,13 @@ H5D__chunk_prune_by_extent(H5D_t *dset, hid_t dxpl_id, const hsize_t *old_dim)
                     if((layout->storage.u.chunk.ops->remove)(&idx_info, &idx_udata)
                             < 0)
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTDELETE, FAIL, "unable to remove chunk entry from index")
+
+                    /* Forget the chunk's address */
+                    chk_udata.nbytes = 0;
+                    chk_udata.filter_mask = 0;
+                    chk_udata.addr = HADDR_UNDEF;
+                    if(H5D__chunk_addr_update(dset, &chk_udata) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't update chunk address table")
                 } /* end if */
             } /* end else */
 
@@ -4149,6 +6370,7 @@ H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[])
 {
     H5D_chk_idx_info_t idx_info;        /* Chunked index info */
     H5D_t *dset = io_info->dset;        /* Local pointer to dataset info */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);  /* Dataset's chunk cache */
     H5D_chunk_it_ud2_t udata;          	/* User data for iteration callback */
     herr_t ret_value = SUCCEED;         /* Return value */
 
@@ -4158,6 +6380,23 @@ H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[])
     HDassert(dset->shared);
     HDassert(chunk_addr);
 
+    /* Use the chunk address table, if it holds every chunk */
+    if(rdcc->addr.complete && dset->shared->layout.u.chunk.nchunks <= H5D_CHUNK_ADDR_MAX_NELMTS) {
+        hsize_t u;                      /* Local index variable */
+
+        for(u = 0; u < dset->shared->layout.u.chunk.nchunks; u++) {
+            size_t blk = (size_t)(u / H5D_CHUNK_ADDR_DBLK_NELMTS);     /* Data block holding the chunk */
+
+            if(blk < rdcc->addr.nblocks && rdcc->addr.block[blk]
+                    && rdcc->addr.block[blk][u % H5D_CHUNK_ADDR_DBLK_NELMTS].valid)
+                chunk_addr[u] = rdcc->addr.block[blk][u % H5D_CHUNK_ADDR_DBLK_NELMTS].addr;
+            else
+                chunk_addr[u] = HADDR_UNDEF;
+        } /* end for */
+
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Set up user data for B-tree callback */
     HDmemset(&udata, 0, sizeof(udata));
     udata.common.layout = &dset->shared->layout.u.chunk;
@@ -4181,6 +6420,88 @@ done:
 } /* end H5D__chunk_addrmap() */
 #endif /* H5_HAVE_PARALLEL */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_iter_cb
+ *
+ * Purpose:	Callback when reporting each chunk to the application
+ *
+ * Return:	Value returned by the application's operator
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_iter_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_it_ud6_t	*udata = (H5D_chunk_it_ud6_t *)_udata;  /* User data for callback */
+    int                 ret_value;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Make the application's callback */
+    ret_value = (udata->op)(chunk_rec->offset, chunk_rec->filter_mask,
+            chunk_rec->chunk_addr, (hsize_t)chunk_rec->nbytes, udata->op_data);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_iter_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_iter
+ *
+ * Purpose:	Iterate over the chunks of a dataset that exist in the file,
+ *              after writing any chunks in the chunk cache to the file.
+ *
+ * Return:	Success:	Last value returned by the operator
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_iter(H5D_t *dset, hid_t dxpl_id, H5D_chunk_iter_op_t op,
+    void *op_data)
+{
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_chunk_it_ud6_t udata;          	/* User data for iteration callback */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+    HDassert(dset->shared);
+    HDassert(op);
+
+    /* Write cached chunks to the file, so they have their final addresses */
+    if(H5D__chunk_flush(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush raw data chunks")
+
+    /* Nothing to do if no chunks have been allocated */
+    if(!(*dset->shared->layout.ops->is_space_alloc)(&dset->shared->layout.storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Set up user data for B-tree callback */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.common.layout = &dset->shared->layout.u.chunk;
+    udata.common.storage = &dset->shared->layout.storage.u.chunk;
+    udata.common.rdcc = &(dset->shared->cache.chunk);
+    udata.op = op;
+    udata.op_data = op_data;
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = dxpl_id;
+    idx_info.pline = &dset->shared->dcpl_cache.pline;
+    idx_info.layout = &dset->shared->layout.u.chunk;
+    idx_info.storage = &dset->shared->layout.storage.u.chunk;
+
+    /* Iterate over the chunks */
+    if((ret_value = (dset->shared->layout.storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_iter_cb, &udata)) < 0)
+        HERROR(H5E_DATASET, H5E_BADITER, "unable to iterate over chunk index");
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_iter() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_delete
@@ -4274,13 +6595,10 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id)
+H5D__chunk_update_cache(H5D_t *dset, hid_t UNUSED dxpl_id)
 {
     H5D_rdcc_t         *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
-    H5D_rdcc_ent_t     *ent, *next;	/*cache entry  */
-    H5D_rdcc_ent_t     *old_ent;	/* Old cache entry  */
-    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
-    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_rdcc_ent_t     *ent;		/*cache entry  */
     unsigned            rank;	        /*current # of dimensions */
     herr_t              ret_value = SUCCEED;      /* Return value */
 
@@ -4298,46 +6616,27 @@ H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id)
     if(rank == 1)
         HGOTO_DONE(SUCCEED)
 
-    /* Fill the DXPL cache values for later use */
-    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+    /* The ghost entries of an ARC cache and the read-ahead history refer
+     * to the old chunk indices */
+    H5D__chunk_cache_ghost_clear(rdcc);
+    rdcc->prefetch.valid = FALSE;
+    rdcc->prefetch.nseq = 0;
 
     /* Recompute the index for each cached chunk that is in a dataset */
-    for(ent = rdcc->head; ent; ent = next) {
+    for(ent = rdcc->head; ent; ent = ent->next) {
         hsize_t             idx;        /* Chunk index */
-        unsigned	    old_idx;	/* Previous index number	*/
-
-        /* Get the pointer to the next cache entry */
-        next = ent->next;
 
         /* Calculate the index of this chunk */
         if(H5V_chunk_index(rank, ent->offset, dset->shared->layout.u.chunk.dim, dset->shared->layout.u.chunk.down_chunks, &idx) < 0)
             HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "can't get chunk index")
 
-        /* Compute the index for the chunk entry */
-        old_idx = ent->idx;   /* Save for later */
-        ent->idx = H5D_CHUNK_HASH(dset->shared, idx);
-
-        if(old_idx != ent->idx) {
-            /* Check if there is already a chunk at this chunk's new location */
-            old_ent = rdcc->slot[ent->idx];
-            if(old_ent != NULL) {
-                HDassert(old_ent->locked == 0);
-
-                /* Check if we are removing the entry we would walk to next */
-                if(old_ent == next)
-                    next = old_ent->next;
-
-                /* Remove the old entry from the cache */
-                if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, old_ent, TRUE) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
-            } /* end if */
-
-            /* Insert this chunk into correct location in hash table */
+        /* Move the chunk to its new hash bucket, if it changed */
+        ent->chunk_idx = idx;
+        if(H5D_CHUNK_HASH(dset->shared, idx) != ent->idx) {
+            H5D__chunk_cache_unhash(rdcc, ent);
+            ent->idx = H5D_CHUNK_HASH(dset->shared, idx);
+            ent->hnext = rdcc->slot[ent->idx];
             rdcc->slot[ent->idx] = ent;
-
-            /* Null out previous location */
-            rdcc->slot[old_idx] = NULL;
         } /* end if */
     } /* end for */
 
@@ -4967,9 +7266,17 @@ H5D__chunk_dest(H5F_t *f, hid_t dxpl_id, H5D_t *dset)
     if(nerrors)
 	HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
+    /* Stop sharing the file's cache budget */
+    if(rdcc->pool)
+        H5D__chunk_pool_unlink(rdcc);
+
     /* Release cache structures */
+    H5D__chunk_cache_ghost_clear(rdcc);
+    if(rdcc->arc.slot)
+        rdcc->arc.slot = H5FL_SEQ_FREE(H5D_rdcc_ghost_ptr_t, rdcc->arc.slot);
     if(rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    H5D__chunk_addr_reset(rdcc);
     HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
 
     /* Compose chunked index info struct */
@@ -4987,6 +7294,56 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_dest() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_release_handle
+ *
+ * Purpose:	Called when one of several open handles for a dataset is
+ *		closed.  If the dataset's cache draws on the file's shared
+ *		budget and preempts chunks through this handle, flush and
+ *		preempt them now, since another dataset may need to preempt
+ *		them after the handle is gone.  (The next access through
+ *		another handle attaches it instead.)
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_release_handle(const H5D_t *dset, hid_t dxpl_id)
+{
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5D_rdcc_ent_t	*ent = NULL, *next = NULL;      /* Pointer to current & next cache entries */
+    int		nerrors = 0;            /* Accumulated count of errors */
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset);
+
+    if(rdcc->pool && rdcc->pool_dset == dset) {
+        /* Fill the DXPL cache values for later use */
+        if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+        /* Flush and preempt all the cached chunks */
+        for(ent = rdcc->head; ent; ent = next) {
+            next = ent->next;
+            if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
+                nerrors++;
+        } /* end for */
+        rdcc->pool_dset = NULL;
+
+        if(nerrors)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_release_handle() */
+
 #ifdef H5D_CHUNK_DEBUG
 
 /*-------------------------------------------------------------------------
@@ -5029,9 +7386,9 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
 #endif
 
     if (headers) {
-        if (rdcc->nhits>0 || rdcc->nmisses>0) {
-            miss_rate = 100.0 * rdcc->nmisses /
-                    (rdcc->nhits + rdcc->nmisses);
+        if (rdcc->stats.nhits>0 || rdcc->stats.nmisses>0) {
+            miss_rate = 100.0 * rdcc->stats.nmisses /
+                    (rdcc->stats.nhits + rdcc->stats.nmisses);
         } else {
             miss_rate = 0.0;
         }
@@ -5041,9 +7398,9 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
             sprintf(ascii, "%7.2f%%", miss_rate);
         }
 
-        fprintf(H5DEBUG(AC), "   %-18s %8u %8u %7s %8d+%-9ld\n",
-            "raw data chunks", rdcc->nhits, rdcc->nmisses, ascii,
-            rdcc->ninits, (long)(rdcc->nflushes)-(long)(rdcc->ninits));
+        HDfprintf(H5DEBUG(AC), "   %-18s %8Hu %8Hu %7s %8Hu+%-9ld\n",
+            "raw data chunks", rdcc->stats.nhits, rdcc->stats.nmisses, ascii,
+            rdcc->stats.ninits, (long)(rdcc->stats.nflushes)-(long)(rdcc->stats.ninits));
     }
 
 done:
@@ -55,6 +55,17 @@
 /* Local Typedefs */
 /******************/
 
+/* Raw data requests gathered for one vector read or write */
+typedef struct H5D_contig_iovec_t {
+    size_t nseq;                        /* Number of requests gathered */
+    haddr_t addr[H5D_IO_VECTOR_SIZE];   /* File address of each request */
+    size_t len[H5D_IO_VECTOR_SIZE];     /* Length of each request */
+    union {
+        void *rbuf[H5D_IO_VECTOR_SIZE];         /* Buffer to read each request into */
+        const void *wbuf[H5D_IO_VECTOR_SIZE];   /* Buffer to write each request from */
+    } u;
+} H5D_contig_iovec_t;
+
 /* Callback info for sieve buffer readvv operation */
 typedef struct H5D_contig_readvv_sieve_ud_t {
     H5F_t *file;                /* File for dataset */
@@ -62,6 +73,7 @@ typedef struct H5D_contig_readvv_sieve_ud_t {
     const H5D_contig_storage_t *store_contig;    /* Contiguous storage info for this I/O operation */
     unsigned char *rbuf;        /* Pointer to buffer to fill */
     hid_t dxpl_id;              /* DXPL for operation */
+    H5D_contig_iovec_t *vec;    /* Direct reads gathered, or NULL */
 } H5D_contig_readvv_sieve_ud_t;
 
 /* Callback info for [plain] readvv operation */
@@ -70,6 +82,7 @@ typedef struct H5D_contig_readvv_ud_t {
     haddr_t dset_addr;          /* Address of dataset */
     unsigned char *rbuf;        /* Pointer to buffer to fill */
     hid_t dxpl_id;              /* DXPL for operation */
+    H5D_contig_iovec_t *vec;    /* Reads gathered, or NULL */
 } H5D_contig_readvv_ud_t;
 
 /* Callback info for sieve buffer writevv operation */
@@ -79,6 +92,7 @@ typedef struct H5D_contig_writevv_sieve_ud_t {
     const H5D_contig_storage_t *store_contig;    /* Contiguous storage info for this I/O operation */
     const unsigned char *wbuf;  /* Pointer to buffer to write */
     hid_t dxpl_id;              /* DXPL for operation */
+    H5D_contig_iovec_t *vec;    /* Direct writes gathered, or NULL */
 } H5D_contig_writevv_sieve_ud_t;
 
 /* Callback info for [plain] writevv operation */
@@ -87,6 +101,7 @@ typedef struct H5D_contig_writevv_ud_t {
     haddr_t dset_addr;          /* Address of dataset */
     const unsigned char *wbuf;  /* Pointer to buffer to write */
     hid_t dxpl_id;              /* DXPL for operation */
+    H5D_contig_iovec_t *vec;    /* Writes gathered, or NULL */
 } H5D_contig_writevv_ud_t;
 
 
@@ -108,8 +123,21 @@ static ssize_t H5D__contig_writevv(const H5D_io_info_t *io_info,
 static herr_t H5D__contig_flush(H5D_t *dset, hid_t dxpl_id);
 
 /* Helper routines */
+static htri_t H5D__contig_read_block(H5D_io_info_t *io_info,
+    const H5D_type_info_t *type_info, hsize_t nelmts, const H5S_t *file_space,
+    const H5S_t *mem_space);
 static herr_t H5D__contig_write_one(H5D_io_info_t *io_info, hsize_t offset,
     size_t size);
+static H5D_contig_iovec_t *H5D__contig_iovec_new(const H5F_t *file,
+    size_t dset_nseq, size_t mem_nseq);
+static herr_t H5D__contig_queue_read(H5F_t *file, hid_t dxpl_id,
+    H5D_contig_iovec_t *vec, haddr_t addr, size_t len, void *buf);
+static herr_t H5D__contig_flush_reads(H5F_t *file, hid_t dxpl_id,
+    H5D_contig_iovec_t *vec);
+static herr_t H5D__contig_queue_write(H5F_t *file, hid_t dxpl_id,
+    H5D_contig_iovec_t *vec, haddr_t addr, size_t len, const void *buf);
+static herr_t H5D__contig_flush_writes(H5F_t *file, hid_t dxpl_id,
+    H5D_contig_iovec_t *vec);
 
 
 /*********************/
@@ -145,6 +173,8 @@ H5FL_BLK_DEFINE(sieve_buf);
 /* Declare extern the free list to manage blocks of type conversion data */
 H5FL_BLK_EXTERN(type_conv);
 
+/* Declare a free list to manage lists of gathered raw data requests */
+H5FL_DEFINE_STATIC(H5D_contig_iovec_t);
 
 
 /*-------------------------------------------------------------------------
@@ -527,6 +557,7 @@ H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
     H5D_chunk_map_t UNUSED *fm)
 {
+    htri_t      block_read;             /* Whether the data was read as one block */
     herr_t	ret_value = SUCCEED;	/*return value		*/
 
     FUNC_ENTER_PACKAGE
@@ -538,14 +569,194 @@ H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     HDassert(mem_space);
     HDassert(file_space);
 
+    /* Read data straight into the buffer when it's one block in both places */
+    if((block_read = H5D__contig_read_block(io_info, type_info, nelmts, file_space, mem_space)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous block read failed")
+
     /* Read data */
-    if((io_info->io_ops.single_read)(io_info, type_info, nelmts, file_space, mem_space) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous read failed")
+    if(!block_read)
+        if((io_info->io_ops.single_read)(io_info, type_info, nelmts, file_space, mem_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "contiguous read failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__contig_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_read_block
+ *
+ * Purpose:	Reads the selection with a single block read straight into
+ *		the application's buffer, when the data needs no conversion
+ *		and the file and memory selections are each one contiguous
+ *		block.  This skips building sequence lists for the
+ *		selections and copying the data through the sieve buffer.
+ *
+ *		Reads small enough to fit in the sieve buffer are left to
+ *		the usual path, so they still fill the sieve buffer for
+ *		later reads.
+ *
+ * Return:	Success:	TRUE if the data was read, FALSE if the
+ *				read needs the usual path
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__contig_read_block(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space)
+{
+    H5F_t *file = io_info->dset->oloc.file;     /* File for dataset */
+    H5D_rdcdc_t *dset_contig = &(io_info->dset->shared->cache.contig); /* Cached information about contiguous data */
+    hsize_t file_off;           /* Offset of selection in the dataset (in elements) */
+    hsize_t mem_off;            /* Offset of selection in memory (in elements) */
+    haddr_t addr;               /* Address of data to read */
+    size_t len;                 /* Size of data to read */
+    void *buf;                  /* Where the data goes in memory */
+    htri_t is_contig;           /* Whether a selection is one block */
+    htri_t ret_value = FALSE;   /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Only the plain contiguous layout, with no conversion or transform */
+    if(io_info->layout_ops.readvv != H5D__contig_readvv
+            || io_info->io_ops.single_read != H5D__select_read)
+        HGOTO_DONE(FALSE)
+    if(!H5F_addr_defined(io_info->store->contig.dset_addr))
+        HGOTO_DONE(FALSE)
+
+    /* Size of the data, leaving small reads to the sieve buffer */
+    if(nelmts == 0 || nelmts > (hsize_t)((size_t)-1 / type_info->src_type_size))
+        HGOTO_DONE(FALSE)
+    len = (size_t)nelmts * type_info->src_type_size;
+    if(H5F_HAS_FEATURE(file, H5FD_FEAT_DATA_SIEVE) && len <= dset_contig->sieve_buf_size)
+        HGOTO_DONE(FALSE)
+
+    /* Both selections must be one block */
+    if((is_contig = H5S_SELECT_IS_CONTIGUOUS(file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check file selection")
+    if(!is_contig)
+        HGOTO_DONE(FALSE)
+    if((is_contig = H5S_SELECT_IS_CONTIGUOUS(mem_space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check memory selection")
+    if(!is_contig)
+        HGOTO_DONE(FALSE)
+
+    /* Locate the block in the file and in memory */
+    if(H5S_SELECT_OFFSET(file_space, &file_off) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection offset")
+    if(H5S_SELECT_OFFSET(mem_space, &mem_off) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory selection offset")
+    addr = io_info->store->contig.dset_addr + (file_off * type_info->src_type_size);
+
+    /* Flush the sieve buffer if it holds unwritten data for the block */
+    if(dset_contig->sieve_buf && dset_contig->sieve_dirty
+            && H5F_addr_overlap(addr, len, dset_contig->sieve_loc, dset_contig->sieve_size)) {
+        if(H5F_block_write(file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, io_info->dxpl_id, dset_contig->sieve_buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+
+        /* Reset sieve buffer dirty flag */
+        dset_contig->sieve_dirty = FALSE;
+    } /* end if */
+
+    /* Read directly into the user's buffer */
+    /* (As a vector, so the read can run without the API lock) */
+    buf = (unsigned char *)io_info->u.rbuf + (mem_off * type_info->dst_type_size);
+    if(H5F_block_readv(file, H5FD_MEM_DRAW, (size_t)1, &addr, &len, io_info->dxpl_id, &buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_read_block() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_map
+ *
+ * Purpose:	Points BUF at the selection's data in the file's memory
+ *		image, for drivers which keep the file in memory, instead
+ *		of copying it out.  The selection must be one contiguous
+ *		block of a contiguous dataset, and the data must need no
+ *		conversion or transform into MEM_TYPE.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__contig_map(H5D_t *dset, const H5T_t *mem_type, const H5S_t *file_space,
+    hid_t dxpl_id, const void **buf)
+{
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5T_path_t *tpath;          /* Type conversion path */
+    hssize_t snelmts;           /* Number of elements selected (signed) */
+    hsize_t nelmts;             /* Number of elements selected */
+    hsize_t file_off;           /* Offset of selection in the dataset (in elements) */
+    size_t type_size;           /* Size of dataset's datatype */
+    htri_t status;              /* Generic status */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    HDassert(dset && dset->oloc.file);
+    HDassert(mem_type);
+    HDassert(buf);
+
+    if(!file_space)
+        file_space = dset->shared->space;
+
+    /* Only plain contiguous storage in the file can be mapped */
+    if(H5D_CONTIGUOUS != dset->shared->layout.type || dset->shared->dcpl_cache.efl.nused > 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset storage is not contiguous in the file")
+    if(!H5F_addr_defined(dset->shared->layout.storage.u.contig.addr))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset storage is not allocated")
+
+    /* The data must be readable as it is stored */
+    if(NULL == (tpath = H5T_path_find(dset->shared->type, mem_type, NULL, NULL, dxpl_id, FALSE)))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "unable to convert between src and dest datatype")
+    if(!H5T_path_noop(tpath))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "data needs datatype conversion")
+    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+    if(!H5Z_xform_noop(dxpl_cache->data_xform_prop))
+        HGOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "data needs a data transform")
+
+    /* The selection must be one block of the dataset */
+    if((status = H5S_extent_equal(file_space, dset->shared->space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOMPARE, FAIL, "can't compare dataspaces")
+    if(!status)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "file dataspace doesn't match the dataset's")
+    if((snelmts = H5S_GET_SELECT_NPOINTS(file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "file dataspace has invalid selection")
+    H5_ASSIGN_OVERFLOW(nelmts, snelmts, hssize_t, hsize_t);
+    if(nelmts == 0) {
+        *buf = NULL;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if((status = H5S_SELECT_IS_CONTIGUOUS(file_space)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check file selection")
+    if(!status)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_UNSUPPORTED, FAIL, "file selection is not one contiguous block")
+    if(H5S_SELECT_OFFSET(file_space, &file_off) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection offset")
+
+    /* Write out any unwritten data held in the sieve buffer */
+    if(H5D__flush_sieve_buf(dset, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush sieve buffer")
+
+    type_size = H5T_get_size(dset->shared->type);
+    if(H5F_block_map(dset->oloc.file, H5FD_MEM_DRAW,
+            dset->shared->layout.storage.u.contig.addr + (file_off * type_size),
+            (size_t)nelmts * type_size, dxpl_id, buf) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "unable to map data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_map() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_write
@@ -621,6 +832,170 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_write_one() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_iovec_new
+ *
+ * Purpose:	Allocates a list for gathering raw data requests, when the
+ *		file driver can handle lists of requests and a vector
+ *		operation may turn into more than one request.
+ *
+ * Return:	Success:	Pointer to an empty list
+ *		Failure:	NULL (also when the requests shouldn't be
+ *				gathered)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_contig_iovec_t *
+H5D__contig_iovec_new(const H5F_t *file, size_t dset_nseq, size_t mem_nseq)
+{
+    H5D_contig_iovec_t *vec = NULL;     /* List of requests */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(H5F_HAS_FEATURE(file, H5FD_FEAT_VECTOR_IO) && (dset_nseq > 1 || mem_nseq > 1))
+        /* (Failing to allocate just means the requests aren't gathered) */
+        if(NULL != (vec = H5FL_MALLOC(H5D_contig_iovec_t)))
+            vec->nseq = 0;
+
+    FUNC_LEAVE_NOAPI(vec)
+}   /* end H5D__contig_iovec_new() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_queue_read
+ *
+ * Purpose:	Adds a raw data read to a list of gathered requests, reading
+ *		the list first if it's full.  Without a list, the data is
+ *		read immediately.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_queue_read(H5F_t *file, hid_t dxpl_id, H5D_contig_iovec_t *vec,
+    haddr_t addr, size_t len, void *buf)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == vec) {
+        /* (As a vector, so the read can run without the API lock) */
+        if(H5F_block_readv(file, H5FD_MEM_DRAW, (size_t)1, &addr, &len, dxpl_id, &buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
+    } /* end if */
+    else {
+        if(H5D_IO_VECTOR_SIZE == vec->nseq)
+            if(H5D__contig_flush_reads(file, dxpl_id, vec) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+
+        vec->addr[vec->nseq] = addr;
+        vec->len[vec->nseq] = len;
+        vec->u.rbuf[vec->nseq] = buf;
+        vec->nseq++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_queue_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_flush_reads
+ *
+ * Purpose:	Reads a list of gathered raw data requests and empties it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_flush_reads(H5F_t *file, hid_t dxpl_id, H5D_contig_iovec_t *vec)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(vec && vec->nseq > 0) {
+        if(H5F_block_readv(file, H5FD_MEM_DRAW, vec->nseq, vec->addr, vec->len, dxpl_id, vec->u.rbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block vector read failed")
+        vec->nseq = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_flush_reads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_queue_write
+ *
+ * Purpose:	Adds a raw data write to a list of gathered requests,
+ *		writing the list first if it's full.  Without a list, the
+ *		data is written immediately.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_queue_write(H5F_t *file, hid_t dxpl_id, H5D_contig_iovec_t *vec,
+    haddr_t addr, size_t len, const void *buf)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == vec) {
+        if(H5F_block_write(file, H5FD_MEM_DRAW, addr, len, dxpl_id, buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    } /* end if */
+    else {
+        if(H5D_IO_VECTOR_SIZE == vec->nseq)
+            if(H5D__contig_flush_writes(file, dxpl_id, vec) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
+        vec->addr[vec->nseq] = addr;
+        vec->len[vec->nseq] = len;
+        vec->u.wbuf[vec->nseq] = buf;
+        vec->nseq++;
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_queue_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__contig_flush_writes
+ *
+ * Purpose:	Writes a list of gathered raw data requests and empties it.
+ *		This must happen before anything else reads or writes the
+ *		same part of the file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__contig_flush_writes(H5F_t *file, hid_t dxpl_id, H5D_contig_iovec_t *vec)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(vec && vec->nseq > 0) {
+        if(H5F_block_writev(file, H5FD_MEM_DRAW, vec->nseq, vec->addr, vec->len, dxpl_id, vec->u.wbuf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block vector write failed")
+        vec->nseq = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5D__contig_flush_writes() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__contig_readvv_sieve_cb
@@ -670,7 +1045,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
     if(NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if(len > dset_contig->sieve_buf_size) {
-            if(H5F_block_read(file, H5FD_MEM_DRAW, addr, len, udata->dxpl_id, buf) < 0)
+            if(H5D__contig_queue_read(file, udata->dxpl_id, udata->vec, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
         } /* end if */
         else {
@@ -737,7 +1112,7 @@ H5D__contig_readvv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
                 } /* end if */
 
                 /* Read directly into the user's buffer */
-                if(H5F_block_read(file, H5FD_MEM_DRAW, addr, len, udata->dxpl_id, buf) < 0)
+                if(H5D__contig_queue_read(file, udata->dxpl_id, udata->vec, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
             } /* end if */
             /* Element size fits within the buffer size */
@@ -809,10 +1184,10 @@ H5D__contig_readvv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udata
 
     FUNC_ENTER_STATIC
 
-    /* Write data */
-    if(H5F_block_read(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off),
-            len, udata->dxpl_id, (udata->rbuf + src_off)) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
+    /* Read data */
+    if(H5D__contig_queue_read(udata->file, udata->dxpl_id, udata->vec,
+            (udata->dset_addr + dst_off), len, (udata->rbuf + src_off)) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -842,6 +1217,7 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
+    H5D_contig_iovec_t *vec;    /* Requests gathered for the file driver */
     ssize_t ret_value;          /* Return value */
 
     FUNC_ENTER_STATIC
@@ -855,6 +1231,10 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Gather the requests into lists, if the file driver can use them */
+    vec = H5D__contig_iovec_new(io_info->dset->oloc.file,
+            dset_max_nseq - *dset_curr_seq, mem_max_nseq - *mem_curr_seq);
+
     /* Check if data sieving is enabled */
     if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata;     /* User data for H5V_opvv() operator */
@@ -865,6 +1245,7 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
         udata.store_contig = &(io_info->store->contig);
         udata.rbuf = (unsigned char *)io_info->u.rbuf;
         udata.dxpl_id = io_info->dxpl_id;
+        udata.vec = vec;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5V_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
@@ -880,6 +1261,7 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.rbuf = (unsigned char *)io_info->u.rbuf;
         udata.dxpl_id = io_info->dxpl_id;
+        udata.vec = vec;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5V_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
@@ -888,7 +1270,14 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
     } /* end else */
 
+    /* Perform the requests still gathered */
+    if(H5D__contig_flush_reads(io_info->dset->oloc.file, io_info->dxpl_id, vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "vector read failed")
+
 done:
+    if(vec)
+        vec = H5FL_FREE(H5D_contig_iovec_t, vec);
+
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_readvv() */
 
@@ -941,7 +1330,7 @@ H5D__contig_writevv_sieve_cb(hsize_t dst_off, hsize_t src_off, size_t len,
     if(NULL == dset_contig->sieve_buf) {
         /* Check if we can actually hold the I/O request in the sieve buffer */
         if(len > dset_contig->sieve_buf_size) {
-            if(H5F_block_write(file, H5FD_MEM_DRAW, addr, len, udata->dxpl_id, buf) < 0)
+            if(H5D__contig_queue_write(file, udata->dxpl_id, udata->vec, addr, len, buf) < 0)
                 HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
         } /* end if */
         else {
@@ -969,6 +1358,10 @@ if(dset_contig->sieve_size > len)
 
             /* Check if there is any point in reading the data from the file */
             if(dset_contig->sieve_size > len) {
+                /* Write the gathered requests first */
+                if(H5D__contig_flush_writes(file, udata->dxpl_id, udata->vec) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
                 /* Read the new sieve buffer */
                 if(H5F_block_read(file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, udata->dxpl_id, dset_contig->sieve_buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
@@ -1009,6 +1402,10 @@ if(dset_contig->sieve_size > len)
                         || ((sieve_end - 1) >= addr && (sieve_end - 1) < (contig_end + 1))) {
                     /* Flush the sieve buffer, if it's dirty */
                     if(dset_contig->sieve_dirty) {
+                        /* Write the gathered requests first */
+                        if(H5D__contig_flush_writes(file, udata->dxpl_id, udata->vec) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
                         /* Write to file */
                         if(H5F_block_write(file, H5FD_MEM_DRAW, sieve_start, sieve_size, udata->dxpl_id, dset_contig->sieve_buf) < 0)
                             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
@@ -1023,7 +1420,7 @@ if(dset_contig->sieve_size > len)
                 } /* end if */
 
                 /* Write directly from the user's buffer */
-                if(H5F_block_write(file, H5FD_MEM_DRAW, addr, len, udata->dxpl_id, buf) < 0)
+                if(H5D__contig_queue_write(file, udata->dxpl_id, udata->vec, addr, len, buf) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
             } /* end if */
             /* Element size fits within the buffer size */
@@ -1062,6 +1459,10 @@ if(dset_contig->sieve_size > len)
                 else {
                     /* Flush the sieve buffer if it's dirty */
                     if(dset_contig->sieve_dirty) {
+                        /* Write the gathered requests first */
+                        if(H5D__contig_flush_writes(file, udata->dxpl_id, udata->vec) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
                         /* Write to file */
                         if(H5F_block_write(file, H5FD_MEM_DRAW, sieve_start, sieve_size, udata->dxpl_id, dset_contig->sieve_buf) < 0)
                             HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
@@ -1091,6 +1492,10 @@ if(dset_contig->sieve_size > len)
 
                     /* Check if there is any point in reading the data from the file */
                     if(dset_contig->sieve_size > len) {
+                        /* Write the gathered requests first */
+                        if(H5D__contig_flush_writes(file, udata->dxpl_id, udata->vec) < 0)
+                            HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
                         /* Read the new sieve buffer */
                         if(H5F_block_read(file, H5FD_MEM_DRAW, dset_contig->sieve_loc, dset_contig->sieve_size, udata->dxpl_id, dset_contig->sieve_buf) < 0)
                             HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "block read failed")
@@ -1132,7 +1537,7 @@ H5D__contig_writevv_cb(hsize_t dst_off, hsize_t src_off, size_t len, void *_udat
     FUNC_ENTER_STATIC
 
     /* Write data */
-    if(H5F_block_write(udata->file, H5FD_MEM_DRAW, (udata->dset_addr + dst_off), len, udata->dxpl_id, (udata->wbuf + src_off)) < 0)
+    if(H5D__contig_queue_write(udata->file, udata->dxpl_id, udata->vec, (udata->dset_addr + dst_off), len, (udata->wbuf + src_off)) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "block write failed")
 
 done:
@@ -1163,6 +1568,7 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
+    H5D_contig_iovec_t *vec;    /* Requests gathered for the file driver */
     ssize_t ret_value;          /* Return value (Size of sequence in bytes) */
 
     FUNC_ENTER_STATIC
@@ -1176,6 +1582,10 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Gather the requests into lists, if the file driver can use them */
+    vec = H5D__contig_iovec_new(io_info->dset->oloc.file,
+            dset_max_nseq - *dset_curr_seq, mem_max_nseq - *mem_curr_seq);
+
     /* Check if data sieving is enabled */
     if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_writevv_sieve_ud_t udata;    /* User data for H5V_opvv() operator */
@@ -1186,6 +1596,7 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
         udata.store_contig = &(io_info->store->contig);
         udata.wbuf = (const unsigned char *)io_info->u.wbuf;
         udata.dxpl_id = io_info->dxpl_id;
+        udata.vec = vec;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5V_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
@@ -1201,6 +1612,7 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
         udata.dset_addr = io_info->store->contig.dset_addr;
         udata.wbuf = (const unsigned char *)io_info->u.wbuf;
         udata.dxpl_id = io_info->dxpl_id;
+        udata.vec = vec;
 
         /* Call generic sequence operation routine */
         if((ret_value = H5V_opvv(dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr,
@@ -1209,7 +1621,14 @@ H5D__contig_writevv(const H5D_io_info_t *io_info,
             HGOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "can't perform vectorized read")
     } /* end else */
 
+    /* Perform the requests still gathered */
+    if(H5D__contig_flush_writes(io_info->dset->oloc.file, io_info->dxpl_id, vec) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "vector write failed")
+
 done:
+    if(vec)
+        vec = H5FL_FREE(H5D_contig_iovec_t, vec);
+
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5D__contig_writevv() */
 
@@ -335,6 +335,10 @@ H5D__get_dxpl_cache_real(hid_t dxpl_id, H5D_dxpl_cache_t *cache)
     if(H5P_get(dx_plist, H5D_XFER_FILTER_CB_NAME, &cache->filter_cb) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve filter callback function")
 
+    /* Get number of threads for running filters */
+    if(H5P_get(dx_plist, H5D_XFER_FILTER_THREADS_NAME, &cache->filter_threads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve number of filter threads")
+
     /* Get the data transform property */
     if(H5P_get(dx_plist, H5D_XFER_XFORM_NAME, &cache->data_xform_prop) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve data transform info")
@@ -1395,6 +1399,10 @@ H5D_close(H5D_t *dataset)
             case H5D_CHUNKED:
                 /* Check for skip list for iterating over chunks during I/O to close */
                 if(dataset->shared->cache.chunk.sel_chunks) {
+                    /* Release any chunk map kept from the last I/O */
+                    if(H5D__chunk_map_reset(&dataset->shared->cache.chunk) < 0)
+                        HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to release chunk map")
+
                     HDassert(H5SL_count(dataset->shared->cache.chunk.sel_chunks) == 0);
                     H5SL_close(dataset->shared->cache.chunk.sel_chunks);
                     dataset->shared->cache.chunk.sel_chunks = NULL;
@@ -1461,6 +1469,11 @@ H5D_close(H5D_t *dataset)
         dataset->shared = H5FL_FREE(H5D_shared_t, dataset->shared);
     } /* end if */
     else {
+        /* Stop preempting shared chunk cache entries through this handle */
+        if(H5D_CHUNKED == dataset->shared->layout.type)
+            if(H5D__chunk_release_handle(dataset, H5AC_dxpl_id) < 0)
+                HDONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to release chunk cache")
+
         /* Decrement the ref. count for this object in the top file */
         if(H5FO_top_decr(dataset->oloc.file, dataset->oloc.addr) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't decrement count for object")
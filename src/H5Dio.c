@@ -57,6 +57,8 @@ static herr_t H5D__write(H5D_t *dataset, hid_t mem_type_id,
     const void *buf);
 static herr_t H5D__pre_write(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 	 hid_t file_space_id, hid_t dxpl_id, const void *buf);
+static herr_t H5D__direct_read(const H5D_t *dset, hid_t dxpl_id,
+    H5P_genplist_t *plist, void *bufs[]);
 
 /* Setup/teardown routines */
 static herr_t H5D__ioinfo_init(H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
@@ -125,6 +127,8 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     H5D_t		   *dset = NULL;
     const H5S_t		   *mem_space = NULL;
     const H5S_t		   *file_space = NULL;
+    H5P_genplist_t 	   *plist;      /* Property list pointer */
+    hbool_t		    direct_read = FALSE;
     char                    fake_char;
     herr_t                  ret_value = SUCCEED;  /* Return value */
 
@@ -164,6 +168,21 @@ H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
     else
         if(TRUE != H5P_isa_class(plist_id, H5P_DATASET_XFER))
             HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Get the dataset transfer property list */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(plist_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset transfer property list")
+
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &direct_read) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting flag for direct chunk read")
+
+    /* Direct chunk read */
+    if(direct_read) {
+        if(H5D__direct_read(dset, plist_id, plist, (void **)buf) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read chunks directly")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     if(!buf && (NULL == file_space || H5S_GET_SELECT_NPOINTS(file_space) != 0))
 	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output buffer")
 
@@ -182,6 +201,94 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__direct_read
+ *
+ * Purpose:	Reads whole chunks of a chunked dataset directly from the
+ *		file, as they are stored there, for H5DOread_chunk and
+ *		H5DOread_chunks.  The number of chunks, their offsets and
+ *		the array for their filter masks come from the transfer
+ *		property list; BUFS holds one buffer for each chunk.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__direct_read(const H5D_t *dset, hid_t dxpl_id, H5P_genplist_t *plist,
+    void *bufs[])
+{
+    size_t      direct_nchunks = 0;
+    hsize_t    *direct_offset = NULL;
+    uint32_t   *direct_filters = NULL;
+    hsize_t    *internal_offset = NULL;
+    int         ndims = 0;
+    hsize_t     dims[H5O_LAYOUT_NDIMS];
+    size_t      u;
+    int         i;
+    herr_t      ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_NAME, &direct_nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting number of chunks for direct chunk read")
+
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, &direct_offset) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting offset info for direct chunk read")
+
+    if(H5P_get(plist, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME, &direct_filters) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "error getting filter info for direct chunk read")
+
+    if(0 == direct_nchunks)
+        HGOTO_DONE(SUCCEED)
+    if(!direct_offset || !direct_filters || !bufs)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no offsets, filter masks or buffers for direct chunk read")
+
+    /* The library's chunking code requires each offset to terminate with a
+     * zero.  So transfer the offsets to an internal offset array */
+    if((ndims = H5S_get_simple_extent_dims(dset->shared->space, dims, NULL)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't retrieve dataspace extent dims")
+    if(NULL == (internal_offset = (hsize_t *)H5MM_malloc(direct_nchunks * (size_t)(ndims + 1) * sizeof(hsize_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk offsets")
+
+    for(u = 0; u < direct_nchunks; u++) {
+        const hsize_t *offset = direct_offset + (u * (size_t)ndims);
+        hsize_t *chunk_offset = internal_offset + (u * (size_t)(ndims + 1));
+
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output buffer")
+
+        for(i = 0; i < ndims; i++) {
+            /* Make sure the offset is within the dataset's dimensions */
+            if(offset[i] >= dims[i])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset exceeds dimensions of dataset")
+
+            /* Make sure the offset falls right on a chunk's boundary */
+            if(offset[i] % dset->shared->layout.u.chunk.dim[i])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset doesn't fall on chunks's boundary")
+
+            chunk_offset[i] = offset[i];
+        } /* end for */
+
+        /* Terminate the offset with a zero */
+        chunk_offset[ndims] = 0;
+    } /* end for */
+
+    /* read raw data */
+    if(H5D__chunk_direct_read(dset, dxpl_id, direct_nchunks, internal_offset, direct_filters, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read chunks directly")
+
+done:
+    if(internal_offset)
+        H5MM_xfree(internal_offset);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__direct_read() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Dwrite
@@ -234,6 +341,79 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dmap
+ *
+ * Purpose:	Gets a read-only pointer to the data of dataset DSET_ID
+ *		selected by FILE_SPACE_ID, without copying it, for files
+ *		opened with a driver which keeps the file's contents in
+ *		memory (currently the core and mmap drivers).  The data
+ *		is returned in BUF as it would be read into memory with
+ *		the MEM_TYPE_ID datatype.
+ *
+ *		The dataset must use contiguous storage in the file, the
+ *		selection must be one contiguous block of the dataset,
+ *		and reading the data as MEM_TYPE_ID must need no datatype
+ *		conversion or data transform.  Other cases fail, and the
+ *		data should be read with H5Dread instead.
+ *
+ *		The FILE_SPACE_ID can be the constant H5S_ALL which
+ *		indicates that the entire file data space is to be mapped.
+ *		When nothing is selected BUF is set to NULL.
+ *
+ *		The data pointed to must not be modified, and the pointer
+ *		is only valid until the file is next written to or closed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dmap(hid_t dset_id, hid_t mem_type_id, hid_t file_space_id,
+    hid_t plist_id, const void **buf/*out*/)
+{
+    H5D_t		   *dset = NULL;
+    const H5T_t		   *mem_type = NULL;
+    const H5S_t		   *file_space = NULL;
+    herr_t                  ret_value = SUCCEED;  /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "iiiix", dset_id, mem_type_id, file_space_id, plist_id, buf);
+
+    /* check arguments */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(NULL == dset->oloc.file)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(NULL == (mem_type = (const H5T_t *)H5I_object_verify(mem_type_id, H5I_DATATYPE)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
+    if(H5S_ALL != file_space_id) {
+	if(NULL == (file_space = (const H5S_t *)H5I_object_verify(file_space_id, H5I_DATASPACE)))
+	    HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data space")
+
+	/* Check for valid selection */
+	if(H5S_SELECT_VALID(file_space) != TRUE)
+	    HGOTO_ERROR(H5E_DATASPACE, H5E_BADRANGE, FAIL, "selection+offset not within extent")
+    } /* end if */
+    if(!buf)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output pointer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == plist_id)
+        plist_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(plist_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Map the data */
+    if(H5D__contig_map(dset, mem_type, file_space, plist_id, buf) < 0)
+	HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't map data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dmap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__pre_write
@@ -264,7 +264,7 @@ typedef struct H5D_chunk_ud_t {
     H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
 
     /* Upward */
-    unsigned    idx_hint;               /*index of chunk in cache, if present */
+    struct H5D_rdcc_ent_t *ent;         /*chunk's entry in cache, if present */
     uint32_t	nbytes;			/*size of stored data	*/
     unsigned	filter_mask;		/*excluded filters	*/
     haddr_t	addr;			/*file address of chunk */
@@ -346,6 +346,7 @@ typedef struct H5D_chunk_map_t {
     H5S_sel_type msel_type;     /* Selection type in memory */
 
     H5SL_t *sel_chunks;         /* Skip list containing information for each chunk selected */
+    hbool_t keep_map;           /* Whether the chunks in sel_chunks are kept for later I/O */
 
     H5S_t  *single_space;       /* Dataspace for single chunk */
     H5D_chunk_info_t *single_chunk_info;  /* Pointer to single chunk's info */
@@ -370,24 +371,74 @@ typedef struct H5D_chunk_cached_t{
     haddr_t	addr;				/*file address of chunk */
 } H5D_chunk_cached_t;
 
+/* Entry in the table of chunk addresses, indexed by linear chunk index */
+typedef struct H5D_rdcc_addr_t {
+    hbool_t     valid;                          /*whether the chunk has been looked up*/
+    uint32_t	nbytes;				/*size of stored data	*/
+    unsigned	filter_mask;			/*excluded filters	*/
+    haddr_t	addr;				/*file address of chunk, or HADDR_UNDEF */
+} H5D_rdcc_addr_t;
+typedef H5D_rdcc_addr_t *H5D_rdcc_addr_ptr_t; /* For free lists */
+
 /* The raw data chunk cache */
 typedef struct H5D_rdcc_t {
     struct {
-        unsigned	ninits;	/* Number of chunk creations		*/
-        unsigned	nhits;	/* Number of cache hits			*/
-        unsigned	nmisses;/* Number of cache misses		*/
-        unsigned	nflushes;/* Number of cache flushes		*/
+        hsize_t		ninits;	/* Number of chunk creations		*/
+        hsize_t		nhits;	/* Number of cache hits			*/
+        hsize_t		nmisses;/* Number of cache misses		*/
+        hsize_t		nflushes;/* Number of cache flushes		*/
+        hsize_t		nevicts;/* Number of cache preemptions		*/
+        hsize_t		nprefetches;/* Number of chunks read ahead	*/
     } stats;
     size_t		nbytes_max; /* Maximum cached raw data in bytes	*/
-    size_t		nslots;	/* Number of chunk slots allocated	*/
+    size_t		nslots;	/* Number of hash buckets allocated	*/
+    size_t		nslots_conf; /* Number of hash buckets configured	*/
     double		w0;     /* Chunk preemption policy          */
+    H5D_chunk_cache_policy_t policy; /* Eviction policy		*/
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list		*/
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list		*/
     size_t		nbytes_used; /* Current cached raw data in bytes */
-    int			nused;	/* Number of chunk slots in use		*/
+    int			nused;	/* Number of chunks in the cache	*/
     H5D_chunk_cached_t last;    /* Cached copy of last chunk information */
-    struct H5D_rdcc_ent_t **slot; /* Chunk slots, each points to a chunk*/
+    struct {
+        hbool_t		load;	/* Whether to load every address on open */
+        hbool_t		complete;/* Whether the table holds every chunk
+                                 * it has a place for (chunks missing
+                                 * from it don't exist)			*/
+        size_t		nblocks;/* # of data block pointers allocated	*/
+        H5D_rdcc_addr_t **block; /* Data blocks of chunk addresses, each
+                                 * allocated when first used		*/
+    } addr;                     /* Chunk addresses already looked up	*/
+    struct H5D_rdcc_ent_t **slot; /* Hash buckets, each a chain of chunks */
+    struct {
+        size_t		p;	/* Target number of "recent" chunks	*/
+        size_t		nrecent;/* Number of cached chunks seen once	*/
+        size_t		nghosts[2]; /* Length of each ghost list	*/
+        struct H5D_rdcc_ghost_t *head[2]; /* Oldest entry of each ghost list */
+        struct H5D_rdcc_ghost_t *tail[2]; /* Newest entry of each ghost list */
+        struct H5D_rdcc_ghost_t **slot; /* Ghost hash buckets (nslots)	*/
+    } arc;                      /* Adaptive replacement cache state	*/
+    struct {
+        size_t		nchunks;/* # of chunks to read ahead (0 = off)	*/
+        hbool_t		valid;	/* Whether LAST is set			*/
+        hsize_t		last;	/* Index of last chunk missed or read ahead */
+        hsize_t		stride;	/* Distance between the last misses	*/
+        unsigned	nseq;	/* # of misses in a row at STRIDE	*/
+    } prefetch;                 /* Read-ahead state			*/
+    H5F_rdcc_pool_t	*pool;	/* File's shared cache budget, if used	*/
+    const struct H5D_t	*pool_dset; /* Dataset to flush through when chunks
+                                 * are preempted for another dataset	*/
+    struct H5D_rdcc_t	*pool_prev; /* Previous (less recently accessed) dataset sharing the budget */
+    struct H5D_rdcc_t	*pool_next; /* Next (more recently accessed) dataset sharing the budget */
     H5SL_t		*sel_chunks; /* Skip list containing information for each chunk selected */
+    struct {
+        hbool_t		valid;	/* Whether SEL_CHUNKS holds a map to reuse */
+        hsize_t		down_chunks[H5O_LAYOUT_NDIMS]; /* Chunk index strides when mapped */
+        H5S_hyper_dim_t	fsel[H5O_LAYOUT_NDIMS]; /* Regular file selection mapped */
+        hsize_t		m_dims[H5O_LAYOUT_NDIMS]; /* Memory dataspace dimensions */
+        hsize_t		m_start[H5O_LAYOUT_NDIMS]; /* Low bound of memory selection */
+    } map;                      /* Chunk map kept from the last I/O on a
+                                 * regular hyperslab			*/
     H5S_t		*single_space; /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t *single_chunk_info;  /* Pointer to single chunk's info */
 } H5D_rdcc_t;
@@ -498,12 +549,27 @@ typedef struct H5D_rdcc_ent_t {
     uint32_t	wr_count;	/*bytes remaining to be written		*/
     haddr_t     chunk_addr;     /*address of chunk in file		*/
     uint8_t	*chunk;		/*the unfiltered chunk data		*/
+    hsize_t	chunk_idx;	/*linear index of chunk in dataset	*/
     unsigned	idx;		/*index in hash table			*/
+    unsigned	naccess;	/*number of times chunk was locked	*/
+    hbool_t	frequent;	/*chunk has been used more than once (ARC) */
+    struct H5D_rdcc_ent_t *hnext;/*next item in hash bucket chain	*/
     struct H5D_rdcc_ent_t *next;/*next item in doubly-linked list	*/
     struct H5D_rdcc_ent_t *prev;/*previous item in doubly-linked list	*/
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+/* Chunks recently preempted from an ARC chunk cache are remembered by: */
+typedef struct H5D_rdcc_ghost_t {
+    hsize_t	chunk_idx;	/*linear index of chunk in dataset	*/
+    unsigned	list;		/*ghost list the chunk is on (0 or 1)	*/
+    unsigned	idx;		/*index in ghost hash table		*/
+    struct H5D_rdcc_ghost_t *hnext;/*next item in hash bucket chain	*/
+    struct H5D_rdcc_ghost_t *next;/*next (newer) item in ghost list	*/
+    struct H5D_rdcc_ghost_t *prev;/*previous (older) item in ghost list */
+} H5D_rdcc_ghost_t;
+typedef H5D_rdcc_ghost_t *H5D_rdcc_ghost_ptr_t; /* For free lists */
+
 
 /*****************************/
 /* Package Private Variables */
@@ -590,6 +656,8 @@ H5_DLL herr_t H5D__contig_fill(H5D_t *dset, hid_t dxpl_id);
 H5_DLL herr_t H5D__contig_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
     H5D_chunk_map_t *fm);
+H5_DLL herr_t H5D__contig_map(H5D_t *dset, const H5T_t *mem_type,
+    const H5S_t *file_space, hid_t dxpl_id, const void **buf);
 H5_DLL herr_t H5D__contig_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t nelmts, const H5S_t *file_space, const H5S_t *mem_space,
     H5D_chunk_map_t *fm);
@@ -611,7 +679,7 @@ H5_DLL hbool_t H5D__chunk_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL herr_t H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id,
     const hsize_t *chunk_offset, hsize_t chunk_idx, H5D_chunk_ud_t *udata);
 H5_DLL void *H5D__chunk_lock(const H5D_io_info_t *io_info,
-    H5D_chunk_ud_t *udata, hbool_t relax);
+    H5D_chunk_ud_t *udata, hbool_t relax, void *preread);
 H5_DLL herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
     const H5D_chunk_ud_t *udata, hbool_t dirty, void *chunk,
     uint32_t naccessed);
@@ -624,6 +692,12 @@ H5_DLL herr_t H5D__chunk_prune_by_extent(H5D_t *dset, hid_t dxpl_id,
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id);
+H5_DLL herr_t H5D__chunk_iter(H5D_t *dset, hid_t dxpl_id,
+    H5D_chunk_iter_op_t op, void *op_data);
+H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hid_t dxpl_id,
+    size_t nchunks, const hsize_t *offsets, uint32_t *filters, void *bufs[]);
+H5_DLL herr_t H5D__chunk_get_storage_size(const H5D_t *dset, hid_t dxpl_id,
+    const hsize_t *offset, hsize_t *storage_size);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
     H5O_layout_chunk_t *layout_src, H5F_t *f_dst, H5O_storage_chunk_t *storage_dst,
     const H5S_extent_t *ds_extent_src, const H5T_t *dt_src,
@@ -632,6 +706,8 @@ H5_DLL herr_t H5D__chunk_bh_info(H5F_t *f, hid_t dxpl_id, H5O_layout_t *layout,
     const H5O_pline_t *pline, hsize_t *btree_size);
 H5_DLL herr_t H5D__chunk_dump_index(H5D_t *dset, hid_t dxpl_id, FILE *stream);
 H5_DLL herr_t H5D__chunk_dest(H5F_t *f, hid_t dxpl_id, H5D_t *dset);
+H5_DLL herr_t H5D__chunk_map_reset(H5D_rdcc_t *rdcc);
+H5_DLL herr_t H5D__chunk_release_handle(const H5D_t *dset, hid_t dxpl_id);
 H5_DLL herr_t H5D__chunk_delete(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
     H5O_storage_t *store);
 #ifdef H5D_CHUNK_DEBUG
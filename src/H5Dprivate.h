@@ -52,6 +52,9 @@
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME   "rdcc_nslots"   /* Size of raw data chunk cache(slots) */
 #define H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME   "rdcc_nbytes"   /* Size of raw data chunk cache(bytes) */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME    "rdcc_w0"       /* Preemption read chunks first */
+#define H5D_ACS_DATA_CACHE_PREFETCH_NAME    "rdcc_prefetch" /* # of chunks to read ahead of sequential access */
+#define H5D_ACS_DATA_CACHE_POLICY_NAME      "rdcc_policy"   /* Raw data chunk cache eviction policy */
+#define H5D_ACS_CHUNK_ADDR_MAP_NAME         "chunk_addr_map" /* Load all chunk addresses when opening */
 
 /* ======== Data transfer properties ======== */
 #define H5D_XFER_MAX_TEMP_BUF_NAME      "max_temp_buf"  /* Maximum temp buffer size */
@@ -79,6 +82,7 @@
 #endif /* H5_HAVE_PARALLEL */
 #define H5D_XFER_EDC_NAME               "err_detect"    /* EDC */
 #define H5D_XFER_FILTER_CB_NAME         "filter_cb"     /* Filter callback function */
+#define H5D_XFER_FILTER_THREADS_NAME    "filter_threads" /* Threads for running filters */
 #define H5D_XFER_CONV_CB_NAME           "type_conv_cb"  /* Type conversion callback function */
 #define H5D_XFER_XFORM_NAME             "data_transform" /* Data transform */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
@@ -130,6 +134,7 @@ typedef struct H5D_dxpl_cache_t {
     H5FD_mpio_collective_opt_t coll_opt_mode; /* Parallel transfer with independent IO or collective IO with this mode */
 #endif /*H5_HAVE_PARALLEL*/
     H5Z_cb_t filter_cb;         /* Filter callback function (H5D_XFER_FILTER_CB_NAME) */
+    unsigned filter_threads;    /* Threads for running filters (H5D_XFER_FILTER_THREADS_NAME) */
     H5Z_data_xform_t *data_xform_prop; /* Data transform prop (H5D_XFER_XFORM_NAME) */
 } H5D_dxpl_cache_t;
 
@@ -39,6 +39,12 @@
 #define H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_NAME	"direct_chunk_filters"
 #define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_NAME		"direct_chunk_offset"
 #define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_NAME	"direct_chunk_datasize"
+
+/* Property names for H5DOread_chunk and H5DOread_chunks */
+#define H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME	        "direct_chunk_read_flag"
+#define H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_NAME	        "direct_chunk_read_nchunks"
+#define H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME	        "direct_chunk_read_offset"
+#define H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME	        "direct_chunk_read_filters"
  
 /*******************/
 /* Public Typedefs */
@@ -92,6 +98,28 @@ typedef enum H5D_fill_value_t {
     H5D_FILL_VALUE_USER_DEFINED =2
 } H5D_fill_value_t;
 
+/* Values for the raw data chunk cache eviction policy property */
+typedef enum H5D_chunk_cache_policy_t {
+    H5D_CHUNK_CACHE_POLICY_ERROR = -1,
+    H5D_CHUNK_CACHE_POLICY_W0    = 0,   /*approximate LRU weighted by w0 (default) */
+    H5D_CHUNK_CACHE_POLICY_LRU   = 1,   /*strict least recently used	     */
+    H5D_CHUNK_CACHE_POLICY_LFU   = 2,   /*least frequently used		     */
+    H5D_CHUNK_CACHE_POLICY_ARC   = 3,   /*adaptive replacement cache	     */
+    H5D_CHUNK_CACHE_POLICY_NTYPES       /*this one must be last!	     */
+} H5D_chunk_cache_policy_t;
+
+/* Raw data chunk cache statistics for a dataset */
+typedef struct H5D_chunk_cache_stats_t {
+    hsize_t     nhits;          /* Number of lookups satisfied by the cache */
+    hsize_t     nmisses;        /* Number of chunks read from the file      */
+    hsize_t     ninits;         /* Number of chunks created in the cache    */
+    hsize_t     nflushes;       /* Number of chunks written to the file     */
+    hsize_t     nevictions;     /* Number of chunks preempted from the cache */
+    hsize_t     nprefetches;    /* Number of chunks read ahead of access    */
+    size_t      nused;          /* Number of chunks currently cached        */
+    size_t      nbytes_used;    /* Number of bytes currently cached         */
+} H5D_chunk_cache_stats_t;
+
 /********************/
 /* Public Variables */
 /********************/
@@ -116,6 +144,10 @@ typedef herr_t (*H5D_scatter_func_t)(const void **src_buf/*out*/,
 typedef herr_t (*H5D_gather_func_t)(const void *dst_buf,
                                     size_t dst_buf_bytes_used, void *op_data);
 
+/* Define the operator function pointer for H5Dchunk_iter() */
+typedef int (*H5D_chunk_iter_op_t)(const hsize_t *offset, unsigned filter_mask,
+                                   haddr_t addr, hsize_t size, void *op_data);
+
 H5_DLL hid_t H5Dcreate2(hid_t loc_id, const char *name, hid_t type_id,
     hid_t space_id, hid_t lcpl_id, hid_t dcpl_id, hid_t dapl_id);
 H5_DLL hid_t H5Dcreate_anon(hid_t file_id, hid_t type_id, hid_t space_id,
@@ -133,6 +165,8 @@ H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dmap(hid_t dset_id, hid_t mem_type_id, hid_t file_space_id,
+			hid_t plist_id, const void **buf/*out*/);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
@@ -145,6 +179,13 @@ H5_DLL herr_t H5Dscatter(H5D_scatter_func_t op, void *op_data, hid_t type_id,
 H5_DLL herr_t H5Dgather(hid_t src_space_id, const void *src_buf, hid_t type_id,
     size_t dst_buf_size, void *dst_buf, H5D_gather_func_t op, void *op_data);
 H5_DLL herr_t H5Ddebug(hid_t dset_id);
+H5_DLL herr_t H5Dget_chunk_cache_stats(hid_t dset_id,
+    H5D_chunk_cache_stats_t *stats/*out*/);
+H5_DLL herr_t H5Dreset_chunk_cache_stats(hid_t dset_id);
+H5_DLL herr_t H5Dchunk_iter(hid_t dset_id, hid_t dxpl_id,
+    H5D_chunk_iter_op_t op, void *op_data);
+H5_DLL herr_t H5Dget_chunk_storage_size(hid_t dset_id, const hsize_t *offset,
+    hsize_t *chunk_nbytes/*out*/);
 
 /* Symbols defined for compatibility with previous versions of the HDF5 API.
  *
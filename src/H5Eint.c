@@ -47,6 +47,23 @@
 /* Local Macros */
 /****************/
 
+/* Serialize access to the (single, global) error stack while library worker
+ * threads are running.  Threadsafe builds have a stack per thread instead.
+ */
+#if defined(H5_HAVE_FILTER_THREADS) && !defined(H5_HAVE_THREADSAFE)
+#define H5E_THREADS_LOCK(locked)                                              \
+    if(H5E_threads_active_g) {                                                \
+        pthread_mutex_lock(&H5E_threads_mutex_g);                             \
+        (locked) = TRUE;                                                      \
+    }
+#define H5E_THREADS_UNLOCK(locked)                                            \
+    if(locked)                                                                \
+        pthread_mutex_unlock(&H5E_threads_mutex_g);
+#else
+#define H5E_THREADS_LOCK(locked)
+#define H5E_THREADS_UNLOCK(locked) (void)(locked);
+#endif
+
 
 /******************/
 /* Local Typedefs */
@@ -92,6 +109,15 @@ H5E_t H5E_stack_g[1];
 /* Library Private Variables */
 /*****************************/
 
+#if defined(H5_HAVE_FILTER_THREADS) && !defined(H5_HAVE_THREADSAFE)
+/* Whether worker threads may currently be pushing errors */
+static hbool_t H5E_threads_active_g = FALSE;
+
+/* (Recursive) lock on the error stack, while worker threads are active */
+static hbool_t H5E_threads_mutex_init_g = FALSE;
+static pthread_mutex_t H5E_threads_mutex_g;
+#endif /* defined(H5_HAVE_FILTER_THREADS) && !defined(H5_HAVE_THREADSAFE) */
+
 /* HDF5 error class ID */
 hid_t H5E_ERR_CLS_g = FAIL;
 
@@ -808,6 +834,7 @@ herr_t
 H5E_push_stack(H5E_t *estack, const char *file, const char *func, unsigned line,
     hid_t cls_id, hid_t maj_id, hid_t min_id, const char *desc)
 {
+    hbool_t     locked = FALSE;           /* Whether the stack was locked */
     herr_t	ret_value = SUCCEED;      /* Return value */
 
     /*
@@ -824,6 +851,9 @@ H5E_push_stack(H5E_t *estack, const char *file, const char *func, unsigned line,
     HDassert(maj_id > 0);
     HDassert(min_id > 0);
 
+    /* Serialize with any worker threads */
+    H5E_THREADS_LOCK(locked)
+
     /* Check for 'default' error stack */
     if(estack == NULL)
     	if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
@@ -867,6 +897,8 @@ H5E_push_stack(H5E_t *estack, const char *file, const char *func, unsigned line,
     } /* end if */
 
 done:
+    H5E_THREADS_UNLOCK(locked)
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_push_stack() */
 
@@ -943,10 +975,14 @@ done:
 herr_t
 H5E_clear_stack(H5E_t *estack)
 {
+    hbool_t locked = FALSE;       /* Whether the stack was locked */
     herr_t ret_value = SUCCEED;   /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    /* Serialize with any worker threads */
+    H5E_THREADS_LOCK(locked)
+
     /* Check for 'default' error stack */
     if(estack == NULL)
     	if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
@@ -959,9 +995,62 @@ H5E_clear_stack(H5E_t *estack)
             HGOTO_ERROR(H5E_ERROR, H5E_CANTSET, FAIL, "can't clear error stack")
 
 done:
+    H5E_THREADS_UNLOCK(locked)
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_clear_stack() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5E_set_threads_active
+ *
+ * Purpose:	Private function to tell the error API that library worker
+ *              threads (which may push errors) are about to start running,
+ *              or have all finished.  In non-threadsafe builds there is only
+ *              one error stack, so it is locked while workers are active.
+ *
+ *              Must only be called from the application's thread, while no
+ *              workers are running.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_set_threads_active(hbool_t active)
+{
+    herr_t ret_value = SUCCEED;   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#if defined(H5_HAVE_FILTER_THREADS) && !defined(H5_HAVE_THREADSAFE)
+    /* Create the lock the first time it's needed */
+    if(active && !H5E_threads_mutex_init_g) {
+        pthread_mutexattr_t attr;       /* Mutex attributes */
+
+        /* (Errors while clearing the stack can push more errors) */
+        if(pthread_mutexattr_init(&attr))
+            HGOTO_DONE(FAIL)
+        if(pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE))
+            ret_value = FAIL;
+        else if(pthread_mutex_init(&H5E_threads_mutex_g, &attr))
+            ret_value = FAIL;
+        (void)pthread_mutexattr_destroy(&attr);
+        if(ret_value < 0)
+            HGOTO_DONE(FAIL)
+        H5E_threads_mutex_init_g = TRUE;
+    } /* end if */
+
+    H5E_threads_active_g = active;
+
+done:
+#else /* defined(H5_HAVE_FILTER_THREADS) && !defined(H5_HAVE_THREADSAFE) */
+    /* Nothing to do */
+    (void)active;
+#endif /* defined(H5_HAVE_FILTER_THREADS) && !defined(H5_HAVE_THREADSAFE) */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_set_threads_active() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5E_pop
@@ -85,6 +85,7 @@ H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func
     unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *fmt, ...);
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
 H5_DLL herr_t H5E_dump_api_stack(int is_api);
+H5_DLL herr_t H5E_set_threads_active(hbool_t active);
 
 /*
  * Macros handling system error messages as described in C standard.
@@ -366,6 +366,8 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
     if(H5P_set(new_plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+    if(H5P_set(new_plist, H5F_ACS_DATA_CACHE_SHARED_SIZE_NAME, &(f->shared->rdcc_pool.nbytes_max)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared data cache byte size")
     if(H5P_set(new_plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set alignment threshold")
     if(H5P_set(new_plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -376,6 +378,18 @@ H5F_get_access_plist(H5F_t *f, hbool_t app_ref)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache size")
     if(H5P_set(new_plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't sieve buffer size")
+    if(H5P_set(new_plist, H5F_ACS_META_PREFETCH_SIZE_NAME, &(f->shared->meta_prefetch_size)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata prefetch size")
+    if(H5P_set(new_plist, H5F_ACS_MDC_IMAGE_CONFIG_NAME, &(f->shared->mdc_image_config)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image config")
+    if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, &(f->shared->page_buf_size)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer size")
+    if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, &(f->shared->page_buf_page_size)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer page size")
+    if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, &(f->shared->page_buf_min_meta_perc)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set minimum metadata fraction of page buffer")
+    if(H5P_set(new_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &(f->shared->page_buf_min_raw_perc)) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set minimum raw data fraction of page buffer")
     if(H5P_set(new_plist, H5F_ACS_SDATA_BLOCK_SIZE_NAME, &(f->shared->sdata_aggr.alloc_size)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set 'small data' cache size")
     if(H5P_set(new_plist, H5F_ACS_LATEST_FORMAT_NAME, &(f->shared->latest_format)) < 0)
@@ -951,6 +965,8 @@ H5F_new(H5F_file_t *shared, hid_t fcpl_id, hid_t fapl_id, H5FD_t *lf)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get data cache byte size")
         if(H5P_get(plist, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, &(f->shared->rdcc_w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get preempt read chunk")
+        if(H5P_get(plist, H5F_ACS_DATA_CACHE_SHARED_SIZE_NAME, &(f->shared->rdcc_pool.nbytes_max)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get shared data cache byte size")
         if(H5P_get(plist, H5F_ACS_ALIGN_THRHD_NAME, &(f->shared->threshold)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold")
         if(H5P_get(plist, H5F_ACS_ALIGN_NAME, &(f->shared->alignment)) < 0)
@@ -959,6 +975,18 @@ H5F_new(H5F_file_t *shared, hid_t fcpl_id, hid_t fapl_id, H5FD_t *lf)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get garbage collect reference")
         if(H5P_get(plist, H5F_ACS_SIEVE_BUF_SIZE_NAME, &(f->shared->sieve_buf_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get sieve buffer size")
+        if(H5P_get(plist, H5F_ACS_META_PREFETCH_SIZE_NAME, &(f->shared->meta_prefetch_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata prefetch size")
+        if(H5P_get(plist, H5F_ACS_MDC_IMAGE_CONFIG_NAME, &(f->shared->mdc_image_config)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata cache image config")
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, &(f->shared->page_buf_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get page buffer size")
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, &(f->shared->page_buf_page_size)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get page buffer page size")
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, &(f->shared->page_buf_min_meta_perc)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get minimum metadata fraction of page buffer")
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &(f->shared->page_buf_min_raw_perc)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get minimum raw data fraction of page buffer")
         if(H5P_get(plist, H5F_ACS_LATEST_FORMAT_NAME, &(f->shared->latest_format)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'latest format' flag")
         if(H5P_get(plist, H5F_ACS_META_BLOCK_SIZE_NAME, &(f->shared->meta_aggr.alloc_size)) < 0)
@@ -983,6 +1011,13 @@ H5F_new(H5F_file_t *shared, hid_t fcpl_id, hid_t fapl_id, H5FD_t *lf)
             HGOTO_ERROR(H5E_FILE, H5E_CANTGET, NULL, "can't get free space type mapping from VFD")
         if(H5MF_init_merge_flags(f) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "problem initializing free space merge flags")
+
+        /* Create the page buffer, if requested */
+        /* (needs the VFD feature flags) */
+        if(f->shared->page_buf_size > 0)
+            if(H5F_pb_create(f, f->shared->page_buf_size, f->shared->page_buf_page_size,
+                    f->shared->page_buf_min_meta_perc, f->shared->page_buf_min_raw_perc) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "can't create page buffer")
         f->shared->tmp_addr = f->shared->maxaddr;
         /* Disable temp. space allocation for parallel I/O (for now) */
         /* (When we've arranged to have the relocated metadata addresses (and
@@ -1023,8 +1058,11 @@ H5F_new(H5F_file_t *shared, hid_t fcpl_id, hid_t fapl_id, H5FD_t *lf)
 
 done:
     if(!ret_value && f) {
-	if(!shared)
+	if(!shared) {
+            if(f->shared && H5F_pb_dest(f, H5AC_dxpl_id, FALSE) < 0)
+                HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, NULL, "can't free page buffer")
             f->shared = H5FL_FREE(H5F_file_t, f->shared);
+        } /* end if */
 	f = H5FL_FREE(H5F_t, f);
     } /* end if */
 
@@ -1060,13 +1098,24 @@ H5F_dest(H5F_t *f, hid_t dxpl_id, hbool_t flush)
     HDassert(f->shared);
 
     if(1 == f->shared->nrefs) {
+#ifdef H5F_HAVE_UNLOCKED_READS
+        /* Wait for any reads from the file running without the API lock */
+        H5TS_readers_wait(&f->shared->nreaders);
+#endif /* H5F_HAVE_UNLOCKED_READS */
+
         /* Flush at this point since the file will be closed.
          * Only try to flush the file if it was opened with write access, and if
          * the caller requested a flush.
          */
-        if((f->shared->flags & H5F_ACC_RDWR) && flush)
+        if((f->shared->flags & H5F_ACC_RDWR) && flush) {
+            /* Record the metadata cache image, if requested */
+            if(f->shared->mdc_image_config.generate_image && f->shared->sblock)
+                if(H5F_mdci_save(f, dxpl_id) < 0)
+                    HDONE_ERROR(H5E_CACHE, H5E_CANTSERIALIZE, FAIL, "unable to save metadata cache image")
+
             if(H5F_flush(f, dxpl_id, TRUE) < 0)
                 HDONE_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to flush cache")
+        } /* end if */
 
         /* Release the external file cache */
         if(f->shared->efc) {
@@ -1121,6 +1170,12 @@ H5F_dest(H5F_t *f, hid_t dxpl_id, hbool_t flush)
         if(H5F_accum_reset(f, dxpl_id, TRUE) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if(H5F_mdci_free(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if(H5F_pb_dest(f, dxpl_id, TRUE) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
         if(H5FO_dest(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
@@ -1128,6 +1183,9 @@ H5F_dest(H5F_t *f, hid_t dxpl_id, hbool_t flush)
         if(H5G_node_close(f) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
+        if(H5G_traverse_cache_reset(f) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
 
         /* Destroy file creation properties */
         if(H5I_GENPROP_LST != H5I_get_type(f->shared->fcpl_id))
@@ -1370,11 +1428,19 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
          */
         if(H5G_mkroot(file, dxpl_id, TRUE) < 0)
             HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create/open root group")
+
+        /* Remove any metadata cache image left by an earlier file of this name */
+        if(H5F_mdci_discard(file) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_CANTDELETE, NULL, "unable to remove metadata cache image")
     } else if (1 == shared->nrefs) {
 	/* Read the superblock if it hasn't been read before. */
         if(H5F_super_read(file, dxpl_id) < 0)
 	    HGOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "unable to read superblock")
 
+        /* Read in the metadata recorded in the metadata cache image, if there is one */
+        if(H5F_mdci_load(file, dxpl_id) < 0)
+	    HGOTO_ERROR(H5E_FILE, H5E_READERROR, NULL, "unable to load metadata cache image")
+
 	/* Open the root group */
 	if(H5G_mkroot(file, dxpl_id, FALSE) < 0)
 	    HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to read root group")
@@ -1767,6 +1833,11 @@ H5F_flush(H5F_t *f, hid_t dxpl_id, hbool_t closing)
         /* Push error, but keep going*/
         HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
 
+    /* Flush out the page buffer */
+    if(H5F_pb_flush(f, dxpl_id) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
+
     /* Flush file buffers to disk. */
     if(H5FD_flush(f->shared->lf, dxpl_id, closing) < 0)
         /* Push error, but keep going*/
@@ -3135,6 +3206,81 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Fclear_elink_file_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_page_buffering_stats
+ *
+ * Purpose:     Retrieves the statistics of the file's page buffer, for
+ *              metadata ([0]) and raw data ([1]): the number of pages
+ *              accessed, found in the buffer, loaded into the buffer
+ *              and evicted from it, and the number of I/Os done directly
+ *              on the file instead.  Any of the arrays may be NULL.
+ *
+ * Return:      Success:        non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
+    unsigned hits[2], unsigned misses[2], unsigned evictions[2],
+    unsigned bypasses[2])
+{
+    H5F_t         *file;        /* File */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "i*Iu*Iu*Iu*Iu*Iu", file_id, accesses, hits, misses, evictions,
+             bypasses);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->page_buf)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "page buffering is not enabled for file")
+
+    /* Get the statistics */
+    if(H5F_pb_get_stats(file->shared->page_buf, accesses, hits, misses, evictions, bypasses) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve page buffer statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Fget_page_buffering_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_page_buffering_stats
+ *
+ * Purpose:     Resets the statistics of the file's page buffer.
+ *
+ * Return:      Success:        non-negative
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_page_buffering_stats(hid_t file_id)
+{
+    H5F_t         *file;        /* File */
+    herr_t        ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->page_buf)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "page buffering is not enabled for file")
+
+    /* Reset the statistics */
+    if(H5F_pb_reset_stats(file->shared->page_buf) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset page buffer statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Freset_page_buffering_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_grp_btree_shared
@@ -3165,6 +3311,33 @@ H5F_set_grp_btree_shared(H5F_t *f, H5RC_t *rc)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5F_set_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_set_grp_path_cache
+ *
+ * Purpose:     Set the grp_path_cache field (NULL when the cache is
+ *              released).
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL (should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_set_grp_path_cache(H5F_t *f, struct H5SL_t *cache)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    f->shared->grp_path_cache = cache;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5F_set_grp_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_set_sohm_addr
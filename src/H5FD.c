@@ -54,6 +54,8 @@
 #include "H5FDwindows.h"        /* Windows buffered I/O     */
 #endif
 #include "H5FDdirect.h"		/* Direct file I/O			*/
+#include "H5FDiouring.h"	/* io_uring file I/O			*/
+#include "H5FDmmap.h"		/* Read-only mmap file I/O		*/
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"		/* Property lists			*/
@@ -220,6 +222,12 @@ H5FD_term_interface(void)
                 H5FD_sec2_term();
 #ifdef H5_HAVE_DIRECT
                 H5FD_direct_term();
+#endif
+#ifdef H5_HAVE_IOURING
+                H5FD_iouring_term();
+#endif
+#ifdef H5_HAVE_MMAP_VFD
+                H5FD_mmap_term();
 #endif
                 H5FD_log_term();
                 H5FD_stdio_term();
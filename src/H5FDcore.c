@@ -31,13 +31,23 @@
 #include "H5Fprivate.h"     /* File access                  */
 #include "H5FDprivate.h"    /* File drivers                 */
 #include "H5FDcore.h"       /* Core file driver             */
+#include "H5FLprivate.h"    /* Free lists                   */
 #include "H5Iprivate.h"     /* IDs                          */
 #include "H5MMprivate.h"    /* Memory management            */
 #include "H5Pprivate.h"     /* Property lists               */
+#include "H5SLprivate.h"    /* Skip lists                   */
 
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_CORE_g = 0;
 
+/* A dirty region of the in-memory file image, when write tracking is
+ * enabled.  The bounds are inclusive and aligned to the tracking page size.
+ */
+typedef struct H5FD_core_region_t {
+    haddr_t start;              /* Start address of the region          */
+    haddr_t end;                /* End address of the region            */
+} H5FD_core_region_t;
+
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
  * of the file (the current size of the underlying memory).
@@ -85,6 +95,9 @@ typedef struct H5FD_core_t {
 #endif /* H5_HAVE_WIN32_API */
     hbool_t dirty;                              /* changes not saved?       */
     H5FD_file_image_callbacks_t fi_callbacks;   /* file image callbacks     */
+    hbool_t write_tracking;                     /* Whether to track writes  */
+    size_t bstore_page_size;                    /* backing store page size  */
+    H5SL_t *dirty_list;                         /* dirty parts of the file  */
 } H5FD_core_t;
 
 /* Driver-specific file access properties */
@@ -117,6 +130,11 @@ typedef struct H5FD_core_fapl_t {
                                 (size_t)((A)+(Z))<(size_t)(A))
 
 /* Prototypes */
+static herr_t H5FD_core_add_dirty_region(H5FD_core_t *file, haddr_t start,
+            haddr_t end);
+static herr_t H5FD_core_destroy_dirty_list(H5FD_core_t *file);
+static herr_t H5FD_core_write_to_bstore(H5FD_core_t *file, haddr_t addr,
+            size_t size);
 static void *H5FD_core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD_core_open(const char *name, unsigned flags, hid_t fapl_id,
             haddr_t maxaddr);
@@ -129,6 +147,8 @@ static haddr_t H5FD_core_get_eof(const H5FD_t *_file);
 static herr_t  H5FD_core_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
 static herr_t H5FD_core_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, void *buf);
+static herr_t H5FD_core_map(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+            size_t size, const void **ptr);
 static herr_t H5FD_core_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
 static herr_t H5FD_core_flush(H5FD_t *_file, hid_t dxpl_id, unsigned closing);
@@ -165,9 +185,190 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD_core_truncate,         /* truncate             */
     NULL,                       /* lock                 */
     NULL,                       /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    NULL,                       /* readv                */
+    NULL,                       /* writev               */
+    H5FD_core_map               /* map                  */
 };
 
+
+/* Declare a free list to manage the H5FD_core_region_t struct */
+H5FL_DEFINE_STATIC(H5FD_core_region_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_add_dirty_region
+ *
+ * Purpose:     Add a new dirty region to the list, for later flushing
+ *              to the backing store.
+ *
+ *              The region is first rounded out to the backing store page
+ *              size, then merged with any regions it overlaps or abuts,
+ *              so that the list always holds disjoint, non-adjacent
+ *              regions sorted by address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end)
+{
+    H5FD_core_region_t *item = NULL;    /* Region in the dirty list */
+    haddr_t b_addr;                     /* Search key for neighboring regions */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->dirty_list);
+    HDassert(start <= end);
+
+    /* Align the region to page boundaries */
+    start = (start / file->bstore_page_size) * file->bstore_page_size;
+    end = ((end / file->bstore_page_size) * file->bstore_page_size) + (file->bstore_page_size - 1);
+
+    /* Absorb every region which overlaps or abuts the new one.  Searching
+     * down from 'end + 1' finds them from the highest address downward.
+     */
+    b_addr = end + 1;
+    while(NULL != (item = (H5FD_core_region_t *)H5SL_less(file->dirty_list, &b_addr))
+            && item->end + 1 >= start) {
+        if(NULL == H5SL_remove(file->dirty_list, &item->start))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTREMOVE, FAIL, "can't remove dirty region from list")
+        if(item->start < start)
+            start = item->start;
+        if(item->end > end)
+            end = item->end;
+        item = H5FL_FREE(H5FD_core_region_t, item);
+        b_addr = end + 1;
+    } /* end while */
+
+    /* Insert the merged region */
+    if(NULL == (item = H5FL_MALLOC(H5FD_core_region_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate dirty region")
+    item->start = start;
+    item->end = end;
+    if(H5SL_insert(file->dirty_list, item, &item->start) < 0) {
+        item = H5FL_FREE(H5FD_core_region_t, item);
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "can't insert new dirty region into list")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_core_add_dirty_region() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_free_region_cb
+ *
+ * Purpose:     Skip list callback to release a dirty region.
+ *
+ * Return:      SUCCEED (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_core_free_region_cb(void *item, void UNUSED *key, void UNUSED *op_data)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    item = H5FL_FREE(H5FD_core_region_t, item);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_core_free_region_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_destroy_dirty_list
+ *
+ * Purpose:     Completely destroy the dirty list, releasing any regions
+ *              still in it.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_core_destroy_dirty_list(H5FD_core_t *file)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(file->dirty_list) {
+        if(H5SL_destroy(file->dirty_list, H5FD_core_free_region_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCLOSEOBJ, FAIL, "can't close core vfd dirty list")
+        file->dirty_list = NULL;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_core_destroy_dirty_list() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_write_to_bstore
+ *
+ * Purpose:     Write SIZE bytes of the in-memory image, starting at ADDR,
+ *              to the same location in the backing store.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
+{
+    unsigned char *ptr = file->mem + addr;      /* mutable pointer into the buffer (can't change mem) */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if((HDoff_t)addr != HDlseek(file->fd, (HDoff_t)addr, SEEK_SET))
+        HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "error seeking in backing store")
+
+    while(size > 0) {
+
+        h5_posix_io_t       bytes_in        = 0;    /* # of bytes to write  */
+        h5_posix_io_ret_t   bytes_wrote     = -1;   /* # of bytes written   */ 
+
+        /* Trying to write more bytes than the return type can handle is
+         * undefined behavior in POSIX.
+         */
+        if(size > H5_POSIX_MAX_IO_BYTES)
+            bytes_in = H5_POSIX_MAX_IO_BYTES;
+        else
+            bytes_in = (h5_posix_io_t)size;
+
+        do {
+            bytes_wrote = HDwrite(file->fd, ptr, bytes_in);
+        } while(-1 == bytes_wrote && EINTR == errno);
+
+        if(-1 == bytes_wrote) { /* error */
+            int myerrno = errno;
+            time_t mytime = HDtime(NULL);
+            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write to backing store failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', ptr = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->name, file->fd, myerrno, HDstrerror(myerrno), ptr, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)myoffset);
+        } /* end if */
+
+        HDassert(bytes_wrote > 0);
+        HDassert((size_t)bytes_wrote <= size);
+
+        size -= (size_t)bytes_wrote;
+        ptr = (unsigned char *)ptr + bytes_wrote;
+
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_core_write_to_bstore() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_core_init_interface
@@ -387,6 +588,8 @@ H5FD_core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     h5_stat_t           sb;
     int                 fd = -1;
     H5FD_file_image_info_t  file_image_info;
+    hbool_t             write_tracking;     /* Whether write tracking is requested */
+    size_t              page_size;          /* Write tracking page size */
     H5FD_t              *ret_value;
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -462,6 +665,21 @@ H5FD_core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
     /* Save file image callbacks */
     file->fi_callbacks = file_image_info.callbacks;
 
+    /* Retrieve the write tracking settings.  Tracking only matters when
+     * there is a backing store to write the changes to.
+     */
+    if(H5P_get(plist, H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME, &write_tracking) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD write tracking flag")
+    if(H5P_get(plist, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME, &page_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD write tracking page size")
+    if(write_tracking && file->backing_store) {
+        HDassert(page_size > 0);
+        file->write_tracking = TRUE;
+        file->bstore_page_size = page_size;
+        if(NULL == (file->dirty_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTCREATE, NULL, "can't create core vfd dirty region list")
+    } /* end if */
+
     if(fd >= 0) {
         /* Retrieve information for determining uniqueness of file */
 #ifdef H5_HAVE_WIN32_API
@@ -521,6 +739,13 @@ H5FD_core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
                 } /* end if */
                 else
                     HDmemcpy(file->mem, file_image_info.buffer, size);
+
+                /* The backing store doesn't hold the image yet, so all of
+                 * it must be written out by the next flush.
+                 */
+                if(file->write_tracking)
+                    if(H5FD_core_add_dirty_region(file, (haddr_t)0, (haddr_t)(size - 1)) < 0)
+                        HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, NULL, "unable to add file image to dirty region list")
             } /* end if */
             /* Read in existing data from the file if there is no image */
             else {
@@ -571,6 +796,8 @@ done:
     if(!ret_value && file) {
         if(file->fd >= 0)
             HDclose(file->fd);
+        if(H5FD_core_destroy_dirty_list(file) < 0)
+            HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to free core VFD dirty region list")
         H5MM_xfree(file->name);
         H5MM_xfree(file->mem);
         H5MM_xfree(file);
@@ -607,6 +834,8 @@ H5FD_core_close(H5FD_t *_file)
     /* Release resources */
     if(file->fd >= 0)
         HDclose(file->fd);
+    if(H5FD_core_destroy_dirty_list(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to free core VFD dirty region list")
     if(file->name)
         H5MM_xfree(file->name);
     if(file->mem) {
@@ -735,10 +964,16 @@ H5FD_core_query(const H5FD_t * _file, unsigned long *flags /* out */)
         *flags = 0;
         *flags |= H5FD_FEAT_AGGREGATE_METADATA; /* OK to aggregate metadata allocations */
         *flags |= H5FD_FEAT_ACCUMULATE_METADATA; /* OK to accumulate metadata for faster writes */
-        *flags |= H5FD_FEAT_DATA_SIEVE;       /* OK to perform data sieving for faster raw data reads & writes */
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA; /* OK to aggregate "small" raw data allocations */
         *flags |= H5FD_FEAT_ALLOW_FILE_IMAGE;   /* OK to use file image feature with this VFD */
         *flags |= H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS;       /* OK to use file image callbacks with this VFD */
+        *flags |= H5FD_FEAT_CONCURRENT_READ;    /* OK to read raw data from several threads at once */
+
+        /* Data sieving writes back the whole sieve buffer, which would
+         * defeat write tracking by dirtying pages that didn't change.
+         */
+        if(!(file && file->write_tracking))
+            *flags |= H5FD_FEAT_DATA_SIEVE;   /* OK to perform data sieving for faster raw data reads & writes */
 
         /* If the backing store is open, a POSIX file handle is available */
         if(file && file->fd >= 0 && file->backing_store)
@@ -957,6 +1192,47 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_core_map
+ *
+ * Purpose:     Points PTR at the SIZE bytes of FILE's memory image
+ *              beginning at address ADDR, so they can be read without
+ *              copying.  The pointer is only valid until the file is
+ *              written to or closed, since writes may move the image.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_core_map(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id, haddr_t addr,
+        size_t size, const void **ptr/*out*/)
+{
+    H5FD_core_t  *file = (H5FD_core_t*)_file;
+    herr_t      ret_value=SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(ptr);
+
+    /* Check for overflow conditions */
+    if (HADDR_UNDEF == addr)
+        HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+    if (REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "file address overflowed")
+
+    /* The data must all be in the memory image */
+    if((addr + size) > file->eof)
+        HGOTO_ERROR(H5E_IO, H5E_OVERFLOW, FAIL, "data is past the end of the memory image")
+
+    *ptr = file->mem + addr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_core_map() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_core_write
@@ -1023,6 +1299,11 @@ H5FD_core_write(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id, had
         file->eof = new_eof;
     } /* end if */
 
+    /* Add the buffer region to the dirty list if using that optimization */
+    if(file->write_tracking && size > 0)
+        if(H5FD_core_add_dirty_region(file, addr, addr + size - 1) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINSERT, FAIL, "unable to add core VFD dirty region during write call - addresses: start=%llu end=%llu", (unsigned long long)addr, (unsigned long long)(addr + size - 1))
+
     /* Write from BUF to memory */
     HDmemcpy(file->mem + addr, buf, size);
 
@@ -1057,45 +1338,37 @@ H5FD_core_flush(H5FD_t *_file, hid_t UNUSED dxpl_id, unsigned UNUSED closing)
 
     /* Write to backing store */
     if (file->dirty && file->fd >= 0 && file->backing_store) {
-        haddr_t size = file->eof;
-        unsigned char *ptr = file->mem;
 
-        if(0 != HDlseek(file->fd, (off_t)0, SEEK_SET))
-            HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "error seeking in backing store")
-        
-        while (size > 0) {
+        /* Write only the dirty regions, when tracking writes */
+        if(file->write_tracking) {
+            H5SL_node_t *node;          /* Current node in dirty list */
 
-            h5_posix_io_t       bytes_in        = 0;    /* # of bytes to write  */
-            h5_posix_io_ret_t   bytes_wrote     = -1;   /* # of bytes written   */ 
+            for(node = H5SL_first(file->dirty_list); node; node = H5SL_next(node)) {
+                H5FD_core_region_t *item = (H5FD_core_region_t *)H5SL_item(node);
+                haddr_t end;            /* End of the region, clipped to the eof */
+
+                /* Regions are page-aligned and may run past the end of
+                 * the memory buffer, which may also have shrunk since the
+                 * region was recorded.
+                 */
+                if(item->start >= file->eof)
+                    break;
+                end = MIN(item->end, file->eof - 1);
+
+                if(H5FD_core_write_to_bstore(file, item->start, (size_t)((end - item->start) + 1)) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+            } /* end for */
+
+            /* Empty the dirty list */
+            if(H5SL_free(file->dirty_list, H5FD_core_free_region_cb, NULL) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "can't free core vfd dirty region list")
+        } /* end if */
+        else {
+            /* Write the whole image */
+            if(H5FD_core_write_to_bstore(file, (haddr_t)0, (size_t)file->eof) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+        } /* end else */
 
-            /* Trying to write more bytes than the return type can handle is
-             * undefined behavior in POSIX.
-             */
-            if(size > H5_POSIX_MAX_IO_BYTES)
-                bytes_in = H5_POSIX_MAX_IO_BYTES;
-            else
-                bytes_in = (h5_posix_io_t)size;
-
-            do {
-                bytes_wrote = HDwrite(file->fd, ptr, bytes_in);
-            } while(-1 == bytes_wrote && EINTR == errno);
-            
-            if(-1 == bytes_wrote) { /* error */
-                int myerrno = errno;
-                time_t mytime = HDtime(NULL);
-                HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
-
-                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write to backing store failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', ptr = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->name, file->fd, myerrno, HDstrerror(myerrno), ptr, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)myoffset);
-            } /* end if */
-            
-            HDassert(bytes_wrote > 0);
-            HDassert((size_t)bytes_wrote <= size);
-
-            size -= (size_t)bytes_wrote;
-            ptr = (unsigned char *)ptr + bytes_wrote;
-            
-        } /* end while */
-        
         file->dirty = FALSE;
     }
 
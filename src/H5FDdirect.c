@@ -175,7 +175,10 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD_direct_truncate,      /*truncate    */
     NULL,                                       /*lock                  */
     NULL,                                       /*unlock                */
-    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+    H5FD_FLMAP_DICHOTOMY,                       /*fl_map                */
+    NULL,                     /*readv      */
+    NULL,                     /*writev     */
+    NULL                      /*map        */
 };
 
 /* Declare a free list to manage the H5FD_direct_t struct */
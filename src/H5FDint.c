@@ -42,6 +42,7 @@
 #include "H5Fprivate.h"         /* File access				*/
 #include "H5FDpkg.h"		/* File Drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"		/* Property lists			*/
 
 
@@ -188,6 +189,162 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_readv
+ *
+ * Purpose:	Reads a list of COUNT pieces of data from a file.  Piece U
+ *		is SIZE[U] bytes at relative address ADDR[U] and is read
+ *		into buffer BUF[U].  Drivers without a 'readv' callback get
+ *		one 'read' call per piece.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_readv(H5FD_t *file, hid_t dxpl_id, H5FD_mem_t type, size_t count,
+    const haddr_t addr[], const size_t size[], void *buf[]/*out*/)
+{
+    haddr_t     *abs_addr = NULL;           /* Absolute addresses of pieces */
+    size_t      u;                          /* Local index variable */
+    herr_t      ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(H5I_GENPROP_LST == H5I_get_type(dxpl_id));
+    HDassert(TRUE == H5P_isa_class(dxpl_id, H5P_DATASET_XFER));
+    HDassert(0 == count || (addr && size && buf));
+
+    /* Fall back to one read per piece */
+    if(NULL == file->cls->readv) {
+        for(u = 0; u < count; u++)
+            if(H5FD_read(file, dxpl_id, type, addr[u], size[u], buf[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Offset the addresses by the base address, if there is one */
+    if(file->base_addr > 0) {
+        if(NULL == (abs_addr = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for addresses")
+        for(u = 0; u < count; u++)
+            abs_addr[u] = addr[u] + file->base_addr;
+        addr = abs_addr;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if((file->cls->readv)(file, type, dxpl_id, count, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver vector read request failed")
+
+done:
+    if(abs_addr)
+        H5MM_xfree(abs_addr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_readv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_map
+ *
+ * Purpose:	Get a read-only pointer to SIZE bytes of the file at ADDR
+ *		from drivers which keep the file's contents in memory.
+ *
+ * Return:	Success:	Non-negative, with PTR set
+ *		Failure:	Negative, also if the driver can't map data
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_map(H5FD_t *file, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
+    size_t size, const void **ptr/*out*/)
+{
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(ptr);
+
+    if(NULL == file->cls->map)
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "file driver can't map data")
+
+    /* Dispatch to driver */
+    if((file->cls->map)(file, type, dxpl_id, addr + file->base_addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "driver map request failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_writev
+ *
+ * Purpose:	Writes a list of COUNT pieces of data to a file.  Piece U is
+ *		SIZE[U] bytes from buffer BUF[U] and is written at relative
+ *		address ADDR[U].  Drivers without a 'writev' callback get one
+ *		'write' call per piece.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_writev(H5FD_t *file, hid_t dxpl_id, H5FD_mem_t type, size_t count,
+    const haddr_t addr[], const size_t size[], const void *buf[])
+{
+    haddr_t     *abs_addr = NULL;           /* Absolute addresses of pieces */
+    size_t      u;                          /* Local index variable */
+    herr_t      ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(H5I_GENPROP_LST == H5I_get_type(dxpl_id));
+    HDassert(TRUE == H5P_isa_class(dxpl_id, H5P_DATASET_XFER));
+    HDassert(0 == count || (addr && size && buf));
+
+    /* Fall back to one write per piece */
+    if(NULL == file->cls->writev) {
+        for(u = 0; u < count; u++)
+            if(H5FD_write(file, dxpl_id, type, addr[u], size[u], buf[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* The no-op case */
+    if(0 == count)
+        HGOTO_DONE(SUCCEED)
+
+    /* Offset the addresses by the base address, if there is one */
+    if(file->base_addr > 0) {
+        if(NULL == (abs_addr = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for addresses")
+        for(u = 0; u < count; u++)
+            abs_addr[u] = addr[u] + file->base_addr;
+        addr = abs_addr;
+    } /* end if */
+
+    /* Dispatch to driver */
+    if((file->cls->writev)(file, type, dxpl_id, count, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver vector write request failed")
+
+done:
+    if(abs_addr)
+        H5MM_xfree(abs_addr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_writev() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_set_eoa
@@ -0,0 +1,1579 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The io_uring file driver submits reads and writes to the Linux
+ *          kernel through an io_uring submission queue instead of making
+ *          one blocking system call per request.
+ *
+ *          Writes are asynchronous: the data is copied into a buffer
+ *          owned by the request and the call returns as soon as the
+ *          request is queued, so up to 'queue_depth' writes (chunk
+ *          flushes, for instance) are handed to the device together.
+ *          Reads block until their data has arrived, but the pieces of a
+ *          vectored read are all queued before waiting.  Outstanding
+ *          writes are completed when the file is flushed, truncated or
+ *          closed, when the queue is full, and before any read or write
+ *          that overlaps them.  An error from an asynchronous write is
+ *          reported by the next call that waits for it.
+ */
+
+/* Interface initialization */
+#define H5_INTERFACE_INIT_FUNC  H5FD_iouring_init_interface
+
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDprivate.h"    /* File drivers             */
+#include "H5FDiouring.h"    /* io_uring file driver     */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* The ring indices are shared with the kernel, so they are read and
+ * updated with acquire/release ordering.
+ */
+#define H5FD_IOURING_LOAD(P)        __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define H5FD_IOURING_STORE(P, V)    __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+
+/* The largest number of bytes moved by one request (the kernel reports
+ * the result of a request as a 32-bit signed integer)
+ */
+#define H5FD_IOURING_MAX_IO_BYTES   ((size_t)1 << 30)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned    queue_depth;    /* Number of requests that may be in flight */
+} H5FD_iouring_fapl_t;
+
+/* A request that has been (or is being) handed to the kernel.  'iov' and
+ * 'addr' describe the part of the transfer that hasn't completed yet.
+ * Writes transfer from 'stage', a copy of the caller's data which is kept
+ * with the request and reused by later writes.
+ */
+typedef struct H5FD_iouring_req_t {
+    struct iovec    iov;        /* Memory still to be transferred       */
+    haddr_t         addr;       /* File address of 'iov'                */
+    void            *stage;     /* Copy of the data being written       */
+    size_t          stage_size; /* Allocated size of 'stage'            */
+    hbool_t         write;      /* Whether the request is a write       */
+    hbool_t         busy;       /* Whether the request is in flight     */
+} H5FD_iouring_req_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the size of the underlying file once all queued writes have
+ * completed).
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;        /* public stuff, must be first      */
+    int                 fd;         /* the filesystem file descriptor   */
+    haddr_t             eoa;        /* end of allocated region          */
+    haddr_t             eof;        /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;         /* file access properties           */
+    char                filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t               device;     /* file device number               */
+    ino_t               inode;      /* file i-node number               */
+
+    /* The rings shared with the kernel */
+    int                 ring_fd;    /* io_uring file descriptor         */
+    void                *sq_ring;   /* Submission queue ring            */
+    size_t              sq_ring_size;
+    void                *cq_ring;   /* Completion queue ring (may be the same mapping as 'sq_ring') */
+    size_t              cq_ring_size;
+    struct io_uring_sqe *sqes;      /* Submission queue entries         */
+    size_t              sqes_size;
+    unsigned            *sq_tail;
+    unsigned            *sq_mask;
+    unsigned            *sq_array;
+    unsigned            *cq_head;
+    unsigned            *cq_tail;
+    unsigned            *cq_mask;
+    struct io_uring_cqe *cqes;
+    unsigned            to_submit;  /* # of queued entries not yet passed to the kernel */
+
+    /* Requests */
+    H5FD_iouring_req_t  *req;       /* Array of 'fa.queue_depth' requests */
+    unsigned            *free_req;  /* Stack of unused request indices  */
+    unsigned            nfree;      /* # of entries in 'free_req'       */
+    unsigned            nbusy;      /* # of requests in flight          */
+    unsigned            nreads;     /* # of reads in flight             */
+    int                 read_errno; /* First error returned by a read   */
+    haddr_t             read_err_addr;  /* File address of that read    */
+    int                 write_errno;    /* First error returned by a write not yet reported */
+    haddr_t             write_err_addr; /* File address of that write   */
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Prototypes */
+static void *H5FD_iouring_fapl_get(H5FD_t *file);
+static void *H5FD_iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_iouring_close(H5FD_t *_file);
+static int H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_iouring_get_eof(const H5FD_t *_file);
+static herr_t H5FD_iouring_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_iouring_readv(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addr[], const size_t size[], void *buf[]);
+static herr_t H5FD_iouring_writev(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addr[], const size_t size[],
+            const void *buf[]);
+static herr_t H5FD_iouring_flush(H5FD_t *_file, hid_t dxpl_id, unsigned closing);
+static herr_t H5FD_iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_iouring_setup(H5FD_iouring_t *file);
+static herr_t H5FD_iouring_teardown(H5FD_iouring_t *file);
+static herr_t H5FD_iouring_enter(H5FD_iouring_t *file, unsigned min_complete);
+static void H5FD_iouring_prep(H5FD_iouring_t *file, unsigned idx);
+static void H5FD_iouring_reap(H5FD_iouring_t *file);
+static void H5FD_iouring_cancel(H5FD_iouring_t *file);
+static herr_t H5FD_iouring_wait(H5FD_iouring_t *file, const unsigned *count,
+            unsigned target);
+static herr_t H5FD_iouring_report(H5FD_iouring_t *file, hbool_t write);
+static hbool_t H5FD_iouring_overlaps(const H5FD_iouring_t *file, haddr_t addr,
+            size_t size);
+static herr_t H5FD_iouring_check_region(const H5FD_iouring_t *file, haddr_t addr,
+            size_t size);
+static herr_t H5FD_iouring_queue_read(H5FD_iouring_t *file, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_iouring_queue_write(H5FD_iouring_t *file, haddr_t addr,
+            size_t size, const void *buf);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                  /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t),/* fapl_size            */
+    H5FD_iouring_fapl_get,      /* fapl_get             */
+    H5FD_iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_iouring_open,          /* open                 */
+    H5FD_iouring_close,         /* close                */
+    H5FD_iouring_cmp,           /* cmp                  */
+    H5FD_iouring_query,         /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_iouring_get_eoa,       /* get_eoa              */
+    H5FD_iouring_set_eoa,       /* set_eoa              */
+    H5FD_iouring_get_eof,       /* get_eof              */
+    H5FD_iouring_get_handle,    /* get_handle           */
+    H5FD_iouring_read,          /* read                 */
+    H5FD_iouring_write,         /* write                */
+    H5FD_iouring_flush,         /* flush                */
+    H5FD_iouring_truncate,      /* truncate             */
+    NULL,                       /* lock                 */
+    NULL,                       /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD_iouring_readv,         /* readv                */
+    H5FD_iouring_writev,        /* writev               */
+    NULL                        /* map                  */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init_interface
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_init_interface(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5FD_iouring_init())
+} /* H5FD_iouring_init_interface() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value;            /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     <none>
+ *
+ *---------------------------------------------------------------------------
+ */
+void
+H5FD_iouring_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_iouring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *              QUEUE_DEPTH is the number of requests that may be in flight
+ *              at once; zero selects H5FD_IOURING_QUEUE_DEPTH_DEF.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth)
+{
+    H5P_genplist_t      *plist;     /* Property list pointer */
+    H5FD_iouring_fapl_t fa;
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", fapl_id, queue_depth);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(queue_depth > H5FD_IOURING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth too large")
+
+    fa.queue_depth = queue_depth ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access property
+ *              list through the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/)
+{
+    H5P_genplist_t      *plist;     /* Property list pointer */
+    const H5FD_iouring_fapl_t *fa;
+    herr_t ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, queue_depth);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_IOURING != H5P_get_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_get_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(queue_depth)
+        *queue_depth = fa->queue_depth;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5FD_iouring_fapl_copy(&(file->fa)))
+} /* end H5FD_iouring_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t *old_fa = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t *new_fa;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(NULL != (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HDmemcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    FUNC_LEAVE_NOAPI(new_fa)
+} /* end H5FD_iouring_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_setup
+ *
+ * Purpose:     Creates the io_uring instance for FILE, maps its rings and
+ *              allocates the request table.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_setup(H5FD_iouring_t *file)
+{
+    struct io_uring_params  p;
+    void                    *ptr;
+    unsigned                u;
+    herr_t                  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(file->fa.queue_depth > 0);
+
+    HDmemset(&p, 0, sizeof(p));
+    if((file->ring_fd = (int)syscall(__NR_io_uring_setup, file->fa.queue_depth, &p)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to set up io_uring")
+
+    /* Map the submission and completion queue rings, which newer kernels
+     * allow to share one mapping.
+     */
+    file->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    file->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if(p.features & IORING_FEAT_SINGLE_MMAP)
+        file->sq_ring_size = file->cq_ring_size = MAX(file->sq_ring_size, file->cq_ring_size);
+
+    if(MAP_FAILED == (ptr = HDmmap(NULL, file->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file->ring_fd, (HDoff_t)IORING_OFF_SQ_RING)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue")
+    file->sq_ring = ptr;
+    if(p.features & IORING_FEAT_SINGLE_MMAP)
+        file->cq_ring = file->sq_ring;
+    else {
+        if(MAP_FAILED == (ptr = HDmmap(NULL, file->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file->ring_fd, (HDoff_t)IORING_OFF_CQ_RING)))
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion queue")
+        file->cq_ring = ptr;
+    } /* end else */
+
+    file->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    if(MAP_FAILED == (ptr = HDmmap(NULL, file->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, file->ring_fd, (HDoff_t)IORING_OFF_SQES)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission queue entries")
+    file->sqes = (struct io_uring_sqe *)ptr;
+
+    file->sq_tail = (unsigned *)((char *)file->sq_ring + p.sq_off.tail);
+    file->sq_mask = (unsigned *)((char *)file->sq_ring + p.sq_off.ring_mask);
+    file->sq_array = (unsigned *)((char *)file->sq_ring + p.sq_off.array);
+    file->cq_head = (unsigned *)((char *)file->cq_ring + p.cq_off.head);
+    file->cq_tail = (unsigned *)((char *)file->cq_ring + p.cq_off.tail);
+    file->cq_mask = (unsigned *)((char *)file->cq_ring + p.cq_off.ring_mask);
+    file->cqes = (struct io_uring_cqe *)((char *)file->cq_ring + p.cq_off.cqes);
+
+    /* Every request owns at most one submission queue entry, so the queue
+     * can't overflow as long as the number of requests is bounded by its
+     * size.
+     */
+    HDassert(p.sq_entries >= file->fa.queue_depth);
+    if(NULL == (file->req = (H5FD_iouring_req_t *)H5MM_calloc(file->fa.queue_depth * sizeof(H5FD_iouring_req_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate request table")
+    if(NULL == (file->free_req = (unsigned *)H5MM_malloc(file->fa.queue_depth * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate request table")
+    for(u = 0; u < file->fa.queue_depth; u++)
+        file->free_req[u] = file->fa.queue_depth - (u + 1);
+    file->nfree = file->fa.queue_depth;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_teardown
+ *
+ * Purpose:     Releases the io_uring instance and request table of FILE.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_teardown(H5FD_iouring_t *file)
+{
+    unsigned    u;
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(file->req) {
+        for(u = 0; u < file->fa.queue_depth; u++)
+            H5MM_xfree(file->req[u].stage);
+        file->req = (H5FD_iouring_req_t *)H5MM_xfree(file->req);
+    } /* end if */
+    file->free_req = (unsigned *)H5MM_xfree(file->free_req);
+
+    if(file->sqes && HDmunmap(file->sqes, file->sqes_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring submission queue entries")
+    if(file->cq_ring && file->cq_ring != file->sq_ring && HDmunmap(file->cq_ring, file->cq_ring_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring completion queue")
+    if(file->sq_ring && HDmunmap(file->sq_ring, file->sq_ring_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap io_uring submission queue")
+    file->sqes = NULL;
+    file->sq_ring = file->cq_ring = NULL;
+
+    if(file->ring_fd >= 0 && HDclose(file->ring_fd) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTCLOSEFILE, FAIL, "unable to close io_uring")
+    file->ring_fd = -1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_teardown() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_enter
+ *
+ * Purpose:     Passes the queued submission entries of FILE to the kernel
+ *              and, when MIN_COMPLETE is positive, waits until that many
+ *              requests have completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_enter(H5FD_iouring_t *file, unsigned min_complete)
+{
+    long        ret;
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    do {
+        ret = syscall(__NR_io_uring_enter, file->ring_fd, file->to_submit,
+                min_complete, min_complete ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if(ret < 0) {
+            /* Interrupted, or the kernel is temporarily short of resources */
+            if(EINTR == errno || EAGAIN == errno || EBUSY == errno)
+                continue;
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "unable to submit io_uring requests")
+        } /* end if */
+
+        HDassert((unsigned)ret <= file->to_submit);
+        file->to_submit -= (unsigned)ret;
+    } while(ret < 0 || file->to_submit > 0);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_enter() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_prep
+ *
+ * Purpose:     Places request IDX of FILE in the submission queue.  The
+ *              entry is handed to the kernel by the next call to
+ *              H5FD_iouring_enter().
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_iouring_prep(H5FD_iouring_t *file, unsigned idx)
+{
+    H5FD_iouring_req_t  *req = &file->req[idx];
+    struct io_uring_sqe *sqe;
+    unsigned            tail;
+    unsigned            pos;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Only this process writes the tail of the submission queue */
+    tail = *file->sq_tail;
+    pos = tail & *file->sq_mask;
+
+    sqe = &file->sqes[pos];
+    HDmemset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (__u8)(req->write ? IORING_OP_WRITEV : IORING_OP_READV);
+    sqe->fd = file->fd;
+    sqe->addr = (__u64)(uintptr_t)&req->iov;
+    sqe->len = 1;
+    sqe->off = (__u64)req->addr;
+    sqe->user_data = (__u64)idx;
+
+    file->sq_array[pos] = pos;
+    H5FD_IOURING_STORE(file->sq_tail, tail + 1);
+    file->to_submit++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_iouring_prep() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_reap
+ *
+ * Purpose:     Processes the entries in the completion queue of FILE.
+ *              Requests that transferred less than they asked for are
+ *              queued again for the remainder; a read that reaches the
+ *              end of the file fills the rest of its buffer with zeros.
+ *              The first error of a read and the first error of a write
+ *              are remembered separately, for H5FD_iouring_report() to
+ *              report to the call waiting on that kind of request.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_iouring_reap(H5FD_iouring_t *file)
+{
+    unsigned    head;
+    unsigned    tail;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    head = *file->cq_head;
+    tail = H5FD_IOURING_LOAD(file->cq_tail);
+    while(head != tail) {
+        const struct io_uring_cqe *cqe = &file->cqes[head & *file->cq_mask];
+        unsigned            idx = (unsigned)cqe->user_data;
+        H5FD_iouring_req_t  *req = &file->req[idx];
+        int                 res = cqe->res;
+        hbool_t             done = TRUE;
+
+        HDassert(idx < file->fa.queue_depth);
+        if(-EINTR == res || -EAGAIN == res)
+            done = FALSE;
+        else if(res < 0 || (0 == res && req->write)) {
+            if(req->write) {
+                if(0 == file->write_errno) {
+                    file->write_errno = res < 0 ? -res : EIO;
+                    file->write_err_addr = req->addr;
+                } /* end if */
+            } /* end if */
+            else if(0 == file->read_errno) {
+                file->read_errno = -res;
+                file->read_err_addr = req->addr;
+            } /* end if */
+        } /* end if */
+        else if(0 == res)
+            /* end of file but not end of format address space */
+            HDmemset(req->iov.iov_base, 0, req->iov.iov_len);
+        else if((size_t)res < req->iov.iov_len) {
+            req->iov.iov_base = (char *)req->iov.iov_base + res;
+            req->iov.iov_len -= (size_t)res;
+            req->addr += (haddr_t)res;
+            done = FALSE;
+        } /* end if */
+
+        if(done) {
+            req->busy = FALSE;
+            file->nbusy--;
+            if(!req->write)
+                file->nreads--;
+            file->free_req[file->nfree++] = idx;
+        } /* end if */
+        else
+            H5FD_iouring_prep(file, idx);
+
+        head++;
+    } /* end while */
+    H5FD_IOURING_STORE(file->cq_head, head);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_iouring_reap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_cancel
+ *
+ * Purpose:     Takes the reads of FILE that are in the submission queue
+ *              but haven't been passed to the kernel back out of the
+ *              queue, and releases their requests.  This is used when a
+ *              read fails, so that no entry pointing into the caller's
+ *              buffer is submitted after the read returns.  Queued writes
+ *              are moved up to close the gaps and stay queued.
+ *
+ * Return:      <none>
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_iouring_cancel(H5FD_iouring_t *file)
+{
+    unsigned    tail;
+    unsigned    keep;
+    unsigned    pos;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* The kernel only takes entries from the queue when it is entered, so
+     * the last 'to_submit' entries are still ours
+     */
+    tail = *file->sq_tail;
+    keep = tail - file->to_submit;
+    for(pos = keep; pos != tail; pos++) {
+        struct io_uring_sqe *sqe = &file->sqes[pos & *file->sq_mask];
+        unsigned            idx = (unsigned)sqe->user_data;
+        H5FD_iouring_req_t  *req = &file->req[idx];
+
+        HDassert(req->busy);
+        if(req->write) {
+            if(keep != pos)
+                file->sqes[keep & *file->sq_mask] = *sqe;
+            file->sq_array[keep & *file->sq_mask] = keep & *file->sq_mask;
+            keep++;
+        } /* end if */
+        else {
+            req->busy = FALSE;
+            file->nreads--;
+            file->nbusy--;
+            file->free_req[file->nfree++] = idx;
+        } /* end else */
+    } /* end for */
+    file->to_submit -= tail - keep;
+    H5FD_IOURING_STORE(file->sq_tail, keep);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_iouring_cancel() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_wait
+ *
+ * Purpose:     Waits until *COUNT, one of the request counters of FILE,
+ *              drops to TARGET or below.  Errors returned by the requests
+ *              that complete are left for H5FD_iouring_report().
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_wait(H5FD_iouring_t *file, const unsigned *count, unsigned target)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    H5FD_iouring_reap(file);
+    while(*count > target) {
+        if(H5FD_iouring_enter(file, 1) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "unable to wait for io_uring requests")
+        H5FD_iouring_reap(file);
+    } /* end while */
+
+    /* Resubmit the remainder of partial transfers */
+    if(file->to_submit > 0)
+        if(H5FD_iouring_enter(file, 0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "unable to submit io_uring requests")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_wait() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_report
+ *
+ * Purpose:     Reports, and clears, the first error returned by a read of
+ *              FILE or, when WRITE is set, by a write of FILE.  Reads are
+ *              always waited for by the call that issued them, so a read
+ *              error belongs to that call; write errors are reported by
+ *              the next flush, truncate or close of the file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_report(H5FD_iouring_t *file, hbool_t write)
+{
+    int         myerrno;
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(write) {
+        if(0 != (myerrno = file->write_errno)) {
+            file->write_errno = 0;
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: filename = '%s', file descriptor = %d, errno = %d, error message = '%s', offset = %llu", file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)file->write_err_addr)
+        } /* end if */
+    } /* end if */
+    else if(0 != (myerrno = file->read_errno)) {
+        file->read_errno = 0;
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: filename = '%s', file descriptor = %d, errno = %d, error message = '%s', offset = %llu", file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)file->read_err_addr)
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_report() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_overlaps
+ *
+ * Purpose:     Checks whether SIZE bytes at ADDR overlap a write of FILE
+ *              that is still in flight.  The kernel may complete requests
+ *              in any order, so such a write must finish before the
+ *              region is read or written again.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5FD_iouring_overlaps(const H5FD_iouring_t *file, haddr_t addr, size_t size)
+{
+    unsigned    u;
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Few requests are in flight at once, so check each of them */
+    if(file->nbusy > file->nreads)
+        for(u = 0; u < file->fa.queue_depth && !ret_value; u++)
+            if(file->req[u].busy && file->req[u].write)
+                ret_value = (hbool_t)(addr < file->req[u].addr + file->req[u].iov.iov_len &&
+                        file->req[u].addr < addr + size);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_overlaps() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t  *file       = NULL;     /* io_uring VFD info        */
+    int             fd          = -1;       /* File descriptor          */
+    int             o_flags;                /* Flags for open() call    */
+    H5P_genplist_t  *plist;                 /* Property list pointer    */
+    const H5FD_iouring_fapl_t *fa;          /* io_uring properties      */
+    h5_stat_t       sb;
+    H5FD_t          *ret_value;             /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if(H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if(H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if(H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if((fd = HDopen(name, o_flags, 0666)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x", name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_VFL, H5E_BADTYPE, NULL, "not a file access property list")
+    fa = (const H5FD_iouring_fapl_t *)H5P_get_driver_info(plist);
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+
+    file->fd = fd;
+    file->ring_fd = -1;
+    file->fa.queue_depth = fa ? fa->queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    H5_ASSIGN_OVERFLOW(file->eof, sb.st_size, h5_stat_size_t, haddr_t);
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set up the rings */
+    if(H5FD_iouring_setup(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to initialize io_uring")
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    if(NULL == ret_value) {
+        if(fd >= 0)
+            HDclose(fd);
+        if(file) {
+            if(H5FD_iouring_teardown(file) < 0)
+                HDONE_ERROR(H5E_VFL, H5E_CANTFREE, NULL, "unable to release io_uring")
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_close
+ *
+ * Purpose:     Completes the outstanding requests and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Complete the outstanding requests.  The file is closed even if one of
+     * them failed.
+     */
+    if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+    if(H5FD_iouring_report(file, TRUE) < 0)
+        HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write file")
+
+    /* Release the rings */
+    if(H5FD_iouring_teardown(file) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to release io_uring")
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t    *f1 = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t    *f2 = (const H5FD_iouring_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_query(const H5FD_t UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
+        *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* VFD handle is POSIX I/O call compatible                          */
+        *flags |= H5FD_FEAT_VECTOR_IO;              /* OK to pass lists of raw data requests to 'readv' & 'writev'      */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_iouring_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eof(const H5FD_t *_file)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(MAX(file->eof, file->eoa))
+} /* end H5FD_iouring_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_handle
+ *
+ * Purpose:     Returns the file handle of the io_uring file driver, after
+ *              completing the outstanding writes so that the handle sees
+ *              all the data written through the driver.
+ *
+ * Returns:     SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_get_handle(H5FD_t *_file, hid_t UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_check_region
+ *
+ * Purpose:     Checks that SIZE bytes at ADDR lie within the allocated
+ *              address space of FILE.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_check_region(const H5FD_iouring_t *file, haddr_t addr, size_t size)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+    if((addr + size) > file->eoa)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%lu, eoa=%llu",
+                    (unsigned long long)addr, size, (unsigned long long)file->eoa)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_check_region() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_queue_read
+ *
+ * Purpose:     Queues requests that read SIZE bytes at ADDR of FILE into
+ *              BUF, waiting for a free request when all of them are in
+ *              flight.  The caller waits for the reads to complete.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_queue_read(H5FD_iouring_t *file, haddr_t addr, size_t size, void *buf)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    while(size > 0) {
+        H5FD_iouring_req_t  *req;
+        unsigned            idx;
+
+        if(0 == file->nfree)
+            if(H5FD_iouring_wait(file, &file->nbusy, file->fa.queue_depth - 1) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete outstanding requests")
+
+        idx = file->free_req[--file->nfree];
+        req = &file->req[idx];
+        req->iov.iov_base = buf;
+        req->iov.iov_len = MIN(size, H5FD_IOURING_MAX_IO_BYTES);
+        req->addr = addr;
+        req->write = FALSE;
+        req->busy = TRUE;
+        file->nbusy++;
+        file->nreads++;
+        H5FD_iouring_prep(file, idx);
+
+        size -= req->iov.iov_len;
+        addr += (haddr_t)req->iov.iov_len;
+        buf = (char *)buf + req->iov.iov_len;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_queue_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_queue_write
+ *
+ * Purpose:     Copies SIZE bytes from BUF into free requests of FILE and
+ *              queues them to be written at ADDR, waiting for a free
+ *              request when all of them are in flight.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_queue_write(H5FD_iouring_t *file, haddr_t addr, size_t size,
+    const void *buf)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Update the end of file before the writes complete */
+    if(addr + size > file->eof)
+        file->eof = addr + size;
+
+    while(size > 0) {
+        H5FD_iouring_req_t  *req;
+        unsigned            idx;
+        size_t              len = MIN(size, H5FD_IOURING_MAX_IO_BYTES);
+
+        if(0 == file->nfree)
+            if(H5FD_iouring_wait(file, &file->nbusy, file->fa.queue_depth - 1) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+
+        idx = file->free_req[file->nfree - 1];
+        req = &file->req[idx];
+        if(req->stage_size < len) {
+            void *stage;
+
+            if(NULL == (stage = H5MM_realloc(req->stage, len)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate write buffer")
+            req->stage = stage;
+            req->stage_size = len;
+        } /* end if */
+        HDmemcpy(req->stage, buf, len);
+
+        file->nfree--;
+        req->iov.iov_base = req->stage;
+        req->iov.iov_len = len;
+        req->addr = addr;
+        req->write = TRUE;
+        req->busy = TRUE;
+        file->nbusy++;
+        H5FD_iouring_prep(file, idx);
+
+        size -= len;
+        addr += (haddr_t)len;
+        buf = (const char *)buf + len;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_queue_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(H5FD_iouring_check_region(file, addr, size) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "invalid file region")
+
+    /* Data still on its way to the file must get there first */
+    if(H5FD_iouring_overlaps(file, addr, size))
+        if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete outstanding requests")
+
+    /* Read the data and wait for it */
+    if(H5FD_iouring_queue_read(file, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to queue read requests")
+    if(H5FD_iouring_wait(file, &file->nreads, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete read requests")
+    if(H5FD_iouring_report(file, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    /* Never return while the kernel may still write into BUF */
+    if(file->nreads > 0) {
+        H5FD_iouring_cancel(file);
+        if(H5FD_iouring_wait(file, &file->nreads, 0) < 0)
+            HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete read requests")
+    } /* end if */
+    file->read_errno = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write
+ *
+ * Purpose:     Queues SIZE bytes of data from buffer BUF to be written to
+ *              FILE beginning at address ADDR according to data transfer
+ *              properties in DXPL_ID.  The data is copied, so BUF may be
+ *              reused as soon as this function returns.  A failure of the
+ *              write itself is reported by the next flush, truncate or
+ *              close of the file.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
+    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(H5FD_iouring_check_region(file, addr, size) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "invalid file region")
+
+    /* Keep overlapping writes in order */
+    if(H5FD_iouring_overlaps(file, addr, size))
+        if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+
+    if(H5FD_iouring_queue_write(file, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to queue write requests")
+    if(H5FD_iouring_enter(file, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to submit write requests")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_readv
+ *
+ * Purpose:     Reads COUNT pieces of raw data, the I'th being SIZE[I]
+ *              bytes at ADDR[I] read into BUF[I].  The reads are queued
+ *              together and then waited for.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_readv(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
+    size_t count, const haddr_t addr[], const size_t size[], void *buf[] /*out*/)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    hbool_t         overlaps    = FALSE;
+    size_t          u;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(addr && size && buf);
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(H5FD_iouring_check_region(file, addr[u], size[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "invalid file region")
+        if(!overlaps)
+            overlaps = H5FD_iouring_overlaps(file, addr[u], size[u]);
+    } /* end for */
+
+    /* Data still on its way to the file must get there first */
+    if(overlaps)
+        if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete outstanding requests")
+
+    /* Read the data and wait for it */
+    for(u = 0; u < count; u++)
+        if(H5FD_iouring_queue_read(file, addr[u], size[u], buf[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to queue read requests")
+    if(H5FD_iouring_wait(file, &file->nreads, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete read requests")
+    if(H5FD_iouring_report(file, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    /* Never return while the kernel may still write into BUF */
+    if(file->nreads > 0) {
+        H5FD_iouring_cancel(file);
+        if(H5FD_iouring_wait(file, &file->nreads, 0) < 0)
+            HDONE_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to complete read requests")
+    } /* end if */
+    file->read_errno = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_readv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_writev
+ *
+ * Purpose:     Queues COUNT pieces of raw data to be written, the I'th
+ *              being SIZE[I] bytes from BUF[I] written at ADDR[I].
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_writev(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
+    size_t count, const haddr_t addr[], const size_t size[], const void *buf[])
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    size_t          u;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(addr && size && buf);
+
+    for(u = 0; u < count; u++) {
+        /* Check for overflow conditions */
+        if(H5FD_iouring_check_region(file, addr[u], size[u]) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "invalid file region")
+
+        /* Keep overlapping writes in order */
+        if(H5FD_iouring_overlaps(file, addr[u], size[u]))
+            if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+
+        if(H5FD_iouring_queue_write(file, addr[u], size[u], buf[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to queue write requests")
+    } /* end for */
+    if(H5FD_iouring_enter(file, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to submit write requests")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_writev() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_flush
+ *
+ * Purpose:     Waits for the outstanding requests of FILE to complete.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_flush(H5FD_t *_file, hid_t UNUSED dxpl_id, unsigned UNUSED closing)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+    if(H5FD_iouring_report(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address, once the outstanding requests have
+ *              completed.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_truncate(H5FD_t *_file, hid_t UNUSED dxpl_id, hbool_t UNUSED closing)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(H5FD_iouring_wait(file, &file->nbusy, 0) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to complete outstanding requests")
+    if(H5FD_iouring_report(file, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write file")
+
+    /* Extend the file to make sure it's large enough */
+    if(!H5F_addr_eq(file->eoa, file->eof)) {
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_truncate() */
+#endif /* H5_HAVE_IOURING */
+
@@ -0,0 +1,51 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the io_uring driver.
+ */
+#ifndef H5FDiouring_H
+#define H5FDiouring_H
+
+#include "H5Ipublic.h"
+
+#ifdef H5_HAVE_IOURING
+#       define H5FD_IOURING	(H5FD_iouring_init())
+#else
+#       define H5FD_IOURING     (-1)
+#endif /* H5_HAVE_IOURING */
+
+#ifdef H5_HAVE_IOURING
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default and largest number of requests that may be in flight at once.
+ * Application can set the queue depth through H5Pset_fapl_iouring. */
+#define H5FD_IOURING_QUEUE_DEPTH_DEF    32
+#define H5FD_IOURING_QUEUE_DEPTH_MAX    4096
+
+H5_DLL hid_t H5FD_iouring_init(void);
+H5_DLL void H5FD_iouring_term(void);
+H5_DLL herr_t H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth);
+H5_DLL herr_t H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_IOURING */
+
+#endif
@@ -0,0 +1,45 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	The public header file for the read-only mmap driver.
+ */
+#ifndef H5FDmmap_H
+#define H5FDmmap_H
+
+#include "H5Ipublic.h"
+
+#ifdef H5_HAVE_MMAP_VFD
+#       define H5FD_MMAP	(H5FD_mmap_init())
+#else
+#       define H5FD_MMAP        (-1)
+#endif /* H5_HAVE_MMAP_VFD */
+
+#ifdef H5_HAVE_MMAP_VFD
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+H5_DLL hid_t H5FD_mmap_init(void);
+H5_DLL void H5FD_mmap_term(void);
+H5_DLL herr_t H5Pset_fapl_mmap(hid_t fapl_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* H5_HAVE_MMAP_VFD */
+
+#endif
@@ -213,7 +213,10 @@ static const H5FD_class_mpi_t H5FD_mpiposix_g = {
     H5FD_mpiposix_truncate,         /* truncate         */
     NULL,                           /* lock             */
     NULL,                           /* unlock           */
-    H5FD_FLMAP_DICHOTOMY            /* fl_map           */
+    H5FD_FLMAP_DICHOTOMY,           /* fl_map           */
+    NULL,                           /* readv            */
+    NULL,                           /* writev           */
+    NULL                            /* map              */
     },  /* End of superclass information */
     H5FD_mpiposix_mpi_rank,         /* get_rank         */
     H5FD_mpiposix_mpi_size,         /* get_size         */
@@ -178,7 +178,10 @@ static const H5FD_class_t H5FD_multi_g = {
     H5FD_multi_truncate,			/*truncate		*/
     NULL,                                       /*lock                  */
     NULL,                                       /*unlock                */
-    H5FD_FLMAP_DEFAULT 				/*fl_map		*/
+    H5FD_FLMAP_DEFAULT,				/*fl_map		*/
+    NULL,					/*readv			*/
+    NULL,					/*writev		*/
+    NULL					/*map			*/
 };
 
 
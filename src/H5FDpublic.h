@@ -189,6 +189,23 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * image to store in memory.
      */
 #define H5FD_FEAT_CAN_USE_FILE_IMAGE_CALLBACKS 0x00000800
+    /*
+     * Defining the H5FD_FEAT_VECTOR_IO for a VFL driver means that the
+     * driver's 'readv' and 'writev' callbacks handle a list of raw data
+     * requests with fewer system calls than one 'read' or 'write' per
+     * request, so the library will gather raw data sequences into lists
+     * for them.
+     */
+#define H5FD_FEAT_VECTOR_IO             0x00001000
+    /*
+     * Defining the H5FD_FEAT_CONCURRENT_READ for a VFL driver means that
+     * the driver's 'read' and 'readv' callbacks can be called for raw data
+     * by several threads at once, on a file opened read-only, while other
+     * threads make any calls other than 'write', 'truncate' or 'close' on
+     * the same file.  Threadsafe builds of the library then read raw data
+     * without holding the library's lock.
+     */
+#define H5FD_FEAT_CONCURRENT_READ       0x00002000
 
 
 /* Forward declaration */
@@ -232,6 +249,13 @@ typedef struct H5FD_class_t {
     herr_t  (*lock)(H5FD_t *file, unsigned char *oid, unsigned lock_type, hbool_t last);
     herr_t  (*unlock)(H5FD_t *file, unsigned char *oid, hbool_t last);
     H5FD_mem_t fl_map[H5FD_MEM_NTYPES];
+    herr_t  (*readv)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, size_t count,
+                     const haddr_t addr[], const size_t size[], void *buffer[]);
+    herr_t  (*writev)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, size_t count,
+                      const haddr_t addr[], const size_t size[],
+                      const void *buffer[]);
+    herr_t  (*map)(H5FD_t *file, H5FD_mem_t type, hid_t dxpl, haddr_t addr,
+                   size_t size, const void **ptr/*out*/);
 } H5FD_class_t;
 
 /* A free list is a singly-linked list of address/size pairs. */
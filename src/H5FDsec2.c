@@ -18,11 +18,15 @@
  *              Thursday, July 29, 1999
  *
  * Purpose: The POSIX unbuffered file driver using only the HDF5 public
- *          API and with a few optimizations: the lseek() call is made
- *          only when the current file position is unknown or needs to be
- *          changed based on previous I/O through this driver (don't mix
- *          I/O from this driver with I/O from other parts of the
- *          application to the same file).
+ *          API and with a few optimizations: where pread() and pwrite()
+ *          are available they are used so that no lseek() call is needed
+ *          at all; otherwise the lseek() call is made only when the
+ *          current file position is unknown or needs to be changed based
+ *          on previous I/O through this driver (don't mix I/O from this
+ *          driver with I/O from other parts of the application to the
+ *          same file).  Where preadv() and pwritev() are available, lists
+ *          of raw data requests that are adjacent in the file are handled
+ *          with one system call.
  */
 
 /* Interface initialization */
@@ -39,6 +43,19 @@
 #include "H5MMprivate.h"    /* Memory management        */
 #include "H5Pprivate.h"     /* Property lists           */
 
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+#include <sys/uio.h>
+
+/* The largest number of buffers passed to one preadv() or pwritev() call */
+#if defined(IOV_MAX) && IOV_MAX < 1024
+#define H5FD_SEC2_MAX_IOV   IOV_MAX
+#elif defined(IOV_MAX)
+#define H5FD_SEC2_MAX_IOV   1024
+#else
+#define H5FD_SEC2_MAX_IOV   16
+#endif
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_SEC2_g = 0;
 
@@ -140,6 +157,19 @@ static herr_t H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_sec2_readv(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addr[], const size_t size[], void *buf[]);
+static herr_t H5FD_sec2_writev(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+            size_t count, const haddr_t addr[], const size_t size[],
+            const void *buf[]);
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+static size_t H5FD_sec2_iov_count(const haddr_t addr[], const size_t size[],
+            size_t count, size_t *total);
+static herr_t H5FD_sec2_preadv(H5FD_sec2_t *file, size_t count, haddr_t addr,
+            const size_t size[], size_t total, void *buf[]);
+static herr_t H5FD_sec2_pwritev(H5FD_sec2_t *file, size_t count, haddr_t addr,
+            const size_t size[], size_t total, const void *buf[]);
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
 static herr_t H5FD_sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 
 static const H5FD_class_t H5FD_sec2_g = {
@@ -173,7 +203,10 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD_sec2_truncate,         /* truncate             */
     NULL,                       /* lock                 */
     NULL,                       /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD_sec2_readv,            /* readv                */
+    H5FD_sec2_writev,           /* writev               */
+    NULL                        /* map                  */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -536,6 +569,12 @@ H5FD_sec2_query(const H5FD_t *_file, unsigned long *flags /* out */)
         *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
         *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* VFD handle is POSIX I/O call compatible                          */
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+        *flags |= H5FD_FEAT_VECTOR_IO;              /* OK to pass lists of raw data requests to 'readv' & 'writev'      */
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+#ifdef H5_HAVE_PREAD
+        *flags |= H5FD_FEAT_CONCURRENT_READ;        /* OK to read raw data from several threads at once                 */
+#endif /* H5_HAVE_PREAD */
 
         /* Check for flags that are set by h5repart */
         if(file && file->fam_to_sec2)
@@ -691,11 +730,13 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%lu, eoa=%llu", 
                     (unsigned long long)addr, size, (unsigned long long)file->eoa)
 
+#ifndef H5_HAVE_PREAD
     /* Seek to the correct location */
     if(addr != file->pos || OP_READ != file->op) {
         if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
             HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
     } /* end if */
+#endif /* H5_HAVE_PREAD */
 
     /* Read data, being careful of interrupted system calls, partial results,
      * and the end of the file.
@@ -714,13 +755,21 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREAD
+            bytes_read = HDpread(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREAD */
             bytes_read = HDread(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PREAD */
         } while(-1 == bytes_read && EINTR == errno);
         
         if(-1 == bytes_read) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
+#ifdef H5_HAVE_PREAD
+            HDoff_t myoffset = (HDoff_t)addr;
+#else /* H5_HAVE_PREAD */
             HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+#endif /* H5_HAVE_PREAD */
 
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)myoffset);
         } /* end if */
@@ -739,16 +788,23 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
         buf = (char *)buf + bytes_read;
     } /* end while */
 
+#ifndef H5_HAVE_PREAD
     /* Update current position */
+    /* (pread() doesn't use or move the file position, and leaving it alone
+     *  lets several threads read at once)
+     */
     file->pos = addr;
     file->op = OP_READ;
+#endif /* H5_HAVE_PREAD */
 
 done:
+#ifndef H5_HAVE_PREAD
     if(ret_value < 0) {
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
     } /* end if */
+#endif /* H5_HAVE_PREAD */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_read() */
@@ -788,11 +844,13 @@ H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
     if((addr + size) > file->eoa)
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)addr, (unsigned long long)size, (unsigned long long)file->eoa)
 
+#ifndef H5_HAVE_PWRITE
     /* Seek to the correct location */
     if(addr != file->pos || OP_WRITE != file->op) {
         if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
             HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
     } /* end if */
+#endif /* H5_HAVE_PWRITE */
 
     /* Write the data, being careful of interrupted system calls and partial
      * results
@@ -811,13 +869,21 @@ H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PWRITE
+            bytes_wrote = HDpwrite(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PWRITE */
             bytes_wrote = HDwrite(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PWRITE */
         } while(-1 == bytes_wrote && EINTR == errno);
         
         if(-1 == bytes_wrote) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
+#ifdef H5_HAVE_PWRITE
+            HDoff_t myoffset = (HDoff_t)addr;
+#else /* H5_HAVE_PWRITE */
             HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+#endif /* H5_HAVE_PWRITE */
 
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)myoffset);
         } /* end if */
@@ -846,6 +912,329 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_readv
+ *
+ * Purpose:     Reads COUNT pieces of data from FILE.  Piece U is SIZE[U]
+ *              bytes at address ADDR[U], read into buffer BUF[U].  Where
+ *              preadv() is available, runs of pieces which are adjacent in
+ *              the file are read with one system call.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffers BUF.
+ *              Failure:    FAIL, Contents of buffers BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_readv(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+    const haddr_t addr[], const size_t size[], void *buf[] /*out*/)
+{
+    size_t          nvec;                       /* # of pieces in a run */
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(_file && _file->cls);
+    HDassert(0 == count || (addr && size && buf));
+
+    for(u = 0; u < count; u += nvec) {
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+        size_t total;           /* # of bytes in the run */
+
+        /* Read adjacent pieces together */
+        if((nvec = H5FD_sec2_iov_count(addr + u, size + u, count - u, &total)) > 1) {
+            if(H5FD_sec2_preadv((H5FD_sec2_t *)_file, nvec, addr[u], size + u, total, buf + u) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read failed")
+            continue;
+        } /* end if */
+#else /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+        nvec = 1;
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+
+        if(H5FD_sec2_read(_file, type, dxpl_id, addr[u], size[u], buf[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read failed")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_readv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_writev
+ *
+ * Purpose:     Writes COUNT pieces of data to FILE.  Piece U is SIZE[U]
+ *              bytes from buffer BUF[U], written at address ADDR[U].
+ *              Where pwritev() is available, runs of pieces which are
+ *              adjacent in the file are written with one system call.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_writev(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, size_t count,
+    const haddr_t addr[], const size_t size[], const void *buf[])
+{
+    size_t          nvec;                       /* # of pieces in a run */
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(_file && _file->cls);
+    HDassert(0 == count || (addr && size && buf));
+
+    for(u = 0; u < count; u += nvec) {
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+        size_t total;           /* # of bytes in the run */
+
+        /* Write adjacent pieces together */
+        if((nvec = H5FD_sec2_iov_count(addr + u, size + u, count - u, &total)) > 1) {
+            if(H5FD_sec2_pwritev((H5FD_sec2_t *)_file, nvec, addr[u], size + u, total, buf + u) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+            continue;
+        } /* end if */
+#else /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+        nvec = 1;
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+
+        if(H5FD_sec2_write(_file, type, dxpl_id, addr[u], size[u], buf[u]) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write failed")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_writev() */
+
+#if defined(H5_HAVE_PREADV) && defined(H5_HAVE_PWRITEV)
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_iov_count
+ *
+ * Purpose:     Counts how many of the COUNT pieces at the start of a
+ *              request list are adjacent in the file and can be passed to
+ *              one preadv() or pwritev() call.
+ *
+ * Return:      The number of pieces in the run (at least one).  The total
+ *              number of bytes in the run is returned in TOTAL.
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5FD_sec2_iov_count(const haddr_t addr[], const size_t size[], size_t count,
+    size_t *total)
+{
+    size_t      nvec = 1;               /* # of pieces in the run */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(count > 0);
+    HDassert(total);
+
+    *total = size[0];
+    while(nvec < count && nvec < (size_t)H5FD_SEC2_MAX_IOV
+            && H5F_addr_defined(addr[nvec])
+            && addr[nvec] == addr[nvec - 1] + size[nvec - 1]
+            && *total <= (size_t)H5_POSIX_MAX_IO_BYTES
+            && size[nvec] <= (size_t)H5_POSIX_MAX_IO_BYTES - *total) {
+        *total += size[nvec];
+        nvec++;
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI(nvec)
+} /* end H5FD_sec2_iov_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_preadv
+ *
+ * Purpose:     Reads COUNT pieces of data which are adjacent in FILE,
+ *              starting at address ADDR, with preadv().  Piece U is
+ *              SIZE[U] bytes and is read into buffer BUF[U].  TOTAL is the
+ *              sum of the sizes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_preadv(H5FD_sec2_t *file, size_t count, haddr_t addr,
+    const size_t size[], size_t total, void *buf[])
+{
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];     /* I/O vector for preadv() */
+    struct iovec    *iov_curr = iov;            /* First unfinished piece */
+    size_t          iov_left = count;           /* # of unfinished pieces */
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(count > 1 && count <= H5FD_SEC2_MAX_IOV);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, total))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+    if((addr + total) > file->eoa)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size=%lu, eoa=%llu", 
+                    (unsigned long long)addr, total, (unsigned long long)file->eoa)
+
+    /* Set up the I/O vector */
+    for(u = 0; u < count; u++) {
+        HDassert(buf[u]);
+        iov[u].iov_base = buf[u];
+        iov[u].iov_len = size[u];
+    } /* end for */
+
+    /* Read data, being careful of interrupted system calls, partial results,
+     * and the end of the file.
+     */
+    while(total > 0) {
+        h5_posix_io_ret_t   bytes_read      = -1;   /* # of bytes actually read */ 
+
+        do {
+            bytes_read = HDpreadv(file->fd, iov_curr, (int)iov_left, (HDoff_t)addr);
+        } while(-1 == bytes_read && EINTR == errno);
+
+        if(-1 == bytes_read) { /* error */
+            int myerrno = errno;
+            time_t mytime = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', total read size = %llu, buffers = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)total, (unsigned long long)iov_left, (unsigned long long)addr);
+        } /* end if */
+
+        if(0 == bytes_read) {
+            /* end of file but not end of format address space */
+            for(; iov_left > 0; iov_curr++, iov_left--)
+                HDmemset(iov_curr->iov_base, 0, iov_curr->iov_len);
+            break;
+        } /* end if */
+
+        HDassert(bytes_read > 0);
+        HDassert((size_t)bytes_read <= total);
+
+        total -= (size_t)bytes_read;
+        addr += (haddr_t)bytes_read;
+
+        /* Skip the pieces which were read completely */
+        while(iov_left > 0 && (size_t)bytes_read >= iov_curr->iov_len) {
+            bytes_read -= (h5_posix_io_ret_t)iov_curr->iov_len;
+            iov_curr++;
+            iov_left--;
+        } /* end while */
+
+        /* Adjust a partially read piece */
+        if(bytes_read > 0) {
+            iov_curr->iov_base = (unsigned char *)iov_curr->iov_base + bytes_read;
+            iov_curr->iov_len -= (size_t)bytes_read;
+        } /* end if */
+    } /* end while */
+
+done:
+    /* (preadv() doesn't use or move the file position, so it's left alone) */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_preadv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_pwritev
+ *
+ * Purpose:     Writes COUNT pieces of data which are adjacent in FILE,
+ *              starting at address ADDR, with pwritev().  Piece U is
+ *              SIZE[U] bytes from buffer BUF[U].  TOTAL is the sum of the
+ *              sizes.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_pwritev(H5FD_sec2_t *file, size_t count, haddr_t addr,
+    const size_t size[], size_t total, const void *buf[])
+{
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];     /* I/O vector for pwritev() */
+    struct iovec    *iov_curr = iov;            /* First unfinished piece */
+    size_t          iov_left = count;           /* # of unfinished pieces */
+    size_t          u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(count > 1 && count <= H5FD_SEC2_MAX_IOV);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, total))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)total)
+    if((addr + total) > file->eoa)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)addr, (unsigned long long)total, (unsigned long long)file->eoa)
+
+    /* Set up the I/O vector */
+    for(u = 0; u < count; u++) {
+        HDassert(buf[u]);
+        iov[u].iov_base = (void *)buf[u];       /* Casting away const OK -- pwritev() doesn't modify the buffers */
+        iov[u].iov_len = size[u];
+    } /* end for */
+
+    /* Write the data, being careful of interrupted system calls and partial
+     * results
+     */
+    while(total > 0) {
+        h5_posix_io_ret_t   bytes_wrote     = -1;   /* # of bytes written   */ 
+
+        do {
+            bytes_wrote = HDpwritev(file->fd, iov_curr, (int)iov_left, (HDoff_t)addr);
+        } while(-1 == bytes_wrote && EINTR == errno);
+
+        if(-1 == bytes_wrote) { /* error */
+            int myerrno = errno;
+            time_t mytime = HDtime(NULL);
+
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', total write size = %llu, buffers = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)total, (unsigned long long)iov_left, (unsigned long long)addr);
+        } /* end if */
+
+        HDassert(bytes_wrote > 0);
+        HDassert((size_t)bytes_wrote <= total);
+
+        total -= (size_t)bytes_wrote;
+        addr += (haddr_t)bytes_wrote;
+
+        /* Skip the pieces which were written completely */
+        while(iov_left > 0 && (size_t)bytes_wrote >= iov_curr->iov_len) {
+            bytes_wrote -= (h5_posix_io_ret_t)iov_curr->iov_len;
+            iov_curr++;
+            iov_left--;
+        } /* end while */
+
+        /* Adjust a partially written piece */
+        if(bytes_wrote > 0) {
+            iov_curr->iov_base = (unsigned char *)iov_curr->iov_base + bytes_wrote;
+            iov_curr->iov_len -= (size_t)bytes_wrote;
+        } /* end if */
+    } /* end while */
+
+    /* Update eof */
+    if(addr > file->eof)
+        file->eof = addr;
+
+done:
+    /* pwritev() doesn't use the file position */
+    file->pos = HADDR_UNDEF;
+    file->op = OP_UNKNOWN;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_pwritev() */
+#endif /* H5_HAVE_PREADV && H5_HAVE_PWRITEV */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_sec2_truncate
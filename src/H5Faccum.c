@@ -72,6 +72,12 @@ typedef enum {
 /********************/
 /* Local Prototypes */
 /********************/
+static void H5F_accum_read_dirty(const H5F_t *f, haddr_t addr, size_t size,
+    void *buf);
+static herr_t H5F_accum_prefetch(const H5F_t *f, hid_t dxpl_id,
+    H5FD_mem_t map_type, haddr_t addr, size_t size, void *buf);
+static void H5F_accum_update_raw(const H5F_t *f, haddr_t addr, size_t size,
+    const void *buf);
 
 
 /*********************/
@@ -92,6 +98,127 @@ typedef enum {
 H5FL_BLK_DEFINE_STATIC(meta_accum);
 
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_accum_prefetch
+ *
+ * Purpose:	Replace the (clean) contents of the metadata accumulator
+ *              with the aligned prefetch window around a metadata read
+ *              request, reading the whole window with one I/O, then copy
+ *              the requested data out of it.
+ *
+ *              The window is clipped to the EOA, so no speculative read
+ *              goes past the allocated space in the file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F_accum_prefetch(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t map_type,
+    haddr_t addr, size_t size, void *buf/*out*/)
+{
+    size_t      window;                 /* Size of prefetch window */
+    haddr_t     eoa;                    /* End of allocated space in file */
+    haddr_t     win_start;              /* Address of start of window */
+    haddr_t     win_end;                /* Address of end of window */
+    size_t      win_size;               /* Size of window to read */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(f->shared->meta_prefetch_size > 0);
+    HDassert(!f->shared->accum.dirty);
+
+    /* Get the end of the allocated space, to clip the window against */
+    if(HADDR_UNDEF == (eoa = H5FD_get_eoa(f->shared->lf, map_type)))
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to get end of allocated space")
+
+    /* Compute the aligned window containing the request, or start the
+     *  window at the request if it crosses a window boundary (which keeps
+     *  the accumulator within its maximum size)
+     */
+    window = MIN(f->shared->meta_prefetch_size, H5F_ACCUM_MAX_SIZE);
+    win_start = (addr / window) * window;
+    if(H5F_addr_gt(addr + size, win_start + window))
+        win_start = addr;
+    win_end = MIN(win_start + window, eoa);
+    if(H5F_addr_lt(win_end, addr + size))
+        win_end = addr + size;
+    H5_ASSIGN_OVERFLOW(win_size, (win_end - win_start), hsize_t, size_t);
+
+    /* Check if we need more buffer space */
+    if(win_size > f->shared->accum.alloc_size) {
+        size_t new_alloc_size;        /* New size of accumulator */
+
+        /* Adjust the buffer size to be a power of 2 that is large enough to hold data */
+        new_alloc_size = (size_t)1 << (1 + H5V_log2_gen((uint64_t)(win_size - 1)));
+
+        /* Reallocate the metadata accumulator buffer */
+        if(NULL == (f->shared->accum.buf = H5FL_BLK_REALLOC(meta_accum, f->shared->accum.buf, new_alloc_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate metadata accumulator buffer")
+
+        /* Note the new buffer size */
+        f->shared->accum.alloc_size = new_alloc_size;
+#ifdef H5_CLEAR_MEMORY
+HDmemset(f->shared->accum.buf + win_size, 0, (f->shared->accum.alloc_size - win_size));
+#endif /* H5_CLEAR_MEMORY */
+    } /* end if */
+
+    /* Drop the old contents of the accumulator before reading the window */
+    f->shared->accum.loc = HADDR_UNDEF;
+    f->shared->accum.size = 0;
+
+    /* Dispatch to driver */
+    if(H5FD_read(f->shared->lf, dxpl_id, map_type, win_start, win_size, f->shared->accum.buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
+
+    /* Update the metadata accumulator information */
+    f->shared->accum.loc = win_start;
+    f->shared->accum.size = win_size;
+
+    /* Copy the data out of the buffer */
+    HDmemcpy(buf, f->shared->accum.buf + (addr - win_start), size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_accum_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_accum_update_raw
+ *
+ * Purpose:	Copy the part of a raw data write which overlaps the
+ *              metadata accumulator into the accumulator's buffer.
+ *
+ *              A prefetch window can cover raw data, and the dirty region
+ *              of the accumulator can later grow over those bytes, so the
+ *              copy is made whether or not the accumulator is dirty.
+ *              Otherwise flushing the accumulator would write the old raw
+ *              data back over the new.
+ *
+ * Return:	None
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F_accum_update_raw(const H5F_t *f, haddr_t addr, size_t size, const void *buf)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f->shared->meta_prefetch_size > 0);
+    HDassert(buf);
+
+    if(H5F_addr_overlap(addr, size, f->shared->accum.loc, f->shared->accum.size)) {
+        haddr_t start = MAX(addr, f->shared->accum.loc);       /* Start of overlap */
+        haddr_t end = MIN(addr + size, f->shared->accum.loc + f->shared->accum.size);   /* End of overlap */
+
+        HDmemcpy(f->shared->accum.buf + (start - f->shared->accum.loc), (const unsigned char *)buf + (start - addr), (size_t)(end - start));
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_accum_update_raw() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_accum_read
@@ -101,7 +228,11 @@ H5FL_BLK_DEFINE_STATIC(meta_accum);
  *
  * Note:	We can't change (or add to) the metadata accumulator, because
  *		this might be a speculative read and could possibly read raw
- *		data into the metadata accumulator.
+ *		data into the metadata accumulator.  (Except when metadata
+ *		prefetching is enabled, where reads which miss a clean
+ *		accumulator replace it with the window around the request;
+ *		raw data writes and frees within the window are handled by
+ *		H5F_accum_write, H5F_accum_writev and H5F_accum_free.)
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -202,6 +333,14 @@ H5F_accum_read(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
                 f->shared->accum.loc = new_addr;
                 f->shared->accum.size = new_size;
             } /* end if */
+            /* Current read doesn't overlap with metadata accumulator, but was read in from the metadata cache image */
+            else if(f->shared->mdci_nvalid > 0 && H5F_mdci_read(f, addr, size, buf))
+                ;
+            /* Current read doesn't overlap with clean metadata accumulator, prefetch the window around it */
+            else if(f->shared->meta_prefetch_size > size && !f->shared->accum.dirty) {
+                if(H5F_accum_prefetch(f, dxpl_id, map_type, addr, size, buf) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't prefetch metadata")
+            } /* end if */
             /* Current read doesn't overlap with metadata accumulator, read it from file */
             else {
                 /* Dispatch to driver */
@@ -219,37 +358,8 @@ H5F_accum_read(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
              *  information in the accumulator with [some of] the information
              *  just read in. -QAK)
              */
-            if(f->shared->accum.dirty &&
-                    H5F_addr_overlap(addr, size, f->shared->accum.loc + f->shared->accum.dirty_off, f->shared->accum.dirty_len)) {
-                haddr_t dirty_loc = f->shared->accum.loc + f->shared->accum.dirty_off;  /* File offset of dirty information */
-                size_t buf_off;         /* Offset of dirty region in buffer */
-                size_t dirty_off;       /* Offset within dirty region */
-                size_t overlap_size;    /* Size of overlap with dirty region */
-
-                /* Check for read starting before beginning dirty region */
-                if(H5F_addr_le(addr, dirty_loc)) {
-                    /* Compute offset of dirty region within buffer */
-                    buf_off = (size_t)(dirty_loc - addr);
-
-                    /* Compute offset within dirty region */
-                    dirty_off = 0;
-
-                    /* Check for read ending within dirty region */
-                    if(H5F_addr_lt(addr + size, dirty_loc + f->shared->accum.dirty_len))
-                        overlap_size = (size_t)((addr + size) - buf_off);
-                    else        /* Access covers whole dirty region */
-                        overlap_size = f->shared->accum.dirty_len;
-                } /* end if */
-                else { /* Read starts after beginning of dirty region */
-                    /* Compute dirty offset within buffer and overlap size */
-                    buf_off = 0;
-                    dirty_off = (size_t)(addr - dirty_loc);
-                    overlap_size = (size_t)((dirty_loc + f->shared->accum.dirty_len) - addr);
-                } /* end else */
-
-                /* Copy the dirty region to buffer */
-                HDmemcpy((unsigned char *)buf + buf_off, (unsigned char *)f->shared->accum.buf + f->shared->accum.dirty_off + dirty_off, overlap_size);
-            } /* end if */
+            if(f->shared->accum.dirty)
+                H5F_accum_read_dirty(f, addr, size, buf);
         } /* end else */
     } /* end if */
     else {
@@ -262,6 +372,60 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_accum_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_accum_read_dirty
+ *
+ * Purpose:	Copy the part of the metadata accumulator's dirty region
+ *              that overlaps a block just read from the file driver over
+ *              the stale bytes in BUF.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F_accum_read_dirty(const H5F_t *f, haddr_t addr, size_t size, void *buf)
+{
+    haddr_t dirty_loc;          /* File offset of dirty information */
+    size_t buf_off;             /* Offset of dirty region in buffer */
+    size_t dirty_off;           /* Offset within dirty region */
+    size_t overlap_size;        /* Size of overlap with dirty region */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f->shared->accum.dirty);
+
+    dirty_loc = f->shared->accum.loc + f->shared->accum.dirty_off;
+    if(H5F_addr_overlap(addr, size, dirty_loc, f->shared->accum.dirty_len)) {
+        /* Check for read starting before beginning dirty region */
+        if(H5F_addr_le(addr, dirty_loc)) {
+            /* Compute offset of dirty region within buffer */
+            buf_off = (size_t)(dirty_loc - addr);
+
+            /* Compute offset within dirty region */
+            dirty_off = 0;
+
+            /* Check for read ending within dirty region */
+            if(H5F_addr_lt(addr + size, dirty_loc + f->shared->accum.dirty_len))
+                overlap_size = (size_t)((addr + size) - dirty_loc);
+            else        /* Access covers whole dirty region */
+                overlap_size = f->shared->accum.dirty_len;
+        } /* end if */
+        else { /* Read starts after beginning of dirty region */
+            /* Compute dirty offset within buffer and overlap size */
+            buf_off = 0;
+            dirty_off = (size_t)(addr - dirty_loc);
+            overlap_size = MIN((size_t)((dirty_loc + f->shared->accum.dirty_len) - addr), size);
+        } /* end else */
+
+        /* Copy the dirty region to buffer */
+        HDmemcpy((unsigned char *)buf + buf_off, (unsigned char *)f->shared->accum.buf + f->shared->accum.dirty_off + dirty_off, overlap_size);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_accum_read_dirty() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_accum_adjust
@@ -432,6 +596,10 @@ H5F_accum_write(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
     /* Treat global heap as raw data */
     map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
 
+    /* Drop any metadata cache image runs the write overlaps */
+    if(f->shared->mdci_nvalid > 0)
+        H5F_mdci_invalidate(f, addr, (hsize_t)size);
+
     /* Check for accumulating metadata */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         if(size < H5F_ACCUM_MAX_SIZE) {
@@ -814,12 +982,98 @@ HDmemset(f->shared->accum.buf + size, 0, (f->shared->accum.alloc_size - size));
         /* Write the data */
         if(H5FD_write(f->shared->lf, dxpl_id, map_type, addr, size, buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+        /* A prefetched window may hold a copy of the raw data just written */
+        if(f->shared->meta_prefetch_size > 0)
+            H5F_accum_update_raw(f, addr, size, buf);
     } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_accum_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_accum_readv
+ *
+ * Purpose:	Read a list of COUNT raw data blocks from the file driver,
+ *              patching in any data for them that is still only in the
+ *              dirty part of the metadata accumulator.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_accum_readv(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, size_t count,
+    const haddr_t addr[], const size_t size[], void *buf[]/*out*/)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5FD_MEM_DRAW == type);
+    HDassert(0 == count || (addr && size && buf));
+
+    /* Read the blocks */
+    if(H5FD_readv(f->shared->lf, dxpl_id, type, count, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver vector read request failed")
+
+    /* Check each block for overlap w/dirty accumulator */
+    if(f->shared->accum.dirty)
+        for(u = 0; u < count; u++)
+            H5F_accum_read_dirty(f, addr[u], size[u], buf[u]);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_accum_readv() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_accum_writev
+ *
+ * Purpose:	Write a list of COUNT raw data blocks to the file driver,
+ *              keeping the metadata accumulator (and the metadata cache
+ *              image) consistent with the blocks written.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_accum_writev(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, size_t count,
+    const haddr_t addr[], const size_t size[], const void *buf[])
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->intent & H5F_ACC_RDWR);
+    HDassert(H5FD_MEM_DRAW == type);
+    HDassert(0 == count || (addr && size && buf));
+
+    /* Write the blocks */
+    if(H5FD_writev(f->shared->lf, dxpl_id, type, count, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "driver vector write request failed")
+
+    /* Update anything in memory which holds a copy of the bytes written */
+    for(u = 0; u < count; u++) {
+        if(f->shared->mdci_nvalid > 0)
+            H5F_mdci_invalidate(f, addr[u], (hsize_t)size[u]);
+        if(f->shared->meta_prefetch_size > 0)
+            H5F_accum_update_raw(f, addr[u], size[u], buf[u]);
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_accum_writev() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_accum_free
@@ -846,15 +1100,21 @@ H5F_accum_free(H5F_t *f, hid_t dxpl_id, H5FD_mem_t UNUSED type, haddr_t addr,
     /* check arguments */
     HDassert(f);
 
+    /* Drop any metadata cache image runs the freed block overlaps */
+    if(f->shared->mdci_nvalid > 0)
+        H5F_mdci_invalidate(f, addr, size);
+
     /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
     if((f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
             && H5F_addr_overlap(addr, size, f->shared->accum.loc, f->shared->accum.size)) {
         size_t overlap_size;        /* Size of overlap with accumulator */
 
         /* Sanity check */
-        /* (The metadata accumulator should not intersect w/raw data */
-        HDassert(H5FD_MEM_DRAW != type);
-        HDassert(H5FD_MEM_GHEAP != type); /* (global heap data is being treated as raw data currently) */
+        /* (The metadata accumulator should not intersect w/raw data, unless
+         *  it was filled from a metadata prefetch window)
+         */
+        HDassert(f->shared->meta_prefetch_size > 0 || H5FD_MEM_DRAW != type);
+        HDassert(f->shared->meta_prefetch_size > 0 || H5FD_MEM_GHEAP != type); /* (global heap data is being treated as raw data currently) */
 
         /* Check for overlapping the beginning of the accumulator */
         if(H5F_addr_le(addr, f->shared->accum.loc)) {
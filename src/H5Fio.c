@@ -44,6 +44,16 @@
 /* Local Macros */
 /****************/
 
+#ifdef H5F_HAVE_UNLOCKED_READS
+/* Whether raw data can be read from a file without the API lock: the file
+ * must be read-only, so nothing else changes the data or the driver's state
+ * underneath, and the raw data mustn't go through the page buffer.
+ */
+#define H5F_CAN_READ_UNLOCKED(F)                                              \
+    (!((F)->shared->flags & H5F_ACC_RDWR) && NULL == (F)->shared->page_buf    \
+        && H5F_HAS_FEATURE(F, H5FD_FEAT_CONCURRENT_READ))
+#endif /* H5F_HAVE_UNLOCKED_READS */
+
 
 /******************/
 /* Local Typedefs */
@@ -59,6 +69,11 @@
 /* Local Prototypes */
 /********************/
 
+#ifdef H5F_HAVE_UNLOCKED_READS
+static herr_t H5F_block_readv_unlocked(const H5F_t *f, hid_t dxpl_id,
+    size_t count, const haddr_t addr[], const size_t size[], void *buf[]);
+#endif /* H5F_HAVE_UNLOCKED_READS */
+
 
 /*********************/
 /* Package Variables */
@@ -108,8 +123,12 @@ H5F_block_read(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
     if(H5F_addr_le(f->shared->tmp_addr, (addr + size)))
         HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
 
-    /* Pass through metadata accumulator layer */
-    if(H5F_accum_read(f, dxpl_id, type, addr, size, buf) < 0)
+    /* Pass through page buffer or metadata accumulator layer */
+    if(f->shared->page_buf) {
+        if(H5F_pb_read(f, dxpl_id, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+    } /* end if */
+    else if(H5F_accum_read(f, dxpl_id, type, addr, size, buf) < 0)
         HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
 
 done:
@@ -153,11 +172,232 @@ HDfprintf(stderr, "%s: write to addr = %a, size = %Zu\n", FUNC, addr, size);
     if(H5F_addr_le(f->shared->tmp_addr, (addr + size)))
         HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
 
-    /* Pass through metadata accumulator layer */
-    if(H5F_accum_write(f, dxpl_id, type, addr, size, buf) < 0)
+    /* Pass through page buffer or metadata accumulator layer */
+    if(f->shared->page_buf) {
+        if(H5F_pb_write(f, dxpl_id, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+    } /* end if */
+    else if(H5F_accum_write(f, dxpl_id, type, addr, size, buf) < 0)
         HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_readv
+ *
+ * Purpose:	Reads a list of COUNT blocks of raw data from a file.  Block
+ *		U is SIZE[U] bytes at address ADDR[U], relative to the base
+ *		address for the file, and is read into buffer BUF[U].
+ *
+ *		In threadsafe builds, the blocks of read-only files may be
+ *		read without the API lock, so the buffers must not be
+ *		reachable by other threads through the library (e.g. they
+ *		can be the application's buffer, but not a dataset's sieve
+ *		buffer).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_readv(const H5F_t *f, H5FD_mem_t type, size_t count,
+    const haddr_t addr[], const size_t size[], hid_t dxpl_id,
+    void *buf[]/*out*/)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(0 == count || (addr && size && buf));
+
+    /* Only raw data may skip the metadata accumulator */
+    HDassert(H5FD_MEM_DRAW == type);
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for(u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addr[u]));
+        if(H5F_addr_le(f->shared->tmp_addr, (addr[u] + size[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Pass the blocks through the page buffer, if there is one, otherwise
+     *  pass the list through the metadata accumulator layer
+     */
+    if(f->shared->page_buf) {
+        for(u = 0; u < count; u++)
+            if(H5F_pb_read(f, dxpl_id, type, addr[u], size[u], buf[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+    } /* end if */
+#ifdef H5F_HAVE_UNLOCKED_READS
+    else if(H5F_CAN_READ_UNLOCKED(f)) {
+        if(H5F_block_readv_unlocked(f, dxpl_id, count, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read without the API lock failed")
+    } /* end if */
+#endif /* H5F_HAVE_UNLOCKED_READS */
+    else if(H5F_accum_readv(f, dxpl_id, type, count, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vector read through metadata accumulator failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_readv() */
+
+
+#ifdef H5F_HAVE_UNLOCKED_READS
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_readv_unlocked
+ *
+ * Purpose:	Reads a list of COUNT blocks of raw data from a read-only
+ *		file, as H5F_block_readv() does, but with the API lock
+ *		released while the file driver reads, so that other threads
+ *		can use the library (and read from this file or others)
+ *		meanwhile.  The read is counted on the file until it's done,
+ *		so the file isn't closed underneath it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F_block_readv_unlocked(const H5F_t *f, hid_t dxpl_id, size_t count,
+    const haddr_t addr[], const size_t size[], void *buf[])
+{
+    H5F_file_t  *shared = f->shared;    /* Shared file info */
+    unsigned    lock_count;             /* # of times the API lock was held */
+    herr_t      status;                 /* Result of the driver read */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* (Read-only files have no unwritten metadata to patch the data with) */
+    HDassert(!(shared->flags & H5F_ACC_RDWR));
+    HDassert(!shared->accum.dirty);
+
+    /* Let other threads into the library while the driver reads */
+    H5TS_readers_enter(&shared->nreaders);
+    if(H5TS_mutex_release(&H5_g.init_lock, &lock_count) != 0) {
+        H5TS_readers_leave(&shared->nreaders);
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTUNLOCK, FAIL, "can't release API lock")
+    } /* end if */
+
+    status = H5FD_readv(shared->lf, dxpl_id, H5FD_MEM_DRAW, count, addr, size, buf);
+
+    /* (The read must stop counting before the lock is taken again, as a
+     *  thread holding the lock may be waiting for the file's reads to end)
+     */
+    H5TS_readers_leave(&shared->nreaders);
+    if(H5TS_mutex_reacquire(&H5_g.init_lock, lock_count) != 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTLOCK, FAIL, "can't reacquire API lock")
+    if(status < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver vector read request failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_readv_unlocked() */
+#endif /* H5F_HAVE_UNLOCKED_READS */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_writev
+ *
+ * Purpose:	Writes a list of COUNT blocks of raw data to a file.  Block
+ *		U is SIZE[U] bytes from buffer BUF[U] and is written at
+ *		address ADDR[U], relative to the base address for the file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_writev(const H5F_t *f, H5FD_mem_t type, size_t count,
+    const haddr_t addr[], const size_t size[], hid_t dxpl_id,
+    const void *buf[])
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->intent & H5F_ACC_RDWR);
+    HDassert(0 == count || (addr && size && buf));
+
+    /* Only raw data may skip the metadata accumulator */
+    HDassert(H5FD_MEM_DRAW == type);
+
+    /* Check for attempting I/O on 'temporary' file address */
+    for(u = 0; u < count; u++) {
+        HDassert(H5F_addr_defined(addr[u]));
+        if(H5F_addr_le(f->shared->tmp_addr, (addr[u] + size[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Pass the blocks through the page buffer, if there is one, otherwise
+     *  pass the list through the metadata accumulator layer
+     */
+    if(f->shared->page_buf) {
+        for(u = 0; u < count; u++)
+            if(H5F_pb_write(f, dxpl_id, type, addr[u], size[u], buf[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+    } /* end if */
+    else if(H5F_accum_writev(f, dxpl_id, type, count, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write through metadata accumulator failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_writev() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_map
+ *
+ * Purpose:	Gets a read-only pointer to SIZE bytes of the file at
+ *		address ADDR, relative to the base address for the file,
+ *		from drivers which keep the file's contents in memory.
+ *		Data cached above the driver is flushed first, so the
+ *		pointer sees the same bytes a read would.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_map(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
+    hid_t dxpl_id, const void **ptr/*out*/)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(ptr);
+    HDassert(H5F_addr_defined(addr));
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if(H5F_addr_le(f->shared->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    /* Write out dirty pages, or dirty accumulated metadata over the block */
+    if(f->shared->page_buf) {
+        if(H5F_pb_flush(f, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
+    } /* end if */
+    else if(f->shared->accum.dirty && H5F_addr_overlap(addr, size,
+            f->shared->accum.loc + f->shared->accum.dirty_off, f->shared->accum.dirty_len))
+        if(H5F_accum_flush(f, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush metadata accumulator")
+
+    if(H5FD_map(f->shared->lf, dxpl_id, type, addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver can't map block")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_map() */
+
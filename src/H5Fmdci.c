@@ -0,0 +1,847 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:             H5Fmdci.c
+ *
+ * Purpose:             Metadata cache image routines.  When a file is
+ *                      closed, the extents of the metadata held in the
+ *                      metadata cache are recorded in a small file next
+ *                      to it (the file's name with ".mdci" appended), so
+ *                      the HDF5 file itself is left unchanged.  When the
+ *                      file is opened again, that
+ *                      metadata is read back in a few large "runs" and
+ *                      metadata reads are served from them.  A run is
+ *                      released when part of it is written to or freed,
+ *                      or when the file is closed, so the memory held is
+ *                      bounded by the size of the metadata cache when the
+ *                      image was recorded.
+ *
+ *                      The image only holds hints: the bytes always come
+ *                      from the file itself, so an out of date image
+ *                      costs some extra I/O but can't return stale
+ *                      metadata.  This is also why an image isn't tied
+ *                      to the file any further than by its name.
+ *
+ *                      Images are only looked for and recorded when the
+ *                      file is opened with generate_image set, and only
+ *                      for drivers which store the file as one POSIX file
+ *                      under its name, since the image is read and
+ *                      written next to it with POSIX calls rather than
+ *                      through the file driver.
+ *
+ *                      An image file holds:
+ *
+ *                          "HDF5MDCI" signature             8 bytes
+ *                          version (0), then 3 reserved     4 bytes
+ *                          number of extents, N             4 bytes
+ *                          N x (address, length)           N x 16 bytes
+ *                          checksum of the above            4 bytes
+ *
+ *                      with all numbers in little-endian order.
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_PACKAGE		/*suppress error about including H5Fpkg	  */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5ACprivate.h"        /* Metadata cache                       */
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"             /* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5MMprivate.h"	/* Memory management			*/
+
+/* File drivers which can have a metadata cache image */
+#include "H5FDiouring.h"        /* Linux io_uring I/O                   */
+#include "H5FDlog.h"            /* sec2 driver with logging, for debugging */
+#include "H5FDmmap.h"           /* Read-only memory-mapped I/O          */
+#include "H5FDsec2.h"		/* Posix unbuffered I/O			*/
+#include "H5FDstdio.h"		/* Standard C buffered I/O		*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Suffix appended to a file's name to get the name of its image */
+#define H5F_MDCI_SUFFIX         ".mdci"
+
+/* Signature and version of an image */
+#define H5F_MDCI_SIGNATURE      "HDF5MDCI"
+#define H5F_MDCI_SIGNATURE_LEN  8
+#define H5F_MDCI_VERSION        0
+
+/* Size of an encoded image holding N extents */
+#define H5F_MDCI_SIZE(N)        (H5F_MDCI_SIGNATURE_LEN + 4 + 4         \
+                                    + (N) * 16 + H5F_SIZEOF_CHKSUM)
+
+/* Maximum number of extents recorded in an image (keeps the image small
+ *      enough to read in with a single I/O)
+ */
+#define H5F_MDCI_MAX_EXTENTS    2048
+
+/* Initial gap bridged when merging extents to fit within the maximum */
+#define H5F_MDCI_MERGE_GAP      512
+
+/* Largest gap between extents that are read in as a single run */
+#define H5F_MDCI_RUN_GAP        (16 * 1024)
+
+/* Size beyond which runs are not grown by merging further extents */
+#define H5F_MDCI_MAX_RUN        (4 * 1024 * 1024)
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* User data for collecting the extents of the entries in the cache */
+typedef struct H5F_mdci_ud_t {
+    H5F_t *f;                           /* File the cache belongs to */
+    size_t nextents;                    /* Number of extents collected */
+    size_t nalloc;                      /* Number of extents allocated */
+    H5F_mdci_extent_t *extents;         /* Extents collected */
+} H5F_mdci_ud_t;
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static int H5F_mdci_extent_cb(haddr_t addr, size_t size, int type_id,
+    void *_udata);
+static int H5F_mdci_cmp(const void *_ext1, const void *_ext2);
+static htri_t H5F_mdci_setup(H5F_t *f);
+static htri_t H5F_mdci_decode(const uint8_t *image, size_t len,
+    H5F_mdci_extent_t **extents, size_t *nextents);
+static size_t H5F_mdci_merge(H5F_mdci_extent_t *extents, size_t nextents,
+    hsize_t gap);
+static void H5F_mdci_drop(H5F_file_t *shared, H5F_mdci_run_t *run);
+static size_t H5F_mdci_search(const H5F_file_t *shared, haddr_t addr);
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_extent_cb
+ *
+ * Purpose:	Metadata cache iteration callback, recording the extent of
+ *              an entry.  Entries which don't belong in an image (the
+ *              superblock, which is read before the image, free space
+ *              manager entries, which are released at file close, and
+ *              entries at temporary addresses) are skipped.
+ *
+ * Return:	H5_ITER_CONT on success/H5_ITER_ERROR on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5F_mdci_extent_cb(haddr_t addr, size_t size, int type_id, void *_udata)
+{
+    H5F_mdci_ud_t *udata = (H5F_mdci_ud_t *)_udata;   /* User data for callback */
+    int ret_value = H5_ITER_CONT;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Skip entries which don't belong in the image */
+    if(type_id == H5AC_SUPERBLOCK_ID || type_id == H5AC_FSPACE_HDR_ID
+            || type_id == H5AC_FSPACE_SINFO_ID
+            || H5F_IS_TMP_ADDR(udata->f, addr) || size == 0)
+        HGOTO_DONE(H5_ITER_CONT)
+
+    /* Make room for another extent, if necessary */
+    if(udata->nextents == udata->nalloc) {
+        size_t new_nalloc = MAX(64, udata->nalloc * 2);
+        H5F_mdci_extent_t *new_extents;
+
+        if(NULL == (new_extents = (H5F_mdci_extent_t *)H5MM_realloc(udata->extents, new_nalloc * sizeof(H5F_mdci_extent_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5_ITER_ERROR, "memory allocation failed")
+        udata->extents = new_extents;
+        udata->nalloc = new_nalloc;
+    } /* end if */
+
+    /* Record the extent */
+    udata->extents[udata->nextents].addr = addr;
+    udata->extents[udata->nextents].len = (hsize_t)size;
+    udata->nextents++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_extent_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_cmp
+ *
+ * Purpose:	Compare two extents by address, for qsort.
+ *
+ * Return:	<0, 0 or >0, as for qsort
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5F_mdci_cmp(const void *_ext1, const void *_ext2)
+{
+    const H5F_mdci_extent_t *ext1 = (const H5F_mdci_extent_t *)_ext1;
+    const H5F_mdci_extent_t *ext2 = (const H5F_mdci_extent_t *)_ext2;
+    int ret_value;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5F_addr_lt(ext1->addr, ext2->addr))
+        ret_value = -1;
+    else if(H5F_addr_gt(ext1->addr, ext2->addr))
+        ret_value = 1;
+    else
+        ret_value = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_merge
+ *
+ * Purpose:	Merge sorted extents which overlap, or which are separated
+ *              by no more than GAP bytes, in place.
+ *
+ * Return:	Number of extents left
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5F_mdci_merge(H5F_mdci_extent_t *extents, size_t nextents, hsize_t gap)
+{
+    size_t u, v;                /* Local index variables */
+    size_t ret_value;           /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(extents);
+    HDassert(nextents > 0);
+
+    for(u = 1, v = 0; u < nextents; u++) {
+        haddr_t end = extents[v].addr + extents[v].len;
+
+        if(H5F_addr_le(extents[u].addr, end + gap)) {
+            if(H5F_addr_gt(extents[u].addr + extents[u].len, end))
+                extents[v].len = (extents[u].addr + extents[u].len) - extents[v].addr;
+        } /* end if */
+        else
+            extents[++v] = extents[u];
+    } /* end for */
+
+    /* Set return value */
+    ret_value = v + 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_merge() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_setup
+ *
+ * Purpose:	Check whether the file can have an image and, if so, build
+ *              the image's name.  Only files opened with generate_image
+ *              set, through a driver which stores the file as one POSIX
+ *              file under its name, can have one.  The name is absolute,
+ *              so the image is still found next to the file at close if
+ *              the working directory changed while the file was open.
+ *
+ * Return:	Success:	TRUE, with the name in f->shared->mdci_name,
+ *                              or FALSE if the file can't have an image
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5F_mdci_setup(H5F_t *f)
+{
+    hid_t       driver_id;      /* ID of the file's driver */
+    char        *extpath = NULL;        /* Absolute path of the file's directory */
+    const char  *base;          /* Last component of the file's name */
+    char        *ptr = NULL;    /* Last delimiter in the file's name */
+    size_t      path_len;       /* Length of the directory's path */
+    size_t      base_len;       /* Length of the last component of the name */
+    htri_t      ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->open_name);
+    HDassert(NULL == f->shared->mdci_name);
+
+    if(!f->shared->mdc_image_config.generate_image)
+        HGOTO_DONE(FALSE)
+
+    /* Images sit next to files stored as a single POSIX file */
+    driver_id = f->shared->lf->driver_id;
+    if(driver_id != H5FD_SEC2 && driver_id != H5FD_STDIO && driver_id != H5FD_LOG
+            && driver_id != H5FD_IOURING && driver_id != H5FD_MMAP)
+        HGOTO_DONE(FALSE)
+
+    /* Get the absolute path of the file's directory */
+    if(H5_build_extpath(f->open_name, &extpath) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to build path of file")
+    if(NULL == extpath)
+        HGOTO_DONE(FALSE)
+
+    /* Append the last component of the file's name and the suffix */
+    H5_GET_LAST_DELIMITER(f->open_name, ptr)
+    base = ptr ? ptr + 1 : f->open_name;
+    path_len = HDstrlen(extpath);
+    base_len = HDstrlen(base);
+    if(NULL == (f->shared->mdci_name = (char *)H5MM_malloc(path_len + base_len + sizeof(H5F_MDCI_SUFFIX))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    HDmemcpy(f->shared->mdci_name, extpath, path_len);
+    HDmemcpy(f->shared->mdci_name + path_len, base, base_len);
+    HDmemcpy(f->shared->mdci_name + path_len + base_len, H5F_MDCI_SUFFIX, sizeof(H5F_MDCI_SUFFIX));
+
+    /* Set return value */
+    ret_value = TRUE;
+
+done:
+    H5MM_xfree(extpath);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_decode
+ *
+ * Purpose:	Decode the LEN bytes of an image read in from its file.
+ *
+ * Return:	Success:	TRUE, with the extents in *EXTENTS, which the
+ *                              caller must free, or FALSE if IMAGE isn't a
+ *                              valid image
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5F_mdci_decode(const uint8_t *image, size_t len, H5F_mdci_extent_t **extents,
+    size_t *nextents)
+{
+    const uint8_t *p = image;   /* Pointer into the image */
+    uint32_t    n;              /* Number of extents */
+    uint32_t    stored_chksum;  /* Checksum stored in the image */
+    size_t      u;              /* Local index variable */
+    htri_t      ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(image);
+    HDassert(extents);
+    HDassert(nextents);
+
+    /* Check the signature, version and size */
+    if(len < H5F_MDCI_SIZE(0) || HDmemcmp(p, H5F_MDCI_SIGNATURE, (size_t)H5F_MDCI_SIGNATURE_LEN))
+        HGOTO_DONE(FALSE)
+    p += H5F_MDCI_SIGNATURE_LEN;
+    if(*p != H5F_MDCI_VERSION)
+        HGOTO_DONE(FALSE)
+    p += 4;
+    UINT32DECODE(p, n);
+    if(n == 0 || n > H5F_MDCI_MAX_EXTENTS || len != H5F_MDCI_SIZE((size_t)n))
+        HGOTO_DONE(FALSE)
+
+    /* Check the checksum */
+    p = image + len - H5F_SIZEOF_CHKSUM;
+    UINT32DECODE(p, stored_chksum);
+    if(stored_chksum != H5_checksum_metadata(image, len - H5F_SIZEOF_CHKSUM, 0))
+        HGOTO_DONE(FALSE)
+
+    /* Retrieve the extents */
+    if(NULL == (*extents = (H5F_mdci_extent_t *)H5MM_malloc((size_t)n * sizeof(H5F_mdci_extent_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    p = image + H5F_MDCI_SIZE(0) - H5F_SIZEOF_CHKSUM;
+    for(u = 0; u < n; u++) {
+        UINT64DECODE(p, (*extents)[u].addr);
+        UINT64DECODE(p, (*extents)[u].len);
+    } /* end for */
+    *nextents = (size_t)n;
+
+    /* Set return value */
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_save
+ *
+ * Purpose:	Record the extents of the metadata in the metadata cache in
+ *              the file's image, replacing any image already there.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_mdci_save(H5F_t *f, hid_t UNUSED dxpl_id)
+{
+    H5F_mdci_ud_t udata;                /* User data for cache iteration */
+    uint8_t     *image = NULL;          /* Encoded image */
+    uint8_t     *p;                     /* Pointer into the image */
+    size_t      len;                    /* Length of the image */
+    uint32_t    chksum;                 /* Checksum of the image */
+    int         fd = -1;                /* File descriptor of the image */
+    hsize_t     gap;                    /* Gap to bridge when merging extents */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+
+    /* Initialize the user data */
+    udata.f = f;
+    udata.nextents = 0;
+    udata.nalloc = 0;
+    udata.extents = NULL;
+
+    /* Check if the file can have an image */
+    if(NULL == f->shared->mdci_name)
+        HGOTO_DONE(SUCCEED)
+
+    /* Collect the extents of the entries in the cache */
+    if(H5AC_iterate(f, H5F_mdci_extent_cb, &udata) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTNEXT, FAIL, "unable to iterate over metadata cache")
+    if(0 == udata.nextents)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the extents and merge the ones that touch, then merge across
+     *  wider and wider gaps until they fit in the image
+     */
+    HDqsort(udata.extents, udata.nextents, sizeof(H5F_mdci_extent_t), H5F_mdci_cmp);
+    udata.nextents = H5F_mdci_merge(udata.extents, udata.nextents, (hsize_t)0);
+    for(gap = H5F_MDCI_MERGE_GAP; udata.nextents > H5F_MDCI_MAX_EXTENTS; gap *= 2)
+        udata.nextents = H5F_mdci_merge(udata.extents, udata.nextents, gap);
+
+    /* Encode the image */
+    len = H5F_MDCI_SIZE(udata.nextents);
+    if(NULL == (image = (uint8_t *)H5MM_calloc(len)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    p = image;
+    HDmemcpy(p, H5F_MDCI_SIGNATURE, (size_t)H5F_MDCI_SIGNATURE_LEN);
+    p += H5F_MDCI_SIGNATURE_LEN;
+    *p = H5F_MDCI_VERSION;
+    p += 4;
+    UINT32ENCODE(p, udata.nextents);
+    for(u = 0; u < udata.nextents; u++) {
+        UINT64ENCODE(p, udata.extents[u].addr);
+        UINT64ENCODE(p, udata.extents[u].len);
+    } /* end for */
+    chksum = H5_checksum_metadata(image, (size_t)(p - image), 0);
+    UINT32ENCODE(p, chksum);
+    HDassert((size_t)(p - image) == len);
+
+    /* Write the image out */
+    if((fd = HDopen(f->shared->mdci_name, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "unable to create metadata cache image")
+    if(HDwrite(fd, image, len) != (ssize_t)len)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "unable to write metadata cache image")
+
+done:
+    if(fd >= 0 && HDclose(fd) < 0)
+        HSYS_DONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close metadata cache image")
+    H5MM_xfree(image);
+    H5MM_xfree(udata.extents);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_save() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_load
+ *
+ * Purpose:	Read in the metadata recorded in the file's metadata cache
+ *              image, if it has one, as a few large runs.  A missing or
+ *              damaged image is the same as none.
+ *
+ *              When the file is opened with write access, the image is
+ *              removed, so it doesn't outlive the metadata it describes.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_mdci_load(H5F_t *f, hid_t dxpl_id)
+{
+    int         fd = -1;                /* File descriptor of the image */
+    h5_stat_t   sb;                     /* Information about the image */
+    uint8_t     *image = NULL;          /* Encoded image */
+    size_t      len;                    /* Length of the image */
+    H5F_mdci_extent_t *extents = NULL;  /* Extents in the image */
+    size_t      nextents = 0;           /* Number of extents */
+    H5F_mdci_run_t *runs = NULL;        /* Runs to read */
+    size_t      nruns = 0;              /* Number of runs */
+    haddr_t     eoa;                    /* End of allocated space in file */
+    htri_t      status;                 /* Whether the image is valid */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity check */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(NULL == f->shared->mdci_runs);
+
+    /* Check if the file can have an image */
+    if((status = H5F_mdci_setup(f)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to build name of metadata cache image")
+    if(!status)
+        HGOTO_DONE(SUCCEED)
+
+    /* Images are only read when metadata reads go through the accumulator */
+    if(!H5F_HAS_FEATURE(f, H5FD_FEAT_ACCUMULATE_METADATA))
+        HGOTO_DONE(SUCCEED)
+
+    /* Look for an image */
+    if((fd = HDopen(f->shared->mdci_name, O_RDONLY, 0)) < 0)
+        HGOTO_DONE(SUCCEED)
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to fstat metadata cache image")
+    if(sb.st_size < (off_t)H5F_MDCI_SIZE(1) || sb.st_size > (off_t)H5F_MDCI_SIZE(H5F_MDCI_MAX_EXTENTS))
+        HGOTO_DONE(SUCCEED)
+
+    /* Read the image */
+    len = (size_t)sb.st_size;
+    if(NULL == (image = (uint8_t *)H5MM_malloc(len)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(HDread(fd, image, len) != (ssize_t)len)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_READERROR, FAIL, "unable to read metadata cache image")
+    if(HDclose(fd) < 0) {
+        fd = -1;
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close metadata cache image")
+    } /* end if */
+    fd = -1;
+    if((status = H5F_mdci_decode(image, len, &extents, &nextents)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTDECODE, FAIL, "unable to decode metadata cache image")
+    if(!status)
+        HGOTO_DONE(SUCCEED)
+
+    /* (The runs aren't needed when a page buffer caches the metadata) */
+    if(NULL == f->shared->page_buf) {
+        /* Get the end of the allocated space, to clip the runs against */
+        if(HADDR_UNDEF == (eoa = H5FD_get_eoa(f->shared->lf, H5FD_MEM_DEFAULT)))
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to get end of allocated space")
+
+        /* Runs must be sorted and disjoint for lookups and invalidation */
+        HDqsort(extents, nextents, sizeof(H5F_mdci_extent_t), H5F_mdci_cmp);
+
+        /* Coalesce the extents into runs */
+        if(NULL == (runs = (H5F_mdci_run_t *)H5MM_calloc(nextents * sizeof(H5F_mdci_run_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(u = 0; u < nextents; u++) {
+            haddr_t start = extents[u].addr;
+            haddr_t end;
+
+            /* Skip extents past the end of the file */
+            if(!H5F_addr_defined(start) || H5F_addr_ge(start, eoa) || 0 == extents[u].len)
+                continue;
+            end = MIN(start + extents[u].len, eoa);
+
+            /* Extend the last run, or start a new one */
+            if(nruns > 0 && H5F_addr_le(start, runs[nruns - 1].addr + runs[nruns - 1].size + H5F_MDCI_RUN_GAP)
+                    && (end - runs[nruns - 1].addr) <= H5F_MDCI_MAX_RUN) {
+                H5F_mdci_run_t *run = &runs[nruns - 1];
+
+                if(H5F_addr_gt(end, run->addr + run->size))
+                    run->size = (size_t)(end - run->addr);
+            } /* end if */
+            else if(nruns > 0 && H5F_addr_le(end, runs[nruns - 1].addr + runs[nruns - 1].size))
+                ;       /* Already covered by the last run */
+            else {
+                H5F_mdci_run_t *run = &runs[nruns++];
+
+                /* (Overlaps with the last run are cut off the new run) */
+                if(nruns > 1 && H5F_addr_lt(start, runs[nruns - 2].addr + runs[nruns - 2].size))
+                    start = runs[nruns - 2].addr + runs[nruns - 2].size;
+                run->addr = start;
+                run->size = (size_t)(end - start);
+            } /* end else */
+        } /* end for */
+
+        /* Read in the runs */
+        for(u = 0; u < nruns; u++) {
+            if(NULL == (runs[u].buf = (uint8_t *)H5MM_malloc(runs[u].size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+            if(H5FD_read(f->shared->lf, dxpl_id, H5FD_MEM_DEFAULT, runs[u].addr, runs[u].size, runs[u].buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read metadata cache image run")
+        } /* end for */
+
+        /* Hand the runs over to the file */
+        if(nruns > 0) {
+            f->shared->mdci_runs = runs;
+            f->shared->mdci_nruns = nruns;
+            f->shared->mdci_nvalid = nruns;
+            runs = NULL;
+        } /* end if */
+    } /* end if */
+
+    /* Remove the image, if the file is about to be modified */
+    if(H5F_INTENT(f) & H5F_ACC_RDWR)
+        if(HDunlink(f->shared->mdci_name) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTDELETE, FAIL, "unable to remove metadata cache image")
+
+done:
+    /* Release the runs, if they weren't handed over */
+    if(runs) {
+        for(u = 0; u < nruns; u++)
+            H5MM_xfree(runs[u].buf);
+        H5MM_xfree(runs);
+    } /* end if */
+
+    if(fd >= 0 && HDclose(fd) < 0)
+        HSYS_DONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close metadata cache image")
+    H5MM_xfree(extents);
+    H5MM_xfree(image);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_discard
+ *
+ * Purpose:	Remove the image left by an earlier file of the same name
+ *              when a file is created, so it isn't used for the new file.
+ *              Only files starting with an image's signature are removed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_mdci_discard(H5F_t *f)
+{
+    int         fd = -1;                /* File descriptor of the image */
+    char        sig[H5F_MDCI_SIGNATURE_LEN];    /* Signature read in */
+    htri_t      status;                 /* Whether the file can have an image */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+
+    /* Check if the file can have an image */
+    if((status = H5F_mdci_setup(f)) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "unable to build name of metadata cache image")
+    if(!status)
+        HGOTO_DONE(SUCCEED)
+
+    if((fd = HDopen(f->shared->mdci_name, O_RDONLY, 0)) < 0)
+        HGOTO_DONE(SUCCEED)
+    if(HDread(fd, sig, sizeof(sig)) != (ssize_t)sizeof(sig) || HDmemcmp(sig, H5F_MDCI_SIGNATURE, sizeof(sig)))
+        HGOTO_DONE(SUCCEED)
+    if(HDclose(fd) < 0) {
+        fd = -1;
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close metadata cache image")
+    } /* end if */
+    fd = -1;
+
+    /* Remove the image */
+    if(HDunlink(f->shared->mdci_name) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTDELETE, FAIL, "unable to remove metadata cache image")
+
+done:
+    if(fd >= 0 && HDclose(fd) < 0)
+        HSYS_DONE_ERROR(H5E_FILE, H5E_CANTCLOSEFILE, FAIL, "unable to close metadata cache image")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_discard() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_drop
+ *
+ * Purpose:	Release a run's buffer, and the array of runs once they
+ *              have all been released.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F_mdci_drop(H5F_file_t *shared, H5F_mdci_run_t *run)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(shared->mdci_nvalid > 0);
+    HDassert(run->size > 0);
+
+    run->buf = (uint8_t *)H5MM_xfree(run->buf);
+    run->size = 0;
+
+    if(0 == --shared->mdci_nvalid) {
+        shared->mdci_runs = (H5F_mdci_run_t *)H5MM_xfree(shared->mdci_runs);
+        shared->mdci_nruns = 0;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_mdci_drop() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_search
+ *
+ * Purpose:	Find the last run starting at or before ADDR.
+ *
+ * Return:	Index of the run, or the number of runs if there is none
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5F_mdci_search(const H5F_file_t *shared, haddr_t addr)
+{
+    size_t lo = 0, hi = shared->mdci_nruns;     /* Bounds of search */
+    size_t ret_value;           /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Find the first run starting after ADDR */
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if(H5F_addr_le(shared->mdci_runs[mid].addr, addr))
+            lo = mid + 1;
+        else
+            hi = mid;
+    } /* end while */
+
+    /* Set return value */
+    ret_value = (lo > 0) ? lo - 1 : shared->mdci_nruns;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_search() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_read
+ *
+ * Purpose:	Copy a metadata read request out of the runs read in from
+ *              the metadata cache image, if one of them holds all of it.
+ *
+ * Return:	TRUE if the request was served, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5F_mdci_read(const H5F_t *f, haddr_t addr, size_t size, void *buf/*out*/)
+{
+    H5F_mdci_run_t *run;        /* Run holding the request */
+    size_t      u;              /* Index of run */
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(buf);
+
+    /* Find the run which would hold the request */
+    if((u = H5F_mdci_search(f->shared, addr)) == f->shared->mdci_nruns)
+        HGOTO_DONE(FALSE)
+    run = &f->shared->mdci_runs[u];
+    if(0 == run->size || H5F_addr_gt(addr + size, run->addr + run->size))
+        HGOTO_DONE(FALSE)
+
+    /* Copy the data out of the run */
+    HDmemcpy(buf, run->buf + (addr - run->addr), size);
+
+    /* Set return value */
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_mdci_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_invalidate
+ *
+ * Purpose:	Release the runs overlapping a region of the file which is
+ *              being written to or freed.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_mdci_invalidate(const H5F_t *f, haddr_t addr, hsize_t size)
+{
+    size_t      u;              /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+
+    /* Start at the run holding ADDR, if there is one */
+    if((u = H5F_mdci_search(f->shared, addr)) == f->shared->mdci_nruns)
+        u = 0;
+
+    /* Release each run overlapping the region */
+    for(; u < f->shared->mdci_nruns && H5F_addr_lt(f->shared->mdci_runs[u].addr, addr + size); u++)
+        if(f->shared->mdci_runs[u].size > 0 && H5F_addr_overlap(addr, size, f->shared->mdci_runs[u].addr, f->shared->mdci_runs[u].size))
+            H5F_mdci_drop(f->shared, &f->shared->mdci_runs[u]);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_mdci_invalidate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdci_free
+ *
+ * Purpose:	Release the runs read in from the metadata cache image,
+ *              and the image's name.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_mdci_free(const H5F_t *f)
+{
+    size_t      u;              /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    for(u = 0; u < f->shared->mdci_nruns; u++)
+        H5MM_xfree(f->shared->mdci_runs[u].buf);
+    f->shared->mdci_runs = (H5F_mdci_run_t *)H5MM_xfree(f->shared->mdci_runs);
+    f->shared->mdci_nruns = 0;
+    f->shared->mdci_nvalid = 0;
+    f->shared->mdci_name = (char *)H5MM_xfree(f->shared->mdci_name);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F_mdci_free() */
+
@@ -80,6 +80,10 @@ H5F_close_mounts(H5F_t *f)
 
     HDassert(f);
 
+    /* Drop paths cached while the children were mounted */
+    if(f->nmounts > 0 && H5G_traverse_cache_reset(f) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to reset path cache")
+
     /* Unmount all child files.  Loop backwards to avoid having to adjust u when
      * a file is unmounted.  Note that we rely on unsigned u "wrapping around"
      * to terminate the loop. */
@@ -241,6 +245,10 @@ H5F_mount(H5G_loc_t *loc, const char *name, H5F_t *child,
     parent->shared->mtab.child[md].file = child;
     child->parent = parent;
 
+    /* Paths cached in either file may now cross the mount point */
+    if(H5G_traverse_cache_reset(parent) < 0 || H5G_traverse_cache_reset(child) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to reset path cache")
+
     /* Set the group's mountpoint flag */
     if(H5G_mount(parent->shared->mtab.child[md].group) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEOBJ, FAIL, "unable to set group mounted flag")
@@ -403,6 +411,10 @@ H5F_unmount(H5G_loc_t *loc, const char *name, hid_t dxpl_id)
     parent->shared->mtab.nmounts -= 1;
     parent->nmounts -= 1;
 
+    /* Drop paths cached in either file */
+    if(H5G_traverse_cache_reset(parent) < 0 || H5G_traverse_cache_reset(child) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "unable to reset path cache")
+
     /* Unmount the child file from the parent file */
     if(H5G_unmount(child_group) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTCLOSEOBJ, FAIL, "unable to reset group mounted flag")
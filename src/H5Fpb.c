@@ -0,0 +1,798 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*-------------------------------------------------------------------------
+ *
+ * Created:             H5Fpb.c
+ *
+ * Purpose:             File "page buffer" routines.  (Used to cache whole,
+ *                      aligned pages of the file, so that small metadata
+ *                      and raw data I/Os are turned into page-sized,
+ *                      page-aligned I/Os on the file)
+ *
+ *-------------------------------------------------------------------------
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_PACKAGE		/*suppress error about including H5Fpkg	  */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"             /* File access				*/
+#include "H5FDprivate.h"	/* File drivers				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5SLprivate.h"	/* Skip lists				*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Indices of the metadata and raw data statistics */
+#define H5F_PB_META     0
+#define H5F_PB_RAW      1
+
+/* Which statistics a piece of I/O of a given type is counted in */
+#define H5F_PB_KIND(T)  (((T) == H5FD_MEM_DRAW || (T) == H5FD_MEM_GHEAP) ? H5F_PB_RAW : H5F_PB_META)
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+/* Structure for each page in a file's page buffer */
+typedef struct H5F_pb_entry_t {
+    haddr_t             addr;           /* Address of the page in the file */
+    uint8_t             *buf;           /* Contents of the page */
+    unsigned            kind;           /* Whether the page holds metadata or raw data */
+    hbool_t             dirty;          /* Whether the page must be written back */
+    struct H5F_pb_entry_t *LRU_next;    /* Next page in LRU list */
+    struct H5F_pb_entry_t *LRU_prev;    /* Previous page in LRU list */
+} H5F_pb_entry_t;
+
+/* Structure for a shared file struct's page buffer */
+struct H5F_pb_t {
+    size_t              page_size;      /* Size of each page */
+    size_t              max_pages;      /* Maximum number of pages in the buffer */
+    size_t              min_pages[2];   /* Minimum number of metadata/raw data pages kept */
+    size_t              npages[2];      /* Current number of metadata/raw data pages */
+    H5SL_t              *slist;         /* Skip list of pages, by address */
+    H5F_pb_entry_t      *LRU_head;      /* Head of LRU list.  This is the least recently used page */
+    H5F_pb_entry_t      *LRU_tail;      /* Tail of LRU list.  This is the most recently used page */
+
+    /* Statistics, for metadata ([0]) and raw data ([1]) */
+    unsigned            accesses[2];    /* Pages accessed */
+    unsigned            hits[2];        /* Pages found in the buffer */
+    unsigned            misses[2];      /* Pages loaded into the buffer */
+    unsigned            evictions[2];   /* Pages evicted from the buffer */
+    unsigned            bypasses[2];    /* I/Os done directly on the file */
+};
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static void H5F_pb_lru_remove(H5F_pb_t *pb, H5F_pb_entry_t *ent);
+static void H5F_pb_lru_append(H5F_pb_t *pb, H5F_pb_entry_t *ent);
+static herr_t H5F_pb_write_page(const H5F_t *f, hid_t dxpl_id,
+    H5F_pb_entry_t *ent, haddr_t eoa);
+static herr_t H5F_pb_make_space(const H5F_t *f, hid_t dxpl_id, unsigned kind,
+    hbool_t *made_space);
+static H5F_pb_entry_t *H5F_pb_load(const H5F_t *f, hid_t dxpl_id,
+    unsigned kind, haddr_t page_addr);
+static herr_t H5F_pb_access(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
+    haddr_t addr, size_t size, void *rbuf, const void *wbuf);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Free lists */
+H5FL_DEFINE_STATIC(H5F_pb_entry_t);
+H5FL_DEFINE_STATIC(H5F_pb_t);
+H5FL_BLK_DEFINE_STATIC(pb_page);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_create
+ *
+ * Purpose:     Create the page buffer for a file, holding at most SIZE
+ *              bytes of PAGE_SIZE pages, with at least MIN_META_PERC
+ *              percent of the pages kept for metadata and MIN_RAW_PERC
+ *              percent kept for raw data.
+ *
+ *              While the page buffer is in use, the metadata and "small
+ *              data" aggregators allocate at least a page at a time, so
+ *              that small objects are packed into pages instead of being
+ *              scattered through the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_create(H5F_t *f, size_t size, size_t page_size, unsigned min_meta_perc,
+    unsigned min_raw_perc)
+{
+    H5F_pb_t    *pb = NULL;             /* New page buffer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(NULL == f->shared->page_buf);
+    HDassert(size > 0);
+    HDassert(page_size > 0);
+    HDassert(min_meta_perc + min_raw_perc <= 100);
+
+    /* The page buffer stands in for the metadata accumulator, so it can
+     *  only be used on drivers that allow all I/O to be cached together
+     */
+    if(!H5F_HAS_FEATURE(f, H5FD_FEAT_ACCUMULATE_METADATA))
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "page buffering not supported by this file driver")
+    if(size < page_size)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "page buffer size must be at least one page")
+
+    /* Allocate the page buffer */
+    if(NULL == (pb = H5FL_CALLOC(H5F_pb_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (pb->slist = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTCREATE, FAIL, "can't create skip list")
+    pb->page_size = page_size;
+    pb->max_pages = size / page_size;
+    pb->min_pages[H5F_PB_META] = (pb->max_pages * min_meta_perc) / 100;
+    pb->min_pages[H5F_PB_RAW] = (pb->max_pages * min_raw_perc) / 100;
+
+    /* Pack small metadata and raw data allocations into pages */
+    if(f->shared->meta_aggr.alloc_size < page_size)
+        f->shared->meta_aggr.alloc_size = page_size;
+    if(f->shared->sdata_aggr.alloc_size < page_size)
+        f->shared->sdata_aggr.alloc_size = page_size;
+
+    f->shared->page_buf = pb;
+
+done:
+    if(ret_value < 0 && pb) {
+        if(pb->slist)
+            H5SL_close(pb->slist);
+        pb = H5FL_FREE(H5F_pb_t, pb);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_lru_remove
+ *
+ * Purpose:     Unlink a page from the page buffer's LRU list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F_pb_lru_remove(H5F_pb_t *pb, H5F_pb_entry_t *ent)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(ent->LRU_next)
+        ent->LRU_next->LRU_prev = ent->LRU_prev;
+    else {
+        HDassert(pb->LRU_tail == ent);
+        pb->LRU_tail = ent->LRU_prev;
+    } /* end else */
+    if(ent->LRU_prev)
+        ent->LRU_prev->LRU_next = ent->LRU_next;
+    else {
+        HDassert(pb->LRU_head == ent);
+        pb->LRU_head = ent->LRU_next;
+    } /* end else */
+    ent->LRU_next = ent->LRU_prev = NULL;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_pb_lru_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_lru_append
+ *
+ * Purpose:     Link a page at the most recently used end of the page
+ *              buffer's LRU list.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5F_pb_lru_append(H5F_pb_t *pb, H5F_pb_entry_t *ent)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(NULL == ent->LRU_next && NULL == ent->LRU_prev);
+
+    ent->LRU_prev = pb->LRU_tail;
+    if(pb->LRU_tail)
+        pb->LRU_tail->LRU_next = ent;
+    else
+        pb->LRU_head = ent;
+    pb->LRU_tail = ent;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_pb_lru_append() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_write_page
+ *
+ * Purpose:     Write a dirty page back to the file, up to EOA, and mark
+ *              it clean.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F_pb_write_page(const H5F_t *f, hid_t dxpl_id, H5F_pb_entry_t *ent,
+    haddr_t eoa)
+{
+    H5F_pb_t    *pb = f->shared->page_buf;      /* Page buffer */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(ent->dirty);
+
+    /* Space past the EOA has been released, so its contents don't matter */
+    if(H5F_addr_lt(ent->addr, eoa)) {
+        size_t write_size = (size_t)MIN(pb->page_size, eoa - ent->addr);
+
+        if(H5FD_write(f->shared->lf, dxpl_id, H5FD_MEM_DEFAULT, ent->addr, write_size, ent->buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    } /* end if */
+    ent->dirty = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_write_page() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_make_space
+ *
+ * Purpose:     Evict the least recently used page that may be given up
+ *              for a new page of KIND, if the page buffer is full.
+ *
+ *              A page of the other kind is only evicted if more than the
+ *              minimum number of pages of that kind are in the buffer.
+ *              When no page may be evicted, MADE_SPACE is set to FALSE
+ *              and the caller does its I/O directly on the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F_pb_make_space(const H5F_t *f, hid_t dxpl_id, unsigned kind,
+    hbool_t *made_space)
+{
+    H5F_pb_t    *pb = f->shared->page_buf;      /* Page buffer */
+    H5F_pb_entry_t *ent;                        /* Page to evict */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    *made_space = TRUE;
+    if((pb->npages[H5F_PB_META] + pb->npages[H5F_PB_RAW]) < pb->max_pages)
+        HGOTO_DONE(SUCCEED)
+
+    /* Look for a page to evict, from the least recently used end */
+    for(ent = pb->LRU_head; ent; ent = ent->LRU_next)
+        if(ent->kind == kind || pb->npages[ent->kind] > pb->min_pages[ent->kind])
+            break;
+    if(NULL == ent) {
+        *made_space = FALSE;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Write the page back, if it's dirty */
+    if(ent->dirty) {
+        haddr_t eoa;            /* End of allocated space in file */
+
+        if(HADDR_UNDEF == (eoa = H5FD_get_eoa(f->shared->lf, H5FD_MEM_DEFAULT)))
+            HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to get end of allocated space")
+        if(H5F_pb_write_page(f, dxpl_id, ent, eoa) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write page")
+    } /* end if */
+
+    /* Remove the page */
+    if(ent != H5SL_remove(pb->slist, &ent->addr))
+        HGOTO_ERROR(H5E_FILE, H5E_CANTDELETE, FAIL, "can't remove page from skip list")
+    H5F_pb_lru_remove(pb, ent);
+    pb->npages[ent->kind]--;
+    pb->evictions[ent->kind]++;
+    ent->buf = H5FL_BLK_FREE(pb_page, ent->buf);
+    ent = H5FL_FREE(H5F_pb_entry_t, ent);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_make_space() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_load
+ *
+ * Purpose:     Read the page at PAGE_ADDR into the page buffer, evicting
+ *              another page if necessary.
+ *
+ *              The page is read up to EOA and the rest of it is zeroed.
+ *
+ *              The caller must have made room for the page already.
+ *
+ * Return:      Success:        Pointer to the new page
+ *              Failure:        NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5F_pb_entry_t *
+H5F_pb_load(const H5F_t *f, hid_t dxpl_id, unsigned kind, haddr_t page_addr)
+{
+    H5F_pb_t    *pb = f->shared->page_buf;      /* Page buffer */
+    H5F_pb_entry_t *ent = NULL;                 /* New page */
+    haddr_t     eoa;                            /* End of allocated space in file */
+    size_t      read_size = 0;                  /* Amount of page to read */
+    H5F_pb_entry_t *ret_value;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Allocate the new page */
+    if(NULL == (ent = H5FL_CALLOC(H5F_pb_entry_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    if(NULL == (ent->buf = (uint8_t *)H5FL_BLK_MALLOC(pb_page, pb->page_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    ent->addr = page_addr;
+    ent->kind = kind;
+
+    /* Read the page, up to EOA */
+    if(HADDR_UNDEF == (eoa = H5FD_get_eoa(f->shared->lf, H5FD_MEM_DEFAULT)))
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, NULL, "unable to get end of allocated space")
+    if(H5F_addr_lt(page_addr, eoa)) {
+        read_size = (size_t)MIN(pb->page_size, eoa - page_addr);
+        if(H5FD_read(f->shared->lf, dxpl_id, H5FD_MEM_DEFAULT, page_addr, read_size, ent->buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "file read failed")
+    } /* end if */
+    if(read_size < pb->page_size)
+        HDmemset(ent->buf + read_size, 0, pb->page_size - read_size);
+
+    /* Insert the page */
+    if(H5SL_insert(pb->slist, ent, &ent->addr) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTINSERT, NULL, "can't insert page into skip list")
+    H5F_pb_lru_append(pb, ent);
+    pb->npages[kind]++;
+
+    /* Set return value */
+    ret_value = ent;
+
+done:
+    if(NULL == ret_value && ent) {
+        if(ent->buf)
+            ent->buf = H5FL_BLK_FREE(pb_page, ent->buf);
+        ent = H5FL_FREE(H5F_pb_entry_t, ent);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_load() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_access
+ *
+ * Purpose:     Read or write a request smaller than a page through the
+ *              page buffer, one page at a time.  Data is read into RBUF,
+ *              or written from WBUF when that is given instead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F_pb_access(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
+    size_t size, void *rbuf, const void *wbuf)
+{
+    H5F_pb_t    *pb = f->shared->page_buf;      /* Page buffer */
+    unsigned    kind = H5F_PB_KIND(type);       /* Kind of pages accessed */
+    uint8_t     *rp = (uint8_t *)rbuf;          /* Pointer into user's buffer to read into */
+    const uint8_t *wp = (const uint8_t *)wbuf;  /* Pointer into user's buffer to write from */
+    haddr_t     page_addr;                      /* Address of current page */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    page_addr = (addr / pb->page_size) * pb->page_size;
+    while(size > 0) {
+        H5F_pb_entry_t *ent;            /* Current page */
+        size_t  off = (size_t)(addr - page_addr);       /* Offset of request in page */
+        size_t  len = MIN(size, pb->page_size - off);   /* Amount of request in page */
+
+        pb->accesses[kind]++;
+        if(NULL != (ent = (H5F_pb_entry_t *)H5SL_search(pb->slist, &page_addr))) {
+            pb->hits[kind]++;
+            H5F_pb_lru_remove(pb, ent);
+            H5F_pb_lru_append(pb, ent);
+        } /* end if */
+        else {
+            hbool_t made_space;         /* Whether there is room for the page */
+
+            pb->misses[kind]++;
+            if(H5F_pb_make_space(f, dxpl_id, kind, &made_space) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to evict page")
+            if(made_space && NULL == (ent = H5F_pb_load(f, dxpl_id, kind, page_addr)))
+                HGOTO_ERROR(H5E_IO, H5E_CANTLOAD, FAIL, "unable to load page")
+        } /* end else */
+
+        if(ent) {
+            if(wp) {
+                HDmemcpy(ent->buf + off, wp, len);
+                ent->dirty = TRUE;
+            } /* end if */
+            else
+                HDmemcpy(rp, ent->buf + off, len);
+        } /* end if */
+        else {
+            /* No page could be given up, do this piece directly */
+            pb->bypasses[kind]++;
+            if(wp) {
+                if(H5FD_write(f->shared->lf, dxpl_id, type, addr, len, wp) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            } /* end if */
+            else {
+                if(H5FD_read(f->shared->lf, dxpl_id, type, addr, len, rp) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            } /* end else */
+        } /* end else */
+
+        addr += len;
+        if(wp)
+            wp += len;
+        else
+            rp += len;
+        size -= len;
+        page_addr += pb->page_size;
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_access() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_read
+ *
+ * Purpose:     Read data through the page buffer.
+ *
+ *              Requests of a page or more are read directly from the file
+ *              and then patched with any dirty pages they overlap.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_read(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
+    size_t size, void *buf/*out*/)
+{
+    H5F_pb_t    *pb;                    /* Page buffer */
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->page_buf);
+    HDassert(buf);
+
+    pb = f->shared->page_buf;
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    if(size < pb->page_size) {
+        if(H5F_pb_access(f, dxpl_id, map_type, addr, size, buf, NULL) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
+    } /* end if */
+    else {
+        haddr_t page_addr = (addr / pb->page_size) * pb->page_size;
+        H5SL_node_t *node;
+
+        pb->bypasses[H5F_PB_KIND(map_type)]++;
+        if(H5FD_read(f->shared->lf, dxpl_id, map_type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+        /* Patch in newer data from dirty pages the request overlaps */
+        for(node = H5SL_above(pb->slist, &page_addr); node; node = H5SL_next(node)) {
+            H5F_pb_entry_t *ent = (H5F_pb_entry_t *)H5SL_item(node);
+
+            if(H5F_addr_le(addr + size, ent->addr))
+                break;
+            if(ent->dirty) {
+                haddr_t start = MAX(addr, ent->addr);
+                haddr_t end = MIN(addr + size, ent->addr + pb->page_size);
+
+                HDmemcpy((uint8_t *)buf + (start - addr), ent->buf + (start - ent->addr), (size_t)(end - start));
+            } /* end if */
+        } /* end for */
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_write
+ *
+ * Purpose:     Write data through the page buffer.
+ *
+ *              Requests of a page or more are written directly to the
+ *              file, and any pages they overlap are updated to match.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_write(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type, haddr_t addr,
+    size_t size, const void *buf)
+{
+    H5F_pb_t    *pb;                    /* Page buffer */
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->page_buf);
+    HDassert(buf);
+
+    pb = f->shared->page_buf;
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    if(size < pb->page_size) {
+        if(H5F_pb_access(f, dxpl_id, map_type, addr, size, NULL, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+    } /* end if */
+    else {
+        pb->bypasses[H5F_PB_KIND(map_type)]++;
+        if(H5FD_write(f->shared->lf, dxpl_id, map_type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+        H5F_pb_update(f, addr, size, buf);
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_update
+ *
+ * Purpose:     Copy data that was written directly to the file into any
+ *              pages it overlaps, so they don't write stale data back
+ *              over it.  Whether the pages are dirty is not changed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5F_pb_update(const H5F_t *f, haddr_t addr, size_t size, const void *buf)
+{
+    H5F_pb_t    *pb;                    /* Page buffer */
+    haddr_t     page_addr;              /* Address of first page overlapped */
+    H5SL_node_t *node;                  /* Skip list node for page */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(buf);
+
+    if(NULL != (pb = f->shared->page_buf)) {
+        page_addr = (addr / pb->page_size) * pb->page_size;
+        for(node = H5SL_above(pb->slist, &page_addr); node; node = H5SL_next(node)) {
+            H5F_pb_entry_t *ent = (H5F_pb_entry_t *)H5SL_item(node);
+            haddr_t start, end;
+
+            if(H5F_addr_le(addr + size, ent->addr))
+                break;
+            start = MAX(addr, ent->addr);
+            end = MIN(addr + size, ent->addr + pb->page_size);
+            HDmemcpy(ent->buf + (start - ent->addr), (const uint8_t *)buf + (start - addr), (size_t)(end - start));
+        } /* end for */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5F_pb_update() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_flush
+ *
+ * Purpose:     Write all dirty pages back to the file, in address order.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_flush(const H5F_t *f, hid_t dxpl_id)
+{
+    H5F_pb_t    *pb;                    /* Page buffer */
+    H5SL_node_t *node;                  /* Skip list node for page */
+    haddr_t     eoa;                    /* End of allocated space in file */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(NULL == (pb = f->shared->page_buf))
+        HGOTO_DONE(SUCCEED)
+
+    if(HADDR_UNDEF == (eoa = H5FD_get_eoa(f->shared->lf, H5FD_MEM_DEFAULT)))
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to get end of allocated space")
+    for(node = H5SL_first(pb->slist); node; node = H5SL_next(node)) {
+        H5F_pb_entry_t *ent = (H5F_pb_entry_t *)H5SL_item(node);
+
+        if(ent->dirty)
+            if(H5F_pb_write_page(f, dxpl_id, ent, eoa) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to write page")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_dest
+ *
+ * Purpose:     Destroy a file's page buffer, writing back its dirty pages
+ *              first if FLUSH is set.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_dest(const H5F_t *f, hid_t dxpl_id, hbool_t flush)
+{
+    H5F_pb_t    *pb;                    /* Page buffer */
+    H5F_pb_entry_t *ent;                /* Page to free */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    if(NULL == (pb = f->shared->page_buf))
+        HGOTO_DONE(SUCCEED)
+
+    if(flush)
+        if(H5F_pb_flush(f, dxpl_id) < 0)
+            /* Push error, but keep going */
+            HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
+
+    /* Free all the pages */
+    while(NULL != (ent = (H5F_pb_entry_t *)H5SL_remove_first(pb->slist))) {
+        ent->buf = H5FL_BLK_FREE(pb_page, ent->buf);
+        ent = H5FL_FREE(H5F_pb_entry_t, ent);
+    } /* end while */
+    H5SL_close(pb->slist);
+    f->shared->page_buf = H5FL_FREE(H5F_pb_t, pb);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_pb_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_get_stats
+ *
+ * Purpose:     Retrieve the page buffer's statistics, for metadata ([0])
+ *              and raw data ([1]).  Any of the arrays may be NULL.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_get_stats(const H5F_pb_t *pb, unsigned accesses[2], unsigned hits[2],
+    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2])
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(pb);
+
+    if(accesses)
+        HDmemcpy(accesses, pb->accesses, sizeof(pb->accesses));
+    if(hits)
+        HDmemcpy(hits, pb->hits, sizeof(pb->hits));
+    if(misses)
+        HDmemcpy(misses, pb->misses, sizeof(pb->misses));
+    if(evictions)
+        HDmemcpy(evictions, pb->evictions, sizeof(pb->evictions));
+    if(bypasses)
+        HDmemcpy(bypasses, pb->bypasses, sizeof(pb->bypasses));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F_pb_get_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5F_pb_reset_stats
+ *
+ * Purpose:     Reset the page buffer's statistics.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_pb_reset_stats(H5F_pb_t *pb)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(pb);
+
+    HDmemset(pb->accesses, 0, sizeof(pb->accesses));
+    HDmemset(pb->hits, 0, sizeof(pb->hits));
+    HDmemset(pb->misses, 0, sizeof(pb->misses));
+    HDmemset(pb->evictions, 0, sizeof(pb->evictions));
+    HDmemset(pb->bypasses, 0, sizeof(pb->bypasses));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5F_pb_reset_stats() */
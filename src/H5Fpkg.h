@@ -72,6 +72,13 @@
 /* Macro to abstract checking whether file is using a free space manager */
 #define H5F_HAVE_FREE_SPACE_MANAGER(F)  TRUE    /* Currently always have a free space manager */
 
+/* Threadsafe builds read raw data from read-only files without holding the
+ * API lock (see H5F_block_readv), when the file driver allows it.
+ */
+#if defined(H5_HAVE_THREADSAFE) && !defined(H5_HAVE_WIN_THREADS)
+#define H5F_HAVE_UNLOCKED_READS
+#endif
+
 /* Macros for encoding/decoding superblock */
 #define H5F_MAX_DRVINFOBLOCK_SIZE  1024         /* Maximum size of superblock driver info buffer */
 #define H5F_DRVINFOBLOCK_HDR_SIZE 16            /* Size of superblock driver info header */
@@ -129,6 +136,9 @@
  * H5Fefc.c) */
 typedef struct H5F_efc_t H5F_efc_t;
 
+/* Page buffer info (forward declared, defined in H5Fpb.c) */
+typedef struct H5F_pb_t H5F_pb_t;
+
 /* Structure for metadata & "small [raw] data" block aggregation fields */
 struct H5F_blk_aggr_t {
     unsigned long       feature_flag;   /* Feature flag type */
@@ -149,6 +159,19 @@ typedef struct H5F_meta_accum_t {
     hbool_t             dirty;          /* Flag to indicate that the accumulated metadata is dirty */
 } H5F_meta_accum_t;
 
+/* Structure for an extent of metadata recorded in a metadata cache image */
+typedef struct H5F_mdci_extent_t {
+    haddr_t             addr;           /* Address of extent */
+    hsize_t             len;            /* Length of extent */
+} H5F_mdci_extent_t;
+
+/* Structure for a run of metadata read in from a metadata cache image */
+typedef struct H5F_mdci_run_t {
+    haddr_t             addr;           /* File location (offset) of the run */
+    size_t              size;           /* Size of the run (in bytes), 0 once dropped */
+    uint8_t            *buf;            /* Buffer holding the run's bytes */
+} H5F_mdci_run_t;
+
 /* Enum for free space manager state */
 typedef enum H5F_fs_state_t {
     H5F_FS_STATE_CLOSED,                /* Free space manager is closed */
@@ -224,7 +247,18 @@ struct H5F_file_t {
     size_t	rdcc_nslots;	/* Size of raw data chunk cache (slots)	*/
     size_t	rdcc_nbytes;	/* Size of raw data chunk cache	(bytes)	*/
     double	rdcc_w0;	/* Preempt read chunks first? [0.0..1.0]*/
+    H5F_rdcc_pool_t rdcc_pool;	/* Raw data chunk cache shared by datasets */
     size_t      sieve_buf_size; /* Size of the data sieve buffer allocated (in bytes) */
+    size_t      meta_prefetch_size; /* Size of the metadata prefetch window (0 disables prefetch) */
+    H5AC_cache_image_config_t mdc_image_config; /* Metadata cache image configuration */
+    size_t      mdci_nruns;     /* Number of runs read from the metadata cache image */
+    size_t      mdci_nvalid;    /* Number of those runs not dropped yet */
+    H5F_mdci_run_t *mdci_runs;  /* Runs read from the metadata cache image, sorted by address */
+    char       *mdci_name;      /* Absolute name of the metadata cache image (NULL if the file can't have one) */
+    size_t      page_buf_size;  /* Maximum size of the page buffer (0 disables it) */
+    size_t      page_buf_page_size; /* Size of the pages in the page buffer */
+    unsigned    page_buf_min_meta_perc; /* Minimum percentage of page buffer pages kept for metadata */
+    unsigned    page_buf_min_raw_perc;  /* Minimum percentage of page buffer pages kept for raw data */
     hsize_t	threshold;	/* Threshold for alignment		*/
     hsize_t	alignment;	/* Alignment				*/
     unsigned	gc_ref;		/* Garbage-collect references?		*/
@@ -235,6 +269,7 @@ struct H5F_file_t {
     struct H5G_t *root_grp;	/* Open root group			*/
     H5FO_t *open_objs;          /* Open objects in file                 */
     H5RC_t *grp_btree_shared;   /* Ref-counted group B-tree node info   */
+    struct H5SL_t *grp_path_cache; /* Paths resolved from the root group (NULL when empty) */
 
     /* File space allocation information */
     hbool_t     use_tmp_space;  /* Whether temp. file space allocation is allowed */
@@ -251,6 +286,13 @@ struct H5F_file_t {
 
     /* Metadata accumulator information */
     H5F_meta_accum_t accum;     /* Metadata accumulator info           	*/
+
+    /* Page buffer information */
+    H5F_pb_t    *page_buf;      /* Page buffer (NULL when not in use)   */
+
+#ifdef H5F_HAVE_UNLOCKED_READS
+    unsigned    nreaders;       /* # of reads running without the API lock */
+#endif /* H5F_HAVE_UNLOCKED_READS */
 };
 
 /*
@@ -318,11 +360,40 @@ H5_DLL herr_t H5F_accum_read(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
     haddr_t addr, size_t size, void *buf);
 H5_DLL herr_t H5F_accum_write(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
     haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5F_accum_readv(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
+    size_t count, const haddr_t addr[], const size_t size[], void *buf[]);
+H5_DLL herr_t H5F_accum_writev(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
+    size_t count, const haddr_t addr[], const size_t size[], const void *buf[]);
 H5_DLL herr_t H5F_accum_free(H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
     haddr_t addr, hsize_t size);
 H5_DLL herr_t H5F_accum_flush(const H5F_t *f, hid_t dxpl_id);
 H5_DLL herr_t H5F_accum_reset(const H5F_t *f, hid_t dxpl_id, hbool_t flush);
 
+/* Metadata cache image routines */
+H5_DLL herr_t H5F_mdci_save(H5F_t *f, hid_t dxpl_id);
+H5_DLL herr_t H5F_mdci_load(H5F_t *f, hid_t dxpl_id);
+H5_DLL herr_t H5F_mdci_discard(H5F_t *f);
+H5_DLL hbool_t H5F_mdci_read(const H5F_t *f, haddr_t addr, size_t size,
+    void *buf);
+H5_DLL void H5F_mdci_invalidate(const H5F_t *f, haddr_t addr, hsize_t size);
+H5_DLL herr_t H5F_mdci_free(const H5F_t *f);
+
+/* Page buffer routines */
+H5_DLL herr_t H5F_pb_create(H5F_t *f, size_t size, size_t page_size,
+    unsigned min_meta_perc, unsigned min_raw_perc);
+H5_DLL herr_t H5F_pb_read(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
+    haddr_t addr, size_t size, void *buf);
+H5_DLL herr_t H5F_pb_write(const H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
+    haddr_t addr, size_t size, const void *buf);
+H5_DLL void H5F_pb_update(const H5F_t *f, haddr_t addr, size_t size,
+    const void *buf);
+H5_DLL herr_t H5F_pb_flush(const H5F_t *f, hid_t dxpl_id);
+H5_DLL herr_t H5F_pb_dest(const H5F_t *f, hid_t dxpl_id, hbool_t flush);
+H5_DLL herr_t H5F_pb_get_stats(const H5F_pb_t *pb, unsigned accesses[2],
+    unsigned hits[2], unsigned misses[2], unsigned evictions[2],
+    unsigned bypasses[2]);
+H5_DLL herr_t H5F_pb_reset_stats(H5F_pb_t *pb);
+
 /* Shared file list related routines */
 H5_DLL herr_t H5F_sfile_add(H5F_file_t *shared);
 H5_DLL H5F_file_t * H5F_sfile_search(H5FD_t *lf);
@@ -341,6 +412,7 @@ H5_DLL herr_t H5F_get_sohm_mesg_count_test(hid_t fid, unsigned type_id,
     size_t *mesg_count);
 H5_DLL herr_t H5F_check_cached_stab_test(hid_t file_id);
 H5_DLL herr_t H5F_get_maxaddr_test(hid_t file_id, haddr_t *maxaddr);
+H5_DLL herr_t H5F_get_mdci_nruns_test(hid_t file_id, size_t *nruns);
 #endif /* H5F_TESTING */
 
 #endif /* _H5Fpkg_H */
@@ -40,6 +40,14 @@ typedef struct H5F_file_t H5F_file_t;
 /* Block aggregation structure */
 typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 
+/* Raw data chunk cache budget shared by the chunked datasets in a file */
+typedef struct H5F_rdcc_pool_t {
+    size_t nbytes_max;          /* Maximum cached raw data in bytes, all datasets */
+    size_t nbytes_used;         /* Current cached raw data in bytes, all datasets */
+    struct H5D_rdcc_t *head;    /* Least recently accessed dataset cache */
+    struct H5D_rdcc_t *tail;    /* Most recently accessed dataset cache */
+} H5F_rdcc_pool_t;
+
 
 /*
  * Encode and decode macros for file meta-data.
@@ -254,6 +262,7 @@ typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 #define H5F_RDCC_NSLOTS(F)      ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)      ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)          ((F)->shared->rdcc_w0)
+#define H5F_RDCC_POOL(F)        (&(F)->shared->rdcc_pool)
 #define H5F_SIEVE_BUF_SIZE(F)   ((F)->shared->sieve_buf_size)
 #define H5F_GC_REF(F)           ((F)->shared->gc_ref)
 #define H5F_USE_LATEST_FORMAT(F) ((F)->shared->latest_format)
@@ -261,6 +270,8 @@ typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    ((F)->shared->store_msg_crt_idx = (FL))
 #define H5F_GRP_BTREE_SHARED(F) ((F)->shared->grp_btree_shared)
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (((F)->shared->grp_btree_shared = (RC)) ? SUCCEED : FAIL)
+#define H5F_GRP_PATH_CACHE(F)   ((F)->shared->grp_path_cache)
+#define H5F_SET_GRP_PATH_CACHE(F, C) ((F)->shared->grp_path_cache = (C), SUCCEED)
 #define H5F_USE_TMP_SPACE(F)    ((F)->shared->use_tmp_space)
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_addr_le((F)->shared->tmp_addr, (ADDR)))
 #else /* H5F_PACKAGE */
@@ -296,6 +307,7 @@ typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 #define H5F_RDCC_NSLOTS(F)      (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)      (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)          (H5F_rdcc_w0(F))
+#define H5F_RDCC_POOL(F)        (H5F_rdcc_pool(F))
 #define H5F_SIEVE_BUF_SIZE(F)   (H5F_sieve_buf_size(F))
 #define H5F_GC_REF(F)           (H5F_gc_ref(F))
 #define H5F_USE_LATEST_FORMAT(F) (H5F_use_latest_format(F))
@@ -303,6 +315,8 @@ typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 #define H5F_SET_STORE_MSG_CRT_IDX(F, FL)    (H5F_set_store_msg_crt_idx((F), (FL)))
 #define H5F_GRP_BTREE_SHARED(F) (H5F_grp_btree_shared(F))
 #define H5F_SET_GRP_BTREE_SHARED(F, RC) (H5F_set_grp_btree_shared((F), (RC)))
+#define H5F_GRP_PATH_CACHE(F)   (H5F_grp_path_cache(F))
+#define H5F_SET_GRP_PATH_CACHE(F, C) (H5F_set_grp_path_cache((F), (C)))
 #define H5F_USE_TMP_SPACE(F)    (H5F_use_tmp_space(F))
 #define H5F_IS_TMP_ADDR(F, ADDR) (H5F_is_tmp_addr((F), (ADDR)))
 #endif /* H5F_PACKAGE */
@@ -385,6 +399,7 @@ typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_NAME       "rdcc_nslots"   /* Size of raw data chunk cache(slots) */
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_NAME       "rdcc_nbytes"   /* Size of raw data chunk cache(bytes) */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_NAME        "rdcc_w0"       /* Preemption read chunks first */
+#define H5F_ACS_DATA_CACHE_SHARED_SIZE_NAME     "rdcc_shared_nbytes" /* Size of raw data chunk cache shared by all datasets (bytes) */
 #define H5F_ACS_ALIGN_THRHD_NAME                "threshold"     /* Threshold for alignment */
 #define H5F_ACS_ALIGN_NAME                      "align"         /* Alignment */
 #define H5F_ACS_META_BLOCK_SIZE_NAME            "meta_block_size" /* Minimum metadata allocation block size (when aggregating metadata allocations) */
@@ -402,6 +417,14 @@ typedef struct H5F_blk_aggr_t H5F_blk_aggr_t;
 #define H5F_ACS_WANT_POSIX_FD_NAME              "want_posix_fd" /* Internal: query the file descriptor from the core VFD, instead of the memory address */
 #define H5F_ACS_EFC_SIZE_NAME                   "efc_size"      /* Size of external file cache */
 #define H5F_ACS_FILE_IMAGE_INFO_NAME            "file_image_info" /* struct containing initial file image and callback info */
+#define H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME   "core_write_tracking_flag" /* Whether or not core VFD backing store write tracking is enabled */
+#define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME "core_write_tracking_page_size" /* Page size (in bytes) used for core VFD write tracking */
+#define H5F_ACS_MDC_IMAGE_CONFIG_NAME           "mdc_image_config" /* Metadata cache image configuration */
+#define H5F_ACS_META_PREFETCH_SIZE_NAME         "meta_prefetch_size" /* Size of the window used to prefetch metadata into the accumulator */
+#define H5F_ACS_PAGE_BUFFER_SIZE_NAME           "page_buffer_size" /* Maximum size of the page buffer (0 disables it) */
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME      "page_buffer_page_size" /* Size of the pages in the page buffer */
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME  "page_buffer_min_meta_perc" /* Minimum percentage of page buffer pages kept for metadata */
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME   "page_buffer_min_raw_perc" /* Minimum percentage of page buffer pages kept for raw data */
 
 /* ======================== File Mount properties ====================*/
 #define H5F_MNT_SYM_LOCAL_NAME 		"local"                 /* Whether absolute symlinks local to file. */
@@ -525,6 +548,7 @@ H5_DLL H5F_close_degree_t H5F_get_fc_degree(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double H5F_rdcc_w0(const H5F_t *f);
+H5_DLL H5F_rdcc_pool_t *H5F_rdcc_pool(const H5F_t *f);
 H5_DLL size_t H5F_sieve_buf_size(const H5F_t *f);
 H5_DLL unsigned H5F_gc_ref(const H5F_t *f);
 H5_DLL hbool_t H5F_use_latest_format(const H5F_t *f);
@@ -532,6 +556,8 @@ H5_DLL hbool_t H5F_store_msg_crt_idx(const H5F_t *f);
 H5_DLL herr_t H5F_set_store_msg_crt_idx(H5F_t *f, hbool_t flag);
 H5_DLL struct H5RC_t *H5F_grp_btree_shared(const H5F_t *f);
 H5_DLL herr_t H5F_set_grp_btree_shared(H5F_t *f, struct H5RC_t *rc);
+H5_DLL struct H5SL_t *H5F_grp_path_cache(const H5F_t *f);
+H5_DLL herr_t H5F_set_grp_path_cache(H5F_t *f, struct H5SL_t *cache);
 H5_DLL hbool_t H5F_use_tmp_space(const H5F_t *f);
 H5_DLL hbool_t H5F_is_tmp_addr(const H5F_t *f, haddr_t addr);
 
@@ -553,6 +579,14 @@ H5_DLL herr_t H5F_block_read(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 size_t size, hid_t dxpl_id, void *buf/*out*/);
 H5_DLL herr_t H5F_block_write(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 size_t size, hid_t dxpl_id, const void *buf);
+H5_DLL herr_t H5F_block_readv(const H5F_t *f, H5FD_mem_t type, size_t count,
+                const haddr_t addr[], const size_t size[], hid_t dxpl_id,
+                void *buf[]/*out*/);
+H5_DLL herr_t H5F_block_writev(const H5F_t *f, H5FD_mem_t type, size_t count,
+                const haddr_t addr[], const size_t size[], hid_t dxpl_id,
+                const void *buf[]);
+H5_DLL herr_t H5F_block_map(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
+                size_t size, hid_t dxpl_id, const void **ptr/*out*/);
 
 /* Address-related functions */
 H5_DLL void H5F_addr_encode(const H5F_t *f, uint8_t **pp, haddr_t addr);
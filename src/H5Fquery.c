@@ -656,6 +656,33 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_rdcc_pool
+ *
+ * Purpose:	Retrieve the raw data chunk cache budget shared by the
+ *              chunked datasets in the file.
+ *
+ * Return:	Success:	Pointer to the file's shared chunk cache
+ *                              information (its nbytes_max is 0 when the
+ *                              shared cache is disabled).
+ *
+ * 		Failure:	(should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5F_rdcc_pool_t *
+H5F_rdcc_pool(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(&f->shared->rdcc_pool)
+} /* end H5F_rdcc_pool() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_get_base_addr
@@ -715,6 +742,32 @@ H5F_grp_btree_shared(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->grp_btree_shared)
 } /* end H5F_grp_btree_shared() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_grp_path_cache
+ *
+ * Purpose:	Retrieve the cache of paths resolved from the file's root
+ *              group.
+ *
+ * Return:	Success:	The path cache, or NULL if no paths are
+ *                              cached.
+ *
+ * 		Failure:	(should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+struct H5SL_t *
+H5F_grp_path_cache(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->grp_path_cache)
+} /* end H5F_grp_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_sieve_buf_size
@@ -186,3 +186,34 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_get_maxaddr_test() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_get_mdci_nruns_test
+ *
+ * Purpose:     Retrieve the number of runs read in from a file's
+ *              metadata cache image that haven't been dropped yet
+ *
+ * Return:	Success:        Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_get_mdci_nruns_test(hid_t file_id, size_t *nruns)
+{
+    H5F_t	*file;                  /* File info */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check arguments */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file")
+
+    /* Retrieve the number of runs not dropped yet */
+    *nruns = file->shared->mdci_nvalid;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_get_mdci_nruns_test() */
+
@@ -228,6 +228,9 @@ H5G_term_interface(void)
 	if((n = H5I_nmembers(H5I_GROUP)))
 	    H5I_clear_type(H5I_GROUP, FALSE, FALSE);
 	else {
+	    /* Drop the path indices of open objects */
+	    H5G_name_index_reset();
+
 	    /* Destroy the group object id group */
 	    H5I_dec_type_ref(H5I_GROUP);
 
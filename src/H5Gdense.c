@@ -226,6 +226,25 @@ typedef struct {
     H5O_link_t  *lnk;                   /* Pointer to link                   */
 } H5G_fh_ud_lbi_t;
 
+/*
+ * Information about each link in a batch inserted into dense link storage
+ * with H5G__dense_insert_many.
+ */
+typedef struct {
+    const H5O_link_t *lnk;              /* Link to insert                    */
+    uint32_t    name_hash;              /* Hash of link's name               */
+    uint8_t     id[H5G_DENSE_FHEAP_ID_LEN]; /* Heap ID of link, once inserted */
+} H5G_dense_ins_t;
+
+/*
+ * User data for bulk-loading a batch of links into an empty index v2 B-tree.
+ */
+typedef struct {
+    /* downward */
+    H5G_bt2_ud_ins_t common;            /* User data for v2 B-tree insertion (must be first) */
+    const H5G_dense_ins_t *ins;         /* Links in batch, in index order    */
+} H5G_dense_bulk_ud_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -236,6 +255,10 @@ typedef struct {
 /* Local Prototypes */
 /********************/
 
+static int H5G_dense_ins_cmp_name(const void *_ins1, const void *_ins2);
+static int H5G_dense_ins_cmp_corder(const void *_ins1, const void *_ins2);
+static herr_t H5G_dense_bulk_cb(hsize_t idx, void *_udata);
+
 
 /*********************/
 /* Package Variables */
@@ -482,6 +505,266 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__dense_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_dense_ins_cmp_name
+ *
+ * Purpose:	Callback routine for sorting a batch of links into the
+ *              order of the 'name' index v2 B-tree (by the hash of the
+ *              name, then by the name itself).
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G_dense_ins_cmp_name(const void *_ins1, const void *_ins2)
+{
+    const H5G_dense_ins_t *ins1 = (const H5G_dense_ins_t *)_ins1;
+    const H5G_dense_ins_t *ins2 = (const H5G_dense_ins_t *)_ins2;
+    int ret_value;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(ins1->name_hash < ins2->name_hash)
+        ret_value = -1;
+    else if(ins1->name_hash > ins2->name_hash)
+        ret_value = 1;
+    else
+        ret_value = HDstrcmp(ins1->lnk->name, ins2->lnk->name);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_dense_ins_cmp_name() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_dense_ins_cmp_corder
+ *
+ * Purpose:	Callback routine for sorting a batch of links into creation
+ *              order.
+ *
+ * Return:	An integer less than, equal to, or greater than zero if the
+ *              first argument is considered to be respectively less than,
+ *              equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G_dense_ins_cmp_corder(const void *_ins1, const void *_ins2)
+{
+    const H5G_dense_ins_t *ins1 = (const H5G_dense_ins_t *)_ins1;
+    const H5G_dense_ins_t *ins2 = (const H5G_dense_ins_t *)_ins2;
+    int ret_value;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(ins1->lnk->corder < ins2->lnk->corder)
+        ret_value = -1;
+    else if(ins1->lnk->corder > ins2->lnk->corder)
+        ret_value = 1;
+    else
+        ret_value = 0;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_dense_ins_cmp_corder() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_dense_bulk_cb
+ *
+ * Purpose:	Callback routine for bulk-loading a batch of links into an
+ *              index v2 B-tree, filling in the insertion user data for the
+ *              idx'th link.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_dense_bulk_cb(hsize_t idx, void *_udata)
+{
+    H5G_dense_bulk_ud_t *udata = (H5G_dense_bulk_ud_t *)_udata;
+    const H5G_dense_ins_t *ins;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    ins = &udata->ins[idx];
+    udata->common.common.name = ins->lnk->name;
+    udata->common.common.name_hash = ins->name_hash;
+    udata->common.common.corder = ins->lnk->corder;
+    HDmemcpy(udata->common.id, ins->id, sizeof(udata->common.id));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G_dense_bulk_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G__dense_insert_many
+ *
+ * Purpose:	Insert a batch of links into the dense link storage
+ *              structures for a group.
+ *
+ *              The fractal heap and the index v2 B-trees are opened once
+ *              for the whole batch.  Every name is checked against the
+ *              batch and the 'name' index before anything is modified,
+ *              then the serialized links are appended to the fractal heap
+ *              in one pass and the index records are inserted in index
+ *              order, so that consecutive insertions touch neighboring
+ *              B-tree nodes.
+ *
+ *              The link info message is not updated here; that is left to
+ *              the caller.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G__dense_insert_many(H5F_t *f, hid_t dxpl_id, const H5O_linfo_t *linfo,
+    size_t nlinks, const H5O_link_t *lnks)
+{
+    H5G_dense_ins_t *ins = NULL;        /* Information for links in batch */
+    H5G_dense_bulk_ud_t bulk_udata;     /* User data for v2 B-tree bulk-loading */
+    H5G_bt2_ud_ins_t *udata = &bulk_udata.common;  /* User data for v2 B-tree insertion */
+    H5HF_t *fheap = NULL;               /* Fractal heap handle */
+    H5B2_t *bt2_name = NULL;            /* v2 B-tree handle for name index */
+    H5B2_t *bt2_corder = NULL;          /* v2 B-tree handle for creation order index */
+    H5WB_t *wb = NULL;                  /* Wrapped buffer for link data */
+    uint8_t link_buf[H5G_LINK_BUF_SIZE];        /* Buffer for serializing link */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(linfo);
+    HDassert(nlinks > 0);
+    HDassert(lnks);
+
+    /* Set up the information for each link & sort it in 'name' index order */
+    if(NULL == (ins = (H5G_dense_ins_t *)H5MM_malloc(sizeof(H5G_dense_ins_t) * nlinks)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTALLOC, FAIL, "memory allocation failed for link batch")
+    for(u = 0; u < nlinks; u++) {
+        ins[u].lnk = &lnks[u];
+        ins[u].name_hash = H5_checksum_lookup3(lnks[u].name, HDstrlen(lnks[u].name), 0);
+    } /* end for */
+    HDqsort(ins, nlinks, sizeof(H5G_dense_ins_t), H5G_dense_ins_cmp_name);
+
+    /* Open the fractal heap */
+    if(NULL == (fheap = H5HF_open(f, dxpl_id, linfo->fheap_addr)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open fractal heap")
+
+    /* Open the name index v2 B-tree */
+    if(NULL == (bt2_name = H5B2_open(f, dxpl_id, linfo->name_bt2_addr, NULL)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for name index")
+
+    /* Create the callback information for v2 B-tree record operations */
+    udata->common.f = f;
+    udata->common.dxpl_id = dxpl_id;
+    udata->common.fheap = fheap;
+    udata->common.found_op = NULL;
+    udata->common.found_op_data = NULL;
+
+    /* Check for names that are repeated in the batch or already in the group */
+    for(u = 0; u < nlinks; u++) {
+        if(u > 0 && H5G_dense_ins_cmp_name(&ins[u - 1], &ins[u]) == 0)
+            HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name appears more than once in link batch")
+        if(linfo->nlinks > 0) {
+            htri_t found;       /* Whether the name is already in the group */
+
+            udata->common.name = ins[u].lnk->name;
+            udata->common.name_hash = ins[u].name_hash;
+            if((found = H5B2_find(bt2_name, dxpl_id, udata, NULL, NULL)) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "unable to search name index")
+            if(found)
+                HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name already exists")
+        } /* end if */
+    } /* end for */
+
+    /* Wrap the local buffer for serialized links */
+    if(NULL == (wb = H5WB_wrap(link_buf, sizeof(link_buf))))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't wrap buffer")
+
+    /* Append the serialized links to the fractal heap */
+    for(u = 0; u < nlinks; u++) {
+        size_t link_size;               /* Size of serialized link in the heap */
+        void *link_ptr;                 /* Pointer to serialized link */
+
+        /* Find out the size of buffer needed for serialized link */
+        if((link_size = H5O_msg_raw_size(f, H5O_LINK_ID, FALSE, ins[u].lnk)) == 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+
+        /* Get a pointer to a buffer that's large enough for link */
+        if(NULL == (link_ptr = H5WB_actual(wb, link_size)))
+            HGOTO_ERROR(H5E_SYM, H5E_NOSPACE, FAIL, "can't get actual buffer")
+
+        /* Create serialized form of link */
+        if(H5O_msg_encode(f, H5O_LINK_ID, FALSE, (unsigned char *)link_ptr, ins[u].lnk) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTENCODE, FAIL, "can't encode link")
+
+        /* Insert the serialized link into the fractal heap */
+        if(H5HF_insert(fheap, dxpl_id, link_size, link_ptr, ins[u].id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into fractal heap")
+    } /* end for */
+
+    /* Insert the links into the 'name' tracking v2 B-tree, in hash order */
+    /* (an empty index is built directly from the sorted batch) */
+    bulk_udata.ins = ins;
+    if(linfo->nlinks == 0) {
+        if(H5B2_bulk_load(bt2_name, dxpl_id, (hsize_t)nlinks, 100, H5G_dense_bulk_cb, &bulk_udata) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to bulk-load records into v2 B-tree")
+    } /* end if */
+    else
+        for(u = 0; u < nlinks; u++) {
+            if(H5G_dense_bulk_cb((hsize_t)u, &bulk_udata) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't set up v2 B-tree record")
+            if(H5B2_insert(bt2_name, dxpl_id, udata) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+        } /* end for */
+
+    /* Check if we should create creation order index v2 B-tree records */
+    if(linfo->index_corder) {
+        /* Open the creation order index v2 B-tree */
+        HDassert(H5F_addr_defined(linfo->corder_bt2_addr));
+        if(NULL == (bt2_corder = H5B2_open(f, dxpl_id, linfo->corder_bt2_addr, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to open v2 B-tree for creation order index")
+
+        /* Insert the records in creation order */
+        HDqsort(ins, nlinks, sizeof(H5G_dense_ins_t), H5G_dense_ins_cmp_corder);
+        if(linfo->nlinks == 0) {
+            if(H5B2_bulk_load(bt2_corder, dxpl_id, (hsize_t)nlinks, 100, H5G_dense_bulk_cb, &bulk_udata) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to bulk-load records into v2 B-tree")
+        } /* end if */
+        else
+            for(u = 0; u < nlinks; u++) {
+                if(H5G_dense_bulk_cb((hsize_t)u, &bulk_udata) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't set up v2 B-tree record")
+                if(H5B2_insert(bt2_corder, dxpl_id, udata) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert record into v2 B-tree")
+            } /* end for */
+    } /* end if */
+
+done:
+    /* Release resources */
+    if(fheap && H5HF_close(fheap, dxpl_id) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close fractal heap")
+    if(bt2_name && H5B2_close(bt2_name, dxpl_id) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for name index")
+    if(bt2_corder && H5B2_close(bt2_corder, dxpl_id) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close v2 B-tree for creation order index")
+    if(wb && H5WB_unwrap(wb) < 0)
+        HDONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close wrapped buffer")
+    if(ins)
+        H5MM_xfree(ins);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G__dense_insert_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_dense_lookup_cb
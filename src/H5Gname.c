@@ -43,12 +43,22 @@
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5Lprivate.h"		/* Links                                */
 #include "H5MMprivate.h"	/* Memory wrappers			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
 
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Number of ID types with group hierarchy paths (groups, datasets & datatypes) */
+#define H5G_NAME_IDX_NTYPES     3
+
+/* Number of name replacements that must see the same IDs before a path
+ * index is built for them.  Building an index costs a few dozen visits of
+ * every open ID, so it is only worth it when the IDs stay open for a while.
+ */
+#define H5G_NAME_IDX_MIN_REPLACE 32
+
 
 /******************/
 /* Local Typedefs */
@@ -63,6 +73,29 @@ typedef struct H5G_names_t {
     H5RS_str_t  *dst_full_path_r;       /* Destination location's full path */
 } H5G_names_t;
 
+/* Open object filed in a path index */
+typedef struct H5G_name_idx_obj_t {
+    hid_t       obj_id;                 /* ID of the object */
+    const void  *obj_ptr;               /* Object the ID referred to when filed */
+    struct H5G_name_idx_path_t *path;   /* Path the object is filed under */
+    struct H5G_name_idx_obj_t *next;    /* Next object filed under the same path */
+} H5G_name_idx_obj_t;
+
+/* Full path in a path index, with the objects filed under it */
+typedef struct H5G_name_idx_path_t {
+    H5RS_str_t  *path_r;                /* Canonical full path (also the key) */
+    H5G_name_idx_obj_t *objs;           /* Objects filed under the path */
+} H5G_name_idx_path_t;
+
+/* Index of the open IDs of one type, by the full paths of their objects */
+typedef struct H5G_name_idx_t {
+    H5I_type_t  type;                   /* Type of the IDs indexed */
+    H5SL_t      *paths;                 /* Paths of the objects (NULL when not built) */
+    unsigned long nregistered;          /* # of IDs registered in the type when built */
+    unsigned long seen;                 /* # of IDs registered in the type at the last replacement */
+    unsigned    nseen;                  /* # of replacements in a row that saw 'seen' */
+} H5G_name_idx_t;
+
 /* Info to pass to the iteration function when building name */
 typedef struct H5G_gnba_iter_t {
     /* In */
@@ -91,6 +124,18 @@ static H5RS_str_t *H5G_build_fullpath_refstr_refstr(const H5RS_str_t *prefix_r,
 static herr_t H5G_name_move_path(H5RS_str_t **path_r_ptr,
     const char *full_suffix, const char *src_path, const char *dst_path);
 static int H5G_name_replace_cb(void *obj_ptr, hid_t obj_id, void *key);
+static H5RS_str_t *H5G_name_idx_key(H5RS_str_t *path_r);
+static int H5G_name_idx_cmp(const void *key1, const void *key2);
+static H5G_name_t *H5G_name_idx_obj_path(H5I_type_t type, void *obj_ptr);
+static herr_t H5G_name_idx_insert(H5G_name_idx_t *idx, hid_t obj_id,
+    const void *obj_ptr, H5RS_str_t *path_r);
+static void H5G_name_idx_unlink(H5G_name_idx_t *idx, H5G_name_idx_obj_t *obj);
+static herr_t H5G_name_idx_free_cb(void *item, void *key, void *op_data);
+static void H5G_name_idx_discard(H5G_name_idx_t *idx);
+static int H5G_name_idx_build_cb(void *obj_ptr, hid_t obj_id, void *key);
+static herr_t H5G_name_idx_build(H5G_name_idx_t *idx);
+static herr_t H5G_name_idx_replace(H5G_name_idx_t *idx, H5G_names_t *names);
+static herr_t H5G_name_replace_type(H5G_name_idx_t *idx, H5G_names_t *names);
 
 
 /*********************/
@@ -110,6 +155,25 @@ H5FL_BLK_EXTERN(str_buf);
 /* Local Variables */
 /*******************/
 
+/* Declare free lists to manage the path index nodes */
+H5FL_DEFINE_STATIC(H5G_name_idx_obj_t);
+H5FL_DEFINE_STATIC(H5G_name_idx_path_t);
+
+/*
+ * Path indices for the open group, dataset & named datatype IDs.  Moving or
+ * deleting a link only changes the names of the objects at or below the
+ * link's path, so once an index is built those objects are found with a
+ * range search instead of by visiting every open ID.  An index covers the
+ * IDs of its type that existed when it was built: it is rebuilt (once the
+ * IDs are stable across several name replacements) or bypassed after new
+ * IDs are registered, and objects whose IDs were closed are dropped from it
+ * as they are found.
+ */
+static H5G_name_idx_t H5G_name_idx_g[H5G_NAME_IDX_NTYPES] = {
+    {H5I_GROUP, NULL, 0, 0, 0},
+    {H5I_DATASET, NULL, 0, 0, 0},
+    {H5I_DATATYPE, NULL, 0, 0, 0}
+};
 
 
 /*-------------------------------------------------------------------------
@@ -1057,6 +1121,551 @@ done:
     FUNC_LEAVE_NOAPI(ret_value);
 } /* end H5G_name_replace_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_key
+ *
+ * Purpose:	Get the canonical form of a full path, which is what the path
+ *              indices are keyed on: absolute, without repeated or trailing
+ *              '/'s.  Paths with the same components (which are the ones
+ *              H5G_common_path treats as equal) have the same canonical form.
+ *
+ * Return:	Success:	New reference to the canonical path
+ *		Failure:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5RS_str_t *
+H5G_name_idx_key(H5RS_str_t *path_r)
+{
+    const char *path;                   /* Path to check */
+    const char *s;                      /* Position in path */
+    char *norm = NULL;                  /* Normalized path */
+    H5RS_str_t *ret_value;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(path_r);
+
+    /* Most paths are already canonical, share those */
+    path = H5RS_get_str(path_r);
+    if(*path == '/') {
+        for(s = path; *s; s++)
+            if(*s == '/' && (s[1] == '/' || (s[1] == '\0' && s != path)))
+                break;
+        if(*s == '\0')
+            HGOTO_DONE(H5RS_dup(path_r))
+    } /* end if */
+
+    /* Remove repeated and trailing '/'s */
+    if(NULL == (norm = H5G_normalize(path)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, NULL, "can't normalize path")
+
+    /* Make the path absolute */
+    if(*norm != '/') {
+        size_t norm_len = HDstrlen(norm);
+        char *abs_path;                 /* Absolute version of path */
+
+        if(NULL == (abs_path = (char *)H5MM_malloc(norm_len + 2)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+        abs_path[0] = '/';
+        HDstrncpy(abs_path + 1, norm, norm_len + 1);
+        H5MM_xfree(norm);
+        norm = abs_path;
+    } /* end if */
+
+    if(NULL == (ret_value = H5RS_dup_str(norm)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, NULL, "can't create path string")
+
+done:
+    H5MM_xfree(norm);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_idx_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_cmp
+ *
+ * Purpose:	Compare two keys of a path index.  The paths are kept in
+ *              lexical order (unlike H5SL_TYPE_STR skip lists, which order
+ *              them by hash), so the paths below a path sort together.
+ *
+ * Return:	<0, 0 or >0, as for strcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G_name_idx_cmp(const void *key1, const void *key2)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(HDstrcmp((const char *)key1, (const char *)key2))
+} /* end H5G_name_idx_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_obj_path
+ *
+ * Purpose:	Get the group hierarchy path of the object for an ID
+ *
+ * Return:	Success:	Pointer to the path
+ *		Failure:	NULL (also for datatypes that are not named)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5G_name_t *
+H5G_name_idx_obj_path(H5I_type_t type, void *obj_ptr)
+{
+    H5G_name_t *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(obj_ptr);
+
+    switch(type) {
+        case H5I_GROUP:
+            ret_value = H5G_nameof((H5G_t *)obj_ptr);
+            break;
+
+        case H5I_DATASET:
+            ret_value = H5D_nameof((H5D_t *)obj_ptr);
+            break;
+
+        case H5I_DATATYPE:
+            if(H5T_is_named((H5T_t *)obj_ptr))
+                ret_value = H5T_nameof((H5T_t *)obj_ptr);
+            break;
+
+        default:
+            HDassert(0 && "unexpected ID type");
+            break;
+    } /* end switch */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_idx_obj_path() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_insert
+ *
+ * Purpose:	File an open object in a path index, under PATH_R
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_name_idx_insert(H5G_name_idx_t *idx, hid_t obj_id, const void *obj_ptr,
+    H5RS_str_t *path_r)
+{
+    H5G_name_idx_path_t *path = NULL;   /* Path to file the object under */
+    H5G_name_idx_obj_t *obj;            /* Object's entry */
+    H5RS_str_t *key_r = NULL;           /* Canonical path */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(idx && idx->paths);
+    HDassert(obj_ptr);
+    HDassert(path_r);
+
+    /* Find the path, or add it */
+    if(NULL == (key_r = H5G_name_idx_key(path_r)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't get canonical path")
+    if(NULL == (path = (H5G_name_idx_path_t *)H5SL_search(idx->paths, H5RS_get_str(key_r)))) {
+        if(NULL == (path = H5FL_MALLOC(H5G_name_idx_path_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        path->path_r = key_r;
+        path->objs = NULL;
+        if(H5SL_insert(idx->paths, path, H5RS_get_str(path->path_r)) < 0) {
+            path = H5FL_FREE(H5G_name_idx_path_t, path);
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert path into index")
+        } /* end if */
+        key_r = NULL;
+    } /* end if */
+
+    /* File the object under the path */
+    if(NULL == (obj = H5FL_MALLOC(H5G_name_idx_obj_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    obj->obj_id = obj_id;
+    obj->obj_ptr = obj_ptr;
+    obj->path = path;
+    obj->next = path->objs;
+    path->objs = obj;
+
+done:
+    if(key_r)
+        H5RS_decr(key_r);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_idx_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_unlink
+ *
+ * Purpose:	Remove an object from a path index, along with its path
+ *              when no other object is filed under it.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G_name_idx_unlink(H5G_name_idx_t *idx, H5G_name_idx_obj_t *obj)
+{
+    H5G_name_idx_path_t *path;          /* Path the object is filed under */
+    H5G_name_idx_obj_t **obj_p;         /* Link to the object in the path's list */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(idx && idx->paths);
+    HDassert(obj);
+
+    path = obj->path;
+    for(obj_p = &path->objs; *obj_p != obj; obj_p = &(*obj_p)->next)
+        HDassert(*obj_p);
+    *obj_p = obj->next;
+    obj = H5FL_FREE(H5G_name_idx_obj_t, obj);
+
+    if(NULL == path->objs) {
+        H5SL_remove(idx->paths, H5RS_get_str(path->path_r));
+        H5RS_decr(path->path_r);
+        path = H5FL_FREE(H5G_name_idx_path_t, path);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G_name_idx_unlink() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_free_cb
+ *
+ * Purpose:	Free a path of a path index and the objects filed under it
+ *
+ * Return:	0 (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_name_idx_free_cb(void *item, void UNUSED *key, void UNUSED *op_data)
+{
+    H5G_name_idx_path_t *path = (H5G_name_idx_path_t *)item;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(path);
+
+    while(path->objs) {
+        H5G_name_idx_obj_t *next = path->objs->next;
+
+        path->objs = H5FL_FREE(H5G_name_idx_obj_t, path->objs);
+        path->objs = next;
+    } /* end while */
+    H5RS_decr(path->path_r);
+    path = H5FL_FREE(H5G_name_idx_path_t, path);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5G_name_idx_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_discard
+ *
+ * Purpose:	Release a path index, if it is built
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5G_name_idx_discard(H5G_name_idx_t *idx)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(idx);
+
+    if(idx->paths) {
+        H5SL_destroy(idx->paths, H5G_name_idx_free_cb, NULL);
+        idx->paths = NULL;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5G_name_idx_discard() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_build_cb
+ *
+ * Purpose:	H5I_iterate callback function to file an open object in a
+ *              path index
+ *
+ * Return:	Success: 0, Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5G_name_idx_build_cb(void *obj_ptr, hid_t obj_id, void *key)
+{
+    H5G_name_idx_t *idx = (H5G_name_idx_t *)key;        /* Index being built */
+    H5G_name_t *obj_path;       /* Pointer to group hier. path for obj */
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Objects without a full path are never renamed, leave them out */
+    if(NULL != (obj_path = H5G_name_idx_obj_path(idx->type, obj_ptr)) && obj_path->full_path_r)
+        if(H5G_name_idx_insert(idx, obj_id, obj_ptr, obj_path->full_path_r) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add object to path index")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_idx_build_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_build
+ *
+ * Purpose:	(Re)build a path index from the open IDs of its type
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_name_idx_build(H5G_name_idx_t *idx)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(idx);
+
+    H5G_name_idx_discard(idx);
+    if(NULL == (idx->paths = H5SL_create(H5SL_TYPE_GENERIC, H5G_name_idx_cmp)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create path index")
+    if(H5I_iterate(idx->type, H5G_name_idx_build_cb, idx, FALSE) < 0) {
+        H5G_name_idx_discard(idx);
+        HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't build path index")
+    } /* end if */
+    idx->nregistered = H5I_nregistered(idx->type);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_idx_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_idx_replace
+ *
+ * Purpose:	Replace names for a link move or delete, visiting only the
+ *              objects that a path index has at or below the source path.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_name_idx_replace(H5G_name_idx_t *idx, H5G_names_t *names)
+{
+    H5RS_str_t *src_key_r = NULL;       /* Canonical source path */
+    const char *src_key;                /* Canonical source path string */
+    size_t src_key_len;                 /* Length of canonical source path */
+    char *prefix = NULL;                /* Prefix of the paths below the source path */
+    H5G_name_idx_obj_t **objs = NULL;   /* Objects to visit */
+    size_t nobjs = 0;                   /* # of objects to visit */
+    size_t nalloc = 0;                  /* # of objects allocated in 'objs' */
+    H5G_name_idx_path_t *path;          /* Path in index */
+    H5SL_node_t *node;                  /* Node of path in index */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(idx && idx->paths);
+    HDassert(names->op == H5G_NAME_MOVE || names->op == H5G_NAME_DELETE);
+
+    if(NULL == (src_key_r = H5G_name_idx_key(names->src_full_path_r)))
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't get canonical path")
+    src_key = H5RS_get_str(src_key_r);
+    src_key_len = HDstrlen(src_key);
+    HDassert(src_key_len > 1);
+
+    /* Gather the objects at the source path, then the ones below it (whose
+     * paths start with the source path and a '/', so they sort together).
+     * They are all gathered before any is visited, since visiting an object
+     * may re-file it.
+     */
+    if(NULL == (prefix = (char *)H5MM_malloc(src_key_len + 2)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    HDstrncpy(prefix, src_key, src_key_len + 1);
+    prefix[src_key_len] = '/';
+    prefix[src_key_len + 1] = '\0';
+    path = (H5G_name_idx_path_t *)H5SL_search(idx->paths, src_key);
+    node = H5SL_above(idx->paths, prefix);
+    do {
+        H5G_name_idx_obj_t *obj;        /* Object filed under path */
+
+        for(obj = path ? path->objs : NULL; obj; obj = obj->next) {
+            if(nobjs == nalloc) {
+                size_t new_nalloc = MAX(16, 2 * nalloc);
+                H5G_name_idx_obj_t **new_objs;
+
+                if(NULL == (new_objs = (H5G_name_idx_obj_t **)H5MM_realloc(objs, new_nalloc * sizeof(H5G_name_idx_obj_t *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+                objs = new_objs;
+                nalloc = new_nalloc;
+            } /* end if */
+            objs[nobjs++] = obj;
+        } /* end for */
+
+        /* Advance to the next path below the source path */
+        path = NULL;
+        if(node) {
+            H5G_name_idx_path_t *next_path = (H5G_name_idx_path_t *)H5SL_item(node);
+
+            if(!HDstrncmp(H5RS_get_str(next_path->path_r), prefix, src_key_len + 1)) {
+                path = next_path;
+                node = H5SL_next(node);
+            } /* end if */
+        } /* end if */
+    } while(path);
+
+    /* Visit the objects, re-filing the ones whose path changed */
+    for(u = 0; u < nobjs; u++) {
+        H5G_name_idx_obj_t *obj = objs[u];
+        void *obj_ptr;                  /* Object for the ID now */
+        H5G_name_t *obj_path;           /* Object's group hier. path */
+
+        /* Drop objects whose IDs were closed since the index was built */
+        obj_ptr = H5I_object_verify(obj->obj_id, idx->type);
+        if(obj_ptr != obj->obj_ptr) {
+            H5G_name_idx_unlink(idx, obj);
+            continue;
+        } /* end if */
+
+        if(H5G_name_replace_cb(obj_ptr, obj->obj_id, names) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't replace name")
+
+        obj_path = H5G_name_idx_obj_path(idx->type, obj_ptr);
+        if(NULL == obj_path || NULL == obj_path->full_path_r)
+            H5G_name_idx_unlink(idx, obj);
+        else if(H5RS_cmp(obj_path->full_path_r, obj->path->path_r)) {
+            hid_t obj_id = obj->obj_id;
+
+            H5G_name_idx_unlink(idx, obj);
+            if(H5G_name_idx_insert(idx, obj_id, obj_ptr, obj_path->full_path_r) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't add object to path index")
+        } /* end if */
+    } /* end for */
+
+done:
+    /* An index that missed an update can't be used again */
+    if(ret_value < 0)
+        H5G_name_idx_discard(idx);
+    if(src_key_r)
+        H5RS_decr(src_key_r);
+    H5MM_xfree(prefix);
+    H5MM_xfree(objs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_idx_replace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_replace_type
+ *
+ * Purpose:	Replace names for one type of ID, through its path index when
+ *              the operation and the index allow it, or by visiting every
+ *              open ID of the type otherwise.
+ *
+ *              The index is only (re)built when no IDs of the type were
+ *              registered during the last H5G_NAME_IDX_MIN_REPLACE
+ *              replacements, so that opening an object before each link
+ *              change costs little more than it did without the index.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_name_replace_type(H5G_name_idx_t *idx, H5G_names_t *names)
+{
+    hbool_t use_idx = FALSE;            /* Whether to use the path index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(idx);
+    HDassert(names);
+
+    /* Only link moves and deletes are limited to the objects below the
+     * source path; mounts and unmounts also rename the child file's objects.
+     */
+    if((names->op == H5G_NAME_MOVE || names->op == H5G_NAME_DELETE)
+            && HDstrcmp(H5RS_get_str(names->src_full_path_r), "/")) {
+        unsigned long nregistered = H5I_nregistered(idx->type);
+
+        if(idx->nseen > 0 && idx->seen == nregistered)
+            idx->nseen++;
+        else {
+            idx->seen = nregistered;
+            idx->nseen = 1;
+        } /* end else */
+
+        if(idx->paths && idx->nregistered == nregistered)
+            use_idx = TRUE;
+        else if(idx->nseen >= H5G_NAME_IDX_MIN_REPLACE) {
+            if(H5G_name_idx_build(idx) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't build path index")
+            use_idx = TRUE;
+        } /* end if */
+    } /* end if */
+
+    if(use_idx) {
+        if(H5G_name_idx_replace(idx, names) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't replace names through path index")
+    } /* end if */
+    else {
+        /* Names may change anywhere, so the index goes stale */
+        H5G_name_idx_discard(idx);
+        if(H5I_iterate(idx->type, H5G_name_replace_cb, names, FALSE) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over IDs")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_name_replace_type() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_name_index_reset
+ *
+ * Purpose:	Drop the path indices of open objects.  This must be called
+ *              when an object that already has an ID gets a new path
+ *              without a link being moved or deleted (e.g. a datatype
+ *              being committed), and when the library shuts down.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_name_index_reset(void)
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    for(u = 0; u < H5G_NAME_IDX_NTYPES; u++) {
+        H5G_name_idx_discard(&H5G_name_idx_g[u]);
+        H5G_name_idx_g[u].nseen = 0;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5G_name_index_reset() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5G_name_replace
@@ -1179,17 +1788,17 @@ H5G_name_replace(const H5O_link_t *lnk, H5G_names_op_t op, H5F_t *src_file,
 
             /* Search through group IDs */
             if(search_group)
-                if(H5I_iterate(H5I_GROUP, H5G_name_replace_cb, &names, FALSE) < 0)
+                if(H5G_name_replace_type(&H5G_name_idx_g[0], &names) < 0)
 		    HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over groups")
 
             /* Search through dataset IDs */
             if(search_dataset)
-                if(H5I_iterate(H5I_DATASET, H5G_name_replace_cb, &names, FALSE) < 0)
+                if(H5G_name_replace_type(&H5G_name_idx_g[1], &names) < 0)
 		    HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over datasets")
 
             /* Search through datatype IDs */
             if(search_datatype)
-                if(H5I_iterate(H5I_DATATYPE, H5G_name_replace_cb, &names, FALSE) < 0)
+                if(H5G_name_replace_type(&H5G_name_idx_g[2], &names) < 0)
 		    HGOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over datatypes")
         } /* end if */
     } /* end if */
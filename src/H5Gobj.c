@@ -91,6 +91,8 @@ typedef struct {
 /********************/
 static herr_t H5G_obj_compact_to_dense_cb(const void *_mesg, unsigned idx,
     void *_udata);
+static herr_t H5G_obj_compact_to_dense(const H5O_loc_t *grp_oloc,
+    H5O_linfo_t *linfo, hid_t dxpl_id);
 static herr_t H5G_obj_remove_update_linfo(const H5O_loc_t *oloc, H5O_linfo_t *linfo,
     hid_t dxpl_id);
 
@@ -460,8 +462,6 @@ herr_t
 H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
     hbool_t adj_link, H5O_type_t obj_type, const void *crt_info, hid_t dxpl_id)
 {
-    H5O_pline_t tmp_pline;      /* Pipeline message */
-    H5O_pline_t *pline = NULL;  /* Pointer to pipeline message */
     H5O_linfo_t linfo;		/* Link info message */
     htri_t linfo_exists;        /* Whether the link info message exists */
     hbool_t use_old_format;     /* Whether to use 'old format' (symbol table) for insertions or not */
@@ -513,38 +513,10 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
         else if(linfo.nlinks < ginfo.max_compact && link_msg_size < H5O_MESG_MAX_SIZE)
             use_new_dense = FALSE;
         else {
-            htri_t              pline_exists;   /* Whether the pipeline message exists */
-            H5G_obj_oh_it_ud1_t	udata;          /* User data for iteration */
-            H5O_mesg_operator_t op;             /* Message operator */
-
-            /* Get the pipeline message, if it exists */
-            if((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID, dxpl_id)) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
-            if(pline_exists) {
-                if(NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline, dxpl_id))
-                    HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
-                pline = &tmp_pline;
-            } /* end if */
-
             /* The group doesn't currently have "dense" storage for links */
-            if(H5G__dense_create(grp_oloc->file, dxpl_id, &linfo, pline) < 0)
+            if(H5G_obj_compact_to_dense(grp_oloc, &linfo, dxpl_id) < 0)
                 HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
 
-            /* Set up user data for object header message iteration */
-            udata.f = grp_oloc->file;
-            udata.dxpl_id = dxpl_id;
-            udata.linfo = &linfo;
-
-            /* Iterate over the 'link' messages, inserting them into the dense link storage  */
-            op.op_type = H5O_MESG_OP_APP;
-            op.u.app_op = H5G_obj_compact_to_dense_cb;
-            if(H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata, dxpl_id) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
-
-            /* Remove all the 'link' messages */
-            if(H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE, dxpl_id) < 0)
-                HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
-
             use_new_dense = TRUE;
         } /* end else */
     } /* end if */
@@ -633,13 +605,233 @@ H5G_obj_insert(const H5O_loc_t *grp_oloc, const char *name, H5O_link_t *obj_lnk,
             HGOTO_ERROR(H5E_SYM, H5E_LINKCOUNT, FAIL, "unable to increment hard link count")
     } /* end if */
 
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_obj_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_obj_compact_to_dense
+ *
+ * Purpose:	Convert a "new format" group from storing its links in
+ *              link messages to "dense" link storage.  LINFO is updated
+ *              with the addresses of the new dense storage, but is not
+ *              written back to the object header.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_obj_compact_to_dense(const H5O_loc_t *grp_oloc, H5O_linfo_t *linfo,
+    hid_t dxpl_id)
+{
+    H5O_pline_t tmp_pline;              /* Pipeline message */
+    H5O_pline_t *pline = NULL;          /* Pointer to pipeline message */
+    htri_t pline_exists;                /* Whether the pipeline message exists */
+    H5G_obj_oh_it_ud1_t	udata;          /* User data for iteration */
+    H5O_mesg_operator_t op;             /* Message operator */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(linfo);
+
+    /* Get the pipeline message, if it exists */
+    if((pline_exists = H5O_msg_exists(grp_oloc, H5O_PLINE_ID, dxpl_id)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "unable to read object header")
+    if(pline_exists) {
+        if(NULL == H5O_msg_read(grp_oloc, H5O_PLINE_ID, &tmp_pline, dxpl_id))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get link pipeline")
+        pline = &tmp_pline;
+    } /* end if */
+
+    /* Create the "dense" storage for links */
+    if(H5G__dense_create(grp_oloc->file, dxpl_id, linfo, pline) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+    /* Set up user data for object header message iteration */
+    udata.f = grp_oloc->file;
+    udata.dxpl_id = dxpl_id;
+    udata.linfo = linfo;
+
+    /* Iterate over the 'link' messages, inserting them into the dense link storage  */
+    op.op_type = H5O_MESG_OP_APP;
+    op.u.app_op = H5G_obj_compact_to_dense_cb;
+    if(H5O_msg_iterate(grp_oloc, H5O_LINK_ID, &op, &udata, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "error iterating over links")
+
+    /* Remove all the 'link' messages */
+    if(H5O_msg_remove(grp_oloc, H5O_LINK_ID, H5O_ALL, FALSE, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTDELETE, FAIL, "unable to delete link messages")
+
 done:
     /* Free any space used by the pipeline message */
     if(pline && H5O_msg_reset(H5O_PLINE_ID, pline) < 0)
         HDONE_ERROR(H5E_SYM, H5E_CANTFREE, FAIL, "can't release pipeline")
 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5G_obj_insert() */
+} /* end H5G_obj_compact_to_dense() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_obj_insert_many
+ *
+ * Purpose:	Insert a batch of NLINKS new links, LNKS, into the group
+ *              described by GRP_OLOC and increment the reference count of
+ *              the object each hard link points to.
+ *
+ *              For "new format" groups the link info and group info
+ *              messages are read once, the group is converted to "dense"
+ *              storage at most once, and the link info message is written
+ *              once for the whole batch.  "Old format" groups insert the
+ *              links one at a time.
+ *
+ *              The names are checked for duplicates within the batch and
+ *              against the group before anything is modified.  The
+ *              creation order fields of LNKS are set and the array is
+ *              reordered on return.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_obj_insert_many(const H5O_loc_t *grp_oloc, size_t nlinks, H5O_link_t *lnks,
+    hid_t dxpl_id)
+{
+    H5O_linfo_t linfo;		/* Link info message */
+    htri_t linfo_exists;        /* Whether the link info message exists */
+    hbool_t use_new_dense = FALSE;      /* Whether to use "dense" form of 'new format' group */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* check arguments */
+    HDassert(grp_oloc && grp_oloc->file);
+    HDassert(nlinks == 0 || lnks);
+
+    /* Quick exit for empty batch */
+    if(nlinks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* Check if we have information about the number of objects in this group */
+    if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo, dxpl_id)) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
+    if(linfo_exists) {
+        H5O_ginfo_t ginfo;	/* Group info message */
+
+        /* Get the group info */
+        if(NULL == H5O_msg_read(grp_oloc, H5O_GINFO_ID, &ginfo, dxpl_id))
+            HGOTO_ERROR(H5E_SYM, H5E_BADMESG, FAIL, "can't get group info")
+
+        /* Set the creation order for the new links (in the order given) &
+         *  indicate that it's valid */
+        if(linfo.track_corder)
+            for(u = 0; u < nlinks; u++) {
+                lnks[u].corder = linfo.max_corder++;
+                lnks[u].corder_valid = TRUE;
+            } /* end for */
+
+        /* Decide on the storage for the group after insertion */
+        if(H5F_addr_defined(linfo.fheap_addr) || linfo.nlinks + nlinks > ginfo.max_compact)
+            use_new_dense = TRUE;
+        else
+            for(u = 0; u < nlinks; u++) {
+                size_t link_msg_size;   /* Size of new link message in the file */
+
+                if((link_msg_size = H5O_msg_raw_size(grp_oloc->file, H5O_LINK_ID, FALSE, &lnks[u])) == 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTGETSIZE, FAIL, "can't get link size")
+                if(link_msg_size >= H5O_MESG_MAX_SIZE) {
+                    use_new_dense = TRUE;
+                    break;
+                } /* end if */
+            } /* end for */
+    } /* end if */
+
+    /* Check the names, unless the group already uses dense storage (whose
+     *  insertion checks them against the 'name' index before changing
+     *  anything).  A group that needs converting is checked here, so that
+     *  a rejected batch leaves its link messages alone.
+     */
+    if(!use_new_dense || !H5F_addr_defined(linfo.fheap_addr)) {
+        H5G_link_table_t ltable;        /* Batch of links, sorted by name */
+
+        /* Sort the batch by name & check for repeated names */
+        ltable.nlinks = nlinks;
+        ltable.lnks = lnks;
+        if(H5G__link_sort_table(&ltable, H5_INDEX_NAME, H5_ITER_INC) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSORT, FAIL, "error sorting link batch")
+        for(u = 1; u < nlinks; u++)
+            if(HDstrcmp(lnks[u - 1].name, lnks[u].name) == 0)
+                HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name appears more than once in link batch")
+
+        /* Check for names already in the group */
+        for(u = 0; u < nlinks; u++) {
+            H5O_link_t tmp_lnk;         /* Existing link with same name */
+            htri_t found;               /* Whether the name exists */
+
+            if((found = H5G__obj_lookup(grp_oloc, lnks[u].name, &tmp_lnk, dxpl_id)) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "can't check for existing link")
+            if(found) {
+                H5O_msg_reset(H5O_LINK_ID, &tmp_lnk);
+                HGOTO_ERROR(H5E_SYM, H5E_EXISTS, FAIL, "name already exists")
+            } /* end if */
+        } /* end for */
+    } /* end if */
+
+    if(linfo_exists) {
+        if(use_new_dense) {
+            /* Convert the group to dense storage, if it isn't already */
+            if(!H5F_addr_defined(linfo.fheap_addr))
+                if(H5G_obj_compact_to_dense(grp_oloc, &linfo, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "unable to create 'dense' form of new format group")
+
+            /* Insert into dense link storage */
+            if(H5G__dense_insert_many(grp_oloc->file, dxpl_id, &linfo, nlinks, lnks) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert links into dense storage")
+        } /* end if */
+        else {
+            /* Insert with link messages */
+            for(u = 0; u < nlinks; u++)
+                if(H5G__compact_insert(grp_oloc, &lnks[u], dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link as link message")
+        } /* end else */
+
+        /* Increment the number of objects in this group */
+        linfo.nlinks += nlinks;
+        if(H5O_msg_write(grp_oloc, H5O_LINFO_ID, 0, H5O_UPDATE_TIME, &linfo, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't update link info message")
+    } /* end if */
+    else {
+        /* Insert into the "old format" group one link at a time, which also
+         *  converts the group to the "new format" if a link requires it */
+        for(u = 0; u < nlinks; u++)
+            if(H5G_obj_insert(grp_oloc, lnks[u].name, &lnks[u], FALSE, H5O_TYPE_UNKNOWN, NULL, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "unable to insert link into group")
+    } /* end else */
+
+    /* Increment link count on objects for hard links */
+    for(u = 0; u < nlinks; u++)
+        if(lnks[u].type == H5L_TYPE_HARD) {
+            H5O_loc_t obj_oloc;             /* Object location */
+
+            /* Create temporary object location */
+            H5O_loc_reset(&obj_oloc);
+            obj_oloc.file = grp_oloc->file;
+            obj_oloc.addr = lnks[u].u.hard.addr;
+
+            /* Increment reference count for object */
+            if(H5O_link(&obj_oloc, 1, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_LINKCOUNT, FAIL, "unable to increment hard link count")
+        } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_obj_insert_many() */
 
 
 /*-------------------------------------------------------------------------
@@ -992,6 +1184,10 @@ H5G_obj_remove(const H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r, const char *n
     HDassert(oloc);
     HDassert(name && *name);
 
+    /* Drop cached paths, some may go through this link */
+    if(H5G_traverse_cache_reset(oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't reset path cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(oloc, &linfo, dxpl_id)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -1057,6 +1253,10 @@ H5G_obj_remove_by_idx(const H5O_loc_t *grp_oloc, H5RS_str_t *grp_full_path_r,
     /* Sanity check */
     HDassert(grp_oloc && grp_oloc->file);
 
+    /* Drop cached paths, some may go through this link */
+    if(H5G_traverse_cache_reset(grp_oloc->file) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't reset path cache")
+
     /* Attempt to get the link info for this group */
     if((linfo_exists = H5G__obj_get_linfo(grp_oloc, &linfo, dxpl_id)) < 0)
         HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't check for link info message")
@@ -470,6 +470,8 @@ H5_DLL herr_t H5G__dense_create(H5F_t *f, hid_t dxpl_id, H5O_linfo_t *linfo,
     const H5O_pline_t *pline);
 H5_DLL herr_t H5G__dense_insert(H5F_t *f, hid_t dxpl_id,
     const H5O_linfo_t *linfo, const H5O_link_t *lnk);
+H5_DLL herr_t H5G__dense_insert_many(H5F_t *f, hid_t dxpl_id,
+    const H5O_linfo_t *linfo, size_t nlinks, const H5O_link_t *lnks);
 H5_DLL htri_t H5G__dense_lookup(H5F_t *f, hid_t dxpl_id,
     const H5O_linfo_t *linfo, const char *name, H5O_link_t *lnk);
 H5_DLL herr_t H5G__dense_lookup_by_idx(H5F_t *f, hid_t dxpl_id,
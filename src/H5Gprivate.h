@@ -217,6 +217,7 @@ H5_DLL char *H5G_normalize(const char *name);
 H5_DLL herr_t H5G_traverse(const H5G_loc_t *loc, const char *name,
     unsigned target, H5G_traverse_t op, void *op_data, hid_t lapl_id,
     hid_t dxpl_id);
+H5_DLL herr_t H5G_traverse_cache_reset(H5F_t *f);
 H5_DLL herr_t H5G_iterate(hid_t loc_id, const char *group_name,
     H5_index_t idx_type, H5_iter_order_t order, hsize_t skip, hsize_t *last_lnk,
     const H5G_link_iterate_t *lnk_op, void *op_data, hid_t lapl_id, hid_t dxpl_id);
@@ -235,6 +236,8 @@ H5_DLL herr_t H5G_link_to_info(const struct H5O_link_t *lnk, H5L_info_t *linfo);
 H5_DLL herr_t H5G_obj_insert(const struct H5O_loc_t *grp_oloc, const char *name,
     struct H5O_link_t *obj_lnk, hbool_t adj_link, H5O_type_t obj_type,
     const void *crt_info, hid_t dxpl_id);
+H5_DLL herr_t H5G_obj_insert_many(const struct H5O_loc_t *grp_oloc, size_t nlinks,
+    struct H5O_link_t *lnks, hid_t dxpl_id);
 H5_DLL ssize_t H5G_obj_get_name_by_idx(const struct H5O_loc_t *oloc, H5_index_t idx_type,
     H5_iter_order_t order, hsize_t n, char* name, size_t size, hid_t dxpl_id);
 H5_DLL herr_t H5G_obj_remove(const struct H5O_loc_t *oloc, H5RS_str_t *grp_full_path_r,
@@ -265,6 +268,7 @@ H5_DLL herr_t H5G_name_set(const H5G_name_t *loc, H5G_name_t *obj, const char *n
 H5_DLL herr_t H5G_name_replace(const struct H5O_link_t *lnk, H5G_names_op_t op,
     H5F_t *src_file, H5RS_str_t *src_full_path_r, H5F_t *dst_file,
     H5RS_str_t *dst_full_path_r, hid_t dxpl_id);
+H5_DLL herr_t H5G_name_index_reset(void);
 H5_DLL herr_t H5G_name_reset(H5G_name_t *name);
 H5_DLL herr_t H5G_name_copy(H5G_name_t *dst, const H5G_name_t *src, H5_copy_depth_t depth);
 H5_DLL herr_t H5G_name_free(H5G_name_t *name);
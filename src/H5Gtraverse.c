@@ -38,12 +38,14 @@
 #include "H5Dprivate.h"         /* Datasets                             */
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"		/* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Gpkg.h"		/* Groups		  		*/
 #include "H5HLprivate.h"	/* Local Heaps				*/
 #include "H5Iprivate.h"		/* IDs					*/
 #include "H5Lprivate.h"		/* Links				*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Ppublic.h"		/* Property Lists			*/
+#include "H5SLprivate.h"	/* Skip lists				*/
 #include "H5WBprivate.h"        /* Wrapped Buffers                      */
 
 
@@ -51,6 +53,9 @@
 /* Local Macros */
 /****************/
 
+/* Maximum number of paths held in a file's path cache */
+#define H5G_TRAVERSE_CACHE_MAX_NENTS    8192
+
 
 /******************/
 /* Local Typedefs */
@@ -66,6 +71,20 @@ typedef struct {
     hbool_t exists;             /* Indicate if object exists */
 } H5G_trav_slink_t;
 
+/* Entry in a file's path cache: a path from the root group made only of hard
+ * links, which is enough to rebuild what the traversal hands to its operator
+ * for the last component of the path.
+ */
+typedef struct H5G_trav_cache_ent_t {
+    H5RS_str_t *path_r;         /* Full path of the object (the key is past its leading '/') */
+    H5RS_str_t *grp_path_r;     /* Full path of the group holding the last link */
+    haddr_t grp_addr;           /* Address of the group holding the last link */
+    haddr_t obj_addr;           /* Address the last link points to */
+    int64_t corder;             /* Creation order of the last link */
+    hbool_t corder_valid;       /* Whether the creation order is valid */
+    H5T_cset_t cset;            /* Character set of the last link's name */
+} H5G_trav_cache_ent_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -84,6 +103,13 @@ static herr_t H5G_traverse_ud(const H5G_loc_t *grp_loc, const H5O_link_t *lnk,
 static herr_t H5G_traverse_slink(const H5G_loc_t *grp_loc, const H5O_link_t *lnk,
     H5G_loc_t *obj_loc/*in,out*/, unsigned target, size_t *nlinks/*in,out*/,
     hbool_t *obj_exists, hid_t lapl_id, hid_t dxpl_id);
+static const char *H5G_traverse_cache_key(const H5G_loc_t *loc,
+    const char *name, H5F_t **top_file);
+static htri_t H5G_traverse_cache_find(H5F_t *top_file, const char *key,
+    H5G_loc_t *grp_loc, H5O_link_t *lnk, H5G_loc_t *obj_loc);
+static herr_t H5G_traverse_cache_insert(const H5G_loc_t *grp_loc,
+    const H5O_link_t *lnk, const H5G_loc_t *obj_loc);
+static herr_t H5G_traverse_cache_free_cb(void *item, void *key, void *op_data);
 static herr_t H5G_traverse_real(const H5G_loc_t *loc, const char *name,
     unsigned target, size_t *nlinks, H5G_traverse_t op, void *op_data,
     hid_t lapl_id, hid_t dxpl_id);
@@ -103,6 +129,8 @@ static herr_t H5G_traverse_real(const H5G_loc_t *loc, const char *name,
 /* Local Variables */
 /*******************/
 
+/* Declare a free list to manage the H5G_trav_cache_ent_t struct */
+H5FL_DEFINE_STATIC(H5G_trav_cache_ent_t);
 
 
 /*-------------------------------------------------------------------------
@@ -462,6 +490,268 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5G__traverse_special() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_traverse_cache_key
+ *
+ * Purpose:	Check whether a path traversal can go through the path cache
+ *              of the file: the path must start at the file's root group
+ *              and already be in the form the traversal builds object
+ *              paths in (no empty or '.' components).
+ *
+ * Return:	Success:	Key to look the path up with (the name
+ *                              without its leading '/'), with the file
+ *                              holding the root group in TOP_FILE.
+ *
+ *		Failure:	NULL if the path can't be cached.
+ *
+ *-------------------------------------------------------------------------
+ */
+static const char *
+H5G_traverse_cache_key(const H5G_loc_t *loc, const char *name, H5F_t **top_file)
+{
+    H5G_t *root_grp;                    /* Root group of the file */
+    const char *s;                      /* Temporary string pointer */
+    const char *ret_value = NULL;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(loc);
+    HDassert(name);
+    HDassert(top_file);
+
+    /* Relative names only start at the root group when given the root
+     * group's own location (as for a file ID)
+     */
+    if('/' == *name) {
+        root_grp = H5G_rootof(loc->oloc->file);
+        name++;
+    } /* end if */
+    else {
+        if(NULL == loc->path->full_path_r || HDstrcmp(H5RS_get_str(loc->path->full_path_r), "/"))
+            HGOTO_DONE(NULL)
+        root_grp = H5G_rootof(loc->oloc->file);
+        if(loc->oloc != &root_grp->oloc)
+            HGOTO_DONE(NULL)
+    } /* end else */
+
+    /* Object paths are only built from the root group's name when it's "/" */
+    if(NULL == root_grp->path.full_path_r || NULL == root_grp->path.user_path_r
+            || root_grp->path.obj_hidden
+            || HDstrcmp(H5RS_get_str(root_grp->path.full_path_r), "/")
+            || HDstrcmp(H5RS_get_str(root_grp->path.user_path_r), "/"))
+        HGOTO_DONE(NULL)
+
+    /* Reject empty components (repeated or trailing '/') and '.' */
+    s = name;
+    do {
+        if('\0' == *s || '/' == *s || ('.' == s[0] && ('\0' == s[1] || '/' == s[1])))
+            HGOTO_DONE(NULL)
+        while(*s && '/' != *s)
+            s++;
+    } while(*s++);
+
+    *top_file = root_grp->oloc.file;
+    ret_value = name;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_traverse_cache_key() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_traverse_cache_find
+ *
+ * Purpose:	Look a path up in the path cache of the file and, if it's
+ *              there, build the locations of the group holding its last
+ *              link and of the object, as well as the link itself.  The
+ *              link's name points into KEY.
+ *
+ * Return:	Success:	TRUE if the path was found, FALSE if not
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5G_traverse_cache_find(H5F_t *top_file, const char *key, H5G_loc_t *grp_loc,
+    H5O_link_t *lnk, H5G_loc_t *obj_loc)
+{
+    H5SL_t *cache;                      /* The file's path cache */
+    H5G_trav_cache_ent_t *ent;          /* Cache entry for the path */
+    const char *s;                      /* Last component of the path */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(top_file);
+    HDassert(key);
+
+    /* Look up the path */
+    if(NULL == (cache = H5F_GRP_PATH_CACHE(top_file)))
+        HGOTO_DONE(FALSE)
+    if(NULL == (ent = (H5G_trav_cache_ent_t *)H5SL_search(cache, key)))
+        HGOTO_DONE(FALSE)
+
+    /* Build the locations, sharing the paths held by the entry */
+    if(H5G_loc_reset(grp_loc) < 0 || H5G_loc_reset(obj_loc) < 0)
+        HGOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "unable to reset location")
+    grp_loc->oloc->file = top_file;
+    grp_loc->oloc->addr = ent->grp_addr;
+    grp_loc->path->full_path_r = H5RS_dup(ent->grp_path_r);
+    grp_loc->path->user_path_r = H5RS_dup(ent->grp_path_r);
+    obj_loc->oloc->file = top_file;
+    obj_loc->oloc->addr = ent->obj_addr;
+    obj_loc->path->full_path_r = H5RS_dup(ent->path_r);
+    obj_loc->path->user_path_r = H5RS_dup(ent->path_r);
+
+    /* Build the link */
+    if(NULL != (s = HDstrrchr(key, '/')))
+        key = s + 1;
+    lnk->type = H5L_TYPE_HARD;
+    lnk->corder_valid = ent->corder_valid;
+    lnk->corder = ent->corder;
+    lnk->cset = ent->cset;
+    lnk->name = (char *)key;    /* (Casting away const OK) */
+    lnk->u.hard.addr = ent->obj_addr;
+
+    ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_traverse_cache_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_traverse_cache_insert
+ *
+ * Purpose:	Add a hard link found while traversing a path from the root
+ *              group to the path cache of the file.  The cache is emptied
+ *              when it's full.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_traverse_cache_insert(const H5G_loc_t *grp_loc, const H5O_link_t *lnk,
+    const H5G_loc_t *obj_loc)
+{
+    H5F_t *f = grp_loc->oloc->file;     /* File holding the link */
+    H5SL_t *cache;                      /* The file's path cache */
+    H5G_trav_cache_ent_t *ent = NULL;   /* New cache entry */
+    const char *key;                    /* Key for the path */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(lnk->type == H5L_TYPE_HARD);
+    HDassert(obj_loc->oloc->file == f);
+
+    /* Only paths with names can be looked up */
+    if(NULL == grp_loc->path->full_path_r || NULL == grp_loc->path->user_path_r
+            || NULL == obj_loc->path->full_path_r || NULL == obj_loc->path->user_path_r)
+        HGOTO_DONE(SUCCEED)
+    key = H5RS_get_str(obj_loc->path->full_path_r);
+    HDassert('/' == *key);
+    key++;
+
+    /* Get the cache, creating it or making room in it as needed */
+    if(NULL == (cache = H5F_GRP_PATH_CACHE(f))) {
+        if(NULL == (cache = H5SL_create(H5SL_TYPE_STR, NULL)))
+            HGOTO_ERROR(H5E_SYM, H5E_CANTCREATE, FAIL, "can't create path cache")
+        if(H5F_SET_GRP_PATH_CACHE(f, cache) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't set path cache")
+    } /* end if */
+    else if(H5SL_search(cache, key))
+        HGOTO_DONE(SUCCEED)
+    else if(H5SL_count(cache) >= H5G_TRAVERSE_CACHE_MAX_NENTS)
+        if(H5SL_free(cache, H5G_traverse_cache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't empty path cache")
+
+    /* Add the entry */
+    if(NULL == (ent = H5FL_MALLOC(H5G_trav_cache_ent_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    ent->path_r = H5RS_dup(obj_loc->path->full_path_r);
+    ent->grp_path_r = H5RS_dup(grp_loc->path->full_path_r);
+    ent->grp_addr = grp_loc->oloc->addr;
+    ent->obj_addr = lnk->u.hard.addr;
+    ent->corder = lnk->corder;
+    ent->corder_valid = lnk->corder_valid;
+    ent->cset = lnk->cset;
+    if(H5SL_insert(cache, ent, key) < 0) {
+        H5G_traverse_cache_free_cb(ent, NULL, NULL);
+        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't insert path into cache")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_traverse_cache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_traverse_cache_free_cb
+ *
+ * Purpose:	Release an entry of a path cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5G_traverse_cache_free_cb(void *item, void UNUSED *key, void UNUSED *op_data)
+{
+    H5G_trav_cache_ent_t *ent = (H5G_trav_cache_ent_t *)item;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(ent);
+
+    H5RS_decr(ent->path_r);
+    H5RS_decr(ent->grp_path_r);
+    ent = H5FL_FREE(H5G_trav_cache_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(0)
+} /* end H5G_traverse_cache_free_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5G_traverse_cache_reset
+ *
+ * Purpose:	Drop every path in the path cache of a file.  This is done
+ *              whenever a link is removed from the file or a file is
+ *              mounted on or unmounted from it, and when the file closes.
+ *              Adding a link can't change what a cached path resolves to,
+ *              so it leaves the cache alone.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5G_traverse_cache_reset(H5F_t *f)
+{
+    H5SL_t *cache;                      /* The file's path cache */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(f);
+
+    if(NULL != (cache = H5F_GRP_PATH_CACHE(f))) {
+        if(H5F_SET_GRP_PATH_CACHE(f, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTSET, FAIL, "can't reset path cache")
+        if(H5SL_destroy(cache, H5G_traverse_cache_free_cb, NULL) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "can't release path cache")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5G_traverse_cache_reset() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5G_traverse_real
@@ -500,6 +790,8 @@ H5G_traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     char                *comp;          /* Pointer to buffer for path components */
     H5WB_t              *wb = NULL;     /* Wrapped buffer for temporary buffer */
     hbool_t last_comp = FALSE;          /* Flag to indicate that a component is the last component in the name */
+    const char          *cache_key;     /* Key for the name in the path cache */
+    H5F_t               *top_file = NULL; /* File holding the root group */
     herr_t              ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -537,6 +829,30 @@ H5G_traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
     obj_loc.oloc = &obj_oloc;
     obj_loc.path = &obj_path;
 
+    /* Check for the name in the file's path cache */
+    if(NULL != (cache_key = H5G_traverse_cache_key(_loc, name, &top_file))) {
+        htri_t found;                   /* Whether the name is cached */
+
+        if((found = H5G_traverse_cache_find(top_file, cache_key, &grp_loc, &lnk, &obj_loc)) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't look up path cache")
+        if(found) {
+            hbool_t obj_exists = TRUE;  /* Whether the object exists */
+
+            group_copy = TRUE;
+            obj_loc_valid = TRUE;
+
+            /* Only mount points need handling for a hard link */
+            if(H5G__traverse_special(&grp_loc, &lnk, target, nlinks, TRUE, &obj_loc, &obj_exists, lapl_id, dxpl_id) < 0)
+                HGOTO_ERROR(H5E_LINK, H5E_TRAVERSE, FAIL, "special link traversal failed")
+
+            /* Call 'operator' routine */
+            if((op)(&grp_loc, lnk.name, &lnk, (obj_exists ? &obj_loc : NULL), op_data, &own_loc) < 0)
+                HGOTO_ERROR(H5E_SYM, H5E_CALLBACK, FAIL, "traversal operator failed")
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
 #if defined(H5_USING_MEMCHECKER) || !defined(NDEBUG)
     /* Clear group location */
     if(H5G_loc_reset(&grp_loc) < 0)
@@ -615,6 +931,20 @@ H5G_traverse_real(const H5G_loc_t *_loc, const char *name, unsigned target,
             /* (soft links, user-defined links, file mounting, etc.) */
             if(H5G__traverse_special(&grp_loc, &lnk, target, nlinks, last_comp, &obj_loc, &obj_exists, lapl_id, dxpl_id) < 0)
                 HGOTO_ERROR(H5E_LINK, H5E_TRAVERSE, FAIL, "special link traversal failed")
+
+            /* Cache the path while it's made of hard links within the
+             * file holding the root group
+             */
+            if(cache_key) {
+                if(H5L_TYPE_HARD == lnk.type && grp_loc.oloc->file == top_file
+                        && obj_loc.oloc->file == top_file
+                        && !obj_loc.oloc->holding_file) {
+                    if(H5G_traverse_cache_insert(&grp_loc, &lnk, &obj_loc) < 0)
+                        HGOTO_ERROR(H5E_SYM, H5E_CANTINSERT, FAIL, "can't cache path")
+                } /* end if */
+                else
+                    cache_key = NULL;
+            } /* end if */
         } /* end if */
 
         /* Check for last component in name provided */
@@ -67,23 +67,47 @@
 #define MAX_FREE_ID_STRUCTS 1000
 
 /*
- * Define the following macro for fast hash calculations (but limited
- * hash sizes)
+ * In threadsafe builds the ID tables have their own lock, as threads which
+ * are reading raw data without the API lock (see H5F_block_readv) still use
+ * IDs: pushing an error takes references on its class and messages.  All
+ * functions which look IDs up, change reference counts or change the tables
+ * take it.  The tables' layout is only changed by threads which also hold
+ * the API lock, so the lock is released around the callbacks to other
+ * interfaces, which can block on other threads (e.g. closing a file waits
+ * for the reads from it).
  */
-#define HASH_SIZE_POWER_2
+#ifdef H5_HAVE_THREADSAFE
+#define H5I_LOCK(locked)                                                      \
+    {                                                                         \
+        H5TS_mutex_lock(&H5_g.ids_lock);                                      \
+        (locked) = TRUE;                                                      \
+    }
+#define H5I_UNLOCK(locked)                                                    \
+    if(locked)                                                                \
+        H5TS_mutex_unlock(&H5_g.ids_lock);
+#define H5I_RELEASE(lock_count)                                               \
+    H5TS_mutex_release(&H5_g.ids_lock, &(lock_count));
+#define H5I_REACQUIRE(lock_count)                                             \
+    H5TS_mutex_reacquire(&H5_g.ids_lock, (lock_count));
+#else /* H5_HAVE_THREADSAFE */
+#define H5I_LOCK(locked)
+#define H5I_UNLOCK(locked) (void)(locked);
+#define H5I_RELEASE(lock_count) (lock_count) = 0;
+#define H5I_REACQUIRE(lock_count) (void)(lock_count);
+#endif /* H5_HAVE_THREADSAFE */
 
-#ifdef HASH_SIZE_POWER_2
-/*
- * Map an ID to a hash location (assumes s is a power of 2 and smaller
- * than the ID_MASK constant).
- */
-#  define H5I_LOC(a,s)		((hid_t)((size_t)(a)&((s)-1)))
-#else
 /*
- * Map an ID to a hash location.
+ * The IDs of a type are kept in a two-level table, indexed directly by the
+ * ID's index bits: the high bits select a segment and the low H5I_SEG_BITS
+ * bits select the slot within it.  Segments are allocated when the first ID
+ * in their range is registered and released when their last ID is removed.
  */
-#  define H5I_LOC(a,s)	(((hid_t)(a)&ID_MASK)%(s))
-#endif
+#define H5I_SEG_BITS    8
+#define H5I_SEG_SIZE    ((unsigned)1 << H5I_SEG_BITS)
+#define H5I_SEG_MASK    (H5I_SEG_SIZE - 1)
+
+/* Map an ID to its index within its type */
+#define H5I_INDEX(a)    ((unsigned)((hid_t)(a) & ID_MASK))
 
 /* Combine a Type number and an atom index into an atom */
 #define H5I_MAKE(g,i)	((((hid_t)(g)&TYPE_MASK)<<ID_BITS)|	  \
@@ -97,9 +121,15 @@ typedef struct H5I_id_info_t {
     unsigned	count;		/* ref. count for this atom		    */
     unsigned    app_count;      /* ref. count of application visible atoms  */
     const void	*obj_ptr;	/* pointer associated with the atom	    */
-    struct H5I_id_info_t *next;	/* link to next atom (in case of hash-clash)*/
+    struct H5I_id_info_t *next;	/* link to next atom (in free list)	    */
 } H5I_id_info_t;
 
+/* Segment of an ID type's table */
+typedef struct H5I_id_seg_t {
+    unsigned    nused;          /* # of slots in use                        */
+    H5I_id_info_t *slot[H5I_SEG_SIZE]; /* IDs, by the low bits of their index */
+} H5I_id_seg_t;
+
 /* ID type structure used */
 typedef struct {
     const H5I_class_t *cls;     /* Pointer to ID class                      */
@@ -108,9 +138,11 @@ typedef struct {
     unsigned	wrapped;	/*whether the id count has wrapped around   */
     unsigned	ids;		/*current number of IDs held		    */
     unsigned	nextid;		/*ID to use for the next atom		    */
+    unsigned long nregistered;  /*# of IDs registered since type was created */
     unsigned    reuse_ids;  /* whether to reuse returned IDs for this type */
     H5I_id_info_t * next_id_ptr; /* pointer to head of available ID list */
-    H5I_id_info_t **id_list;	/*pointer to an array of ptrs to IDs	    */
+    unsigned    nsegs;          /*# of entries in 'segs'		    */
+    H5I_id_seg_t **segs;	/*segments of the ID table		    */
 } H5I_id_type_t;
 
 typedef struct {
@@ -141,8 +173,14 @@ H5FL_DEFINE_STATIC(H5I_id_type_t);
 /* Declare a free list to manage the H5I_class_t struct */
 H5FL_DEFINE_STATIC(H5I_class_t);
 
+/* Declare a free list to manage the H5I_id_seg_t struct */
+H5FL_DEFINE_STATIC(H5I_id_seg_t);
+
 /*--------------------- Local function prototypes ---------------------------*/
 static H5I_id_info_t *H5I_find_id(hid_t id);
+static herr_t H5I_insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr);
+static H5I_id_info_t *H5I_remove_id(H5I_id_type_t *type_ptr, hid_t id);
+static void H5I_free_segs(H5I_id_type_t *type_ptr);
 static int H5I_search_cb(void *obj, hid_t id, void *udata);
 #ifdef H5I_DEBUG_OUTPUT
 static herr_t H5I_debug(H5I_type_t type);
@@ -191,14 +229,17 @@ H5I_term_interface(void)
 {
     H5I_id_type_t	*type_ptr;
     H5I_type_t		type;
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int		n = 0;
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
+    H5I_LOCK(locked)
+
     if(H5_interface_initialize_g) {
         /* How many types are still being used? */
         for(type = (H5I_type_t)0; type < H5I_next_type; H5_INC_ENUM(H5I_type_t, type)) {
-            if((type_ptr = H5I_id_type_list_g[type]) && type_ptr->id_list)
+            if((type_ptr = H5I_id_type_list_g[type]) && type_ptr->count > 0)
                 n++;
         } /* end for */
 
@@ -207,7 +248,7 @@ H5I_term_interface(void)
             for(type = (H5I_type_t)0; type < H5I_next_type; H5_INC_ENUM(H5I_type_t,type)) {
                 type_ptr = H5I_id_type_list_g[type];
                 if(type_ptr) {
-                    HDassert(NULL == type_ptr->id_list);
+                    HDassert(NULL == type_ptr->segs);
                     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
                     H5I_id_type_list_g[type] = NULL;
                 } /* end if */
@@ -218,6 +259,7 @@ H5I_term_interface(void)
         H5_interface_initialize_g = 0;
     } /* end if */
 
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(n)
 } /* end H5I_term_interface() */
 
@@ -328,10 +370,13 @@ herr_t
 H5I_register_type(const H5I_class_t *cls)
 {
     H5I_id_type_t *type_ptr = NULL;	/* Ptr to the atomic type*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(cls);
     HDassert(cls->type_id > 0 && cls->type_id < H5I_MAX_NUM_TYPES);
@@ -339,10 +384,11 @@ H5I_register_type(const H5I_class_t *cls)
     /* Initialize the type */
 
     /* Check arguments */
-#ifdef HASH_SIZE_POWER_2
+    /* (The hash size is no longer used to size the ID table, which grows as
+     *  needed, but is still checked for compatibility)
+     */
     if(!POWER_OF_TWO(cls->hash_size) || cls->hash_size == 1)
         HGOTO_ERROR(H5E_ATOM, H5E_BADRANGE, FAIL, "invalid hash size")
-#endif /* HASH_SIZE_POWER_2 */
 
     if(NULL == H5I_id_type_list_g[cls->type_id]) {
         /* Allocate the type information for new type */
@@ -361,10 +407,10 @@ H5I_register_type(const H5I_class_t *cls)
         type_ptr->wrapped = 0;
         type_ptr->ids = 0;
         type_ptr->nextid = cls->reserved;
+        type_ptr->nregistered = 0;
         type_ptr->next_id_ptr = NULL;
-        type_ptr->id_list = (H5I_id_info_t **)H5MM_calloc(cls->hash_size * sizeof(H5I_id_info_t *));
-        if(NULL == type_ptr->id_list)
-            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, H5I_BADID, "memory allocation failed")
+        type_ptr->nsegs = 0;
+        type_ptr->segs = NULL;
 
         /* Don't re-use IDs for property lists, as this causes problems
          * with some virtual file drivers. Also, open datatypes are not 
@@ -382,13 +428,11 @@ H5I_register_type(const H5I_class_t *cls)
 
 done:
     if(ret_value < 0) {	/* Clean up on error */
-        if(type_ptr) {
-            if(type_ptr->id_list)
-                H5MM_xfree(type_ptr->id_list);
+        if(type_ptr)
             (void)H5FL_FREE(H5I_id_type_t, type_ptr);
-        } /* end if */
     } /* end if */
 
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register_type() */
 
@@ -497,10 +541,13 @@ int
 H5I_nmembers(H5I_type_t type)
 {
     H5I_id_type_t	*type_ptr = NULL;
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int		ret_value;
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     if(type <= H5I_BADID || type >= H5I_next_type)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid type number")
     if(NULL == (type_ptr = H5I_id_type_list_g[type]) || type_ptr->count <= 0)
@@ -510,9 +557,50 @@ H5I_nmembers(H5I_type_t type)
     H5_ASSIGN_OVERFLOW(ret_value, type_ptr->ids, unsigned, int);
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_nmembers() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I_nregistered
+ *
+ * Purpose:	Returns the number of IDs that have been registered in a
+ *		type since the type was created.  The count only grows, so
+ *		callers can compare two values to tell whether any IDs were
+ *		added to the type in between.
+ *
+ * Return:	Success:	Number of IDs registered; zero if the type
+ *				has been deleted.
+ *
+ *		Failure:	Zero
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned long
+H5I_nregistered(H5I_type_t type)
+{
+    H5I_id_type_t	*type_ptr = NULL;
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
+    unsigned long	ret_value;
+
+    FUNC_ENTER_NOAPI(0)
+
+    H5I_LOCK(locked)
+
+    if(type <= H5I_BADID || type >= H5I_next_type)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, 0, "invalid type number")
+    if(NULL == (type_ptr = H5I_id_type_list_g[type]) || type_ptr->count <= 0)
+	HGOTO_DONE(0);
+
+    /* Set return value */
+    ret_value = type_ptr->nregistered;
+
+done:
+    H5I_UNLOCK(locked)
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I_nregistered() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Iclear_type
@@ -585,11 +673,14 @@ herr_t
 H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
 {
     H5I_id_type_t *type_ptr;	        /* ptr to the atomic type */
-    unsigned	i;                      /* Local index variable */
+    unsigned	u;                      /* Local index variable */
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int		ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     if(type <= H5I_BADID || type >= H5I_next_type)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid type number")
 
@@ -602,25 +693,38 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
      * counts. Ignore the return value from from the free method and remove
      * object from type regardless if FORCE is non-zero.
      */
-    for(i = 0; i < type_ptr->cls->hash_size; i++) {
-        H5I_id_info_t *cur;          /* Current node being worked with */
-        H5I_id_info_t *next;         /* Next node in list */
+    for(u = 0; u < type_ptr->nsegs; u++) {
+        unsigned v;                 /* Local index variable */
 
-        for(cur = type_ptr->id_list[i]; cur; cur = next) {
-            hbool_t    delete_node;            /* Flag to indicate node should be removed from linked list */
+        /* (The segment is checked on each pass because the 'free' callbacks
+         *  can make H5I calls, which could release the segment, or move or
+         *  release the whole table.)
+         */
+        for(v = 0; v < H5I_SEG_SIZE && u < type_ptr->nsegs && type_ptr->segs[u]; v++) {
+            H5I_id_info_t *cur;          /* Current node being worked with */
+            hbool_t    delete_node;            /* Flag to indicate node should be removed from table */
+            herr_t     free_status = SUCCEED;  /* Result of the 'free' function */
+
+            if(NULL == (cur = type_ptr->segs[u]->slot[v]))
+                continue;
 
             /*
              * Do nothing to the object if the reference count is larger than
              * one and forcing is off.
              */
-            if(!force && (cur->count - (!app_ref * cur->app_count)) > 1) {
-                next = cur->next;
+            if(!force && (cur->count - (!app_ref * cur->app_count)) > 1)
                 continue;
-            } /* end if */
 
             /* Check for a 'free' function and call it, if it exists */
-            /* (Casting away const OK -QAK) */
-            if(type_ptr->cls->free_func && (type_ptr->cls->free_func)((void *)cur->obj_ptr) < 0) {
+            if(type_ptr->cls->free_func) {
+                unsigned lock_count;        /* # of times the tables were locked */
+
+                H5I_RELEASE(lock_count)
+                /* (Casting away const OK -QAK) */
+                free_status = (type_ptr->cls->free_func)((void *)cur->obj_ptr);
+                H5I_REACQUIRE(lock_count)
+            } /* end if */
+            if(free_status < 0) {
                 if(force) {
 #ifdef H5I_DEBUG
                     if(H5DEBUG(I)) {
@@ -630,62 +734,33 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
                     } /* end if */
 #endif /*H5I_DEBUG*/
 
-                    /* Indicate node should be removed from list */
+                    /* Indicate node should be removed from table */
                     delete_node = TRUE;
                 } /* end if */
                 else {
-                    /* Indicate node should _NOT_ be remove from list */
+                    /* Indicate node should _NOT_ be remove from table */
                     delete_node = FALSE;
                 } /* end else */
             } /* end if */
             else {
-                /* Indicate node should be removed from list */
+                /* Indicate node should be removed from table */
                 delete_node = TRUE;
             } /* end else */
 
             /* Check if we should delete this node or not */
             if(delete_node) {
-                H5I_id_info_t *last;         /* Last node seen */
                 H5I_id_info_t *tmp;          /* Temporary node ptr */
 
                 /* Decrement the number of IDs in the type */
                 (type_ptr->ids)--;
 
-                /* Advance to next node */
-                next = cur->next;
-
-                /* Re-scan the list of nodes and remove the node from the list */
-                /* (can't maintain static pointers to the previous node in the */
-                /*      list, because the node's 'free' callback could have */
-                /*      make an H5I call, which could potentially change the */
-                /*      order of the nodes on the list - QAK) */
-                last = NULL;
-                tmp = type_ptr->id_list[i];
-                while(tmp != cur) {
-                    HDassert(tmp != NULL);
-                    last = tmp;
-                    tmp = tmp->next;
-                } /* end while */
-
-                /* Delete the node from the list */
-                if(NULL == last) {
-                    /* Node at head of list, just advance the list head to next node */
-                    HDassert(type_ptr->id_list[i] == cur);
-                    type_ptr->id_list[i] = next;
-                } /* end if */
-                else {
-                    /* Node in middle of list, jump over it */
-                    HDassert(last->next == cur);
-                    last->next = next;
-                } /* end else */
+                /* Remove the node from the table */
+                tmp = H5I_remove_id(type_ptr, cur->id);
+                HDassert(tmp == cur);
 
                 /* Free the node */
-                cur = H5FL_FREE(H5I_id_info_t, cur);
+                cur = H5FL_FREE(H5I_id_info_t, tmp);
             } /* end if */
-            else {
-                /* Advance to next node */
-                next = cur->next;
-            } /* end else */
         } /* end for */
     } /* end for */
 
@@ -699,7 +774,12 @@ H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref)
     } /* end while */
     type_ptr->free_count = 0;
 
+    /* Release the table, if it's empty now */
+    if(0 == type_ptr->ids)
+        H5I_free_segs(type_ptr);
+
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_clear_type() */
 
@@ -757,10 +837,13 @@ herr_t
 H5I_destroy_type(H5I_type_t type)
 {
     H5I_id_type_t *type_ptr;	/* ptr to the atomic type */
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     herr_t ret_value = SUCCEED; /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     if(type <= H5I_BADID || type >= H5I_next_type)
         HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid type number")
 
@@ -777,12 +860,13 @@ H5I_destroy_type(H5I_type_t type)
     if(type_ptr->cls->flags & H5I_CLASS_IS_APPLICATION)
         type_ptr->cls = H5FL_FREE(H5I_class_t, (void *)type_ptr->cls);
 
-    type_ptr->id_list = H5MM_xfree(type_ptr->id_list);
+    H5I_free_segs(type_ptr);
 
     type_ptr = H5FL_FREE(H5I_id_type_t, type_ptr);
     H5I_id_type_list_g[type] = NULL;
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_destroy_type() */
 
@@ -848,14 +932,14 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
 {
     H5I_id_type_t	*type_ptr;	/*ptr to the type		*/
     H5I_id_info_t	*id_ptr;	/*ptr to the new ID information */
-    unsigned		hash_loc;	/*new item's hash table location*/
-    hid_t		next_id;	/*next ID to check		*/
-    H5I_id_info_t	*curr_id;	/*ptr to the current atom	*/
     unsigned		i;		/*counter			*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     hid_t		ret_value = SUCCEED; /*return value		*/
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Check arguments */
     if(type <= H5I_BADID || type >= H5I_next_type)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid type number")
@@ -894,14 +978,13 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     id_ptr->obj_ptr = object;
     id_ptr->next = NULL;
 
-    /* hash bucket already full, prepend to front of chain */
-    hash_loc = id_ptr->id % (unsigned)type_ptr->cls->hash_size;
-    if(type_ptr->id_list[hash_loc] != NULL)
-	id_ptr->next = type_ptr->id_list[hash_loc];
-
     /* Insert into the type */
-    type_ptr->id_list[hash_loc] = id_ptr;
+    if(H5I_insert_id(type_ptr, id_ptr) < 0) {
+        id_ptr = H5FL_FREE(H5I_id_info_t, id_ptr);
+        HGOTO_ERROR(H5E_ATOM, H5E_CANTINSERT, FAIL, "can't insert ID into table")
+    } /* end if */
     type_ptr->ids++;
+    type_ptr->nregistered++;
 
     /*
      * This next section of code checks for the 'nextid' getting too large and
@@ -929,20 +1012,9 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
 	    if(type_ptr->nextid > (unsigned)ID_MASK)
 		type_ptr->nextid = type_ptr->cls->reserved;
 
-	    /* new ID to check for */
-	    next_id = H5I_MAKE(type, type_ptr->nextid);
-	    hash_loc = (unsigned)H5I_LOC(type_ptr->nextid, type_ptr->cls->hash_size);
-	    curr_id = type_ptr->id_list[hash_loc];
-	    if(curr_id == NULL)
-                break; /* Ha! this is not likely... */
-
-	    while(curr_id) {
-		if(curr_id->id == next_id)
-                    break;
-		curr_id = curr_id->next;
-	    } /* end while */
-	    if(!curr_id)
-                break; /* must not have found a match */
+	    /* Stop at the first ID not in use */
+	    if(NULL == H5I_find_id(H5I_MAKE(type, type_ptr->nextid)))
+                break;
 	    type_ptr->nextid++;
 	} /* end for */
 
@@ -955,6 +1027,7 @@ H5I_register(H5I_type_t type, const void *object, hbool_t app_ref)
     ret_value = id_ptr->id;
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_register() */
 
@@ -977,10 +1050,13 @@ void *
 H5I_subst(hid_t id, const void *new_object)
 {
     H5I_id_info_t	*id_ptr;	/* Ptr to the atom	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     void		*ret_value;	/* Return value		*/
 
     FUNC_ENTER_NOAPI(NULL)
 
+    H5I_LOCK(locked)
+
     /* General lookup of the ID */
     if(NULL == (id_ptr = H5I_find_id(id)))
         HGOTO_ERROR(H5E_ATOM, H5E_NOTFOUND, NULL, "can't get ID ref count")
@@ -993,6 +1069,7 @@ H5I_subst(hid_t id, const void *new_object)
     id_ptr->obj_ptr = new_object;
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end if */
 
@@ -1014,10 +1091,13 @@ void *
 H5I_object(hid_t id)
 {
     H5I_id_info_t	*id_ptr;		/*ptr to the new atom	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     void		*ret_value = NULL;	/*return value		*/
 
     FUNC_ENTER_NOAPI(NULL)
 
+    H5I_LOCK(locked)
+
     /* General lookup of the ID */
     if(NULL != (id_ptr = H5I_find_id(id))) {
         /* Get the object pointer to return */
@@ -1026,6 +1106,7 @@ H5I_object(hid_t id)
     } /* end if */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end if */
 
@@ -1086,10 +1167,13 @@ void *
 H5I_object_verify(hid_t id, H5I_type_t id_type)
 {
     H5I_id_info_t	*id_ptr = NULL;		/*ptr to the new atom	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     void		*ret_value = NULL;	/*return value		*/
 
     FUNC_ENTER_NOAPI(NULL)
 
+    H5I_LOCK(locked)
+
     HDassert(id_type >= 1 && id_type < H5I_next_type);
 
     /* Verify that the type of the ID is correct & lookup the ID */
@@ -1100,6 +1184,7 @@ H5I_object_verify(hid_t id, H5I_type_t id_type)
     } /* end if */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5I_object_verify() */
 
@@ -1259,14 +1344,15 @@ H5I_remove(hid_t id)
 {
     H5I_id_type_t	*type_ptr;	/*ptr to the atomic type	*/
     H5I_id_info_t	*curr_id;	/*ptr to the current atom	*/
-    H5I_id_info_t	*last_id;	/*ptr to the last atom		*/
     H5I_id_info_t   *tmp_id_ptr; /*temp ptr to next atom     */
     H5I_type_t		type;		/*atom's atomic type		*/
-    unsigned		hash_loc;	/*atom's hash table location	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     void *	      ret_value = NULL;	/*return value			*/
 
     FUNC_ENTER_NOAPI(NULL)
 
+    H5I_LOCK(locked)
+
     /* Check arguments */
     type = H5I_TYPE(id);
     if(type <= H5I_BADID || type >= H5I_next_type)
@@ -1275,27 +1361,8 @@ H5I_remove(hid_t id)
     if(type_ptr == NULL || type_ptr->count <= 0)
 	HGOTO_ERROR(H5E_ATOM, H5E_BADGROUP, NULL, "invalid type")
 
-    /* Get the bucket in which the ID is located */
-    hash_loc = (unsigned)H5I_LOC(id, type_ptr->cls->hash_size);
-    curr_id = type_ptr->id_list[hash_loc];
-    if(NULL == curr_id)
-	HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, NULL, "invalid ID")
-
-    last_id = NULL;
-    while(curr_id != NULL) {
-        if(curr_id->id == id)
-            break;
-        last_id = curr_id;
-        curr_id = curr_id->next;
-    } /* end while */
-
-    if(curr_id != NULL) {
-        if(last_id == NULL) {
-            /* ID is the first in the chain */
-            type_ptr->id_list[hash_loc] = curr_id->next;
-        } else {
-            last_id->next = curr_id->next;
-        }
+    /* Remove the ID from the table */
+    if(NULL != (curr_id = H5I_remove_id(type_ptr, id))) {
         /* (Casting away const OK -QAK) */
         ret_value = (void *)curr_id->obj_ptr;
         
@@ -1330,9 +1397,13 @@ H5I_remove(hid_t id)
 
         type_ptr->nextid = type_ptr->cls->reserved;
         type_ptr->wrapped = FALSE;
+
+        /* Release the table */
+        H5I_free_segs(type_ptr);
     } /* end if */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_remove() */
 
@@ -1396,10 +1467,13 @@ H5I_dec_ref(hid_t id)
     H5I_type_t		type;		/*type the object is in*/
     H5I_id_type_t	*type_ptr;	/*ptr to the type	*/
     H5I_id_info_t	*id_ptr;	/*ptr to the new ID	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int ret_value;                      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(id >= 0);
 
@@ -1431,8 +1505,17 @@ H5I_dec_ref(hid_t id)
      * file.  We have to close the dataset anyway. (SLU - 2010/9/7)
      */
     if(1 == id_ptr->count) {
-        /* (Casting away const OK -QAK) */
-        if(!type_ptr->cls->free_func || (type_ptr->cls->free_func)((void *)id_ptr->obj_ptr) >= 0) {
+        herr_t free_status = SUCCEED;   /* Result of the 'free' function */
+
+        if(type_ptr->cls->free_func) {
+            unsigned lock_count;        /* # of times the tables were locked */
+
+            H5I_RELEASE(lock_count)
+            /* (Casting away const OK -QAK) */
+            free_status = (type_ptr->cls->free_func)((void *)id_ptr->obj_ptr);
+            H5I_REACQUIRE(lock_count)
+        } /* end if */
+        if(free_status >= 0) {
             H5I_remove(id);
             ret_value = 0;
         } /* end if */
@@ -1445,6 +1528,7 @@ H5I_dec_ref(hid_t id)
     } /* end else */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_dec_ref() */
 
@@ -1467,10 +1551,13 @@ int
 H5I_dec_app_ref(hid_t id)
 {
     H5I_id_info_t	*id_ptr;	/*ptr to the new ID	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int ret_value;                      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(id >= 0);
 
@@ -1493,6 +1580,7 @@ H5I_dec_app_ref(hid_t id)
     } /* end if */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_dec_app_ref() */
 
@@ -1602,10 +1690,13 @@ H5I_inc_ref(hid_t id, hbool_t app_ref)
     H5I_type_t		type;		/*type the object is in*/
     H5I_id_type_t	*type_ptr;	/*ptr to the type	*/
     H5I_id_info_t	*id_ptr;	/*ptr to the ID		*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int ret_value;                      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(id >= 0);
 
@@ -1630,6 +1721,7 @@ H5I_inc_ref(hid_t id, hbool_t app_ref)
     ret_value = (int)(app_ref ? id_ptr->app_count : id_ptr->count);
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_inc_ref() */
 
@@ -1694,10 +1786,13 @@ H5I_get_ref(hid_t id, hbool_t app_ref)
     H5I_type_t		type;		/*type the object is in*/
     H5I_id_type_t	*type_ptr;	/*ptr to the type	*/
     H5I_id_info_t	*id_ptr;	/*ptr to the ID		*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int ret_value;                      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(id >= 0);
 
@@ -1717,6 +1812,7 @@ H5I_get_ref(hid_t id, hbool_t app_ref)
     ret_value = (int)(app_ref ? id_ptr->app_count : id_ptr->count);
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_get_ref() */
 
@@ -1777,10 +1873,13 @@ int
 H5I_inc_type_ref(H5I_type_t type)
 {
     H5I_id_type_t	*type_ptr;	/* ptr to the type	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int ret_value;                      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(type > 0 && type < H5I_next_type);
 
@@ -1793,6 +1892,7 @@ H5I_inc_type_ref(H5I_type_t type)
     ret_value = (int)(++(type_ptr->count));
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_inc_type_ref() */
 
@@ -1861,10 +1961,13 @@ herr_t
 H5I_dec_type_ref(H5I_type_t type)
 {
     H5I_id_type_t	*type_ptr;      /* Pointer to the ID type */
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     herr_t		ret_value;      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     if(type <= H5I_BADID || type >= H5I_next_type)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid type number")
 
@@ -1888,6 +1991,7 @@ H5I_dec_type_ref(H5I_type_t type)
     } /* end else */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_dec_type_ref() */
 
@@ -1949,10 +2053,13 @@ int
 H5I_get_type_ref(H5I_type_t type)
 {
     H5I_id_type_t	*type_ptr;	/*ptr to the type	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     int ret_value;                      /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Sanity check */
     HDassert(type >= 0);
 
@@ -1965,6 +2072,7 @@ H5I_get_type_ref(H5I_type_t type)
     ret_value = (int)type_ptr->count;
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_get_type_ref() */
 
@@ -1988,11 +2096,14 @@ htri_t
 H5Iis_valid(hid_t id)
 {
     H5I_id_info_t   *id_ptr;            /* ptr to the ID */
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     htri_t          ret_value = TRUE;   /* Return value */
 
     FUNC_ENTER_API(FAIL)
     H5TRACE1("t", "i", id);
 
+    H5I_LOCK(locked)
+
     /* Find the ID */
     if (NULL == (id_ptr = H5I_find_id(id)))
         ret_value = FALSE;
@@ -2002,6 +2113,7 @@ H5Iis_valid(hid_t id)
         ret_value = FALSE;
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_API(ret_value)
 } /* end H5Iis_valid() */
 
@@ -2126,10 +2238,13 @@ herr_t
 H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_ref)
 {
     H5I_id_type_t *type_ptr;		/*ptr to the type	*/
+    hbool_t     locked = FALSE;         /* Whether the ID tables are locked */
     herr_t	   ret_value = SUCCEED;	/*return value		*/
 
     FUNC_ENTER_NOAPI(FAIL)
 
+    H5I_LOCK(locked)
+
     /* Check arguments */
     if(type <= H5I_BADID || type >= H5I_next_type)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "invalid type number")
@@ -2139,32 +2254,36 @@ H5I_iterate(H5I_type_t type, H5I_search_func_t func, void *udata, hbool_t app_re
     if(type_ptr && type_ptr->count > 0 && type_ptr->ids > 0) {
         unsigned u;			/* Counter		*/
 
-        /* Start at the beginning of the array */
-        for(u = 0; u < type_ptr->cls->hash_size; u++) {
-            H5I_id_info_t	*id_ptr;	/* Ptr to the new ID	*/
+        /* Start at the beginning of the table */
+        for(u = 0; u < type_ptr->nsegs; u++) {
+            unsigned v;                 /* Counter		*/
 
-            id_ptr = type_ptr->id_list[u];
-            while(id_ptr) {
-                H5I_id_info_t	*next_id;	/* Ptr to the next ID	*/
+            /* (The segment is checked on each pass, to protect against IDs
+             *  being deleted in the callback)
+             */
+            for(v = 0; v < H5I_SEG_SIZE && u < type_ptr->nsegs && type_ptr->segs[u]; v++) {
+                H5I_id_info_t	*id_ptr;	/* Ptr to the ID	*/
 
-                /* Protect against ID being deleted in callback */
-                next_id = id_ptr->next;
-                if((!app_ref) || (id_ptr->app_count > 0)) {
+                id_ptr = type_ptr->segs[u]->slot[v];
+                if(id_ptr && ((!app_ref) || (id_ptr->app_count > 0))) {
                     herr_t cb_ret_val;  /* Callback return value */
+                    unsigned lock_count; /* # of times the tables were locked */
 
+                    H5I_RELEASE(lock_count)
                     /* (Casting away const OK) */
 		    cb_ret_val = (*func)((void *)id_ptr->obj_ptr, id_ptr->id, udata);
+                    H5I_REACQUIRE(lock_count)
 		    if(cb_ret_val > 0)
                         HGOTO_DONE(SUCCEED)	/* terminate iteration early */
 		    else if(cb_ret_val < 0)
 			HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "func failed")
 		} /* end if */
-                id_ptr = next_id;
-            } /* end while */
+            } /* end for */
         } /* end for */
     } /* end if */
 
 done:
+    H5I_UNLOCK(locked)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_iterate() */
 
@@ -2187,11 +2306,10 @@ static H5I_id_info_t *
 H5I_find_id(hid_t id)
 {
     H5I_id_type_t	*type_ptr;		/*ptr to the type	*/
-    H5I_id_info_t	*last_id;		/*ptr to the last ID	*/
-    H5I_id_info_t	*id_ptr;		/*ptr to the new ID	*/
+    H5I_id_seg_t	*seg;			/*ptr to the ID's segment */
     H5I_type_t		type;			/*ID's type		*/
-    unsigned		hash_loc;		/*bucket pointer	*/
-    H5I_id_info_t	*ret_value;		/*return value		*/
+    unsigned		idx;			/*ID's index in its type */
+    H5I_id_info_t	*ret_value = NULL;	/*return value		*/
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
@@ -2204,33 +2322,149 @@ H5I_find_id(hid_t id)
     if (!type_ptr || type_ptr->count <= 0)
         HGOTO_DONE(NULL);
 
-    /* Get the bucket in which the ID is located */
-    hash_loc = (unsigned)H5I_LOC(id, type_ptr->cls->hash_size);
-    id_ptr = type_ptr->id_list[hash_loc];
-
-    /* Scan the bucket's linked list for a match */
-    last_id = NULL;
-    while(id_ptr) {
-	if(id_ptr->id == id) {
-            /* If we found an object, move it to the front of the list, if it isn't there already */
-            if(last_id != NULL) {
-                last_id->next = id_ptr->next;
-                id_ptr->next = type_ptr->id_list[hash_loc];
-                type_ptr->id_list[hash_loc] = id_ptr;
-            } /* end if */
-            break;
-        } /* end if */
-        last_id = id_ptr;
-	id_ptr = id_ptr->next;
-    } /* end while */
+    /* Look up the ID's slot in the table */
+    idx = H5I_INDEX(id);
+    if((idx >> H5I_SEG_BITS) >= type_ptr->nsegs)
+        HGOTO_DONE(NULL);
+    if(NULL == (seg = type_ptr->segs[idx >> H5I_SEG_BITS]))
+        HGOTO_DONE(NULL);
 
     /* Set the return value */
-    ret_value = id_ptr;
+    ret_value = seg->slot[idx & H5I_SEG_MASK];
+    HDassert(NULL == ret_value || ret_value->id == id);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5I_find_id() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I_insert_id
+ *
+ * Purpose:	Store an ID's info struct in its slot in the type's table,
+ *		allocating the slot's segment (and growing the array of
+ *		segments) if necessary.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5I_insert_id(H5I_id_type_t *type_ptr, H5I_id_info_t *id_ptr)
+{
+    unsigned		idx;			/*ID's index in its type */
+    unsigned		s;			/*segment index		*/
+    H5I_id_seg_t	*seg;			/*ptr to the ID's segment */
+    herr_t		ret_value = SUCCEED;	/*return value		*/
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(type_ptr);
+    HDassert(id_ptr);
+
+    idx = H5I_INDEX(id_ptr->id);
+    s = idx >> H5I_SEG_BITS;
+
+    /* Grow the array of segments, if necessary */
+    if(s >= type_ptr->nsegs) {
+        H5I_id_seg_t **segs;            /* New array of segments */
+        unsigned nsegs;                 /* New # of segments */
+
+        nsegs = MAX(s + 1, 2 * type_ptr->nsegs);
+        if(NULL == (segs = (H5I_id_seg_t **)H5MM_realloc(type_ptr->segs, nsegs * sizeof(H5I_id_seg_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        HDmemset(segs + type_ptr->nsegs, 0, (nsegs - type_ptr->nsegs) * sizeof(H5I_id_seg_t *));
+        type_ptr->segs = segs;
+        type_ptr->nsegs = nsegs;
+    } /* end if */
+
+    /* Allocate the segment, if necessary */
+    if(NULL == (seg = type_ptr->segs[s])) {
+        if(NULL == (seg = H5FL_CALLOC(H5I_id_seg_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        type_ptr->segs[s] = seg;
+    } /* end if */
+
+    /* Store the ID */
+    if(NULL != seg->slot[idx & H5I_SEG_MASK])
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "ID already in use")
+    seg->slot[idx & H5I_SEG_MASK] = id_ptr;
+    seg->nused++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I_insert_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I_remove_id
+ *
+ * Purpose:	Take an ID's info struct out of the type's table, releasing
+ *		its segment if that was the last ID in it.
+ *
+ * Return:	Success:	Ptr to the ID's info struct.
+ *
+ *		Failure:	NULL (the ID is not in the table)
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5I_id_info_t *
+H5I_remove_id(H5I_id_type_t *type_ptr, hid_t id)
+{
+    unsigned		idx;			/*ID's index in its type */
+    unsigned		s;			/*segment index		*/
+    H5I_id_seg_t	*seg;			/*ptr to the ID's segment */
+    H5I_id_info_t	*ret_value = NULL;	/*return value		*/
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(type_ptr);
+
+    idx = H5I_INDEX(id);
+    s = idx >> H5I_SEG_BITS;
+    if(s >= type_ptr->nsegs || NULL == (seg = type_ptr->segs[s]))
+        HGOTO_DONE(NULL)
+    if(NULL == (ret_value = seg->slot[idx & H5I_SEG_MASK]) || ret_value->id != id)
+        HGOTO_DONE(NULL)
+
+    /* Empty the slot, and release the segment if it's unused now */
+    seg->slot[idx & H5I_SEG_MASK] = NULL;
+    if(0 == --seg->nused)
+        type_ptr->segs[s] = H5FL_FREE(H5I_id_seg_t, seg);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5I_remove_id() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5I_free_segs
+ *
+ * Purpose:	Release a type's table.  Any IDs still in it are dropped
+ *		without being freed.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5I_free_segs(H5I_id_type_t *type_ptr)
+{
+    unsigned		u;			/*local index variable	*/
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(type_ptr);
+
+    for(u = 0; u < type_ptr->nsegs; u++)
+        if(type_ptr->segs[u])
+            type_ptr->segs[u] = H5FL_FREE(H5I_id_seg_t, type_ptr->segs[u]);
+    type_ptr->segs = (H5I_id_seg_t **)H5MM_xfree(type_ptr->segs);
+    type_ptr->nsegs = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5I_free_segs() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5Iget_name
@@ -2394,7 +2628,7 @@ H5I_debug(H5I_type_t type)
     fprintf(stderr, "	 count	   = %u\n", type_ptr->count);
     fprintf(stderr, "	 reserved  = %u\n", type_ptr->cls->reserved);
     fprintf(stderr, "	 wrapped   = %u\n", type_ptr->wrapped);
-    fprintf(stderr, "	 hash_size = %lu\n", (unsigned long)type_ptr->cls->hash_size);
+    fprintf(stderr, "	 nsegs     = %u\n", type_ptr->nsegs);
     fprintf(stderr, "	 ids	   = %u\n", type_ptr->ids);
     fprintf(stderr, "	 nextid	   = %u\n", type_ptr->nextid);
 
@@ -2409,8 +2643,10 @@ H5I_debug(H5I_type_t type)
 
     /* List */
     fprintf(stderr, "	 List:\n");
-    for (iu=0; iu<type_ptr->hash_size; iu++) {
-        for (js=0, cur=type_ptr->id_list[iu]; cur; cur=cur->next, js++) {
+    for (iu=0; iu<type_ptr->nsegs; iu++) {
+        for (js=0; type_ptr->segs[iu] && js<(int)H5I_SEG_SIZE; js++) {
+            if (NULL == (cur=type_ptr->segs[iu]->slot[js]))
+                continue;
             fprintf(stderr, "	     #%u.%d\n", iu, js);
             fprintf(stderr, "		 id = %lu\n", (unsigned long)(cur->id));
             fprintf(stderr, "		 count = %u\n", cur->count);
@@ -68,6 +68,7 @@ typedef struct H5I_class_t {
 /***************************************/
 H5_DLL herr_t H5I_register_type(const H5I_class_t *cls);
 H5_DLL int H5I_nmembers(H5I_type_t type);
+H5_DLL unsigned long H5I_nregistered(H5I_type_t type);
 H5_DLL herr_t H5I_clear_type(H5I_type_t type, hbool_t force, hbool_t app_ref);
 H5_DLL int H5I_destroy_type(H5I_type_t type);
 H5_DLL hid_t H5I_register(H5I_type_t type, const void *object, hbool_t app_ref);
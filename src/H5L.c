@@ -153,6 +153,9 @@ static herr_t H5L_link_cb(H5G_loc_t *grp_loc/*in*/, const char *name,
 static herr_t H5L_create_real(const H5G_loc_t *link_loc, const char *link_name,
     H5G_name_t *obj_path, H5F_t *obj_file, H5O_link_t *lnk, H5O_obj_create_t *ocrt_info,
     hid_t lcpl_id, hid_t lapl_id, hid_t dxpl_id);
+static herr_t H5L_create_hard_many(H5G_loc_t *cur_loc, const char *cur_names[],
+    const H5G_loc_t *link_loc, const char *link_names[], size_t nlinks,
+    hid_t lcpl_id, hid_t lapl_id, hid_t dxpl_id);
 static herr_t H5L_get_val_real(const H5O_link_t *lnk, void *buf, size_t size);
 static herr_t H5L_get_val_cb(H5G_loc_t *grp_loc/*in*/, const char *name,
     const H5O_link_t *lnk, H5G_loc_t *obj_loc, void *_udata/*in,out*/,
@@ -519,6 +522,72 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Lcreate_hard() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Lcreate_hard_many
+ *
+ * Purpose:	Creates NLINKS hard links in one group.  Link I is named
+ *              DST_NAMES[I] and points to the existing object CUR_NAMES[I].
+ *
+ *		CUR_NAMES are interpreted relative to CUR_LOC_ID, which is
+ *              either a file ID or a group ID, or H5L_SAME_LOC to use
+ *              DST_LOC_ID.  DST_LOC_ID is the file or group ID of the
+ *              group to hold the new links, and each of DST_NAMES must be
+ *              a single path component within it.
+ *
+ *              This is equivalent to calling H5Lcreate_hard for each link,
+ *              but the group's link storage is updated once for the
+ *              whole batch.  All the names are checked before the group
+ *              is changed, so a batch with a missing object or a name that
+ *              already exists creates no links.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Lcreate_hard_many(hid_t cur_loc_id, const char *cur_names[],
+    hid_t dst_loc_id, const char *dst_names[], size_t nlinks, hid_t lcpl_id,
+    hid_t lapl_id)
+{
+    H5G_loc_t	cur_loc, *cur_loc_p;
+    H5G_loc_t	dst_loc;
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "i**si**szii", cur_loc_id, cur_names, dst_loc_id, dst_names,
+             nlinks, lcpl_id, lapl_id);
+
+    /* Check arguments */
+    if(dst_loc_id == H5L_SAME_LOC)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "destination can't be H5L_SAME_LOC")
+    if(H5G_loc(dst_loc_id, &dst_loc) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    if(cur_loc_id != H5L_SAME_LOC && H5G_loc(cur_loc_id, &cur_loc) < 0)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a location")
+    if(nlinks > 0 && !cur_names)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no current names specified")
+    if(nlinks > 0 && !dst_names)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no new names specified")
+    if(lcpl_id != H5P_DEFAULT && (TRUE != H5P_isa_class(lcpl_id, H5P_LINK_CREATE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a link creation property list")
+
+    /* Set up current location pointer */
+    cur_loc_p = &cur_loc;
+    if(cur_loc_id == H5L_SAME_LOC)
+        cur_loc_p = &dst_loc;
+    else if(cur_loc_p->oloc->file != dst_loc.oloc->file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "source and destination should be in the same file.")
+
+    /* Create the links */
+    if(H5L_create_hard_many(cur_loc_p, cur_names, &dst_loc, dst_names, nlinks,
+                lcpl_id, lapl_id, H5AC_dxpl_id) < 0)
+	HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create links")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Lcreate_hard_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Lcreate_ud
@@ -1963,6 +2032,121 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5L_create_hard() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5L_create_hard_many
+ *
+ * Purpose:	Creates NLINKS hard links named LINK_NAMES in the group at
+ *              LINK_LOC, to the objects named CUR_NAMES.
+ *
+ *              Each object is located first, then the links are inserted
+ *              into the group as one batch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5L_create_hard_many(H5G_loc_t *cur_loc, const char *cur_names[],
+    const H5G_loc_t *link_loc, const char *link_names[], size_t nlinks,
+    hid_t lcpl_id, hid_t lapl_id, hid_t dxpl_id)
+{
+    H5O_link_t *lnks = NULL;            /* Links to insert */
+    H5T_cset_t cset = H5F_DEFAULT_CSET; /* Character encoding of link names */
+    H5O_type_t grp_type;                /* Type of object at link location */
+    H5G_loc_t obj_loc;                  /* Location of object to link to */
+    H5G_name_t path;                    /* obj_loc's path*/
+    H5O_loc_t oloc;                     /* obj_loc's oloc */
+    hbool_t loc_valid = FALSE;
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Check args */
+    HDassert(cur_loc);
+    HDassert(link_loc);
+    HDassert(nlinks == 0 || (cur_names && link_names));
+
+    /* Quick exit for empty batch */
+    if(nlinks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    /* The links all go into the group at the link location */
+    if(H5O_obj_type(link_loc->oloc, &grp_type, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "unable to get object type")
+    if(grp_type != H5O_TYPE_GROUP)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "link location is not a group")
+
+    /* Get the character encoding for the link names */
+    if(lcpl_id != H5P_DEFAULT) {
+        H5P_genplist_t *lc_plist;       /* Link creation property list */
+
+        if(NULL == (lc_plist = (H5P_genplist_t *)H5I_object(lcpl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a property list")
+        if(H5P_get(lc_plist, H5P_STRCRT_CHAR_ENCODING_NAME, &cset) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get property value for character encoding")
+    } /* end if */
+
+    /* Allocate the links */
+    if(NULL == (lnks = (H5O_link_t *)H5MM_malloc(sizeof(H5O_link_t) * nlinks)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for links")
+
+    /* Set up location for objects pointed to */
+    obj_loc.path = &path;
+    obj_loc.oloc = &oloc;
+
+    /* Locate each object & construct its link */
+    for(u = 0; u < nlinks; u++) {
+        if(!cur_names[u] || !*cur_names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no current name specified")
+        if(!link_names[u] || !*link_names[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no new name specified")
+        if(HDstrchr(link_names[u], '/') || !HDstrcmp(link_names[u], "."))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "new name is not a single path component")
+
+        /* Get object location for object pointed to */
+        H5G_loc_reset(&obj_loc);
+        if(H5G_loc_find(cur_loc, cur_names[u], &obj_loc, lapl_id, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_NOTFOUND, FAIL, "source object not found")
+        loc_valid = TRUE;
+
+        /* Check that both objects are in same file */
+        if(!H5F_SAME_SHARED(link_loc->oloc->file, obj_loc.oloc->file))
+            HGOTO_ERROR(H5E_SYM, H5E_BADVALUE, FAIL, "interfile hard links are not allowed")
+
+        /* Construct link information for insertion */
+        lnks[u].type = H5L_TYPE_HARD;
+        lnks[u].corder = 0;             /* Will be re-written during group insertion, if the group is tracking creation order */
+        lnks[u].corder_valid = FALSE;   /* Creation order not valid (yet) */
+        lnks[u].cset = cset;
+        /* Casting away const OK -QAK */
+        lnks[u].name = (char *)link_names[u];
+        lnks[u].u.hard.addr = obj_loc.oloc->addr;
+
+        /* Release the object's location */
+        if(H5G_loc_free(&obj_loc) < 0)
+            HGOTO_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "unable to free location")
+        loc_valid = FALSE;
+    } /* end for */
+
+    /* Insert the links into the group */
+    if(H5G_obj_insert_many(link_loc->oloc, nlinks, lnks, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create new links to objects")
+
+done:
+    /* Free the object header location */
+    if(loc_valid)
+        if(H5G_loc_free(&obj_loc) < 0)
+            HDONE_ERROR(H5E_SYM, H5E_CANTRELEASE, FAIL, "unable to free location")
+
+    /* Free the links */
+    if(lnks)
+        H5MM_xfree(lnks);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5L_create_hard_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5L_create_soft
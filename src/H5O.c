@@ -425,6 +425,7 @@ H5Olink(hid_t obj_id, hid_t new_loc_id, const char *new_name, hid_t lcpl_id,
 {
     H5G_loc_t	new_loc;
     H5G_loc_t	obj_loc;
+    hbool_t     had_path;               /* Whether the object had a path before */
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_API(FAIL)
@@ -447,10 +448,17 @@ H5Olink(hid_t obj_id, hid_t new_loc_id, const char *new_name, hid_t lcpl_id,
     if(lcpl_id != H5P_DEFAULT && (TRUE != H5P_isa_class(lcpl_id, H5P_LINK_CREATE)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a link creation property list")
 
+    /* Note whether the object will be given a path by the link */
+    had_path = (obj_loc.path->user_path_r != NULL);
+
     /* Link to the object */
     if(H5L_link(&new_loc, new_name, &obj_loc, lcpl_id, lapl_id, H5AC_dxpl_id) < 0)
         HGOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "unable to create link")
 
+    /* The object's ID now refers to an object with a (new) path */
+    if(!had_path)
+        H5G_name_index_reset();
+
 done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Olink() */
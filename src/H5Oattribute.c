@@ -126,6 +126,12 @@ typedef struct {
     hbool_t found;              /* Found attribute */
 } H5O_iter_xst_t;
 
+/* User data for iterating over compact attributes in place */
+typedef struct {
+    H5A_lib_iterate_t op;       /* Library callback for each attribute */
+    void *op_data;              /* User data for callback */
+} H5O_iter_nat_t;
+
 
 /********************/
 /* Package Typedefs */
@@ -1397,6 +1403,115 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5O_attr_iterate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O_attr_iterate_native_cb
+ *
+ * Purpose:	Object header iterator callback routine to pass a compact
+ *              attribute to a library callback, without copying it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O_attr_iterate_native_cb(H5O_t UNUSED *oh, H5O_mesg_t *mesg/*in*/,
+    unsigned UNUSED sequence, unsigned UNUSED *oh_modified, void *_udata/*in*/)
+{
+    H5O_iter_nat_t *udata = (H5O_iter_nat_t *)_udata;   /* Operator user data */
+    herr_t ret_value;                   /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* check args */
+    HDassert(mesg);
+
+    /* Make the library callback */
+    ret_value = (udata->op)((const H5A_t *)mesg->native, udata->op_data);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_attr_iterate_native_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O_attr_iterate_native
+ *
+ * Purpose:	Iterate over the attributes of an object in native order,
+ *              with a library callback.
+ *
+ * Note:	Unlike H5O_attr_iterate_real, compact attributes are passed
+ *              to the callback while the object header is protected,
+ *              instead of being copied into a table first.  The callback
+ *              must not access the object header.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5O_attr_iterate_native(const H5O_loc_t *loc, hid_t dxpl_id,
+    H5_index_t idx_type, H5A_lib_iterate_t op, void *op_data)
+{
+    H5O_t *oh = NULL;                   /* Pointer to actual object header */
+    H5O_ainfo_t ainfo;                  /* Attribute information for object */
+    herr_t ret_value;                   /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Check arguments */
+    HDassert(loc);
+    HDassert(loc->file);
+    HDassert(H5F_addr_defined(loc->addr));
+    HDassert(op);
+
+    /* Protect the object header to iterate over */
+    if(NULL == (oh = H5O_protect(loc, dxpl_id, H5AC_READ)))
+	HGOTO_ERROR(H5E_ATTR, H5E_CANTPROTECT, FAIL, "unable to load object header")
+
+    /* Check for attribute info stored */
+    ainfo.fheap_addr = HADDR_UNDEF;
+    if(oh->version > H5O_VERSION_1) {
+        /* Check for (& retrieve if available) attribute info */
+        if(H5A_get_ainfo(loc->file, dxpl_id, oh, &ainfo) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTGET, FAIL, "can't check for attribute info message")
+    } /* end if */
+
+    /* Check for attributes stored densely */
+    if(H5F_addr_defined(ainfo.fheap_addr)) {
+        H5A_attr_iter_op_t attr_op;     /* Attribute operator */
+
+        /* Release the object header */
+        if(H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+        oh = NULL;
+
+        /* Iterate over attributes in dense storage */
+        attr_op.op_type = H5A_ATTR_OP_LIB;
+        attr_op.u.lib_op = op;
+        if((ret_value = H5A_dense_iterate(loc->file, dxpl_id, (hid_t)-1, &ainfo, idx_type, H5_ITER_NATIVE, (hsize_t)0, NULL, &attr_op, op_data)) < 0)
+            HERROR(H5E_ATTR, H5E_BADITER, "error iterating over attributes");
+    } /* end if */
+    else {
+        H5O_mesg_operator_t mesg_op;    /* Wrapper for operator */
+        H5O_iter_nat_t udata;           /* User data for callback */
+
+        /* Iterate over the attribute messages in the object header */
+        udata.op = op;
+        udata.op_data = op_data;
+        mesg_op.op_type = H5O_MESG_OP_LIB;
+        mesg_op.u.lib_op = H5O_attr_iterate_native_cb;
+        if((ret_value = H5O_msg_iterate_real(loc->file, oh, H5O_MSG_ATTR, &mesg_op, &udata, dxpl_id)) < 0)
+            HERROR(H5E_ATTR, H5E_BADITER, "error iterating over attributes");
+    } /* end else */
+
+done:
+    /* Release resources */
+    if(oh && H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_ATTR, H5E_CANTUNPROTECT, FAIL, "unable to release object header")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O_attr_iterate_native() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5O_attr_remove_update
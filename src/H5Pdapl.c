@@ -55,6 +55,15 @@
 /* Definition for preemption read chunks first */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_SIZE        sizeof(double)
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEF         H5D_CHUNK_CACHE_W0_DEFAULT
+/* Definition for raw data chunk cache eviction policy */
+#define H5D_ACS_DATA_CACHE_POLICY_SIZE          sizeof(H5D_chunk_cache_policy_t)
+#define H5D_ACS_DATA_CACHE_POLICY_DEF           H5D_CHUNK_CACHE_POLICY_W0
+/* Definition for # of chunks to read ahead of sequential access */
+#define H5D_ACS_DATA_CACHE_PREFETCH_SIZE        sizeof(size_t)
+#define H5D_ACS_DATA_CACHE_PREFETCH_DEF         0
+/* Definition for loading all chunk addresses when opening */
+#define H5D_ACS_CHUNK_ADDR_MAP_SIZE             sizeof(hbool_t)
+#define H5D_ACS_CHUNK_ADDR_MAP_DEF              FALSE
 
 
 /******************/
@@ -125,6 +134,9 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5D_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5D_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+    H5D_chunk_cache_policy_t rdcc_policy = H5D_ACS_DATA_CACHE_POLICY_DEF; /* Default raw data chunk cache eviction policy */
+    size_t rdcc_prefetch = H5D_ACS_DATA_CACHE_PREFETCH_DEF;     /* Default # of chunks to read ahead */
+    hbool_t chunk_addr_map = H5D_ACS_CHUNK_ADDR_MAP_DEF;        /* Default chunk address loading */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -141,6 +153,18 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     if(H5P_register_real(pclass, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, H5D_ACS_PREEMPT_READ_CHUNKS_SIZE, &rdcc_w0, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the raw data chunk cache eviction policy */
+    if(H5P_register_real(pclass, H5D_ACS_DATA_CACHE_POLICY_NAME, H5D_ACS_DATA_CACHE_POLICY_SIZE, &rdcc_policy, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the # of chunks to read ahead of sequential access */
+    if(H5P_register_real(pclass, H5D_ACS_DATA_CACHE_PREFETCH_NAME, H5D_ACS_DATA_CACHE_PREFETCH_SIZE, &rdcc_prefetch, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register whether to load all chunk addresses when opening */
+    if(H5P_register_real(pclass, H5D_ACS_CHUNK_ADDR_MAP_NAME, H5D_ACS_CHUNK_ADDR_MAP_SIZE, &chunk_addr_map, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dacc_reg_prop() */
@@ -271,5 +295,222 @@ H5Pget_chunk_cache(hid_t dapl_id, size_t *rdcc_nslots, size_t *rdcc_nbytes, doub
 
 done:
     FUNC_LEAVE_API(ret_value)
-}
+} /* end H5Pget_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_cache_policy
+ *
+ * Purpose:	Set the policy used to choose which chunks are preempted
+ *		from the raw data chunk cache when room is needed.
+ *
+ *		H5D_CHUNK_CACHE_POLICY_W0 is the traditional preemption
+ *		policy, which walks the cache in approximate least
+ *		recently used order, favoring fully read or written chunks
+ *		as directed by the RDCC_W0 value.
+ *		H5D_CHUNK_CACHE_POLICY_LRU preempts the least recently used
+ *		chunk, H5D_CHUNK_CACHE_POLICY_LFU the least frequently
+ *		used chunk and H5D_CHUNK_CACHE_POLICY_ARC balances recency
+ *		against frequency with an adaptive replacement cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t policy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iDp", dapl_id, policy);
+
+    /* Check arguments */
+    if(policy <= H5D_CHUNK_CACHE_POLICY_ERROR || policy >= H5D_CHUNK_CACHE_POLICY_NTYPES)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid raw data cache eviction policy")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5D_ACS_DATA_CACHE_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache eviction policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_cache_policy
+ *
+ * Purpose:	Retrieves the raw data chunk cache eviction policy set with
+ *		H5Pset_chunk_cache_policy.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t *policy/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, policy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(policy)
+        if(H5P_get(plist, H5D_ACS_DATA_CACHE_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get data cache eviction policy")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_prefetch
+ *
+ * Purpose:	Sets the number of chunks to read ahead when the chunks of
+ *		a dataset are read in a sequential or strided order.  Once
+ *		a few chunks missing from the chunk cache have been read at
+ *		the same distance from each other, the next NCHUNKS chunks
+ *		at that distance are read into the cache together (and
+ *		unfiltered by several threads, if the transfer property
+ *		list allows it).  The read-ahead is limited to what fits in
+ *		the chunk cache.  Zero (the default) disables it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_prefetch(hid_t dapl_id, size_t nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5D_ACS_DATA_CACHE_PREFETCH_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of chunks to read ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_prefetch
+ *
+ * Purpose:	Retrieves the number of chunks to read ahead set with
+ *		H5Pset_chunk_prefetch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_prefetch(hid_t dapl_id, size_t *nchunks/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(nchunks)
+        if(H5P_get(plist, H5D_ACS_DATA_CACHE_PREFETCH_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of chunks to read ahead")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_addr_map
+ *
+ * Purpose:	Sets whether the addresses of all of a chunked dataset's
+ *		chunks are loaded into memory, in one pass over its chunk
+ *		index, when the dataset is opened.  Later lookups of chunks
+ *		are then answered from memory, including lookups of chunks
+ *		that don't exist.  Off by default.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_addr_map(hid_t dapl_id, hbool_t load)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ib", dapl_id, load);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5D_ACS_CHUNK_ADDR_MAP_NAME, &load) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk address loading")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_addr_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_addr_map
+ *
+ * Purpose:	Retrieves whether all chunk addresses are loaded when the
+ *		dataset is opened, as set with H5Pset_chunk_addr_map.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_addr_map(hid_t dapl_id, hbool_t *load/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", dapl_id, load);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(load)
+        if(H5P_get(plist, H5D_ACS_CHUNK_ADDR_MAP_NAME, load) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk address loading")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_addr_map() */
 
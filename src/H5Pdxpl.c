@@ -118,6 +118,9 @@
 /* Definitions for filter callback function property */
 #define H5D_XFER_FILTER_CB_SIZE     sizeof(H5Z_cb_t)
 #define H5D_XFER_FILTER_CB_DEF      {NULL,NULL}
+/* Definitions for filter threads property */
+#define H5D_XFER_FILTER_THREADS_SIZE sizeof(unsigned)
+#define H5D_XFER_FILTER_THREADS_DEF  1
 /* Definitions for type conversion callback function property */
 #define H5D_XFER_CONV_CB_SIZE       sizeof(H5T_conv_cb_t)
 #define H5D_XFER_CONV_CB_DEF        {NULL,NULL}
@@ -137,6 +140,15 @@
 #define H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_DEF		NULL
 #define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_SIZE	sizeof(size_t)
 #define H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_DEF	0
+/* Definitions for properties of direct chunk read */
+#define H5D_XFER_DIRECT_CHUNK_READ_FLAG_SIZE		sizeof(hbool_t)
+#define H5D_XFER_DIRECT_CHUNK_READ_FLAG_DEF		FALSE
+#define H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_SIZE		sizeof(size_t)
+#define H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_DEF		0
+#define H5D_XFER_DIRECT_CHUNK_READ_OFFSET_SIZE		sizeof(hsize_t *)
+#define H5D_XFER_DIRECT_CHUNK_READ_OFFSET_DEF		NULL
+#define H5D_XFER_DIRECT_CHUNK_READ_FILTERS_SIZE		sizeof(uint32_t *)
+#define H5D_XFER_DIRECT_CHUNK_READ_FILTERS_DEF		NULL
 
 /******************/
 /* Local Typedefs */
@@ -227,12 +239,17 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
 #endif /* H5_HAVE_PARALLEL */
     H5Z_EDC_t enable_edc = H5D_XFER_EDC_DEF;            /* Default value for EDC property */
     H5Z_cb_t filter_cb = H5D_XFER_FILTER_CB_DEF;        /* Default value for filter callback */
+    unsigned filter_threads = H5D_XFER_FILTER_THREADS_DEF;  /* Default value for filter threads */
     H5T_conv_cb_t conv_cb = H5D_XFER_CONV_CB_DEF;       /* Default value for datatype conversion callback */
     void *def_xfer_xform = H5D_XFER_XFORM_DEF;          /* Default value for data transform */
     hbool_t direct_chunk_flag = H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_DEF; 	        /* Default value for the flag of direct chunk write */
     uint32_t direct_chunk_filters = H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_DEF;	/* Default value for the filters of direct chunk write */
     hsize_t *direct_chunk_offset = H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_DEF; 	/* Default value for the offset of direct chunk write */
     size_t direct_chunk_datasize = H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_DEF;    /* Default value for the datasize of direct chunk write */
+    hbool_t direct_chunk_read_flag = H5D_XFER_DIRECT_CHUNK_READ_FLAG_DEF;      /* Default value for the flag of direct chunk read */
+    size_t direct_chunk_read_nchunks = H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_DEF; /* Default value for the # of chunks of direct chunk read */
+    hsize_t *direct_chunk_read_offset = H5D_XFER_DIRECT_CHUNK_READ_OFFSET_DEF; /* Default value for the offsets of direct chunk read */
+    uint32_t *direct_chunk_read_filters = H5D_XFER_DIRECT_CHUNK_READ_FILTERS_DEF; /* Default value for the filter masks of direct chunk read */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
@@ -325,6 +342,10 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
     if(H5P_register_real(pclass, H5D_XFER_FILTER_CB_NAME, H5D_XFER_FILTER_CB_SIZE, &filter_cb, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the filter threads property */
+    if(H5P_register_real(pclass, H5D_XFER_FILTER_THREADS_NAME, H5D_XFER_FILTER_THREADS_SIZE, &filter_threads, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the type conversion callback property */
     if(H5P_register_real(pclass, H5D_XFER_CONV_CB_NAME, H5D_XFER_CONV_CB_SIZE, &conv_cb, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
@@ -357,6 +378,30 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the property of flag for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, H5D_XFER_DIRECT_CHUNK_READ_FLAG_SIZE, &direct_chunk_read_flag,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of number of chunks for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_NAME, H5D_XFER_DIRECT_CHUNK_READ_NCHUNKS_SIZE, &direct_chunk_read_nchunks,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of offsets for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_SIZE, &direct_chunk_read_offset,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the property of filter masks for direct chunk read */
+    /* (Note: this property should not have an encode/decode callback) */
+    if(H5P_register_real(pclass, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_NAME, H5D_XFER_DIRECT_CHUNK_READ_FILTERS_SIZE, &direct_chunk_read_filters,
+            NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__dxfr_reg_prop() */
@@ -1332,6 +1377,88 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_hyper_vector_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_threads
+ *
+ * Purpose:	Given a dataset transfer property list, set the maximum
+ *              number of threads used to run the dataset's filter pipeline
+ *              when a read or write touches several chunks.  Chunks are
+ *              still read from and written to the file one at a time, but
+ *              are decompressed (or compressed) concurrently.
+ *
+ *              Filters, including any third-party filter and the callback
+ *              set with H5Pset_filter_callback, may then be called from
+ *              threads other than the application's, and must be safe to
+ *              call concurrently.  Only filters which are already
+ *              registered are run this way, pipelines needing a filter
+ *              plugin to be loaded are always run serially.
+ *
+ *		The default is 1, which runs the pipeline in the calling
+ *              thread.  The setting has no effect if the library was built
+ *              without thread support.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_threads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be at least 1")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_FILTER_THREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_threads
+ *
+ * Purpose:	Reads values previously set with H5Pset_filter_threads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_threads(hid_t plist_id, unsigned *nthreads/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_FILTER_THREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_threads() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
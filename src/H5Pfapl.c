@@ -68,6 +68,9 @@
 /* Definition for preemption read chunks first */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_SIZE        sizeof(double)
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEF         0.75f
+/* Definition for size of raw data chunk cache shared by all datasets(bytes) */
+#define H5F_ACS_DATA_CACHE_SHARED_SIZE_SIZE     sizeof(size_t)
+#define H5F_ACS_DATA_CACHE_SHARED_SIZE_DEF      0
 /* Definition for threshold for alignment */
 #define H5F_ACS_ALIGN_THRHD_SIZE                sizeof(hsize_t)
 #define H5F_ACS_ALIGN_THRHD_DEF                 1
@@ -129,6 +132,30 @@
 #define H5F_ACS_FILE_IMAGE_INFO_DEL             H5P_file_image_info_del
 #define H5F_ACS_FILE_IMAGE_INFO_COPY            H5P_file_image_info_copy
 #define H5F_ACS_FILE_IMAGE_INFO_CLOSE           H5P_file_image_info_close
+/* Definition of core VFD write tracking flag */
+#define H5F_ACS_CORE_WRITE_TRACKING_FLAG_SIZE   sizeof(hbool_t)
+#define H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEF    FALSE
+/* Definition of core VFD write tracking page size */
+#define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_SIZE      sizeof(size_t)
+#define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF       524288
+/* Definition of metadata prefetch size */
+#define H5F_ACS_META_PREFETCH_SIZE_SIZE         sizeof(size_t)
+#define H5F_ACS_META_PREFETCH_SIZE_DEF          0
+/* Definition of metadata cache image configuration */
+#define H5F_ACS_MDC_IMAGE_CONFIG_SIZE           sizeof(H5AC_cache_image_config_t)
+#define H5F_ACS_MDC_IMAGE_CONFIG_DEF            H5AC__DEFAULT_CACHE_IMAGE_CONFIG
+/* Definition of page buffer size */
+#define H5F_ACS_PAGE_BUFFER_SIZE_SIZE           sizeof(size_t)
+#define H5F_ACS_PAGE_BUFFER_SIZE_DEF            0
+/* Definition of page buffer page size */
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_SIZE      sizeof(size_t)
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_DEF       (64 * 1024)
+/* Definition of minimum percentage of page buffer pages kept for metadata */
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_SIZE  sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF   0
+/* Definition of minimum percentage of page buffer pages kept for raw data */
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_SIZE   sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF    0
 
 
 /******************/
@@ -206,6 +233,7 @@ H5P_facc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5F_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
     double rdcc_w0 = H5F_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+    size_t rdcc_shared_nbytes = H5F_ACS_DATA_CACHE_SHARED_SIZE_DEF; /* Default shared raw data chunk cache # of bytes */
     hsize_t threshold = H5F_ACS_ALIGN_THRHD_DEF;                /* Default allocation alignment threshold */
     hsize_t alignment = H5F_ACS_ALIGN_DEF;                      /* Default allocation alignment value */
     hsize_t meta_block_size = H5F_ACS_META_BLOCK_SIZE_DEF;      /* Default metadata allocation block size */
@@ -223,6 +251,14 @@ H5P_facc_reg_prop(H5P_genclass_t *pclass)
     hbool_t want_posix_fd = H5F_ACS_WANT_POSIX_FD_DEF;          /* Default setting for retrieving 'handle' from core VFD */
     unsigned efc_size = H5F_ACS_EFC_SIZE_DEF;                   /* Default external file cache size */
     H5FD_file_image_info_t file_image_info = H5F_ACS_FILE_IMAGE_INFO_DEF;  /* Default file image info and callbacks */
+    hbool_t core_write_tracking_flag = H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEF;   /* Default setting for core VFD write tracking */
+    size_t core_write_tracking_page_size = H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF;  /* Default core VFD write tracking page size */
+    size_t meta_prefetch_size = H5F_ACS_META_PREFETCH_SIZE_DEF; /* Default metadata prefetch size */
+    H5AC_cache_image_config_t mdc_image_config = H5F_ACS_MDC_IMAGE_CONFIG_DEF; /* Default metadata cache image settings */
+    size_t page_buf_size = H5F_ACS_PAGE_BUFFER_SIZE_DEF; /* Default page buffer size */
+    size_t page_buf_page_size = H5F_ACS_PAGE_BUFFER_PAGE_SIZE_DEF; /* Default page buffer page size */
+    unsigned page_buf_min_meta_perc = H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default minimum percentage of pages kept for metadata */
+    unsigned page_buf_min_raw_perc = H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF; /* Default minimum percentage of pages kept for raw data */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -243,6 +279,10 @@ H5P_facc_reg_prop(H5P_genclass_t *pclass)
     if(H5P_register_real(pclass, H5F_ACS_PREEMPT_READ_CHUNKS_NAME, H5F_ACS_PREEMPT_READ_CHUNKS_SIZE, &rdcc_w0, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of the raw data chunk cache shared by all datasets */
+    if(H5P_register_real(pclass, H5F_ACS_DATA_CACHE_SHARED_SIZE_NAME, H5F_ACS_DATA_CACHE_SHARED_SIZE_SIZE, &rdcc_shared_nbytes, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the threshold for alignment */
     if(H5P_register_real(pclass, H5F_ACS_ALIGN_THRHD_NAME, H5F_ACS_ALIGN_THRHD_SIZE, &threshold, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
@@ -312,6 +352,38 @@ H5P_facc_reg_prop(H5P_genclass_t *pclass)
     if(H5P_register_real(pclass, H5F_ACS_FILE_IMAGE_INFO_NAME, H5F_ACS_FILE_IMAGE_INFO_SIZE, &file_image_info, NULL, NULL, NULL, H5F_ACS_FILE_IMAGE_INFO_DEL, H5F_ACS_FILE_IMAGE_INFO_COPY, NULL, H5F_ACS_FILE_IMAGE_INFO_CLOSE) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the core VFD backing store write tracking flag */
+    if(H5P_register_real(pclass, H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME, H5F_ACS_CORE_WRITE_TRACKING_FLAG_SIZE, &core_write_tracking_flag, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the size of the core VFD backing store page size */
+    if(H5P_register_real(pclass, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_SIZE, &core_write_tracking_page_size, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the metadata prefetch size */
+    if(H5P_register_real(pclass, H5F_ACS_META_PREFETCH_SIZE_NAME, H5F_ACS_META_PREFETCH_SIZE_SIZE, &meta_prefetch_size, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the metadata cache image configuration */
+    if(H5P_register_real(pclass, H5F_ACS_MDC_IMAGE_CONFIG_NAME, H5F_ACS_MDC_IMAGE_CONFIG_SIZE, &mdc_image_config, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the page buffer size */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_SIZE_NAME, H5F_ACS_PAGE_BUFFER_SIZE_SIZE, &page_buf_size, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the page buffer page size */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_SIZE, &page_buf_page_size, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the minimum percentage of page buffer pages kept for metadata */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_SIZE, &page_buf_min_meta_perc, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the minimum percentage of page buffer pages kept for raw data */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_SIZE, &page_buf_min_raw_perc, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P_facc_reg_prop() */
@@ -1088,6 +1160,78 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_chunk_cache_shared
+ *
+ * Purpose:	Sets the size of a raw data chunk cache that is shared by
+ *		all the chunked datasets in the file.  Datasets opened
+ *		without their own cache size (see H5Pset_chunk_cache) draw
+ *		on this common budget instead of getting a private cache
+ *		each, and the space moves to the datasets being accessed:
+ *		when the budget is full, chunks are preempted from the
+ *		dataset that was least recently accessed.  A size of zero
+ *		(the default) disables the shared cache.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_cache_shared(hid_t plist_id, size_t rdcc_nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, rdcc_nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set size */
+    if(H5P_set(plist, H5F_ACS_DATA_CACHE_SHARED_SIZE_NAME, &rdcc_nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET,FAIL, "can't set shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_cache_shared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_chunk_cache_shared
+ *
+ * Purpose:	Retrieves the size of the raw data chunk cache shared by all
+ *		the chunked datasets in the file.  Zero means the shared
+ *		cache is disabled.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_shared(hid_t plist_id, size_t *rdcc_nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", plist_id, rdcc_nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get size */
+    if(rdcc_nbytes)
+        if(H5P_get(plist, H5F_ACS_DATA_CACHE_SHARED_SIZE_NAME, rdcc_nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_shared() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_mdc_config
@@ -1183,6 +1327,101 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Pget_mdc_config() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_mdc_image_config
+ *
+ * Purpose:	Set the metadata cache image configuration in the target
+ *		FAPL.
+ *
+ *		When generate_image is TRUE and the file is closed after
+ *		being opened with write access, the extents of the metadata
+ *		held in the metadata cache are recorded in a file next to
+ *		it, named after it with ".mdci" appended; the HDF5 file
+ *		itself isn't changed.  The next time the file is opened
+ *		with generate_image set, that metadata is read in with a
+ *		few large I/Os, so the cache is warmed without reading its
+ *		entries one at a time.  Only the sec2, stdio, log, io_uring
+ *		and mmap drivers, which store the file as one file under
+ *		its name, keep images.
+ *
+ *		Observe that the function will fail if config_ptr is
+ *		NULL, or if config_ptr->version specifies an unknown
+ *		version of H5AC_cache_image_config_t.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", plist_id, config_ptr);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* validate the new configuration */
+    if(config_ptr == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL config_ptr on entry.")
+    if(config_ptr->version != H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unknown image config version.")
+
+    /* set the modified config */
+    if(H5P_set(plist, H5F_ACS_MDC_IMAGE_CONFIG_NAME, config_ptr) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata cache image config")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pset_mdc_image_config() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_mdc_image_config
+ *
+ * Purpose:	Retrieve the metadata cache image configuration from the
+ *		target FAPL.
+ *
+ *		Observe that the function will fail if config_ptr is
+ *		NULL, or if config_ptr->version specifies an unknown
+ *		version of H5AC_cache_image_config_t.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_image_config(hid_t plist_id, H5AC_cache_image_config_t *config_ptr)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*x", plist_id, config_ptr);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* validate the config_ptr */
+    if(config_ptr == NULL)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL config_ptr on entry.")
+    if(config_ptr->version != H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Unknown image config version.")
+
+    /* Get the current metadata cache image configuration */
+    if(H5P_get(plist, H5F_ACS_MDC_IMAGE_CONFIG_NAME, config_ptr) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get metadata cache image config")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Pget_mdc_image_config() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_gc_references
@@ -2166,6 +2405,343 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_file_image_callbacks() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_core_write_tracking
+ *
+ * Purpose:     Enables/disables core VFD write tracking and sets the
+ *              page aggregation size.
+ *
+ *              When write tracking is enabled, the core VFD records the
+ *              regions of the in-memory image that are modified and only
+ *              writes those regions to the backing store when the file
+ *              is flushed or closed.  Dirty regions are rounded out to
+ *              multiples of PAGE_SIZE bytes, so that many small writes
+ *              are combined into fewer, larger writes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_write_tracking(hid_t plist_id, hbool_t is_enabled, size_t page_size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ibz", plist_id, is_enabled, page_size);
+
+    /* Check arguments */
+    if(0 == page_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page_size cannot be zero")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME, &is_enabled) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD write tracking flag")
+    if(H5P_set(plist, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME, &page_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD write tracking page size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_write_tracking() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_core_write_tracking
+ *
+ * Purpose:     Gets information about core VFD write tracking and page
+ *              aggregation size.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_write_tracking(hid_t plist_id, hbool_t *is_enabled/*out*/,
+    size_t *page_size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, is_enabled, page_size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(is_enabled)
+        if(H5P_get(plist, H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME, is_enabled) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get core VFD write tracking flag")
+    if(page_size)
+        if(H5P_get(plist, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME, page_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get core VFD write tracking page size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_write_tracking() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_meta_prefetch_size
+ *
+ * Purpose:     Sets the size of the window used to prefetch metadata.
+ *
+ *              When a metadata read misses the metadata accumulator, the
+ *              library reads the aligned SIZE-byte window of the file
+ *              around the request with a single I/O and keeps it in the
+ *              accumulator, so that the nearby object headers, heaps and
+ *              B-tree nodes visited while traversing a file that was
+ *              written sequentially are served from memory.  The window
+ *              is limited to the end of the allocated file space and to
+ *              the maximum size of the metadata accumulator (1MB).
+ *
+ *              The default value is 0, which disables prefetching.  The
+ *              VFL driver must allow metadata accumulation for this
+ *              setting to have any effect.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_meta_prefetch_size(hid_t plist_id, size_t size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_META_PREFETCH_SIZE_NAME, &size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set metadata prefetch size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_meta_prefetch_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_meta_prefetch_size
+ *
+ * Purpose:     Returns the metadata prefetch window size from a file
+ *              access property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_meta_prefetch_size(hid_t plist_id, size_t *size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(size)
+        if(H5P_get(plist, H5F_ACS_META_PREFETCH_SIZE_NAME, size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get metadata prefetch size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_meta_prefetch_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_size
+ *
+ * Purpose:     Sets the maximum size of the page buffer, and the minimum
+ *              percentages of its pages that are kept for metadata and
+ *              for raw data.
+ *
+ *              The page buffer caches whole pages of the file (see
+ *              H5Pset_page_buffer_page_size), so that metadata and small
+ *              raw data I/O is done in page-sized, page-aligned reads and
+ *              writes.  Accesses of a page or more bypass the buffer.
+ *              When the buffer is enabled, the metadata and "small data"
+ *              aggregators allocate blocks of at least a page, so small
+ *              objects are packed into pages.
+ *
+ *              When pages must be evicted, the least recently used page
+ *              is chosen, except that a page is not evicted to make room
+ *              for a page of the other kind if that would leave fewer
+ *              pages of its kind than the minimum percentage.
+ *
+ *              The default size is 0, which disables the page buffer.
+ *              The size must be at least one page when the file is
+ *              opened, and the VFL driver must allow metadata
+ *              accumulation (i.e. not the multi/split or parallel
+ *              drivers).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size, unsigned min_meta_perc,
+    unsigned min_raw_perc)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "izIuIu", plist_id, buf_size, min_meta_perc, min_raw_perc);
+
+    /* Check arguments */
+    if(min_meta_perc > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "minimum metadata percentage must be between 0 and 100")
+    if(min_raw_perc > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "minimum raw data percentage must be between 0 and 100")
+    if((min_meta_perc + min_raw_perc) > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sum of minimum metadata and raw data percentages can't exceed 100")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, &buf_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer size")
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, &min_meta_perc) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set minimum metadata fraction of page buffer")
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &min_raw_perc) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set minimum raw data fraction of page buffer")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_size
+ *
+ * Purpose:     Returns the maximum size of the page buffer, and the
+ *              minimum percentages of its pages kept for metadata and
+ *              for raw data, from a file access property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size/*out*/,
+    unsigned *min_meta_perc/*out*/, unsigned *min_raw_perc/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", plist_id, buf_size, min_meta_perc, min_raw_perc);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(buf_size)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, buf_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer size")
+    if(min_meta_perc)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, min_meta_perc) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get minimum metadata fraction of page buffer")
+    if(min_raw_perc)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, min_raw_perc) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get minimum raw data fraction of page buffer")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_page_buffer_page_size
+ *
+ * Purpose:     Sets the size of the pages cached by the page buffer (see
+ *              H5Pset_page_buffer_size).  Pages are aligned to multiples
+ *              of their size in the file's address space.
+ *
+ *              The default page size is 64KB.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_page_size(hid_t plist_id, size_t page_size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, page_size);
+
+    /* Check arguments */
+    if(page_size == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page size must be positive")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set value */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, &page_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer page size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_page_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_page_buffer_page_size
+ *
+ * Purpose:     Returns the size of the pages cached by the page buffer
+ *              from a file access property list.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_page_size(hid_t plist_id, size_t *page_size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, page_size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value */
+    if(page_size)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, page_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer page size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_page_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5P_file_image_info_del
@@ -315,10 +315,17 @@ H5_DLL herr_t H5Pget_cache(hid_t plist_id,
        int *mdc_nelmts, /* out */
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/, double *rdcc_w0);
+H5_DLL herr_t H5Pset_chunk_cache_shared(hid_t plist_id, size_t rdcc_nbytes);
+H5_DLL herr_t H5Pget_chunk_cache_shared(hid_t plist_id,
+       size_t *rdcc_nbytes/*out*/);
 H5_DLL herr_t H5Pset_mdc_config(hid_t    plist_id,
        H5AC_cache_config_t * config_ptr);
 H5_DLL herr_t H5Pget_mdc_config(hid_t     plist_id,
        H5AC_cache_config_t * config_ptr);	/* out */
+H5_DLL herr_t H5Pset_mdc_image_config(hid_t plist_id,
+       H5AC_cache_image_config_t * config_ptr);
+H5_DLL herr_t H5Pget_mdc_image_config(hid_t plist_id,
+       H5AC_cache_image_config_t * config_ptr);	/* out */
 H5_DLL herr_t H5Pset_gc_references(hid_t fapl_id, unsigned gc_ref);
 H5_DLL herr_t H5Pget_gc_references(hid_t fapl_id, unsigned *gc_ref/*out*/);
 H5_DLL herr_t H5Pset_fclose_degree(hid_t fapl_id, H5F_close_degree_t degree);
@@ -341,6 +348,18 @@ H5_DLL herr_t H5Pset_file_image_callbacks(hid_t fapl_id,
        H5FD_file_image_callbacks_t *callbacks_ptr);
 H5_DLL herr_t H5Pget_file_image_callbacks(hid_t fapl_id,
        H5FD_file_image_callbacks_t *callbacks_ptr);
+H5_DLL herr_t H5Pset_core_write_tracking(hid_t fapl_id, hbool_t is_enabled,
+    size_t page_size);
+H5_DLL herr_t H5Pget_core_write_tracking(hid_t fapl_id, hbool_t *is_enabled/*out*/,
+    size_t *page_size/*out*/);
+H5_DLL herr_t H5Pset_meta_prefetch_size(hid_t fapl_id, size_t size);
+H5_DLL herr_t H5Pget_meta_prefetch_size(hid_t fapl_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_page_buffer_size(hid_t plist_id, size_t buf_size,
+    unsigned min_meta_perc, unsigned min_raw_perc);
+H5_DLL herr_t H5Pget_page_buffer_size(hid_t plist_id, size_t *buf_size/*out*/,
+    unsigned *min_meta_perc/*out*/, unsigned *min_raw_perc/*out*/);
+H5_DLL herr_t H5Pset_page_buffer_page_size(hid_t plist_id, size_t page_size);
+H5_DLL herr_t H5Pget_page_buffer_page_size(hid_t plist_id, size_t *page_size/*out*/);
 
 /* Dataset creation property list (DCPL) routines */
 H5_DLL herr_t H5Pset_layout(hid_t plist_id, H5D_layout_t layout);
@@ -377,6 +396,14 @@ H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id,
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/,
        double *rdcc_w0/*out*/);
+H5_DLL herr_t H5Pset_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t policy);
+H5_DLL herr_t H5Pget_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t *policy/*out*/);
+H5_DLL herr_t H5Pset_chunk_prefetch(hid_t dapl_id, size_t nchunks);
+H5_DLL herr_t H5Pget_chunk_prefetch(hid_t dapl_id, size_t *nchunks/*out*/);
+H5_DLL herr_t H5Pset_chunk_addr_map(hid_t dapl_id, hbool_t load);
+H5_DLL herr_t H5Pget_chunk_addr_map(hid_t dapl_id, hbool_t *load/*out*/);
 
 /* Dataset xfer property list (DXPL) routines */
 H5_DLL herr_t H5Pset_data_transform(hid_t plist_id, const char* expression);
@@ -407,6 +434,8 @@ H5_DLL herr_t H5Pget_vlen_mem_manager(hid_t plist_id,
                                        void **free_info);
 H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_filter_threads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_filter_threads(hid_t plist_id, unsigned *nthreads/*out*/);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void* operate_data);
 H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void** operate_data);
 #ifdef H5_HAVE_PARALLEL
@@ -4614,6 +4614,56 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5S_hyper_denormalize_offset() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_hyper_get_regular
+ PURPOSE
+    Retrieve the start, stride, count & block of a regular hyperslab selection
+ USAGE
+    htri_t H5S_hyper_get_regular(space, diminfo)
+        const H5S_t *space;         IN: Pointer to dataspace to query
+        H5S_hyper_dim_t *diminfo;   OUT: Regular selection for each dimension
+ RETURNS
+    TRUE if the selection is a regular hyperslab and DIMINFO was filled in,
+    FALSE if it isn't.
+ DESCRIPTION
+    Copies the "optimized" form of a regular hyperslab selection (contiguous
+    blocks merged), with the selection offset added to each start.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    Irregular hyperslabs (those built with more than one "set" operation),
+    and any other kind of selection, return FALSE.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+htri_t
+H5S_hyper_get_regular(const H5S_t *space, H5S_hyper_dim_t *diminfo)
+{
+    const H5S_hyper_dim_t *opt_diminfo; /* Selection's regular information */
+    unsigned u;                         /* Local index variable */
+    htri_t ret_value = FALSE;           /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(space);
+    HDassert(diminfo);
+
+    if(H5S_GET_SELECT_TYPE(space) == H5S_SEL_HYPERSLABS && space->select.sel_info.hslab->diminfo_valid) {
+        opt_diminfo = space->select.sel_info.hslab->opt_diminfo;
+        for(u = 0; u < space->extent.rank; u++) {
+            diminfo[u].start = (hsize_t)((hssize_t)opt_diminfo[u].start + space->select.offset[u]);
+            diminfo[u].stride = opt_diminfo[u].stride;
+            diminfo[u].count = opt_diminfo[u].count;
+            diminfo[u].block = opt_diminfo[u].block;
+        } /* end for */
+
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5S_hyper_get_regular() */
+
 
 /*--------------------------------------------------------------------------
  NAME
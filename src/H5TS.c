@@ -38,6 +38,13 @@ H5TS_key_t H5TS_errstk_key_g;
 H5TS_key_t H5TS_funcstk_key_g;
 H5TS_key_t H5TS_cancel_key_g;
 
+#ifndef H5_HAVE_WIN_THREADS
+/* Reads running without the API lock (see H5TS_readers_enter) */
+static pthread_mutex_t H5TS_readers_mutex_g = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t H5TS_readers_cond_g = PTHREAD_COND_INITIALIZER;
+static unsigned int H5TS_nreaders_g = 0;
+#endif /* H5_HAVE_WIN_THREADS */
+
 
 /*--------------------------------------------------------------------------
  * NAME
@@ -94,6 +101,7 @@ BOOL CALLBACK
 H5TS_win32_first_thread_init(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpContex)
 {
     InitializeCriticalSection ( &H5_g.init_lock.CriticalSection );
+    InitializeCriticalSection ( &H5_g.ids_lock.CriticalSection );
     H5TS_errstk_key_g = TlsAlloc();
     H5TS_funcstk_key_g = TlsAlloc();
     H5TS_cancel_key_g = TlsAlloc();
@@ -111,9 +119,9 @@ H5TS_win32_first_thread_init(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpCont
  * RETURNS
  *
  * DESCRIPTION
- *   Initialization of global API lock, keys for per-thread error stacks and
- *   cancallability information. Called by the first thread that enters the
- *   library.
+ *   Initialization of global API lock, the ID table lock, keys for
+ *   per-thread error stacks and cancallability information. Called by the
+ *   first thread that enters the library.
  *
  * PROGRAMMER: Chee Wai LEE
  *             May 2, 2000
@@ -125,6 +133,8 @@ H5TS_win32_first_thread_init(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpCont
 void
 H5TS_pthread_first_thread_init(void)
 {
+    pthread_mutexattr_t attr;   /* Attributes for the API mutex */
+
     H5_g.H5_libinit_g = FALSE;
     
 #ifdef H5_HAVE_WIN32_API
@@ -133,10 +143,17 @@ H5TS_pthread_first_thread_init(void)
 # endif
 #endif
 
-    /* initialize global API mutex lock */
-    pthread_mutex_init(&H5_g.init_lock.atomic_lock, NULL);
-    pthread_cond_init(&H5_g.init_lock.cond_var, NULL);
-    H5_g.init_lock.lock_count = 0;
+    /* initialize global API mutex lock as a native recursive mutex, so
+     * that re-entering the library from a callback doesn't deadlock and
+     * H5TS_mutex_lock/H5TS_mutex_unlock are a single pthread call each
+     */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&H5_g.init_lock.mutex, &attr);
+
+    /* initialize the ID table lock the same way (see H5I.c) */
+    pthread_mutex_init(&H5_g.ids_lock.mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
 
     /* initialize key for thread-specific error stacks */
     pthread_key_create(&H5TS_errstk_key_g, H5TS_key_destructor);
@@ -179,27 +196,14 @@ H5TS_mutex_lock(H5TS_mutex_t *mutex)
 {
 #ifdef  H5_HAVE_WIN_THREADS
     EnterCriticalSection( &mutex->CriticalSection); 
+    mutex->lock_count++;
     return 0;
 #else /* H5_HAVE_WIN_THREADS */
-    herr_t ret_value = pthread_mutex_lock(&mutex->atomic_lock);
-
-    if (ret_value)
-        return ret_value;
+    herr_t ret_value = pthread_mutex_lock(&mutex->mutex);
 
-    if(mutex->lock_count && pthread_equal(HDpthread_self(), mutex->owner_thread)) {
-        /* already owned by self - increment count */
+    if(ret_value == 0)
         mutex->lock_count++;
-    } else {
-        /* if owned by other thread, wait for condition signal */
-        while(mutex->lock_count)
-            pthread_cond_wait(&mutex->cond_var, &mutex->atomic_lock);
-
-        /* After we've received the signal, take ownership of the mutex */
-        mutex->owner_thread = HDpthread_self();
-        mutex->lock_count = 1;
-    }
-
-    return pthread_mutex_unlock(&mutex->atomic_lock); 
+    return ret_value;
 #endif /* H5_HAVE_WIN_THREADS */
 }
 
@@ -234,29 +238,148 @@ H5TS_mutex_unlock(H5TS_mutex_t *mutex)
 {
 #ifdef  H5_HAVE_WIN_THREADS
     /* Releases ownership of the specified critical section object. */
+    mutex->lock_count--;
     LeaveCriticalSection(&mutex->CriticalSection);
     return 0; 
 #else  /* H5_HAVE_WIN_THREADS */
-    herr_t ret_value = pthread_mutex_lock(&mutex->atomic_lock);
+    mutex->lock_count--;
+    return pthread_mutex_unlock(&mutex->mutex);
+#endif /* H5_HAVE_WIN_THREADS */
+} /* H5TS_mutex_unlock */
 
-    if(ret_value)
-        return ret_value;
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_release
+ *
+ * USAGE
+ *    H5TS_mutex_release(&mutex_var, &lock_count)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Releases a recursive lock held by the calling thread completely, no
+ *    matter how many times the thread has acquired it, and returns that
+ *    number in LOCK_COUNT so that H5TS_mutex_reacquire() can restore it.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_release(H5TS_mutex_t *mutex, unsigned int *lock_count)
+{
+    herr_t ret_value = 0;
 
-    mutex->lock_count--;
+    *lock_count = mutex->lock_count;
+    while(mutex->lock_count > 0 && ret_value == 0)
+        ret_value = H5TS_mutex_unlock(mutex);
 
-    ret_value = pthread_mutex_unlock(&mutex->atomic_lock);
+    return ret_value;
+} /* H5TS_mutex_release */
 
-    if(mutex->lock_count == 0) {
-        int err;
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_mutex_reacquire
+ *
+ * USAGE
+ *    H5TS_mutex_reacquire(&mutex_var, lock_count)
+ *
+ * RETURNS
+ *    0 on success and non-zero on error.
+ *
+ * DESCRIPTION
+ *    Acquires a recursive lock LOCK_COUNT times, undoing a call to
+ *    H5TS_mutex_release().
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_mutex_reacquire(H5TS_mutex_t *mutex, unsigned int lock_count)
+{
+    herr_t ret_value = 0;
 
-        err = pthread_cond_signal(&mutex->cond_var);
-        if(err != 0)
-            ret_value = err;
-    } /* end if */
+    while(lock_count-- > 0 && ret_value == 0)
+        ret_value = H5TS_mutex_lock(mutex);
 
-    return ret_value; 
+    return ret_value;
+} /* H5TS_mutex_reacquire */
+
+#ifndef H5_HAVE_WIN_THREADS
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_readers_enter
+ *
+ * USAGE
+ *    H5TS_readers_enter(&nreaders)
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *    Counts a read that is about to run without the API lock, both in
+ *    the object's count NREADERS and in the library-wide count.  Threads
+ *    which are about to free what the read uses wait for the counts to
+ *    drop with H5TS_readers_wait().
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_readers_enter(unsigned int *nreaders)
+{
+    pthread_mutex_lock(&H5TS_readers_mutex_g);
+    (*nreaders)++;
+    H5TS_nreaders_g++;
+    pthread_mutex_unlock(&H5TS_readers_mutex_g);
+} /* H5TS_readers_enter */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_readers_leave
+ *
+ * USAGE
+ *    H5TS_readers_leave(&nreaders)
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *    Undoes H5TS_readers_enter() once the read is finished, waking any
+ *    threads waiting for the counts to drop.  Must be called before the
+ *    reading thread acquires the API lock again.
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_readers_leave(unsigned int *nreaders)
+{
+    pthread_mutex_lock(&H5TS_readers_mutex_g);
+    (*nreaders)--;
+    H5TS_nreaders_g--;
+    pthread_cond_broadcast(&H5TS_readers_cond_g);
+    pthread_mutex_unlock(&H5TS_readers_mutex_g);
+} /* H5TS_readers_leave */
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_readers_wait
+ *
+ * USAGE
+ *    H5TS_readers_wait(&nreaders)
+ *
+ * RETURNS
+ *
+ * DESCRIPTION
+ *    Waits until no reads counted in NREADERS are running, or no reads at
+ *    all if NREADERS is NULL.
+ *
+ *--------------------------------------------------------------------------
+ */
+void
+H5TS_readers_wait(const unsigned int *nreaders)
+{
+    pthread_mutex_lock(&H5TS_readers_mutex_g);
+    while((nreaders ? *nreaders : H5TS_nreaders_g) > 0)
+        pthread_cond_wait(&H5TS_readers_cond_g, &H5TS_readers_mutex_g);
+    pthread_mutex_unlock(&H5TS_readers_mutex_g);
+} /* H5TS_readers_wait */
 #endif /* H5_HAVE_WIN_THREADS */
-} /* H5TS_mutex_unlock */
 
 /*--------------------------------------------------------------------------
  * NAME
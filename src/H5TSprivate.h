@@ -40,6 +40,7 @@
 /* Mutexes, Threads, and Attributes */
 typedef struct H5TS_mutex_struct {
 	CRITICAL_SECTION CriticalSection;
+	unsigned int lock_count;	/* # of times the owner holds it */
 } H5TS_mutex_t;
 typedef CRITICAL_SECTION H5TS_mutex_simple_t;
 typedef HANDLE H5TS_thread_t;
@@ -72,10 +73,8 @@ H5TS_win32_first_thread_init(PINIT_ONCE InitOnce, PVOID Parameter, PVOID *lpCont
 
 /* Mutexes, Threads, and Attributes */
 typedef struct H5TS_mutex_struct {
-    pthread_t owner_thread;		/* current lock owner */
-    pthread_mutex_t atomic_lock;	/* lock for atomicity of new mechanism */
-    pthread_cond_t cond_var;		/* condition variable */
-    unsigned int lock_count;
+    pthread_mutex_t mutex;		/* recursive mutex */
+    unsigned int lock_count;		/* # of times the owner holds it */
 } H5TS_mutex_t;
 typedef pthread_t      H5TS_thread_t;
 typedef pthread_attr_t H5TS_attr_t;
@@ -113,6 +112,13 @@ extern      "C"
 H5_DLL void   H5TS_pthread_first_thread_init(void);
 H5_DLL herr_t H5TS_mutex_lock(H5TS_mutex_t *mutex);
 H5_DLL herr_t H5TS_mutex_unlock(H5TS_mutex_t *mutex);
+H5_DLL herr_t H5TS_mutex_release(H5TS_mutex_t *mutex, unsigned int *lock_count);
+H5_DLL herr_t H5TS_mutex_reacquire(H5TS_mutex_t *mutex, unsigned int lock_count);
+#ifndef H5_HAVE_WIN_THREADS
+H5_DLL void   H5TS_readers_enter(unsigned int *nreaders);
+H5_DLL void   H5TS_readers_leave(unsigned int *nreaders);
+H5_DLL void   H5TS_readers_wait(const unsigned int *nreaders);
+#endif /* H5_HAVE_WIN_THREADS */
 H5_DLL herr_t H5TS_cancel_count_inc(void);
 H5_DLL herr_t H5TS_cancel_count_dec(void);
 H5_DLL H5TS_thread_t H5TS_create_thread(void * func, H5TS_attr_t * attr, void *udata);
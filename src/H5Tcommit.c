@@ -217,6 +217,9 @@ H5T__commit_named(const H5G_loc_t *loc, const char *name, H5T_t *dt,
         HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to create and link to named datatype")
     HDassert(ocrt_info.new_obj);
 
+    /* The datatype's ID (if it has one) now refers to an object with a path */
+    H5G_name_index_reset();
+
 done:
     /* If the datatype was committed but something failed after that, we need
      * to return it to the state it was in before it was committed.
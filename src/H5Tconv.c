@@ -715,7 +715,11 @@
             } /* end else */						      \
                                                                               \
             /* Perform loop over elements to convert */			      \
-            if (s_mv && d_mv) {						      \
+            if(NULL == cb_struct.func && s_stride == (ssize_t)sizeof(ST)     \
+                    && d_stride == (ssize_t)sizeof(DT)) {		      \
+                /* Densely packed elements, without exception handling */   \
+                H5T_CONV_LOOP_PACKED(H5_GLUE(GUTS,_NOEX),ST,DT,D_MIN,D_MAX) \
+            } else if (s_mv && d_mv) {					      \
                 /* Alignment is required for both source and dest */	      \
                 s = &src_aligned;					      \
                 H5T_CONV_LOOP_OUTER(PRE_SALIGN,PRE_DALIGN,POST_SALIGN,POST_DALIGN,GUTS,s,d,ST,DT,D_MIN,D_MAX) \
@@ -845,6 +849,38 @@ done:                                                                         \
         dst = (DT *)dst_buf;						      \
     }
 
+/* Number of elements converted at once by H5T_CONV_LOOP_PACKED */
+#define H5T_CONV_PACKED_NELMTS  256
+
+/* The type conversion loop for densely packed elements when there is no
+ * exception handling routine.  Elements are converted in blocks between two
+ * local arrays, which can't overlap each other (or anything else), so the
+ * compiler is free to use vector instructions for the inner loop.  Copying
+ * each block in before any of it is written out also makes the in-place
+ * conversion safe, and takes care of alignment.
+ */
+#define H5T_CONV_LOOP_PACKED(GUTS,ST,DT,D_MIN,D_MAX) {			      \
+    ST  src_block[H5T_CONV_PACKED_NELMTS];  /*block of source elements */    \
+    DT  dst_block[H5T_CONV_PACKED_NELMTS];  /*block of converted elements */ \
+    size_t nblock;                      /*# of elements in block	*/    \
+    size_t u;                           /*local index variable		*/    \
+                                                                              \
+    for (elmtno = 0; elmtno < safe; elmtno += nblock) {		      \
+        nblock = MIN(safe - elmtno, H5T_CONV_PACKED_NELMTS);		      \
+        HDmemcpy(src_block, src_buf, nblock * sizeof(ST));		      \
+        if (nblock == H5T_CONV_PACKED_NELMTS) {			      \
+            /* (Constant trip count for full blocks) */			      \
+            for (u = 0; u < H5T_CONV_PACKED_NELMTS; u++)		      \
+                H5T_CONV_LOOP_GUTS(GUTS,src_block + u,dst_block + u,ST,DT,D_MIN,D_MAX) \
+        } else								      \
+            for (u = 0; u < nblock; u++)				      \
+                H5T_CONV_LOOP_GUTS(GUTS,src_block + u,dst_block + u,ST,DT,D_MIN,D_MAX) \
+        HDmemcpy(dst_buf, dst_block, nblock * sizeof(DT));		      \
+        src_buf += nblock * sizeof(ST);					      \
+        dst_buf += nblock * sizeof(DT);					      \
+    }									      \
+}
+
 /* Macro to call the actual "guts" of the type conversion, or call the "no exception" guts */
 #ifdef H5_WANT_DCONV_EXCEPTION
 #define H5T_CONV_LOOP_GUTS(GUTS,S,D,ST,DT,D_MIN,D_MAX)			      \
@@ -902,6 +938,28 @@ done:                                                                         \
 /* Swap two elements (I & J) of an array using a temporary variable */
 #define H5_SWAP_BYTES(ARRAY,I,J) {uint8_t _tmp; _tmp=ARRAY[I]; ARRAY[I]=ARRAY[J]; ARRAY[J]=_tmp;}
 
+/* Reverse the bytes of a 16-, 32- or 64-bit value */
+#define H5T_SWAP_16(V) ((uint16_t)(((V) << 8) | ((V) >> 8)))
+#define H5T_SWAP_32(V) ((uint32_t)(((V) << 24) | (((V) << 8) & 0x00ff0000) |  \
+                        (((V) >> 8) & 0x0000ff00) | ((V) >> 24)))
+#define H5T_SWAP_64(V) (((uint64_t)H5T_SWAP_32((uint32_t)(V)) << 32) |        \
+                        (uint64_t)H5T_SWAP_32((uint32_t)((V) >> 32)))
+
+/* Reverse the bytes of each of N densely packed elements of TYPE in BUF.
+ * Each element is swapped as a whole, which compilers recognize and turn
+ * into vector byte shuffles.
+ */
+#define H5T_SWAP_PACKED(BUF,N,TYPE,SWAP) {                                    \
+    TYPE _val;                                                                \
+    size_t _u;                                                                \
+                                                                              \
+    for(_u = 0; _u < (N); _u++) {                                             \
+        HDmemcpy(&_val, (BUF) + _u * sizeof(TYPE), sizeof(TYPE));             \
+        _val = SWAP(_val);                                                    \
+        HDmemcpy((BUF) + _u * sizeof(TYPE), &_val, sizeof(TYPE));             \
+    }                                                                         \
+}
+
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE      4096
 
@@ -1150,6 +1208,10 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                     break;
 
                 case 2:
+                    if(2 == buf_stride) {
+                        H5T_SWAP_PACKED(buf, nelmts, uint16_t, H5T_SWAP_16)
+                        break;
+                    } /* end if */
                     for(/*void*/; nelmts >= 20; nelmts -= 20) {
                         H5_SWAP_BYTES(buf, 0,   1); /*  0 */
                         buf += buf_stride;
@@ -1197,6 +1259,10 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                     break;
 
                 case 4:
+                    if(4 == buf_stride) {
+                        H5T_SWAP_PACKED(buf, nelmts, uint32_t, H5T_SWAP_32)
+                        break;
+                    } /* end if */
                     for(/*void*/; nelmts >= 20; nelmts -= 20) {
                         H5_SWAP_BYTES(buf,  0,  3); /*  0 */
                         H5_SWAP_BYTES(buf,  1,  2);
@@ -1266,6 +1332,10 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                     break;
 
                 case 8:
+                    if(8 == buf_stride) {
+                        H5T_SWAP_PACKED(buf, nelmts, uint64_t, H5T_SWAP_64)
+                        break;
+                    } /* end if */
                     for(/*void*/; nelmts >= 10; nelmts -= 10) {
                         H5_SWAP_BYTES(buf,  0,  7); /*  0 */
                         H5_SWAP_BYTES(buf,  1,  6);
@@ -32,8 +32,6 @@
 #include "H5Tpkg.h"		/* Datatypes				*/
 
 /* Static local functions */
-static H5T_t *H5T_get_native_type(H5T_t *dt, H5T_direction_t direction,
-                                  size_t *struct_align, size_t *offset, size_t *comp_size);
 static H5T_t *H5T_get_native_integer(size_t prec, H5T_sign_t sign, H5T_direction_t direction,
                                      size_t *struct_align, size_t *offset, size_t *comp_size);
 static H5T_t *H5T_get_native_float(size_t size, H5T_direction_t direction,
@@ -147,7 +145,7 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static H5T_t *
+H5T_t *
 H5T_get_native_type(H5T_t *dtype, H5T_direction_t direction, size_t *struct_align, size_t *offset, size_t *comp_size)
 {
     H5T_t       *dt;                /* Datatype to make native */
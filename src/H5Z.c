@@ -51,6 +51,20 @@ typedef struct H5Z_object_t {
     htri_t       found;         /* Whether we find an object using the filter */
 } H5Z_object_t;
 
+#ifdef H5_HAVE_FILTER_THREADS
+/* Work shared between the threads of H5Z_pipeline_mt() */
+typedef struct H5Z_pipeline_mt_t {
+    pthread_mutex_t     lock;           /* Protects 'next' */
+    size_t              next;           /* Next job to hand out */
+    size_t              njobs;          /* Number of jobs */
+    H5Z_pipeline_job_t  *jobs;          /* Jobs to run */
+    const H5O_pline_t   *pline;         /* Pipeline to run them through */
+    unsigned            flags;          /* Pipeline flags */
+    H5Z_EDC_t           edc_read;       /* Error detection setting */
+    H5Z_cb_t            cb_struct;      /* Filter failure callback */
+} H5Z_pipeline_mt_t;
+#endif /* H5_HAVE_FILTER_THREADS */
+
 /* Enumerated type for dataset creation prelude callbacks */
 typedef enum {
     H5Z_PRELUDE_CAN_APPLY,      /* Call "can apply" callback */
@@ -70,6 +84,9 @@ static int H5Z_find_idx(H5Z_filter_t id);
 static int H5Z__check_unregister_dset_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__check_unregister_group_cb(void *obj_ptr, hid_t obj_id, void *key);
 static int H5Z__flush_file_cb(void *obj_ptr, hid_t obj_id, void *key);
+#ifdef H5_HAVE_FILTER_THREADS
+static void *H5Z_pipeline_worker(void *_shared);
+#endif /* H5_HAVE_FILTER_THREADS */
 
 
 /*-------------------------------------------------------------------------
@@ -1433,6 +1450,145 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+#ifdef H5_HAVE_FILTER_THREADS
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_pipeline_worker
+ *
+ * Purpose:	Thread body for H5Z_pipeline_mt(): keeps taking the next
+ *		unclaimed job and running it through the pipeline until
+ *		there are none left.
+ *
+ * Return:	NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5Z_pipeline_worker(void *_shared)
+{
+    H5Z_pipeline_mt_t *shared = (H5Z_pipeline_mt_t *)_shared;
+    H5Z_pipeline_job_t *job;
+
+    /* (No FUNC_ENTER, this is a thread's start routine) */
+    for(;;) {
+        /* Claim a job */
+        pthread_mutex_lock(&shared->lock);
+        job = shared->next < shared->njobs ? &shared->jobs[shared->next++] : NULL;
+        pthread_mutex_unlock(&shared->lock);
+        if(NULL == job)
+            break;
+
+        if(job->buf)
+            job->status = H5Z_pipeline(shared->pline, shared->flags,
+                    &job->filter_mask, shared->edc_read, shared->cb_struct,
+                    &job->nbytes, &job->buf_size, &job->buf);
+    } /* end for */
+
+    return(NULL);
+} /* end H5Z_pipeline_worker() */
+#endif /* H5_HAVE_FILTER_THREADS */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Z_pipeline_mt
+ *
+ * Purpose:	Runs each of the NJOBS buffers in JOBS through the filter
+ *		pipeline PLINE, as H5Z_pipeline() does, using up to NTHREADS
+ *		threads (including the calling one).  Jobs with a NULL
+ *		buffer are skipped.  The result of each job is returned in
+ *		its STATUS field, and all jobs are run even if some fail.
+ *
+ *		The filters' functions (and the filter callback in CB_STRUCT)
+ *		may be called concurrently from several threads, so the
+ *		caller must make sure that all the filters in the pipeline
+ *		are already registered (see H5Z_all_filters_avail()).  When
+ *		the library is built without thread support, the jobs are
+ *		simply run one after another.
+ *
+ * Return:	Non-negative if all jobs succeeded/Negative otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Z_pipeline_mt(const H5O_pline_t *pline, unsigned flags, H5Z_EDC_t edc_read,
+    H5Z_cb_t cb_struct, unsigned nthreads, size_t njobs,
+    H5Z_pipeline_job_t *jobs/*in,out*/)
+{
+    size_t      nfailed = 0;            /* Number of jobs which failed */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(pline);
+    HDassert(jobs || 0 == njobs);
+
+    /* Reset the job results */
+    for(u = 0; u < njobs; u++)
+        jobs[u].status = SUCCEED;
+
+#ifdef H5_HAVE_FILTER_THREADS
+    if(nthreads > 1 && njobs > 1) {
+        H5Z_pipeline_mt_t shared;       /* Info shared with the workers */
+        pthread_t *threads = NULL;      /* Worker threads */
+        unsigned nworkers;              /* Number of workers started */
+        unsigned v;                     /* Local index variable */
+
+        /* Set up the shared info */
+        if(pthread_mutex_init(&shared.lock, NULL))
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "can't initialize job lock")
+        shared.next = 0;
+        shared.njobs = njobs;
+        shared.jobs = jobs;
+        shared.pline = pline;
+        shared.flags = flags;
+        shared.edc_read = edc_read;
+        shared.cb_struct = cb_struct;
+
+        /* The calling thread is one of the workers */
+        if((size_t)nthreads > njobs)
+            nthreads = (unsigned)njobs;
+        if(NULL == (threads = (pthread_t *)H5MM_malloc((nthreads - 1) * sizeof(pthread_t)))) {
+            pthread_mutex_destroy(&shared.lock);
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for worker threads")
+        } /* end if */
+
+        /* Start the other workers, making do with fewer if some can't be created */
+        H5E_set_threads_active(TRUE);
+        for(nworkers = 0; nworkers < nthreads - 1; nworkers++)
+            if(pthread_create(&threads[nworkers], NULL, H5Z_pipeline_worker, &shared))
+                break;
+
+        /* Help out, then wait for the other workers */
+        (void)H5Z_pipeline_worker(&shared);
+        for(v = 0; v < nworkers; v++)
+            pthread_join(threads[v], NULL);
+        H5E_set_threads_active(FALSE);
+
+        pthread_mutex_destroy(&shared.lock);
+        H5MM_xfree(threads);
+    } /* end if */
+    else
+#endif /* H5_HAVE_FILTER_THREADS */
+    {
+        for(u = 0; u < njobs; u++)
+            if(jobs[u].buf)
+                jobs[u].status = H5Z_pipeline(pline, flags, &jobs[u].filter_mask,
+                        edc_read, cb_struct, &jobs[u].nbytes, &jobs[u].buf_size,
+                        &jobs[u].buf);
+    } /* end else */
+
+    /* Check for failures */
+    for(u = 0; u < njobs; u++)
+        if(jobs[u].status < 0)
+            nfailed++;
+    if(nfailed)
+        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "filter pipeline failed for %lu of %lu buffers", (unsigned long)nfailed, (unsigned long)njobs)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5Z_pipeline_mt() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Z_filter_info
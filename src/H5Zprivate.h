@@ -61,6 +61,15 @@ typedef struct {
     unsigned		*cd_values;	/*client data values		     */
 } H5Z_filter_info_t;
 
+/* One buffer's worth of work for H5Z_pipeline_mt() */
+typedef struct H5Z_pipeline_job_t {
+    unsigned		filter_mask;	/*in,out: as for H5Z_pipeline()      */
+    size_t		nbytes;		/*in,out: bytes of data in buf	     */
+    size_t		buf_size;	/*in,out: bytes allocated for buf    */
+    void		*buf;		/*in,out: data, or NULL to skip job  */
+    herr_t		status;		/*out: result of H5Z_pipeline()	     */
+} H5Z_pipeline_job_t;
+
 /*****************************/
 /* Library-private Variables */
 /*****************************/
@@ -83,6 +92,9 @@ H5_DLL herr_t H5Z_pipeline(const struct H5O_pline_t *pline,
  			    H5Z_EDC_t edc_read, H5Z_cb_t cb_struct,
 			    size_t *nbytes/*in,out*/, size_t *buf_size/*in,out*/,
                             void **buf/*in,out*/);
+H5_DLL herr_t H5Z_pipeline_mt(const struct H5O_pline_t *pline, unsigned flags,
+    H5Z_EDC_t edc_read, H5Z_cb_t cb_struct, unsigned nthreads, size_t njobs,
+    H5Z_pipeline_job_t *jobs/*in,out*/);
 H5_DLL H5Z_class2_t *H5Z_find(H5Z_filter_t id);
 H5_DLL herr_t H5Z_can_apply(hid_t dcpl_id, hid_t type_id);
 H5_DLL herr_t H5Z_set_local(hid_t dcpl_id, hid_t type_id);
@@ -43,6 +43,13 @@
  #endif /* H5_HAVE_WIN32_API */
 #endif /* H5_HAVE_THREADSAFE */
 
+/* Worker threads for running I/O filters concurrently (see H5Z_pipeline_mt) */
+#if defined(H5_HAVE_PTHREAD_H) && !defined(H5_HAVE_WIN_THREADS) && \
+        (defined(H5_HAVE_LIBPTHREAD) || defined(H5_HAVE_THREADSAFE))
+#define H5_HAVE_FILTER_THREADS
+#include <pthread.h>
+#endif
+
 /*
  * Include ANSI-C header files.
  */
@@ -993,9 +1000,15 @@ H5_DLL int HDfprintf (FILE *stream, const char *fmt, ...);
 #ifndef HDmktime
     #define HDmktime(T)    mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+    #define HDmmap(A,L,P,F,D,O)    mmap(A,L,P,F,D,O)
+#endif /* HDmmap */
 #ifndef HDmodf
     #define HDmodf(X,Y)    modf(X,Y)
 #endif /* HDmodf */
+#ifndef HDmunmap
+    #define HDmunmap(A,L)    munmap(A,L)
+#endif /* HDmunmap */
 #ifndef HDopen
     #ifdef _O_BINARY
         #define HDopen(S,F,M)    open(S,F|_O_BINARY,M)
@@ -1021,6 +1034,12 @@ H5_DLL int HDfprintf (FILE *stream, const char *fmt, ...);
 #ifndef HDpow
     #define HDpow(X,Y)    pow(X,Y)
 #endif /* HDpow */
+#ifndef HDpread
+    #define HDpread(F,M,Z,O)    pread(F,M,Z,O)
+#endif /* HDpread */
+#ifndef HDpreadv
+    #define HDpreadv(F,V,C,O)    preadv(F,V,C,O)
+#endif /* HDpreadv */
 /* printf() variable arguments */
 #ifndef HDputc
     #define HDputc(C,F)    putc(C,F)
@@ -1031,6 +1050,12 @@ H5_DLL int HDfprintf (FILE *stream, const char *fmt, ...);
 #ifndef HDputs
     #define HDputs(S)    puts(S)
 #endif /* HDputs */
+#ifndef HDpwrite
+    #define HDpwrite(F,M,Z,O)    pwrite(F,M,Z,O)
+#endif /* HDpwrite */
+#ifndef HDpwritev
+    #define HDpwritev(F,V,C,O)    pwritev(F,V,C,O)
+#endif /* HDpwritev */
 #ifndef HDqsort
     #define HDqsort(M,N,Z,F)  qsort(M,N,Z,F)
 #endif /* HDqsort*/
@@ -1342,6 +1367,9 @@ H5_DLL int64_t HDstrtoll (const char *s, const char **rest, int base);
 #ifndef HDunlink
     #define HDunlink(S)    unlink(S)
 #endif /* HDunlink */
+#ifndef HDusleep
+    #define HDusleep(N)    usleep(N)
+#endif /* HDusleep */
 #ifndef HDutime
     #define HDutime(S,T)    utime(S,T)
 #endif /* HDutime */
@@ -1718,6 +1746,7 @@ extern char  H5_lib_vers_info_g[];
 /* replacement structure for original global variable */
 typedef struct H5_api_struct {
     H5TS_mutex_t init_lock;  /* API entrance mutex */
+    H5TS_mutex_t ids_lock;   /* ID table mutex (see H5I.c) */
     hbool_t H5_libinit_g;    /* Has the library been initialized? */
 } H5_api_t;
 
@@ -51,5 +51,7 @@
 #include "H5FDwindows.h"        /* Windows buffered I/O     */
 #endif
 #include "H5FDdirect.h"     	/* Linux direct I/O			*/
+#include "H5FDiouring.h"    	/* Linux io_uring I/O			*/
+#include "H5FDmmap.h"       	/* Read-only mmap I/O			*/
 
 #endif
@@ -34,6 +34,10 @@
 #define RAND_SEG_LEN    (1024)
 #define RANDOM_BASE_OFF (1024 * 1024)
 
+/* Metadata prefetch test values */
+#define PREFETCH_SIZE   (64 * 1024)
+#define PREFETCH_EOA    (1024 * 1024 * 10)
+
 /* Make file global to all tests */
 H5F_t * f = NULL;
 
@@ -50,6 +54,8 @@ unsigned test_read_after(void);
 unsigned test_free(void);
 unsigned test_big(void);
 unsigned test_random_write(void);
+unsigned test_prefetch(void);
+unsigned test_readv(void);
 
 /* Helper Function Prototypes */
 void accum_printf(void);
@@ -114,6 +120,8 @@ main(void)
     nerrors += test_free();
     nerrors += test_big();
     nerrors += test_random_write();
+    nerrors += test_prefetch();
+    nerrors += test_readv();
 
     /* End of test code, close and delete file */
     if(H5Fclose(fid) < 0) TEST_ERROR
@@ -1815,3 +1823,223 @@ accum_printf(void)
     printf("\n\n");
 } /* accum_printf() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_prefetch
+ * 
+ * Purpose:     This test exercises reading metadata with prefetching
+ *              enabled.  A read which misses the accumulator should load
+ *              the aligned window around it (clipped to the EOA), later
+ *              reads within the window should see the data on disk, and
+ *              writes or frees of raw data within the window should not
+ *              leave stale data in the accumulator.
+ * 
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ * 
+ *-------------------------------------------------------------------------
+ */
+unsigned 
+test_prefetch(void)
+{
+    int i = 0;
+    int s = 1024;    /* size of buffer */
+    int32_t *wbuf, *rbuf;
+    haddr_t vaddr[2];           /* Addresses of vectored write blocks */
+    size_t vsize[2];            /* Sizes of vectored write blocks */
+    const void *vbuf[2];        /* Buffers of vectored write blocks */
+
+    TESTING("metadata prefetch");
+
+    /* Allocate buffers */
+    wbuf = (int32_t *)HDmalloc((size_t)s * sizeof(int32_t));
+    HDassert(wbuf);
+    rbuf = (int32_t *)HDcalloc((size_t)s, sizeof(int32_t));
+    HDassert(rbuf);
+
+    /* Write blocks of 1s and 2s, in the same prefetch window, to disk */
+    for(i = 0; i < s; i++)
+        wbuf[i] = 1;
+    if(accum_write(PREFETCH_SIZE + 1024, 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < s; i++)
+        wbuf[i] = 2;
+    if(accum_write(PREFETCH_SIZE + 8192, 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+
+    /* Enable metadata prefetching */
+    f->shared->meta_prefetch_size = PREFETCH_SIZE;
+
+    /* A read which misses the accumulator should load the whole window */
+    if(accum_read(PREFETCH_SIZE + 1024, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 1) TEST_ERROR;
+    if(f->shared->accum.loc != PREFETCH_SIZE) TEST_ERROR;
+    if(f->shared->accum.size != PREFETCH_SIZE) TEST_ERROR;
+    if(f->shared->accum.dirty) TEST_ERROR;
+
+    /* A later read in the window is served from it */
+    if(accum_read(PREFETCH_SIZE + 8192, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 2) TEST_ERROR;
+    if(f->shared->accum.loc != PREFETCH_SIZE) TEST_ERROR;
+
+    /* Overwrite part of the window with metadata */
+    for(i = 0; i < s; i++)
+        wbuf[i] = 3;
+    if(accum_write(PREFETCH_SIZE + 8192, 512, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_read(PREFETCH_SIZE + 8192, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 128; i++)
+        if(rbuf[i] != 3) TEST_ERROR;
+    for(i = 128; i < 256; i++)
+        if(rbuf[i] != 2) TEST_ERROR;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+
+    /* Overwrite part of a prefetched window with raw data */
+    if(accum_read(PREFETCH_SIZE + 1024, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < s; i++)
+        wbuf[i] = 4;
+    if(H5F_block_write(f, H5FD_MEM_DRAW, (haddr_t)(PREFETCH_SIZE + 1024), (size_t)1024, H5P_DATASET_XFER_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_read(PREFETCH_SIZE + 1024, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 4) TEST_ERROR;
+
+    /* Free raw data within the prefetched window */
+    if(H5F_accum_free(f, H5P_DATASET_XFER_DEFAULT, H5FD_MEM_DRAW, (haddr_t)(PREFETCH_SIZE + 4096), (hsize_t)1024) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum.loc != PREFETCH_SIZE) TEST_ERROR;
+    if(f->shared->accum.size != 4096) TEST_ERROR;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+
+    /* Write raw data within a prefetched window while the accumulator is
+     *  dirty, then metadata after it, so the dirty region covers the raw
+     *  data when the accumulator is flushed */
+    if(accum_read(PREFETCH_SIZE + 1024, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < s; i++)
+        wbuf[i] = 5;
+    if(accum_write(PREFETCH_SIZE + 12288, 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    if(!f->shared->accum.dirty) TEST_ERROR;
+    for(i = 0; i < s; i++)
+        wbuf[i] = 6;
+    if(H5F_block_write(f, H5FD_MEM_DRAW, (haddr_t)(PREFETCH_SIZE + 16384), (size_t)1024, H5P_DATASET_XFER_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_write(PREFETCH_SIZE + 28672, 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+    if(H5F_block_read(f, H5FD_MEM_DRAW, (haddr_t)(PREFETCH_SIZE + 16384), (size_t)1024, H5P_DATASET_XFER_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 6) TEST_ERROR;
+
+    /* Write raw data within a prefetched window with a vectored write */
+    if(accum_read(PREFETCH_SIZE + 1024, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < s; i++)
+        wbuf[i] = 7;
+    vaddr[0] = (haddr_t)(PREFETCH_SIZE + 16384);
+    vaddr[1] = (haddr_t)(PREFETCH_SIZE + 20480);
+    vsize[0] = vsize[1] = 1024;
+    vbuf[0] = vbuf[1] = wbuf;
+    if(H5F_block_writev(f, H5FD_MEM_DRAW, (size_t)2, vaddr, vsize, H5P_DATASET_XFER_DEFAULT, vbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_write(PREFETCH_SIZE + 12288, 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_write(PREFETCH_SIZE + 28672, 1024, wbuf) < 0) FAIL_STACK_ERROR;
+    if(accum_read(PREFETCH_SIZE + 20480, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 7) TEST_ERROR;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+    if(H5F_block_read(f, H5FD_MEM_DRAW, (haddr_t)(PREFETCH_SIZE + 16384), (size_t)1024, H5P_DATASET_XFER_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 7) TEST_ERROR;
+    if(H5F_block_read(f, H5FD_MEM_DRAW, (haddr_t)(PREFETCH_SIZE + 20480), (size_t)1024, H5P_DATASET_XFER_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR;
+    for(i = 0; i < 256; i++)
+        if(rbuf[i] != 7) TEST_ERROR;
+
+    /* The window should not extend past the EOA */
+    if(H5FD_set_eoa(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)(PREFETCH_EOA - 1000)) < 0) FAIL_STACK_ERROR;
+    if(accum_read(PREFETCH_EOA - 2048, 512, rbuf) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum.loc != (PREFETCH_EOA - PREFETCH_SIZE)) TEST_ERROR;
+    if(f->shared->accum.size != (PREFETCH_SIZE - 1000)) TEST_ERROR;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+    if(H5FD_set_eoa(f->shared->lf, H5FD_MEM_DEFAULT, (haddr_t)PREFETCH_EOA) < 0) FAIL_STACK_ERROR;
+
+    /* A read crossing a window boundary starts the window at the read */
+    if(accum_read(PREFETCH_SIZE - 512, 1024, rbuf) < 0) FAIL_STACK_ERROR;
+    if(f->shared->accum.loc != (PREFETCH_SIZE - 512)) TEST_ERROR;
+    if(f->shared->accum.size != PREFETCH_SIZE) TEST_ERROR;
+
+    /* Disable metadata prefetching */
+    f->shared->meta_prefetch_size = 0;
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    f->shared->meta_prefetch_size = 0;
+
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 1;
+} /* end test_prefetch */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_readv
+ * 
+ * Purpose:     This test checks that a vectored read of raw data sees the
+ *              bytes only written to the dirty metadata accumulator so
+ *              far, like other reads do.
+ * 
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ * 
+ *-------------------------------------------------------------------------
+ */
+unsigned 
+test_readv(void)
+{
+    unsigned char wbuf[1024];   /* Buffer for writing */
+    unsigned char rbuf[3][1024];        /* Buffers for reading blocks */
+    haddr_t vaddr[3];           /* Addresses of vectored read blocks */
+    size_t vsize[3];            /* Sizes of vectored read blocks */
+    void *vbuf[3];              /* Buffers of vectored read blocks */
+    unsigned u, v;
+
+    TESTING("vectored reads overlapping the dirty accumulator");
+
+    /* Write a block of 1s to disk, then 2s over part of it to the
+     *  accumulator */
+    HDmemset(wbuf, 1, sizeof(wbuf));
+    if(H5F_block_write(f, H5FD_MEM_DRAW, (haddr_t)2048, sizeof(wbuf), H5P_DATASET_XFER_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR;
+    HDmemset(wbuf, 2, sizeof(wbuf));
+    if(accum_write(2560, 256, wbuf) < 0) FAIL_STACK_ERROR;
+    if(!f->shared->accum.dirty) TEST_ERROR;
+
+    /* Read blocks ending in, inside and around the dirty region */
+    vaddr[0] = 2304;
+    vsize[0] = 512;
+    vaddr[1] = 2600;
+    vsize[1] = 100;
+    vaddr[2] = 2048;
+    vsize[2] = 1024;
+    for(u = 0; u < 3; u++)
+        vbuf[u] = rbuf[u];
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5F_block_readv(f, H5FD_MEM_DRAW, (size_t)3, vaddr, vsize, H5P_DATASET_XFER_DEFAULT, vbuf) < 0) FAIL_STACK_ERROR;
+    for(u = 0; u < 3; u++)
+        for(v = 0; v < vsize[u]; v++) {
+            haddr_t addr = vaddr[u] + v;
+
+            if(rbuf[u][v] != ((addr >= 2560 && addr < 2816) ? 2 : 1)) TEST_ERROR;
+        } /* end for */
+
+    if(accum_reset() < 0) FAIL_STACK_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    return 1;
+} /* end test_readv */
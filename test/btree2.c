@@ -41,6 +41,7 @@ const char *FILENAME[] = {
 #define DELETE_SMALL            20
 #define DELETE_MEDIUM           200
 #define DELETE_LARGE            2000
+#define BULK_LOAD_MANY          (INSERT_MANY/10)
 
 /* Testing parameters */
 typedef struct bt2_test_param_t {
@@ -444,6 +445,50 @@ remove_cb(const void *_record, void *_op_data)
     return(0);
 } /* end remove_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	bulk_cb
+ *
+ * Purpose:	v2 B-tree bulk load callback, supplying even records
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+bulk_cb(hsize_t idx, void *_udata)
+{
+    hsize_t *record = (hsize_t *)_udata;
+
+    *record = idx * 2;
+
+    return(0);
+} /* end bulk_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	bulk_bad_cb
+ *
+ * Purpose:	v2 B-tree bulk load callback, supplying a record out of order
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+bulk_bad_cb(hsize_t idx, void *_udata)
+{
+    hsize_t *record = (hsize_t *)_udata;
+
+    *record = (idx == (BULK_LOAD_MANY / 2) ? 0 : idx);
+
+    return(0);
+} /* end bulk_bad_cb() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_insert_basic
@@ -7543,6 +7588,360 @@ error:
     return 1;
 } /* test_modify() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_bulk_load
+ *
+ * Purpose:	Tests for bulk-loading records into an empty B-tree
+ *
+ * Return:	Success:	0
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+test_bulk_load(hid_t fapl, const H5B2_create_t *cparam,
+    const bt2_test_param_t *tparam)
+{
+    hid_t	file = -1;              /* File ID */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    hid_t       dxpl = H5P_DATASET_XFER_DEFAULT;        /* DXPL to use */
+    H5B2_t      *bt2 = NULL;            /* v2 B-tree wrapper */
+    haddr_t     bt2_addr;               /* Address of B-tree created */
+    hsize_t     record;                 /* Record to insert into tree */
+    hsize_t     idx;                    /* Index within B-tree, for iterator */
+    hsize_t     *records = NULL;        /* Record #'s for random insertion & removal */
+    hsize_t     temp_rec;               /* Temporary record */
+    unsigned    swap_idx;               /* Location to swap with when shuffling */
+    H5B2_stat_t bt2_stat;               /* Statistics about B-tree created */
+    H5B2_node_info_test_t ninfo;        /* B-tree node info */
+    hsize_t     nrec;                   /* Number of records in B-tree */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret;                    /* Generic error return value */
+
+    /*
+     * Test bulk-loading small B-trees
+     */
+    TESTING("B-tree bulk load: root leaf node");
+
+    /* Create the file for the test */
+    if(create_file(&file, &f, fapl) < 0)
+        TEST_ERROR
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Loading no records should leave the B-tree empty */
+    if(H5B2_bulk_load(bt2, dxpl, (hsize_t)0, 100, bulk_cb, &record) < 0)
+        FAIL_STACK_ERROR
+    bt2_stat.depth = 0;
+    bt2_stat.nrecords = 0;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+
+    /* Load as many records as fit in the root leaf node */
+    if(H5B2_bulk_load(bt2, dxpl, (hsize_t)(INSERT_SPLIT_ROOT_NREC - 1), 100, bulk_cb, &record) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Check up on B-tree */
+    bt2_stat.depth = 0;
+    bt2_stat.nrecords = INSERT_SPLIT_ROOT_NREC - 1;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+    ninfo.depth = 0;
+    ninfo.nrec = INSERT_SPLIT_ROOT_NREC - 1;
+    if(check_node_info(bt2, dxpl, (hsize_t)0, &ninfo) < 0)
+        TEST_ERROR
+
+    /* Loading into a non-empty B-tree should fail */
+    H5E_BEGIN_TRY {
+	ret = H5B2_bulk_load(bt2, dxpl, (hsize_t)10, 100, bulk_cb, &record);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+
+    /* Inserting a record should split the full root node */
+    record = 1;
+    if(H5B2_insert(bt2, dxpl, &record) < 0)
+        FAIL_STACK_ERROR
+    bt2_stat.depth = 1;
+    bt2_stat.nrecords = INSERT_SPLIT_ROOT_NREC;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    PASSED();
+
+    TESTING("B-tree bulk load: root internal node");
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Load one record too many for the root leaf node */
+    if(H5B2_bulk_load(bt2, dxpl, (hsize_t)INSERT_SPLIT_ROOT_NREC, 100, bulk_cb, &record) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Check up on B-tree: two leaves, split evenly */
+    bt2_stat.depth = 1;
+    bt2_stat.nrecords = INSERT_SPLIT_ROOT_NREC;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+    ninfo.depth = 1;
+    ninfo.nrec = 1;
+    if(check_node_info(bt2, dxpl, (hsize_t)(2 * (INSERT_SPLIT_ROOT_NREC / 2)), &ninfo) < 0)
+        TEST_ERROR
+    ninfo.depth = 0;
+    ninfo.nrec = INSERT_SPLIT_ROOT_NREC / 2;
+    if(check_node_info(bt2, dxpl, (hsize_t)0, &ninfo) < 0)
+        TEST_ERROR
+    if(check_node_info(bt2, dxpl, (hsize_t)(2 * (INSERT_SPLIT_ROOT_NREC - 1)), &ninfo) < 0)
+        TEST_ERROR
+
+    /* Iterate over B-tree after inserting the odd records */
+    for(u = 0; u < INSERT_SPLIT_ROOT_NREC; u++) {
+        record = (2 * u) + 1;
+        if(H5B2_insert(bt2, dxpl, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    idx = 0;
+    if(H5B2_iterate(bt2, dxpl, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != (2 * INSERT_SPLIT_ROOT_NREC))
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    PASSED();
+
+    /*
+     * Test bulk-loading many records
+     */
+    TESTING("B-tree bulk load: many records");
+
+    /* Allocate space for the records */
+    if(NULL == (records = (hsize_t *)HDmalloc(sizeof(hsize_t) * 2 * BULK_LOAD_MANY)))
+        TEST_ERROR
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Load the even records */
+    if(H5B2_bulk_load(bt2, dxpl, (hsize_t)BULK_LOAD_MANY, 100, bulk_cb, &record) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Check up on B-tree */
+    bt2_stat.depth = 3;
+    bt2_stat.nrecords = BULK_LOAD_MANY;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+
+    /* Leaves should be full, to within a record */
+    ninfo.depth = 0;
+    ninfo.nrec = INSERT_SPLIT_ROOT_NREC - 1;
+    if(check_node_info(bt2, dxpl, (hsize_t)0, &ninfo) < 0)
+        TEST_ERROR
+    ninfo.nrec = INSERT_SPLIT_ROOT_NREC - 2;
+    if(check_node_info(bt2, dxpl, (hsize_t)((2 * BULK_LOAD_MANY) - 2), &ninfo) < 0)
+        TEST_ERROR
+
+    /* Find & index records */
+    for(u = 0; u < BULK_LOAD_MANY; u += 97) {
+        idx = (hsize_t)u * 2;
+        if(H5B2_find(bt2, dxpl, &idx, find_cb, &idx) != TRUE)
+            FAIL_STACK_ERROR
+        idx = ((hsize_t)u * 2) + 1;
+        if(H5B2_find(bt2, dxpl, &idx, find_cb, &idx) != FALSE)
+            TEST_ERROR
+        record = (hsize_t)u * 2;
+        if(H5B2_index(bt2, dxpl, H5_ITER_INC, (hsize_t)u, find_cb, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    PASSED();
+
+    TESTING("B-tree bulk load: insert & remove after loading");
+
+    /* Shuffle the odd records & insert them */
+    for(u = 0; u < BULK_LOAD_MANY; u++)
+        records[u] = ((hsize_t)u * 2) + 1;
+    for(u = 0; u < BULK_LOAD_MANY; u++) {
+        swap_idx = ((unsigned)HDrandom() % (BULK_LOAD_MANY - u)) + u;
+        temp_rec = records[u];
+        records[u] = records[swap_idx];
+        records[swap_idx] = temp_rec;
+    } /* end for */
+    for(u = 0; u < BULK_LOAD_MANY; u++) {
+        record = records[u];
+        if(H5B2_insert(bt2, dxpl, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Iterate over B-tree to check records are all present */
+    idx = 0;
+    if(H5B2_iterate(bt2, dxpl, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != (2 * BULK_LOAD_MANY))
+        TEST_ERROR
+
+    /* Remove all the records, in random order */
+    for(u = 0; u < (2 * BULK_LOAD_MANY); u++)
+        records[u] = u;
+    for(u = 0; u < (2 * BULK_LOAD_MANY); u++) {
+        swap_idx = ((unsigned)HDrandom() % ((2 * BULK_LOAD_MANY) - u)) + u;
+        temp_rec = records[u];
+        records[u] = records[swap_idx];
+        records[swap_idx] = temp_rec;
+    } /* end for */
+    for(u = 0; u < (2 * BULK_LOAD_MANY); u++) {
+        record = records[u];
+        if(H5B2_remove(bt2, dxpl, &record, NULL, NULL) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Check up on B-tree */
+    bt2_stat.depth = 0;
+    bt2_stat.nrecords = 0;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    PASSED();
+
+    TESTING("B-tree bulk load: partially filled nodes");
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Load the even records, with nodes half full */
+    if(H5B2_bulk_load(bt2, dxpl, (hsize_t)BULK_LOAD_MANY, 50, bulk_cb, &record) < 0)
+        FAIL_STACK_ERROR
+
+    /* Check for closing & re-opening the B-tree */
+    if(reopen_btree(f, dxpl, &bt2, bt2_addr, tparam) < 0)
+        TEST_ERROR
+
+    /* Check up on B-tree */
+    bt2_stat.depth = 3;
+    bt2_stat.nrecords = BULK_LOAD_MANY;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+    ninfo.depth = 0;
+    ninfo.nrec = (INSERT_SPLIT_ROOT_NREC - 1) / 2;
+    if(check_node_info(bt2, dxpl, (hsize_t)0, &ninfo) < 0)
+        TEST_ERROR
+
+    /* Insert the odd records, in increasing order */
+    for(u = 0; u < BULK_LOAD_MANY; u++) {
+        record = ((hsize_t)u * 2) + 1;
+        if(H5B2_insert(bt2, dxpl, &record) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    idx = 0;
+    if(H5B2_iterate(bt2, dxpl, iter_cb, &idx) < 0)
+        FAIL_STACK_ERROR
+    if(idx != (2 * BULK_LOAD_MANY))
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    PASSED();
+
+    TESTING("B-tree bulk load: invalid loads");
+
+    /* Create the v2 B-tree & get its address */
+    if(create_btree(f, dxpl, cparam, &bt2, &bt2_addr) < 0)
+        TEST_ERROR
+
+    /* Attempt to load with invalid fill percentages */
+    H5E_BEGIN_TRY {
+	ret = H5B2_bulk_load(bt2, dxpl, (hsize_t)BULK_LOAD_MANY, 0, bulk_cb, &record);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+	ret = H5B2_bulk_load(bt2, dxpl, (hsize_t)BULK_LOAD_MANY, 101, bulk_cb, &record);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+
+    /* Attempt to load records out of order */
+    H5E_BEGIN_TRY {
+	ret = H5B2_bulk_load(bt2, dxpl, (hsize_t)BULK_LOAD_MANY, 100, bulk_bad_cb, &record);
+    } H5E_END_TRY;
+    if(ret != FAIL)
+        TEST_ERROR
+
+    /* B-tree should still be empty & usable */
+    bt2_stat.depth = 0;
+    bt2_stat.nrecords = 0;
+    if(check_stats(bt2, &bt2_stat) < 0)
+        TEST_ERROR
+    if(H5B2_bulk_load(bt2, dxpl, (hsize_t)BULK_LOAD_MANY, 100, bulk_cb, &record) < 0)
+        FAIL_STACK_ERROR
+    if(H5B2_get_nrec(bt2, &nrec) < 0)
+        FAIL_STACK_ERROR
+    if(nrec != BULK_LOAD_MANY)
+        TEST_ERROR
+
+    /* Close the v2 B-tree */
+    if(H5B2_close(bt2, dxpl) < 0)
+        FAIL_STACK_ERROR
+    bt2 = NULL;
+
+    /* Close file */
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    PASSED();
+
+    HDfree(records);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(bt2)
+            H5B2_close(bt2, dxpl);
+	H5Fclose(file);
+    } H5E_END_TRY;
+    HDfree(records);
+    return 1;
+} /* test_bulk_load() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	main
@@ -7650,6 +8049,9 @@ main(void)
 
         /* Test modifying B-tree records */
         nerrors += test_modify(fapl, &cparam, &tparam);
+
+        /* Test bulk-loading B-tree records */
+        nerrors += test_bulk_load(fapl, &cparam, &tparam);
     } /* end for */
 
     /* Verify symbol table messages are cached */
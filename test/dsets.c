@@ -50,6 +50,14 @@ const char *FILENAME[] = {
     "chunk_expand",
     "copy_dcpl_newfile",
     "layout_extend",
+    "filter_threads",
+    "chunk_cache_policy",
+    "chunk_cache_shared",
+    "chunk_prefetch",
+    "chunk_append",
+    "chunk_addr_map",
+    "contig_block_read",
+    "contig_map",
     NULL
 };
 #define FILENAME_BUF_SIZE       1024
@@ -7568,6 +7576,1139 @@ error:
     return -1;
 } /* end test_chunk_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_cache_policy
+ *
+ * Purpose: Tests the raw data chunk cache eviction policies and the
+ *          chunk cache statistics.  A few "hot" chunks are read over and
+ *          over while other chunks are scanned through a small cache with
+ *          a single hash bucket, so the hot chunks should stay cached
+ *          under all policies that track recency or frequency.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CHUNK_POLICY_CHUNK      100
+#define CHUNK_POLICY_NCHUNKS    64
+#define CHUNK_POLICY_NCACHED    8
+#define CHUNK_POLICY_NHOT       4
+#define CHUNK_POLICY_NROUNDS    10
+static herr_t
+test_chunk_cache_policy(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim = CHUNK_POLICY_CHUNK * CHUNK_POLICY_NCHUNKS;
+    hsize_t     chunk_dim = CHUNK_POLICY_CHUNK;
+    hsize_t     start, count = CHUNK_POLICY_CHUNK;
+    H5D_chunk_cache_policy_t policy;    /* Eviction policy */
+    H5D_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    int         *wbuf = NULL;   /* Buffer for writing data */
+    int         rbuf[CHUNK_POLICY_CHUNK]; /* Buffer for reading a chunk */
+    unsigned    round, u, v;    /* Local index variables */
+    herr_t      ret;            /* Generic return value */
+
+    TESTING("dataset chunk cache eviction policies");
+
+    h5_fixname(FILENAME[14], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * CHUNK_POLICY_CHUNK * CHUNK_POLICY_NCHUNKS))) TEST_ERROR
+    for(u = 0; u < CHUNK_POLICY_CHUNK * CHUNK_POLICY_NCHUNKS; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the access property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_policy(dapl, &policy) < 0) FAIL_STACK_ERROR
+    if(policy != H5D_CHUNK_CACHE_POLICY_W0) FAIL_PUTS_ERROR("    wrong default chunk cache policy")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_NTYPES);
+    } H5E_END_TRY;
+    if(ret >= 0) FAIL_PUTS_ERROR("    setting an invalid chunk cache policy should fail")
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+
+    /* Create file and dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, &count, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* The statistics are only available for chunked datasets */
+    if((dsid = H5Dcreate2(fid, "contig", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dget_chunk_cache_stats(dsid, &stats);
+    } H5E_END_TRY;
+    if(ret >= 0) FAIL_PUTS_ERROR("    getting chunk cache stats of a contiguous dataset should fail")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    for(policy = H5D_CHUNK_CACHE_POLICY_W0; policy < H5D_CHUNK_CACHE_POLICY_NTYPES;
+            policy = (H5D_chunk_cache_policy_t)(policy + 1)) {
+        H5D_chunk_cache_policy_t policy_out;    /* Policy retrieved */
+        size_t nslots;                          /* # of hash buckets retrieved */
+
+        /* Open the dataset with a small cache with a single hash bucket */
+        if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+        if(H5Pset_chunk_cache(dapl, (size_t)1, CHUNK_POLICY_NCACHED * CHUNK_POLICY_CHUNK * sizeof(int), 0.0) < 0)
+            FAIL_STACK_ERROR
+        if(H5Pset_chunk_cache_policy(dapl, policy) < 0) FAIL_STACK_ERROR
+        if(H5Pget_chunk_cache_policy(dapl, &policy_out) < 0) FAIL_STACK_ERROR
+        if(policy_out != policy) FAIL_PUTS_ERROR("    wrong chunk cache policy retrieved")
+        if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+        if(H5Dreset_chunk_cache_stats(dsid) < 0) FAIL_STACK_ERROR
+
+        /* Read the hot chunks and one new chunk in each round */
+        for(round = 0; round < CHUNK_POLICY_NROUNDS; round++)
+            for(u = 0; u <= CHUNK_POLICY_NHOT; u++) {
+                unsigned chunk = (u < CHUNK_POLICY_NHOT) ? u : CHUNK_POLICY_NHOT + round * 5;
+
+                start = (hsize_t)chunk * CHUNK_POLICY_CHUNK;
+                if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+                if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+                for(v = 0; v < CHUNK_POLICY_CHUNK; v++)
+                    if(rbuf[v] != wbuf[start + v]) FAIL_PUTS_ERROR("    wrong data read")
+            } /* end for */
+
+        /* Check the statistics */
+        if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nhits + stats.nmisses != CHUNK_POLICY_NROUNDS * (CHUNK_POLICY_NHOT + 1))
+            FAIL_PUTS_ERROR("    wrong number of chunk cache lookups")
+        if(stats.ninits != 0 || stats.nflushes != 0)
+            FAIL_PUTS_ERROR("    chunks created or flushed by reading")
+        if(stats.nused > CHUNK_POLICY_NCACHED || stats.nbytes_used != stats.nused * CHUNK_POLICY_CHUNK * sizeof(int))
+            FAIL_PUTS_ERROR("    wrong chunk cache size")
+        if(stats.nevictions != stats.nmisses - stats.nused)
+            FAIL_PUTS_ERROR("    wrong number of chunk cache preemptions")
+        if(policy != H5D_CHUNK_CACHE_POLICY_W0) {
+            /* Only the first reads of the hot chunks and the scanned chunks miss */
+            if(stats.nmisses != CHUNK_POLICY_NHOT + CHUNK_POLICY_NROUNDS)
+                FAIL_PUTS_ERROR("    hot chunks were preempted")
+            if(stats.nused != CHUNK_POLICY_NCACHED)
+                FAIL_PUTS_ERROR("    chunk cache not filled")
+        } /* end if */
+        else if(stats.nhits == 0)
+            FAIL_PUTS_ERROR("    no chunk cache hits")
+
+        /* Resetting the statistics keeps the cache contents */
+        if(H5Dreset_chunk_cache_stats(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nhits != 0 || stats.nmisses != 0 || stats.nevictions != 0 || stats.nused == 0)
+            FAIL_PUTS_ERROR("    chunk cache statistics not reset")
+
+        /* The dataset's access properties keep the configured cache,
+         * although its hash table has grown */
+        if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+        if((dapl = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+        if(H5Pget_chunk_cache(dapl, &nslots, NULL, NULL) < 0) FAIL_STACK_ERROR
+        if(nslots != 1) FAIL_PUTS_ERROR("    wrong number of chunk cache slots retrieved")
+        if(H5Pget_chunk_cache_policy(dapl, &policy_out) < 0) FAIL_STACK_ERROR
+        if(policy_out != policy) FAIL_PUTS_ERROR("    wrong chunk cache policy retrieved from dataset")
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Close everything */
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    return -1;
+} /* end test_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_cache_shared
+ *
+ * Purpose: Tests the raw data chunk cache shared by all the chunked
+ *          datasets in a file.  Several datasets are written and read
+ *          through a budget smaller than any one of them, which should
+ *          move to whichever dataset is being accessed.  A dataset with
+ *          its own cache size keeps a private cache.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CHUNK_SHARED_CHUNK      100
+#define CHUNK_SHARED_NCHUNKS    16
+#define CHUNK_SHARED_NCACHED    8
+#define CHUNK_SHARED_NDSETS     4
+static herr_t
+test_chunk_cache_shared(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    char        dset_name[16];  /* Dataset name */
+    hid_t       fid = -1;       /* File ID */
+    hid_t       my_fapl = -1;   /* File access property list ID */
+    hid_t       fapl2 = -1;     /* File's file access property list ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid[CHUNK_SHARED_NDSETS] = {-1, -1, -1, -1}; /* Dataset IDs */
+    hid_t       dsid2 = -1;     /* Second dataset ID */
+    hid_t       priv = -1;      /* Dataset ID with a private cache */
+    hsize_t     dim = CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS;
+    hsize_t     chunk_dim = CHUNK_SHARED_CHUNK;
+    size_t      nbytes = CHUNK_SHARED_NCACHED * CHUNK_SHARED_CHUNK * sizeof(int);
+    size_t      nbytes_out;     /* Shared cache size retrieved */
+    size_t      nbytes_used;    /* Total size cached */
+    H5D_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    int         *wbuf = NULL;   /* Buffer for writing data */
+    int         *rbuf = NULL;   /* Buffer for reading data */
+    unsigned    u, v;           /* Local index variables */
+
+    TESTING("dataset chunk cache shared by datasets");
+
+    h5_fixname(FILENAME[15], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS))) TEST_ERROR
+
+    /* Check the access property */
+    if((my_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_shared(my_fapl, &nbytes_out) < 0) FAIL_STACK_ERROR
+    if(nbytes_out != 0) FAIL_PUTS_ERROR("    shared chunk cache enabled by default")
+    if(H5Pset_chunk_cache_shared(my_fapl, nbytes) < 0) FAIL_STACK_ERROR
+
+    /* Create file and datasets */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0) FAIL_STACK_ERROR
+    if((fapl2 = H5Fget_access_plist(fid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_shared(fapl2, &nbytes_out) < 0) FAIL_STACK_ERROR
+    if(nbytes_out != nbytes) FAIL_PUTS_ERROR("    wrong shared chunk cache size retrieved")
+    if(H5Pclose(fapl2) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < CHUNK_SHARED_NDSETS; u++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", u);
+        if((dsid[u] = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Write the dataset, leaving its last chunks dirty in the cache */
+        for(v = 0; v < CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS; v++)
+            wbuf[v] = (int)(u * 100000 + v);
+        if(H5Dwrite(dsid[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* All datasets together stay within the budget */
+    nbytes_used = 0;
+    for(u = 0; u < CHUNK_SHARED_NDSETS; u++) {
+        if(H5Dget_chunk_cache_stats(dsid[u], &stats) < 0) FAIL_STACK_ERROR
+        nbytes_used += stats.nbytes_used;
+    } /* end for */
+    if(nbytes_used != nbytes) FAIL_PUTS_ERROR("    shared chunk cache not filled or overfilled")
+
+    /* Reading one dataset through moves the whole budget to it */
+    for(u = 0; u < CHUNK_SHARED_NDSETS; u++) {
+        if(H5Dread(dsid[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        for(v = 0; v < CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS; v++)
+            if(rbuf[v] != (int)(u * 100000 + v)) FAIL_PUTS_ERROR("    wrong data read")
+        if(H5Dget_chunk_cache_stats(dsid[u], &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nused != CHUNK_SHARED_NCACHED) FAIL_PUTS_ERROR("    shared chunk cache not moved to dataset read")
+        for(v = 0; v < CHUNK_SHARED_NDSETS; v++)
+            if(v != u) {
+                if(H5Dget_chunk_cache_stats(dsid[v], &stats) < 0) FAIL_STACK_ERROR
+                if(stats.nused != 0) FAIL_PUTS_ERROR("    idle dataset kept shared chunk cache space")
+            } /* end if */
+    } /* end for */
+
+    /* A dataset with its own cache size doesn't draw on the shared budget */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT, 2 * nbytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if((priv = H5Dcreate2(fid, "private", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(priv, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dread(dsid[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dget_chunk_cache_stats(priv, &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nused != 2 * CHUNK_SHARED_NCACHED) FAIL_PUTS_ERROR("    private chunk cache preempted")
+    if(H5Dget_chunk_cache_stats(dsid[0], &stats) < 0) FAIL_STACK_ERROR
+    if(stats.nused != CHUNK_SHARED_NCACHED) FAIL_PUTS_ERROR("    wrong shared chunk cache size")
+    if(H5Dclose(priv) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+
+    /* Closing one of two handles to a dataset must leave its chunks
+     * preemptable by other datasets */
+    if((dsid2 = H5Dopen2(fid, "dset0", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    for(v = 0; v < CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS; v++)
+        wbuf[v] = -(int)v;
+    if(H5Dwrite(dsid2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid2) < 0) FAIL_STACK_ERROR
+    if(H5Dread(dsid[1], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dread(dsid[0], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    for(v = 0; v < CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS; v++)
+        if(rbuf[v] != -(int)v) FAIL_PUTS_ERROR("    wrong data read")
+
+    /* Close everything */
+    for(u = 0; u < CHUNK_SHARED_NDSETS; u++)
+        if(H5Dclose(dsid[u]) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Check the data made it to the file */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < CHUNK_SHARED_NDSETS; u++) {
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", u);
+        if((dsid[u] = H5Dopen2(fid, dset_name, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Dread(dsid[u], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        for(v = 0; v < CHUNK_SHARED_CHUNK * CHUNK_SHARED_NCHUNKS; v++)
+            if(rbuf[v] != (u ? (int)(u * 100000 + v) : -(int)v)) FAIL_PUTS_ERROR("    wrong data in file")
+        if(H5Dclose(dsid[u]) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(my_fapl) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(fapl2);
+        H5Pclose(my_fapl);
+        for(u = 0; u < CHUNK_SHARED_NDSETS; u++)
+            H5Dclose(dsid[u]);
+        H5Dclose(dsid2);
+        H5Dclose(priv);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_chunk_cache_shared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_prefetch
+ *
+ * Purpose: Tests reading chunks ahead of a sequential or strided scan of
+ *          a dataset, one chunk per read.  Chunks read ahead should be
+ *          found in the cache and hold the right data, and scans without
+ *          a forward pattern (or without read-ahead enabled) shouldn't
+ *          read any chunks ahead.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define PREFETCH_DIM0           40
+#define PREFETCH_DIM1           100
+#define PREFETCH_CHUNK0         5
+#define PREFETCH_CHUNK1         10
+#define PREFETCH_NCHUNKS        ((PREFETCH_DIM0 / PREFETCH_CHUNK0) * (PREFETCH_DIM1 / PREFETCH_CHUNK1))
+#define PREFETCH_NAHEAD         4
+static herr_t
+test_chunk_prefetch(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {PREFETCH_DIM0, PREFETCH_DIM1};
+    hsize_t     chunk_dims[2] = {PREFETCH_CHUNK0, PREFETCH_CHUNK1};
+    hsize_t     start[2];       /* Hyperslab start */
+    size_t      nahead;         /* # of chunks to read ahead */
+    H5D_chunk_cache_stats_t stats;      /* Chunk cache statistics */
+    int         *wbuf = NULL;   /* Buffer for writing data */
+    int         rbuf[PREFETCH_CHUNK0][PREFETCH_CHUNK1]; /* Buffer for reading a chunk */
+    unsigned    scan;           /* Kind of scan */
+    unsigned    u, v, w;        /* Local index variables */
+
+    TESTING("reading chunks ahead of sequential access");
+
+    h5_fixname(FILENAME[16], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * PREFETCH_DIM0 * PREFETCH_DIM1))) TEST_ERROR
+    for(u = 0; u < PREFETCH_DIM0 * PREFETCH_DIM1; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the access property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_prefetch(dapl, &nahead) < 0) FAIL_STACK_ERROR
+    if(nahead != 0) FAIL_PUTS_ERROR("    reading ahead enabled by default")
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+
+    /* Create file and dataset */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+#ifdef H5_HAVE_FILTER_DEFLATE
+    if(H5Pset_deflate(dcpl, 6) < 0) FAIL_STACK_ERROR
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(2, chunk_dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Unfilter the chunks read ahead on several threads */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_filter_threads(dxpl, 4) < 0) FAIL_STACK_ERROR
+
+    /* Scan the chunks in order, every third chunk, backwards and in order
+     * without reading ahead */
+    for(scan = 0; scan < 4; scan++) {
+        if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+        if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT,
+                16 * PREFETCH_CHUNK0 * PREFETCH_CHUNK1 * sizeof(int), H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+        if(scan < 3) {
+            if(H5Pset_chunk_prefetch(dapl, (size_t)PREFETCH_NAHEAD) < 0) FAIL_STACK_ERROR
+            if(H5Pget_chunk_prefetch(dapl, &nahead) < 0) FAIL_STACK_ERROR
+            if(nahead != PREFETCH_NAHEAD) FAIL_PUTS_ERROR("    wrong number of chunks to read ahead retrieved")
+        } /* end if */
+        if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+
+        for(u = 0; u < PREFETCH_NCHUNKS; u += (scan == 1 ? 3 : 1)) {
+            unsigned chunk = (scan == 2) ? (PREFETCH_NCHUNKS - 1 - u) : u;
+
+            start[0] = (chunk / (PREFETCH_DIM1 / PREFETCH_CHUNK1)) * PREFETCH_CHUNK0;
+            start[1] = (chunk % (PREFETCH_DIM1 / PREFETCH_CHUNK1)) * PREFETCH_CHUNK1;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0) FAIL_STACK_ERROR
+            if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+            for(v = 0; v < PREFETCH_CHUNK0; v++)
+                for(w = 0; w < PREFETCH_CHUNK1; w++)
+                    if(rbuf[v][w] != wbuf[(start[0] + v) * PREFETCH_DIM1 + start[1] + w])
+                        FAIL_PUTS_ERROR("    wrong data read")
+        } /* end for */
+
+        if(H5Dget_chunk_cache_stats(dsid, &stats) < 0) FAIL_STACK_ERROR
+        if(stats.nhits != stats.nprefetches)
+            FAIL_PUTS_ERROR("    chunks read ahead not found in the cache")
+        if(scan == 0) {
+            /* After three misses in a row, each miss reads the next four
+             * chunks ahead, up to the end of the dataset */
+            if(stats.nprefetches != 62 || stats.nmisses != PREFETCH_NCHUNKS)
+                FAIL_PUTS_ERROR("    wrong number of chunks read ahead")
+        } /* end if */
+        else if(scan == 1) {
+            if(stats.nprefetches == 0)
+                FAIL_PUTS_ERROR("    no chunks read ahead of strided access")
+        } /* end if */
+        else if(stats.nprefetches != 0)
+            FAIL_PUTS_ERROR("    chunks read ahead without a forward pattern")
+
+        /* The dataset's access properties keep the setting */
+        if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+        if((dapl = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+        if(H5Pget_chunk_prefetch(dapl, &nahead) < 0) FAIL_STACK_ERROR
+        if(nahead != (scan < 3 ? PREFETCH_NAHEAD : 0))
+            FAIL_PUTS_ERROR("    wrong number of chunks to read ahead retrieved from dataset")
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Close everything */
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dxpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    return -1;
+} /* end test_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_append
+ *
+ * Purpose: Tests appending chunks to a dataset one at a time, with and
+ *          without a chunk cache, then shrinking and growing it again.
+ *          The addresses of chunks looked up are kept in a table by
+ *          linear chunk index, so the data read back must stay right when
+ *          chunks are added and removed, and when resizing a faster
+ *          changing dimension renumbers the chunks.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define APPEND_CHUNK            10
+#define APPEND_NCHUNKS          600
+#define APPEND_SHRINK           (((APPEND_NCHUNKS / 2) * APPEND_CHUNK) - (APPEND_CHUNK / 2))
+static herr_t
+test_chunk_append(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    const char  *dset_name;     /* Dataset name */
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2];        /* Dataset dimensions */
+    hsize_t     max_dims[2] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    hsize_t     chunk_dims[2] = {APPEND_CHUNK, 2};
+    hsize_t     start[2];       /* Hyperslab start */
+    hsize_t     count[2];       /* Hyperslab count */
+    int         *rbuf = NULL;   /* Buffer for reading data */
+    int         wbuf[APPEND_CHUNK];     /* Buffer for writing a chunk */
+    int         buf2[4][8];     /* Buffer for 2-D dataset */
+    int         fillval = -1;   /* Fill value */
+    unsigned    cache;          /* Whether to use a chunk cache */
+    unsigned    u, v;           /* Local index variables */
+
+    TESTING("appending chunks to a dataset");
+
+    h5_fixname(FILENAME[17], fapl, filename, sizeof filename);
+
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * APPEND_NCHUNKS * APPEND_CHUNK))) TEST_ERROR
+
+    /* Create file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fillval) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, chunk_dims, NULL)) < 0) FAIL_STACK_ERROR
+
+    for(cache = 0; cache < 2; cache++) {
+        dset_name = cache ? "dset_cache" : "dset_nocache";
+        if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+        if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT,
+                cache ? 4 * APPEND_CHUNK * sizeof(int) : 0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+            FAIL_STACK_ERROR
+
+        /* Append one chunk at a time */
+        dims[0] = 0;
+        if((sid = H5Screate_simple(1, dims, max_dims)) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < APPEND_NCHUNKS; u++) {
+            for(v = 0; v < APPEND_CHUNK; v++)
+                wbuf[v] = (int)(u * APPEND_CHUNK + v) + 1;
+            dims[0] = (hsize_t)(u + 1) * APPEND_CHUNK;
+            if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+            if((sid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+            start[0] = (hsize_t)u * APPEND_CHUNK;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+            if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+        } /* end for */
+
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < APPEND_NCHUNKS * APPEND_CHUNK; u++)
+            if(rbuf[u] != (int)u + 1) {
+                printf("    Read different values than written after appending.\n");
+                printf("    At index %u: read %d, expected %d\n", u, rbuf[u], (int)u + 1);
+                TEST_ERROR
+            } /* end if */
+
+        /* Shrink the dataset into the middle of a chunk and grow it again */
+        dims[0] = APPEND_SHRINK;
+        if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+        dims[0] = APPEND_NCHUNKS * APPEND_CHUNK;
+        if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+
+        /* Check the data, before and after reopening the dataset */
+        for(v = 0; v < 2; v++) {
+            if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                FAIL_STACK_ERROR
+            for(u = 0; u < APPEND_NCHUNKS * APPEND_CHUNK; u++)
+                if(rbuf[u] != (u < APPEND_SHRINK ? (int)u + 1 : fillval)) {
+                    printf("    Read different values than written after shrinking.\n");
+                    printf("    At index %u: read %d\n", u, rbuf[u]);
+                    TEST_ERROR
+                } /* end if */
+
+            if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+            if((dsid = H5Dopen2(fid, dset_name, dapl)) < 0) FAIL_STACK_ERROR
+        } /* end for */
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+
+    /* Create a 2-D dataset, then add columns, which renumbers its chunks */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dims[0] = 2;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    dims[0] = 4;
+    dims[1] = 4;
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4; u++)
+        for(v = 0; v < 8; v++)
+            buf2[u][v] = (int)(u * 8 + v) + 1;
+    count[0] = 4;
+    count[1] = 8;
+    if((msid = H5Screate_simple(2, count, NULL)) < 0) FAIL_STACK_ERROR
+    start[0] = start[1] = 0;
+    count[0] = count[1] = 4;
+    if(H5Sselect_hyperslab(msid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, H5S_ALL, H5P_DEFAULT, buf2) < 0) FAIL_STACK_ERROR
+
+    dims[1] = 8;
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    if((sid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+    start[1] = 4;
+    if(H5Sselect_hyperslab(msid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, buf2) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    HDmemset(rbuf, 0, sizeof(buf2));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 4 * 8; u++)
+        if(rbuf[u] != (int)u + 1) {
+            printf("    Read different values than written after adding columns.\n");
+            printf("    At index %u: read %d, expected %d\n", u, rbuf[u], (int)u + 1);
+            TEST_ERROR
+        } /* end if */
+
+    /* Close everything */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_chunk_append() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_addr_map_cb
+ *
+ * Purpose: Callback for H5Dchunk_iter, recording the chunks seen
+ *
+ *-------------------------------------------------------------------------
+ */
+#define ADDR_MAP_DIM0           20
+#define ADDR_MAP_DIM1           30
+#define ADDR_MAP_CHUNK0         5
+#define ADDR_MAP_CHUNK1         10
+#define ADDR_MAP_NCHUNKS1       (ADDR_MAP_DIM1 / ADDR_MAP_CHUNK1)
+#define ADDR_MAP_NCHUNKS        ((ADDR_MAP_DIM0 / ADDR_MAP_CHUNK0) * ADDR_MAP_NCHUNKS1)
+typedef struct {
+    unsigned    nchunks;                /* Number of chunks seen */
+    unsigned    stop;                   /* Number of chunks to stop after */
+    hbool_t     seen[ADDR_MAP_NCHUNKS]; /* Which chunks were seen */
+    hbool_t     bad;                    /* Whether a chunk's info was wrong */
+} chunk_addr_map_ud_t;
+
+static int
+test_chunk_addr_map_cb(const hsize_t *offset, unsigned filter_mask,
+    haddr_t addr, hsize_t size, void *op_data)
+{
+    chunk_addr_map_ud_t *udata = (chunk_addr_map_ud_t *)op_data;
+    unsigned    idx;            /* Chunk index */
+
+    idx = (unsigned)((offset[0] / ADDR_MAP_CHUNK0) * ADDR_MAP_NCHUNKS1 + offset[1] / ADDR_MAP_CHUNK1);
+    if(offset[0] % ADDR_MAP_CHUNK0 || offset[1] % ADDR_MAP_CHUNK1 || idx >= ADDR_MAP_NCHUNKS
+            || udata->seen[idx] || filter_mask != 0 || HADDR_UNDEF == addr
+            || size != ADDR_MAP_CHUNK0 * ADDR_MAP_CHUNK1 * sizeof(int))
+        udata->bad = TRUE;
+    else
+        udata->seen[idx] = TRUE;
+
+    return(++udata->nchunks == udata->stop);
+} /* end test_chunk_addr_map_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_addr_map
+ *
+ * Purpose: Tests loading the addresses of all chunks when a dataset is
+ *          opened, and reporting the chunks with H5Dchunk_iter.  Reads
+ *          of existing and missing chunks must be answered correctly from
+ *          the loaded addresses, including after more chunks are written.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_addr_map(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {ADDR_MAP_DIM0, ADDR_MAP_DIM1};
+    hsize_t     chunk_dims[2] = {ADDR_MAP_CHUNK0, ADDR_MAP_CHUNK1};
+    hsize_t     start[2];       /* Hyperslab start */
+    hbool_t     load;           /* Whether chunk addresses are loaded */
+    hbool_t     written[ADDR_MAP_NCHUNKS];  /* Which chunks were written */
+    chunk_addr_map_ud_t udata;  /* Iteration callback info */
+    int         wbuf[ADDR_MAP_CHUNK0 * ADDR_MAP_CHUNK1];    /* Buffer for writing a chunk */
+    int         rbuf[ADDR_MAP_DIM0][ADDR_MAP_DIM1];         /* Buffer for reading data */
+    int         fillval = -1;   /* Fill value */
+    herr_t      ret;            /* Generic return value */
+    unsigned    u, v;           /* Local index variables */
+
+    TESTING("loading chunk addresses when opening a dataset");
+
+    h5_fixname(FILENAME[18], fapl, filename, sizeof filename);
+
+    /* Check the access property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_addr_map(dapl, &load) < 0) FAIL_STACK_ERROR
+    if(load) FAIL_PUTS_ERROR("    chunk address loading enabled by default")
+    if(H5Pset_chunk_addr_map(dapl, TRUE) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_addr_map(dapl, &load) < 0) FAIL_STACK_ERROR
+    if(!load) FAIL_PUTS_ERROR("    chunk address loading not enabled")
+
+    /* Create file and dataset, and write every third chunk */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fill_value(dcpl, H5T_NATIVE_INT, &fillval) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(2, chunk_dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for(u = 0; u < ADDR_MAP_NCHUNKS; u++) {
+        written[u] = (hbool_t)(u % 3 == 0);
+        if(written[u]) {
+            for(v = 0; v < ADDR_MAP_CHUNK0 * ADDR_MAP_CHUNK1; v++)
+                wbuf[v] = (int)(u * 1000 + v);
+            start[0] = (hsize_t)(u / ADDR_MAP_NCHUNKS1) * ADDR_MAP_CHUNK0;
+            start[1] = (hsize_t)(u % ADDR_MAP_NCHUNKS1) * ADDR_MAP_CHUNK1;
+            if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0)
+                FAIL_STACK_ERROR
+            if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+        } /* end if */
+    } /* end for */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Reopen the dataset loading the chunk addresses, and write one more
+     * chunk, so it's waiting in the chunk cache */
+    if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT,
+            4 * ADDR_MAP_CHUNK0 * ADDR_MAP_CHUNK1 * sizeof(int), H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    for(v = 0; v < ADDR_MAP_CHUNK0 * ADDR_MAP_CHUNK1; v++)
+        wbuf[v] = (int)(1000 + v);
+    written[1] = TRUE;
+    start[0] = 0;
+    start[1] = ADDR_MAP_CHUNK1;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, chunk_dims, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* Check the data */
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < ADDR_MAP_DIM0; u++)
+        for(v = 0; v < ADDR_MAP_DIM1; v++) {
+            unsigned idx = (u / ADDR_MAP_CHUNK0) * ADDR_MAP_NCHUNKS1 + v / ADDR_MAP_CHUNK1;
+            int expected = written[idx] ? (int)(idx * 1000 + (u % ADDR_MAP_CHUNK0) * ADDR_MAP_CHUNK1 + v % ADDR_MAP_CHUNK1) : fillval;
+
+            if(rbuf[u][v] != expected) {
+                printf("    Read different values than written.\n");
+                printf("    At index %u,%u: read %d, expected %d\n", u, v, rbuf[u][v], expected);
+                TEST_ERROR
+            } /* end if */
+        } /* end for */
+
+    /* Check the chunks reported, including the one in the cache */
+    HDmemset(&udata, 0, sizeof(udata));
+    if(H5Dchunk_iter(dsid, H5P_DEFAULT, test_chunk_addr_map_cb, &udata) < 0) FAIL_STACK_ERROR
+    if(udata.bad) FAIL_PUTS_ERROR("    wrong chunk information reported")
+    for(u = 0; u < ADDR_MAP_NCHUNKS; u++)
+        if(udata.seen[u] != written[u]) FAIL_PUTS_ERROR("    wrong chunks reported")
+
+    /* Check stopping the iteration early */
+    HDmemset(&udata, 0, sizeof(udata));
+    udata.stop = 2;
+    if((ret = H5Dchunk_iter(dsid, H5P_DEFAULT, test_chunk_addr_map_cb, &udata)) != 1)
+        FAIL_PUTS_ERROR("    iteration not stopped")
+    if(udata.nchunks != 2) FAIL_PUTS_ERROR("    iteration stopped at wrong chunk")
+
+    /* The dataset's access properties keep the setting */
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if((dapl = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_addr_map(dapl, &load) < 0) FAIL_STACK_ERROR
+    if(!load) FAIL_PUTS_ERROR("    chunk address loading not retrieved from dataset")
+
+    /* Close everything */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_addr_map() */
+
+
+/* Parameters for testing direct reads of contiguous blocks */
+#define BLOCK_READ_DIM          65536
+#define BLOCK_READ_START        1000
+#define BLOCK_READ_COUNT        50000
+#define BLOCK_READ_SMALL_START  2000
+#define BLOCK_READ_SMALL        10
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_contig_block_read
+ *
+ * Purpose: Tests reading a contiguous dataset when the file and memory
+ *          selections are each one block and the data needs no
+ *          conversion, so the data is read straight into the buffer.
+ *          Data written through the sieve buffer but not yet flushed
+ *          must be seen by such reads.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_contig_block_read(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim = BLOCK_READ_DIM;   /* Dataset dimensions */
+    hsize_t     mdim = BLOCK_READ_COUNT + 6;    /* Memory dimensions */
+    hsize_t     start, count;   /* Hyperslab selection */
+    int        *wbuf = NULL;    /* Buffer for writing */
+    int        *rbuf = NULL;    /* Buffer for reading */
+    int         small[BLOCK_READ_SMALL];        /* Buffer for a small write */
+    size_t      u;              /* Local index variable */
+
+    TESTING("reading contiguous blocks directly");
+
+    h5_fixname(FILENAME[19], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * BLOCK_READ_DIM))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * BLOCK_READ_DIM))) TEST_ERROR
+    for(u = 0; u < BLOCK_READ_DIM; u++)
+        wbuf[u] = (int)u;
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* Read the whole dataset */
+    HDmemset(rbuf, 0, sizeof(int) * BLOCK_READ_DIM);
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < BLOCK_READ_DIM; u++)
+        if(rbuf[u] != wbuf[u]) TEST_ERROR
+
+    /* Overwrite a few elements, which leaves them in the sieve buffer */
+    for(u = 0; u < BLOCK_READ_SMALL; u++)
+        wbuf[BLOCK_READ_SMALL_START + u] = small[u] = -(int)(u + 1);
+    start = BLOCK_READ_SMALL_START;
+    count = BLOCK_READ_SMALL;
+    if((msid = H5Screate_simple(1, &count, NULL)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, small) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+
+    /* Read one block of the dataset into the middle of a larger buffer */
+    start = BLOCK_READ_START;
+    count = BLOCK_READ_COUNT;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, &mdim, NULL)) < 0) FAIL_STACK_ERROR
+    start = 3;
+    if(H5Sselect_hyperslab(msid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * BLOCK_READ_DIM);
+    if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < (size_t)mdim; u++)
+        if(u < 3 || u >= BLOCK_READ_COUNT + 3) {
+            if(rbuf[u] != 0) TEST_ERROR
+        } /* end if */
+        else
+            if(rbuf[u] != wbuf[BLOCK_READ_START + u - 3]) TEST_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+
+    /* Read the whole dataset again, after closing and reopening it */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(int) * BLOCK_READ_DIM);
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < BLOCK_READ_DIM; u++)
+        if(rbuf[u] != wbuf[u]) TEST_ERROR
+
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_contig_block_read() */
+
+/* Dimensions of the dataset mapped with H5Dmap */
+#define MAP_DIM0        20
+#define MAP_DIM1        50
+#define MAP_ROW_START   5
+#define MAP_ROW_COUNT   4
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_contig_map
+ *
+ * Purpose: Tests getting pointers to contiguous data with H5Dmap, from
+ *          files opened with the core and mmap drivers.  Data written
+ *          but not yet flushed from the sieve buffer must be seen, and
+ *          selections, datasets or drivers which can't be mapped must
+ *          fail.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_contig_map(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       core_fapl = -1; /* File access property list for core driver */
+    hid_t       fid = -1;       /* File ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hid_t       dsid2 = -1;     /* Chunked dataset ID */
+    hsize_t     dims[2] = {MAP_DIM0, MAP_DIM1};    /* Dataset dimensions */
+    hsize_t     chunk_dims[2] = {MAP_ROW_COUNT, MAP_DIM1};  /* Chunk dimensions */
+    hsize_t     start[2], count[2];     /* Hyperslab selection */
+    int         wbuf[MAP_DIM0][MAP_DIM1];       /* Buffer for writing */
+    int         small[MAP_DIM1];        /* Buffer for a small write */
+    const int  *map = NULL;     /* Mapped data */
+    herr_t      ret;            /* Generic return value */
+    size_t      u, v;           /* Local index variables */
+
+    TESTING("mapping contiguous data");
+
+    /* The core driver, writing the file out when it's closed */
+    if((core_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fapl_core(core_fapl, (size_t)1024, TRUE) < 0) FAIL_STACK_ERROR
+    h5_fixname(FILENAME[20], core_fapl, filename, sizeof filename);
+
+    for(u = 0; u < MAP_DIM0; u++)
+        for(v = 0; v < MAP_DIM1; v++)
+            wbuf[u][v] = (int)(u * MAP_DIM1 + v);
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, core_fapl)) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* Map the whole dataset */
+    if(H5Dmap(dsid, H5T_NATIVE_INT, H5S_ALL, H5P_DEFAULT, (const void **)&map) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(map, wbuf, sizeof(wbuf))) TEST_ERROR
+
+    /* Overwrite a row, which leaves it in the sieve buffer */
+    for(v = 0; v < MAP_DIM1; v++)
+        wbuf[MAP_ROW_START + 1][v] = small[v] = -(int)(v + 1);
+    start[0] = MAP_ROW_START + 1;
+    start[1] = 0;
+    count[0] = 1;
+    count[1] = MAP_DIM1;
+    if((msid = H5Screate_simple(1, &count[1], NULL)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, small) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+
+    /* Map a block of whole rows */
+    start[0] = MAP_ROW_START;
+    count[0] = MAP_ROW_COUNT;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    map = NULL;
+    if(H5Dmap(dsid, H5T_NATIVE_INT, sid, H5P_DEFAULT, (const void **)&map) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(map, wbuf[MAP_ROW_START], sizeof(int) * MAP_ROW_COUNT * MAP_DIM1)) TEST_ERROR
+
+    /* An empty selection maps to NULL */
+    if(H5Sselect_none(sid) < 0) FAIL_STACK_ERROR
+    if(H5Dmap(dsid, H5T_NATIVE_INT, sid, H5P_DEFAULT, (const void **)&map) < 0) FAIL_STACK_ERROR
+    if(map != NULL) TEST_ERROR
+
+    /* A block of partial rows is not contiguous in the file */
+    count[1] = MAP_DIM1 / 2;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dmap(dsid, H5T_NATIVE_INT, sid, H5P_DEFAULT, (const void **)&map);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Data needing conversion can't be mapped */
+    H5E_BEGIN_TRY {
+        ret = H5Dmap(dsid, H5T_NATIVE_DOUBLE, H5S_ALL, H5P_DEFAULT, (const void **)&map);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Nor can chunked datasets */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((dsid2 = H5Dcreate2(fid, "chunked", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dmap(dsid2, H5T_NATIVE_INT, H5S_ALL, H5P_DEFAULT, (const void **)&map);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Dclose(dsid2) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+#ifdef H5_HAVE_MMAP_VFD
+    {
+        hid_t mmap_fapl;        /* File access property list for mmap driver */
+
+        /* Map the data from the file written by the core driver */
+        if((mmap_fapl = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+        if(H5Pset_fapl_mmap(mmap_fapl) < 0) FAIL_STACK_ERROR
+        fid = H5Fopen(filename, H5F_ACC_RDONLY, mmap_fapl);
+        if(H5Pclose(mmap_fapl) < 0) FAIL_STACK_ERROR
+        if(fid < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        map = NULL;
+        if(H5Dmap(dsid, H5T_NATIVE_INT, H5S_ALL, H5P_DEFAULT, (const void **)&map) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(map, wbuf, sizeof(wbuf))) TEST_ERROR
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    }
+#endif /* H5_HAVE_MMAP_VFD */
+
+    /* Drivers which don't keep the file in memory can't map data */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dmap(dsid, H5T_NATIVE_INT, H5S_ALL, H5P_DEFAULT, (const void **)&map);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(core_fapl) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dsid2);
+        H5Dclose(dsid);
+        H5Pclose(dcpl);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+        H5Pclose(core_fapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_contig_map() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_big_chunks_bypass_cache
@@ -8192,6 +9333,151 @@ error:
     return -1;
 } /* end test_large_chunk_shrink() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: test_filter_threads
+ *
+ * Purpose: Tests writing and reading a compressed chunked dataset with
+ *              the filter pipeline running on several threads, with and
+ *              without the chunk cache, and checks the data against
+ *              ordinary serial I/O.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define FILTER_THREADS_DIM      200
+#define FILTER_THREADS_CHUNK    20
+static herr_t
+test_filter_threads(hid_t fapl)
+{
+#ifdef H5_HAVE_FILTER_DEFLATE
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {FILTER_THREADS_DIM, FILTER_THREADS_DIM};
+    hsize_t     chunk_dims[2] = {FILTER_THREADS_CHUNK, FILTER_THREADS_CHUNK};
+    hsize_t     hs_offset[2], hs_size[2];   /* Hyperslab parameters */
+    int         *wbuf = NULL;   /* Buffer for writing data */
+    int         *rbuf = NULL;   /* Buffer for reading data */
+    unsigned    nthreads;       /* Number of filter threads */
+    unsigned    u, v, w;        /* Local index variables */
+
+    TESTING("filter pipeline on several threads");
+
+    h5_fixname(FILENAME[13], fapl, filename, sizeof filename);
+
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * FILTER_THREADS_DIM * FILTER_THREADS_DIM))) TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * FILTER_THREADS_DIM * FILTER_THREADS_DIM))) TEST_ERROR
+    for(u = 0; u < FILTER_THREADS_DIM * FILTER_THREADS_DIM; u++)
+        wbuf[u] = (int)(u % 97) + (int)(u / 1000);
+
+    /* Check the transfer property */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_threads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 1) FAIL_PUTS_ERROR("wrong default number of filter threads");
+    if(H5Pset_filter_threads(dxpl, 4) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_threads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 4) FAIL_PUTS_ERROR("wrong number of filter threads");
+    H5E_BEGIN_TRY {
+        if(H5Pset_filter_threads(dxpl, 0) >= 0)
+            FAIL_PUTS_ERROR("setting zero filter threads should fail");
+    } H5E_END_TRY;
+
+    /* Create file */
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create compressed, chunked dataset creation property list */
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_deflate(dcpl, 6) < 0) FAIL_STACK_ERROR
+
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* Try once with the chunk cache and once without it */
+    for(w = 0; w < 2; w++) {
+        char dset_name[16];
+
+        if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+        if(w == 1)
+            if(H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+        HDsnprintf(dset_name, sizeof(dset_name), "dset%u", w);
+        if((dsid = H5Dcreate2(fid, dset_name, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+            FAIL_STACK_ERROR
+
+        /* Write all the chunks on several threads */
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, wbuf) < 0) FAIL_STACK_ERROR
+
+        /* Read back serially */
+        HDmemset(rbuf, 0, sizeof(int) * FILTER_THREADS_DIM * FILTER_THREADS_DIM);
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rbuf, wbuf, sizeof(int) * FILTER_THREADS_DIM * FILTER_THREADS_DIM))
+            FAIL_PUTS_ERROR("serial read doesn't match threaded write");
+
+        /* Overwrite a block that doesn't line up with the chunks */
+        hs_offset[0] = 7; hs_offset[1] = 13;
+        hs_size[0] = 150; hs_size[1] = 110;
+        for(u = 0; u < hs_size[0]; u++)
+            for(v = 0; v < hs_size[1]; v++)
+                wbuf[(hs_offset[0] + u) * FILTER_THREADS_DIM + hs_offset[1] + v] = -(int)(u * v);
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, hs_offset, NULL, hs_size, NULL) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, sid, sid, dxpl, wbuf) < 0) FAIL_STACK_ERROR
+        if(H5Sselect_all(sid) < 0) FAIL_STACK_ERROR
+
+        /* Close and re-open the dataset, so that everything comes from the file */
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dopen2(fid, dset_name, dapl)) < 0) FAIL_STACK_ERROR
+
+        /* Read back on several threads */
+        HDmemset(rbuf, 0, sizeof(int) * FILTER_THREADS_DIM * FILTER_THREADS_DIM);
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rbuf, wbuf, sizeof(int) * FILTER_THREADS_DIM * FILTER_THREADS_DIM))
+            FAIL_PUTS_ERROR("threaded read doesn't match data written");
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+        if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Close everything */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dxpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+#else /* H5_HAVE_FILTER_DEFLATE */
+    TESTING("filter pipeline on several threads");
+    SKIPPED();
+    puts("    Deflate filter not enabled");
+    return 0;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+} /* end test_filter_threads() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -9395,11 +10681,19 @@ main(void)
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
         nerrors += (test_huge_chunks(my_fapl) < 0		? 1 : 0);
         nerrors += (test_chunk_cache(my_fapl) < 0		? 1 : 0);
+        nerrors += (test_chunk_cache_policy(my_fapl) < 0	? 1 : 0);
+        nerrors += (test_chunk_cache_shared(my_fapl) < 0	? 1 : 0);
+        nerrors += (test_chunk_prefetch(my_fapl) < 0		? 1 : 0);
+        nerrors += (test_chunk_append(my_fapl) < 0		? 1 : 0);
+        nerrors += (test_chunk_addr_map(my_fapl) < 0		? 1 : 0);
+        nerrors += (test_contig_block_read(my_fapl) < 0		? 1 : 0);
+        nerrors += (test_contig_map(my_fapl) < 0		? 1 : 0);
         nerrors += (test_big_chunks_bypass_cache(my_fapl) < 0   ? 1 : 0);
         nerrors += (test_chunk_expand(my_fapl) < 0		? 1 : 0);
 	nerrors += (test_idx_compatible() < 0  			? 1 : 0);
 	nerrors += (test_layout_extend(my_fapl) < 0		? 1 : 0);
 	nerrors += (test_large_chunk_shrink(my_fapl) < 0        ? 1 : 0);
+	nerrors += (test_filter_threads(my_fapl) < 0            ? 1 : 0);
 
         if(H5Fclose(file) < 0)
             goto error;
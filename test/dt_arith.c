@@ -887,6 +887,99 @@ error:
     return MAX((int)fails_this_test, 1);
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_hard_packed
+ *
+ * Purpose:     Tests hard conversions of densely packed elements in place,
+ *              which are converted a block at a time when there is no
+ *              exception handling routine.  The buffer is misaligned and
+ *              the number of elements isn't a multiple of the block size,
+ *              for both narrowing and widening conversions.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_hard_packed(void)
+{
+    const size_t nelmts = 1000;
+    unsigned char *buf = NULL;
+    unsigned char *elmts;               /* Misaligned start of elements */
+    short       s;
+    int         n;
+    float       f;
+    double      d;
+    size_t      u;
+
+    TESTING("hard conversions of packed elements");
+
+    if(NULL == (buf = (unsigned char *)HDmalloc(nelmts * sizeof(double) + 1)))
+        goto error;
+    elmts = buf + 1;
+
+    /* Widening: short -> float, with values outside the range of short */
+    for(u = 0; u < nelmts; u++) {
+        s = (short)((int)u * 37 - 18000);
+        HDmemcpy(elmts + u * sizeof(short), &s, sizeof(short));
+    }
+    if(H5Tconvert(H5T_NATIVE_SHORT, H5T_NATIVE_FLOAT, nelmts, elmts, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++) {
+        HDmemcpy(&f, elmts + u * sizeof(float), sizeof(float));
+        if(f != (float)((int)u * 37 - 18000)) {
+            H5_FAILED();
+            printf("    element %lu: %g for short -> float\n", (unsigned long)u, (double)f);
+            goto error;
+        }
+    }
+
+    /* Widening: float -> double */
+    if(H5Tconvert(H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, nelmts, elmts, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++) {
+        HDmemcpy(&d, elmts + u * sizeof(double), sizeof(double));
+        if(d != (double)((int)u * 37 - 18000)) {
+            H5_FAILED();
+            printf("    element %lu: %g for float -> double\n", (unsigned long)u, d);
+            goto error;
+        }
+    }
+
+    /* Narrowing: int -> short, which clips values out of range */
+    for(u = 0; u < nelmts; u++) {
+        n = ((int)u - 500) * 100;
+        HDmemcpy(elmts + u * sizeof(int), &n, sizeof(int));
+    }
+    if(H5Tconvert(H5T_NATIVE_INT, H5T_NATIVE_SHORT, nelmts, elmts, NULL, H5P_DEFAULT) < 0)
+        goto error;
+    for(u = 0; u < nelmts; u++) {
+        n = ((int)u - 500) * 100;
+        if(n > SHRT_MAX)
+            n = SHRT_MAX;
+        else if(n < SHRT_MIN)
+            n = SHRT_MIN;
+        HDmemcpy(&s, elmts + u * sizeof(short), sizeof(short));
+        if(s != n) {
+            H5_FAILED();
+            printf("    element %lu: %d for int -> short\n", (unsigned long)u, (int)s);
+            goto error;
+        }
+    }
+
+    HDfree(buf);
+    PASSED();
+    return 0;
+
+error:
+    if(buf)
+        HDfree(buf);
+    return 1;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_derived_flt
@@ -5498,6 +5591,9 @@ main(void)
     /* Test a few special values for hardware float-integer conversions */
     nerrors += test_particular_fp_integer();
 
+    /* Test hardware conversions of packed elements in place */
+    nerrors += test_hard_packed();
+
     /*----------------------------------------------------------------------
      * Software tests
      *----------------------------------------------------------------------
@@ -4674,6 +4674,96 @@ test_conv_bitfield(void)
     return 1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_conv_order
+ *
+ * Purpose:	Test byte order conversions of 2-, 4- and 8-byte integers,
+ *		both densely packed and, as members of a compound datatype,
+ *		with a buffer stride.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_order(void)
+{
+    const size_t nelmts = 1001;
+    const size_t cmpd_size = 12;
+    hid_t	be_type[3], le_type[3];
+    hid_t	st = -1, dt = -1;
+    size_t	size[3] = {2, 4, 8};
+    unsigned char *buf = NULL, *bkg = NULL;
+    size_t	i, u, b;
+    int		packed;
+
+    TESTING("byte order conversions");
+
+    be_type[0] = H5T_STD_U16BE; le_type[0] = H5T_STD_U16LE;
+    be_type[1] = H5T_STD_U32BE; le_type[1] = H5T_STD_U32LE;
+    be_type[2] = H5T_STD_U64BE; le_type[2] = H5T_STD_U64LE;
+
+    if(NULL == (buf = (unsigned char *)HDmalloc(nelmts * cmpd_size))) goto error;
+    if(NULL == (bkg = (unsigned char *)HDcalloc(nelmts, cmpd_size))) goto error;
+
+    for(i = 0; i < 3; i++)
+        for(packed = 1; packed >= 0; packed--) {
+            size_t elmt_stride = packed ? size[i] : cmpd_size;
+
+            if(packed) {
+                if((st = H5Tcopy(be_type[i])) < 0) goto error;
+                if((dt = H5Tcopy(le_type[i])) < 0) goto error;
+            } else {
+                if((st = H5Tcreate(H5T_COMPOUND, cmpd_size)) < 0) goto error;
+                if(H5Tinsert(st, "a", (size_t)0, be_type[i]) < 0) goto error;
+                if((dt = H5Tcreate(H5T_COMPOUND, cmpd_size)) < 0) goto error;
+                if(H5Tinsert(dt, "a", (size_t)0, le_type[i]) < 0) goto error;
+            }
+
+            for(u = 0; u < nelmts * cmpd_size; u++)
+                buf[u] = (unsigned char)(u * 7 + 3);
+            if(H5Tconvert(st, dt, nelmts, buf, bkg, H5P_DEFAULT) < 0) goto error;
+
+            for(u = 0; u < nelmts; u++)
+                for(b = 0; b < size[i]; b++) {
+                    size_t src_off = u * elmt_stride + (size[i] - 1 - b);
+
+                    if(buf[u * elmt_stride + b] != (unsigned char)(src_off * 7 + 3)) {
+                        H5_FAILED();
+                        printf("    %lu-byte element %lu, byte %lu is wrong (%s)\n",
+                               (unsigned long)size[i], (unsigned long)u,
+                               (unsigned long)b, packed ? "packed" : "strided");
+                        goto error;
+                    }
+                }
+
+            if(H5Tclose(st) < 0) goto error;
+            if(H5Tclose(dt) < 0) goto error;
+            st = dt = -1;
+        }
+
+    HDfree(buf);
+    HDfree(bkg);
+    PASSED();
+    reset_hdf5();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+        H5Tclose(st);
+        H5Tclose(dt);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    if(bkg)
+        HDfree(bkg);
+    reset_hdf5();
+    return 1;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_bitfield_funcs
@@ -7328,6 +7418,7 @@ main(void)
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
     nerrors += test_conv_bitfield();
+    nerrors += test_conv_order();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
     nerrors += test_set_order();
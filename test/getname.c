@@ -2905,6 +2905,205 @@ error:
     return 1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_many_objs
+ *
+ * Purpose:     Verify that names of open objects are kept up to date
+ *              across many link moves and deletes, while IDs are opened,
+ *              closed, committed and linked between them.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define MANY_OBJS_NGRPS 32
+#define MANY_OBJS_NDSETS 16
+#define MANY_OBJS_NMOVES 40
+static herr_t
+move_many(hid_t fid, const char *src, const char *dst)
+{
+    int i;                              /* Local index variable */
+
+    /* Move a link back and forth, so that open objects are renamed many
+     * times in a row
+     */
+    for(i = 0; i < MANY_OBJS_NMOVES; i++) {
+        if(H5Lmove(fid, src, fid, dst, H5P_DEFAULT, H5P_DEFAULT) < 0)
+            return -1;
+        if(H5Lmove(fid, dst, fid, src, H5P_DEFAULT, H5P_DEFAULT) < 0)
+            return -1;
+    } /* end for */
+
+    return H5Lmove(fid, src, fid, dst, H5P_DEFAULT, H5P_DEFAULT);
+}
+
+static int
+test_many_objs(hid_t fapl)
+{
+    char filename1[1024];               /* Filename */
+    hid_t       fid = -1;               /* HDF5 File ID */
+    hid_t       sid = -1;               /* Dataspace ID */
+    hid_t       gid_a = -1, gid_b = -1; /* Group IDs */
+    hid_t       gid_sib1 = -1, gid_sib2 = -1, gid_sib3 = -1; /* Sibling group IDs */
+    hid_t       gid_extra = -1;         /* Group ID opened between moves */
+    hid_t       gids[MANY_OBJS_NGRPS];  /* Group IDs */
+    hid_t       dids[MANY_OBJS_NDSETS]; /* Dataset IDs */
+    hid_t       did_anon = -1;          /* Anonymous dataset ID */
+    hid_t       tid0 = -1, tid1 = -1;   /* Datatype IDs */
+    hsize_t     dims[1] = {1};          /* Dataspace dimensions */
+    char        path[NAME_BUF_SIZE];    /* Path of object */
+    char        path2[NAME_BUF_SIZE];   /* Another path of object */
+    int         i;                      /* Local index variable */
+
+    TESTING("H5Iget_name with many open objects and link changes");
+
+    for(i = 0; i < MANY_OBJS_NGRPS; i++)
+        gids[i] = -1;
+    for(i = 0; i < MANY_OBJS_NDSETS; i++)
+        dids[i] = -1;
+
+    h5_fixname(FILENAME[1], fapl, filename1, sizeof filename1);
+    if((fid = H5Fcreate(filename1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, NULL)) < 0) FAIL_STACK_ERROR
+
+    /* Create groups under /a/b, plus groups whose names start with "/a" */
+    if((gid_a = H5Gcreate2(fid, "/a", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((gid_b = H5Gcreate2(fid, "/a/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < MANY_OBJS_NGRPS; i++) {
+        sprintf(path, "/a/b/g%d", i);
+        if((gids[i] = H5Gcreate2(fid, path, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if((gid_sib1 = H5Gcreate2(fid, "/a-1", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((gid_sib2 = H5Gcreate2(fid, "/ab", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((gid_sib3 = H5Gcreate2(fid, "/a-1/b", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Move the top group around, then a group inside it */
+    if(move_many(fid, "/a", "/y") < 0) FAIL_STACK_ERROR
+    if(H5Lmove(fid, "/y/b", fid, "/y/c", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(check_name(gid_a, "/y", "/y") < 0) TEST_ERROR
+    if(check_name(gid_b, "/y/c", "/y/c") < 0) TEST_ERROR
+    for(i = 0; i < MANY_OBJS_NGRPS; i++) {
+        sprintf(path, "/y/c/g%d", i);
+        if(check_name(gids[i], path, path) < 0) TEST_ERROR
+    } /* end for */
+    if(check_name(gid_sib1, "/a-1", "/a-1") < 0) TEST_ERROR
+    if(check_name(gid_sib2, "/ab", "/ab") < 0) TEST_ERROR
+    if(check_name(gid_sib3, "/a-1/b", "/a-1/b") < 0) TEST_ERROR
+
+    /* Close some of the groups, then move the rest */
+    for(i = 0; i < MANY_OBJS_NGRPS; i += 2) {
+        if(H5Gclose(gids[i]) < 0) FAIL_STACK_ERROR
+        gids[i] = -1;
+    } /* end for */
+    if(H5Lmove(fid, "/y", fid, "/z", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    for(i = 1; i < MANY_OBJS_NGRPS; i += 2) {
+        sprintf(path, "/z/c/g%d", i);
+        if(check_name(gids[i], path, path) < 0) TEST_ERROR
+    } /* end for */
+
+    /* Open a group between moves */
+    if((gid_extra = H5Gopen2(fid, "/z/c/g2", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Lmove(fid, "/z", fid, "/w", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(move_many(fid, "/w", "/a") < 0) FAIL_STACK_ERROR
+    if(check_name(gid_extra, "/a/c/g2", "/a/c/g2") < 0) TEST_ERROR
+    if(check_name(gid_a, "/a", "/a") < 0) TEST_ERROR
+    for(i = 1; i < MANY_OBJS_NGRPS; i += 2) {
+        sprintf(path, "/a/c/g%d", i);
+        if(check_name(gids[i], path, path) < 0) TEST_ERROR
+    } /* end for */
+    if(check_name(gid_sib1, "/a-1", "/a-1") < 0) TEST_ERROR
+    if(check_name(gid_sib3, "/a-1/b", "/a-1/b") < 0) TEST_ERROR
+
+    /* Delete links to some of the groups */
+    if(H5Ldelete(fid, "/a/c/g3", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Ldelete(fid, "/a/c/g2", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(check_name(gids[3], "", "") < 0) TEST_ERROR
+    if(check_name(gid_extra, "", "") < 0) TEST_ERROR
+    if(check_name(gids[1], "/a/c/g1", "/a/c/g1") < 0) TEST_ERROR
+    if(check_name(gids[5], "/a/c/g5", "/a/c/g5") < 0) TEST_ERROR
+
+    /* Create datasets whose names are prefixes of each other ("d1", "d10") */
+    if(H5Gclose(H5Gcreate2(fid, "/ds", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < MANY_OBJS_NDSETS; i++) {
+        sprintf(path, "/ds/d%d", i);
+        if((dids[i] = H5Dcreate2(fid, path, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if((did_anon = H5Dcreate_anon(fid, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Rename the datasets one at a time */
+    if(move_many(fid, "/ds/d0", "/ds/e0") < 0) FAIL_STACK_ERROR
+    for(i = 1; i < MANY_OBJS_NDSETS; i++) {
+        sprintf(path, "/ds/d%d", i);
+        sprintf(path2, "/ds/e%d", i);
+        if(H5Lmove(fid, path, fid, path2, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    for(i = 0; i < MANY_OBJS_NDSETS; i++) {
+        sprintf(path, "/ds/e%d", i);
+        if(check_name(dids[i], path, path) < 0) TEST_ERROR
+    } /* end for */
+
+    /* Give the anonymous dataset a name, then move it */
+    if(H5Olink(did_anon, fid, "/ds/anon", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lmove(fid, "/ds/anon", fid, "/ds/anon2", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(check_name(did_anon, "/ds/anon2", "/ds/anon2") < 0) TEST_ERROR
+
+    /* Commit a datatype that already has an ID between moves of datatypes */
+    if((tid0 = H5Tcopy(H5T_NATIVE_INT)) < 0) FAIL_STACK_ERROR
+    if((tid1 = H5Tcopy(H5T_NATIVE_INT)) < 0) FAIL_STACK_ERROR
+    if(H5Tcommit2(fid, "/t0", tid0, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(move_many(fid, "/t0", "/v0") < 0) FAIL_STACK_ERROR
+    if(H5Tcommit2(fid, "/t1", tid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Lmove(fid, "/t1", fid, "/u1", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(check_name(tid0, "/v0", "/v0") < 0) TEST_ERROR
+    if(check_name(tid1, "/u1", "/u1") < 0) TEST_ERROR
+
+    /* Close everything */
+    if(H5Tclose(tid0) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(tid1) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did_anon) < 0) FAIL_STACK_ERROR
+    for(i = 0; i < MANY_OBJS_NDSETS; i++)
+        if(H5Dclose(dids[i]) < 0) FAIL_STACK_ERROR
+    for(i = 1; i < MANY_OBJS_NGRPS; i += 2)
+        if(H5Gclose(gids[i]) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid_extra) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid_sib3) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid_sib2) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid_sib1) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid_b) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid_a) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(tid0);
+        H5Tclose(tid1);
+        H5Dclose(did_anon);
+        for(i = 0; i < MANY_OBJS_NDSETS; i++)
+            H5Dclose(dids[i]);
+        for(i = 0; i < MANY_OBJS_NGRPS; i++)
+            H5Gclose(gids[i]);
+        H5Gclose(gid_extra);
+        H5Gclose(gid_sib3);
+        H5Gclose(gid_sib2);
+        H5Gclose(gid_sib1);
+        H5Gclose(gid_b);
+        H5Gclose(gid_a);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+
+    return 1;
+}
+
+
 int
 main(void)
 {
@@ -2927,6 +3126,7 @@ main(void)
     nerrors += test_main(file_id, fapl);
     nerrors += test_obj_ref(fapl);
     nerrors += test_reg_ref(fapl);
+    nerrors += test_many_objs(fapl);
 #ifndef H5_CANNOT_OPEN_TWICE
     nerrors += test_elinks(fapl);
 #endif /*H5_CANNOT_OPEN_TWICE*/
@@ -598,6 +598,11 @@ h5_fileaccess(void)
   /* Linux direct read() and write() system calls.  Set memory boundary, file block size,
    * and copy buffer size to the default values. */
   if (H5Pset_fapl_direct(fapl, 1024, 4096, 8*4096)<0) return -1;
+#endif
+    } else if (!HDstrcmp(name, "iouring")) {
+#ifdef H5_HAVE_IOURING
+  /* Linux io_uring submission queue with the default queue depth */
+  if (H5Pset_fapl_iouring(fapl, 0)<0) return -1;
 #endif
     } else if(!HDstrcmp(name, "latest")) {
   /* use the latest format */
@@ -885,6 +890,12 @@ h5_get_file_size(const char *filename, hid_t fapl)
 #ifdef H5_HAVE_DIRECT
                 driver == H5FD_DIRECT ||
 #endif /* H5_HAVE_DIRECT */
+#ifdef H5_HAVE_IOURING
+                driver == H5FD_IOURING ||
+#endif /* H5_HAVE_IOURING */
+#ifdef H5_HAVE_MMAP_VFD
+                driver == H5FD_MMAP ||
+#endif /* H5_HAVE_MMAP_VFD */
                 driver == H5FD_LOG) {
             /* Get the file's statistics */
             if(0 == HDstat(filename, &sb))
@@ -150,6 +150,10 @@ const char *FILENAME[] = {
 #define CORDER_ITER_STOP            3
 #define CORDER_EST_ENTRY_LEN        9
 
+/* Batched link creation macros */
+#define MANY_NOBJS              20
+#define MANY_NCOMPACT           5
+
 /* Timestamp macros */
 #define TIMESTAMP_GROUP_1       "timestamp1"
 #define TIMESTAMP_GROUP_2       "timestamp2"
@@ -1604,6 +1608,232 @@ error:
     return 1;
 } /* end test_move_preserves() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_create_many
+ *
+ * Purpose:     Tests H5Lcreate_hard_many() into compact and dense groups,
+ *              and that a batch with a bad name creates no links.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_create_many(hid_t fapl, hbool_t new_format)
+{
+    hid_t       file_id = -1, file2_id = -1;
+    hid_t       gcpl_id = -1;
+    hid_t       objs_id = -1, compact_id = -1, dense_id = -1, bulk_id = -1, empty_id = -1, obj_id = -1;
+    char        src_buf[MANY_NOBJS][24];        /* Names of objects to link to */
+    char        dst_buf[2][MANY_NOBJS][24];     /* Names of new links */
+    const char  *src[MANY_NOBJS];
+    const char  *dst[MANY_NOBJS];
+    const char  *bad_src[3];
+    const char  *bad_dst[3];
+    char        name[24];
+    H5G_info_t  ginfo;
+    H5L_info_t  linfo;
+    H5O_info_t  oinfo;
+    unsigned    u, v;
+    char        filename[1024];
+
+    if(new_format)
+        TESTING("H5Lcreate_hard_many (w/new group format)")
+    else
+        TESTING("H5Lcreate_hard_many")
+
+    /* Create files */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+    h5_fixname(FILENAME[1], fapl, filename, sizeof filename);
+    if((file2_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) TEST_ERROR
+
+    /* Create objects to link to */
+    if((objs_id = H5Gcreate2(file_id, "objs", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    for(u = 0; u < MANY_NOBJS; u++) {
+        sprintf(src_buf[u], "objs/obj%02u", u);
+        sprintf(dst_buf[0][u], "batch1_%02u", u);
+        sprintf(dst_buf[1][u], "batch2_%02u", u);
+        if((obj_id = H5Gcreate2(file_id, src_buf[u], H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+        if(H5Gclose(obj_id) < 0) TEST_ERROR
+        obj_id = -1;
+    } /* end for */
+
+    /* Create group tracking & indexing creation order, to become dense */
+    if((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0) TEST_ERROR
+    if(H5Pset_link_creation_order(gcpl_id, (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED)) < 0) TEST_ERROR
+    if((dense_id = H5Gcreate2(file_id, "dense", H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0) TEST_ERROR
+    if((compact_id = H5Gcreate2(file_id, "compact", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) TEST_ERROR
+    if((bulk_id = H5Gcreate2(file_id, "bulk", H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0) TEST_ERROR
+    if((empty_id = H5Gcreate2(file_id, "empty", H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0) TEST_ERROR
+
+    /* Create a batch of links that converts an empty group to dense storage */
+    for(u = 0; u < MANY_NOBJS; u++) {
+        src[u] = src_buf[u];
+        dst[u] = dst_buf[0][u];
+    } /* end for */
+    if(H5Lcreate_hard_many(file_id, src, bulk_id, dst, (size_t)MANY_NOBJS, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Create a couple of links one at a time */
+    if(H5Lcreate_hard(file_id, src_buf[0], dense_id, "single0", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Lcreate_hard(file_id, src_buf[1], dense_id, "single1", H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* Create a batch of links that converts the group to dense storage,
+     *  then a batch into the dense storage */
+    for(v = 0; v < 2; v++) {
+        for(u = 0; u < MANY_NOBJS; u++) {
+            src[u] = src_buf[u];
+            dst[u] = dst_buf[v][u];
+        } /* end for */
+        if(H5Lcreate_hard_many(file_id, src, dense_id, dst, (size_t)MANY_NOBJS, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Create a small batch in reverse name order, relative to the group */
+    for(u = 0; u < MANY_NCOMPACT; u++) {
+        src[u] = src_buf[MANY_NCOMPACT - (u + 1)] + HDstrlen("objs/");
+        dst[u] = dst_buf[0][MANY_NCOMPACT - (u + 1)];
+    } /* end for */
+    if(H5Lcreate_hard_many(objs_id, src, compact_id, dst, (size_t)MANY_NCOMPACT, H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Names repeated in the batch, already in the group, not single
+     *  components, or objects that don't exist or are in another file
+     *  should fail without creating any links */
+    bad_src[0] = bad_src[1] = bad_src[2] = src_buf[0];
+    bad_dst[0] = "new_a";
+    bad_dst[1] = "new_b";
+    H5E_BEGIN_TRY {
+        bad_dst[2] = "new_a";
+        if(H5Lcreate_hard_many(file_id, bad_src, dense_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        if(H5Lcreate_hard_many(file_id, bad_src, compact_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        bad_dst[2] = "batch1_07";
+        if(H5Lcreate_hard_many(file_id, bad_src, dense_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        bad_dst[2] = "batch1_01";
+        if(H5Lcreate_hard_many(file_id, bad_src, compact_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        bad_dst[2] = "new/c";
+        if(H5Lcreate_hard_many(file_id, bad_src, dense_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        bad_dst[2] = "new_c";
+        bad_src[2] = "objs/missing";
+        if(H5Lcreate_hard_many(file_id, bad_src, dense_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        bad_src[2] = "/";
+        if(H5Lcreate_hard_many(file2_id, bad_src, dense_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        if(H5Lcreate_hard_many(file_id, bad_src, objs_id, bad_dst, (size_t)3, H5P_DEFAULT, H5P_DEFAULT) < 0) TEST_ERROR
+        if(H5Lcreate_hard_many(file_id, src, H5L_SAME_LOC, dst, (size_t)1, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+    } H5E_END_TRY;
+
+    /* Batches too large for compact storage should fail the same way,
+     *  without converting the group to dense storage */
+    for(u = 0; u < MANY_NOBJS; u++) {
+        src[u] = src_buf[u];
+        dst[u] = dst_buf[1][u];
+    } /* end for */
+    H5E_BEGIN_TRY {
+        dst[MANY_NOBJS - 1] = dst_buf[0][1];
+        if(H5Lcreate_hard_many(file_id, src, compact_id, dst, (size_t)MANY_NOBJS, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+        dst[MANY_NOBJS - 1] = dst_buf[1][0];
+        if(H5Lcreate_hard_many(file_id, src, empty_id, dst, (size_t)MANY_NOBJS, H5P_DEFAULT, H5P_DEFAULT) >= 0) TEST_ERROR
+    } H5E_END_TRY;
+    if(H5Ldelete(objs_id, "new_a", H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Ldelete(objs_id, "new_b", H5P_DEFAULT) < 0) TEST_ERROR
+    if(H5Ldelete(objs_id, "new_c", H5P_DEFAULT) < 0) TEST_ERROR
+
+    /* Close everything & re-open the file */
+    if(H5Gclose(compact_id) < 0) TEST_ERROR
+    if(H5Gclose(dense_id) < 0) TEST_ERROR
+    if(H5Gclose(bulk_id) < 0) TEST_ERROR
+    if(H5Gclose(empty_id) < 0) TEST_ERROR
+    if(H5Gclose(objs_id) < 0) TEST_ERROR
+    if(H5Pclose(gcpl_id) < 0) TEST_ERROR
+    if(H5Fclose(file2_id) < 0) TEST_ERROR
+    if(H5Fclose(file_id) < 0) TEST_ERROR
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((file_id = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) TEST_ERROR
+
+    /* Check the dense group, including the creation order of the links */
+    if((dense_id = H5Gopen2(file_id, "dense", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gget_info(dense_id, &ginfo) < 0) TEST_ERROR
+    if(ginfo.storage_type != H5G_STORAGE_TYPE_DENSE) TEST_ERROR
+    if(ginfo.nlinks != 2 + 2 * MANY_NOBJS) TEST_ERROR
+    if(ginfo.max_corder != 2 + 2 * MANY_NOBJS) TEST_ERROR
+    for(v = 0; v < 2; v++)
+        for(u = 0; u < MANY_NOBJS; u++) {
+            if(H5Lget_info(dense_id, dst_buf[v][u], &linfo, H5P_DEFAULT) < 0) TEST_ERROR
+            if(linfo.type != H5L_TYPE_HARD) TEST_ERROR
+            if(linfo.corder_valid != TRUE) TEST_ERROR
+            if(linfo.corder != (int64_t)(2 + v * MANY_NOBJS + u)) TEST_ERROR
+            if(H5Lget_name_by_idx(dense_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)(2 + v * MANY_NOBJS + u), name, sizeof(name), H5P_DEFAULT) < 0) TEST_ERROR
+            if(HDstrcmp(name, dst_buf[v][u])) TEST_ERROR
+        } /* end for */
+    if(H5Gclose(dense_id) < 0) TEST_ERROR
+
+    /* Check the group that was empty before its batch */
+    if((bulk_id = H5Gopen2(file_id, "bulk", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gget_info(bulk_id, &ginfo) < 0) TEST_ERROR
+    if(ginfo.storage_type != H5G_STORAGE_TYPE_DENSE) TEST_ERROR
+    if(ginfo.nlinks != MANY_NOBJS) TEST_ERROR
+    for(u = 0; u < MANY_NOBJS; u++) {
+        if(H5Lget_info(bulk_id, dst_buf[0][u], &linfo, H5P_DEFAULT) < 0) TEST_ERROR
+        if(linfo.corder != (int64_t)u) TEST_ERROR
+        if(H5Lget_name_by_idx(bulk_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, (hsize_t)(MANY_NOBJS - (u + 1)), name, sizeof(name), H5P_DEFAULT) < 0) TEST_ERROR
+        if(HDstrcmp(name, dst_buf[0][u])) TEST_ERROR
+    } /* end for */
+    if(H5Lexists(bulk_id, dst_buf[1][0], H5P_DEFAULT) != FALSE) TEST_ERROR
+    if(H5Gclose(bulk_id) < 0) TEST_ERROR
+
+    /* Check the other group */
+    if((compact_id = H5Gopen2(file_id, "compact", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gget_info(compact_id, &ginfo) < 0) TEST_ERROR
+    if(ginfo.nlinks != MANY_NCOMPACT) TEST_ERROR
+    if(ginfo.storage_type != (new_format ? H5G_STORAGE_TYPE_COMPACT : H5G_STORAGE_TYPE_SYMBOL_TABLE)) TEST_ERROR
+    for(u = 0; u < MANY_NCOMPACT; u++)
+        if(H5Lexists(compact_id, dst_buf[0][u], H5P_DEFAULT) != TRUE) TEST_ERROR
+    if(H5Gclose(compact_id) < 0) TEST_ERROR
+
+    /* Check the group whose only batch was rejected */
+    if((empty_id = H5Gopen2(file_id, "empty", H5P_DEFAULT)) < 0) TEST_ERROR
+    if(H5Gget_info(empty_id, &ginfo) < 0) TEST_ERROR
+    if(ginfo.nlinks != 0) TEST_ERROR
+    if(ginfo.storage_type != H5G_STORAGE_TYPE_COMPACT) TEST_ERROR
+    if(H5Gclose(empty_id) < 0) TEST_ERROR
+
+    /* Check the reference counts of the objects */
+    for(u = 0; u < MANY_NOBJS; u++) {
+        haddr_t addr;
+
+        if(H5Oget_info_by_name(file_id, src_buf[u], &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+        if(oinfo.rc != 4 + (u < 2 ? 1U : 0U) + (u < MANY_NCOMPACT ? 1U : 0U)) TEST_ERROR
+        addr = oinfo.addr;
+        sprintf(name, "dense/%s", dst_buf[1][u]);
+        if(H5Oget_info_by_name(file_id, name, &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+        if(oinfo.addr != addr) TEST_ERROR
+        if(u < MANY_NCOMPACT) {
+            sprintf(name, "compact/%s", dst_buf[0][u]);
+            if(H5Oget_info_by_name(file_id, name, &oinfo, H5P_DEFAULT) < 0) TEST_ERROR
+            if(oinfo.addr != addr) TEST_ERROR
+        } /* end if */
+    } /* end for */
+
+    if(H5Fclose(file_id) < 0) TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(obj_id);
+        H5Gclose(compact_id);
+        H5Gclose(dense_id);
+        H5Gclose(bulk_id);
+        H5Gclose(empty_id);
+        H5Gclose(objs_id);
+        H5Pclose(gcpl_id);
+        H5Fclose(file2_id);
+        H5Fclose(file_id);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_create_many() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_deprec
@@ -10130,6 +10360,128 @@ error:
     return -1;
 } /* end obj_exists() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    path_cache
+ *
+ * Purpose:     Check that paths resolved again from the root group follow
+ *              links being moved, re-created and deleted.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+path_cache(hid_t fapl, hbool_t new_format)
+{
+    char filename[NAME_BUF_SIZE];       /* Buffer for file name */
+    char objname[NAME_BUF_SIZE];        /* Object name */
+    hid_t fid = -1;     /* File ID */
+    hid_t gid = -1;     /* Group ID */
+    hid_t did = -1;     /* Dataset ID */
+    hid_t sid = -1;     /* Dataspace ID */
+    hid_t lcpl = -1;    /* Link creation property list ID */
+    H5O_info_t oinfo;   /* Object info */
+    haddr_t addr_d, addr_e;     /* Addresses of the objects */
+    unsigned u;         /* Local index variable */
+    herr_t status;      /* Generic return value */
+
+    if(new_format)
+        TESTING("path resolution after link changes (w/new group format)")
+    else
+        TESTING("path resolution after link changes")
+
+    /* Set up filename and create file */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+
+    /* Create "/a/b/c/d" and "/a/b/c/e" */
+    if((lcpl = H5Pcreate(H5P_LINK_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_create_intermediate_group(lcpl, TRUE) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate(H5S_SCALAR)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dcreate2(fid, "/a/b/c/d", H5T_NATIVE_INT, sid, lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if((gid = H5Gcreate2(fid, "/a/b/c/e", lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+    if(H5Oget_info_by_name(fid, "/a/b/c/d", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    addr_d = oinfo.addr;
+    if(H5Oget_info_by_name(fid, "/a/b/c/e", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    addr_e = oinfo.addr;
+
+    /* Resolve the paths repeatedly, from the root group and from the file */
+    for(u = 0; u < 3; u++) {
+        if(H5Oget_info_by_name(fid, "/a/b/c/d", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(H5F_addr_ne(oinfo.addr, addr_d)) TEST_ERROR
+        if(H5Oget_info_by_name(fid, "a/b/c/e", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(H5F_addr_ne(oinfo.addr, addr_e)) TEST_ERROR
+        if(TRUE != H5Lexists(fid, "/a/b/c", H5P_DEFAULT)) TEST_ERROR
+        if((did = H5Dopen2(fid, "a/b/c/d", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+        if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) FAIL_STACK_ERROR
+        if(HDstrcmp(objname, "/a/b/c/d")) TEST_ERROR
+        if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Resolve a path from a group */
+    if((gid = H5Gopen2(fid, "/a/b", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((did = H5Dopen2(gid, "c/d", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(objname, "/a/b/c/d")) TEST_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(gid) < 0) FAIL_STACK_ERROR
+
+    /* Rename a group on the paths */
+    if(H5Lmove(fid, "/a/b", fid, "/a/x", H5P_DEFAULT, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(FALSE != H5Lexists(fid, "/a/b", H5P_DEFAULT)) TEST_ERROR
+    H5E_BEGIN_TRY {
+        status = H5Oget_info_by_name(fid, "/a/b/c/d", &oinfo, H5P_DEFAULT);
+    } H5E_END_TRY
+    if(status >= 0) TEST_ERROR
+    if(H5Oget_info_by_name(fid, "/a/x/c/d", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5F_addr_ne(oinfo.addr, addr_d)) TEST_ERROR
+    if((did = H5Dopen2(fid, "/a/x/c/d", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Iget_name(did, objname, (size_t)NAME_BUF_SIZE) < 0) FAIL_STACK_ERROR
+    if(HDstrcmp(objname, "/a/x/c/d")) TEST_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+
+    /* Create a new dataset at the old path */
+    if((did = H5Dcreate2(fid, "/a/b/c/d", H5T_NATIVE_INT, sid, lcpl, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(did) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++) {
+        if(H5Oget_info_by_name(fid, "/a/b/c/d", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(H5F_addr_eq(oinfo.addr, addr_d)) TEST_ERROR
+        if(H5Oget_info_by_name(fid, "/a/x/c/d", &oinfo, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(H5F_addr_ne(oinfo.addr, addr_d)) TEST_ERROR
+    } /* end for */
+
+    /* Delete links on the paths, by name and by index */
+    if(TRUE != H5Lexists(fid, "/a/x/c/e", H5P_DEFAULT)) TEST_ERROR
+    if(H5Ldelete(fid, "/a/x/c/e", H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(FALSE != H5Lexists(fid, "/a/x/c/e", H5P_DEFAULT)) TEST_ERROR
+    if(TRUE != H5Lexists(fid, "a/x/c/d", H5P_DEFAULT)) TEST_ERROR
+    if(H5Ldelete_by_idx(fid, "/a/x/c", H5_INDEX_NAME, H5_ITER_INC, (hsize_t)0, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(FALSE != H5Lexists(fid, "a/x/c/d", H5P_DEFAULT)) TEST_ERROR
+    if(TRUE != H5Lexists(fid, "/a/b/c/d", H5P_DEFAULT)) TEST_ERROR
+
+    /* Close everything */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(lcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(did);
+        H5Gclose(gid);
+        H5Sclose(sid);
+        H5Pclose(lcpl);
+        H5Fclose(fid);
+    } H5E_END_TRY
+    return -1;
+} /* end path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    corder_create_empty
@@ -14572,6 +14924,7 @@ main(void)
         nerrors += test_move(my_fapl, new_format);
         nerrors += test_copy(my_fapl, new_format);
         nerrors += test_move_preserves(my_fapl, new_format);
+        nerrors += test_create_many(my_fapl, new_format);
 #ifndef H5_NO_DEPRECATED_SYMBOLS
         nerrors += test_deprec(my_fapl, new_format);
 #endif /* H5_NO_DEPRECATED_SYMBOLS */
@@ -14680,6 +15033,7 @@ main(void)
 #ifndef H5_CANNOT_OPEN_TWICE
         nerrors += obj_exists(my_fapl, new_format) < 0 ? 1 : 0;
 #endif /* H5_CANNOT_OPEN_TWICE */
+        nerrors += path_cache(my_fapl, new_format) < 0 ? 1 : 0;
 
         /* Keep this test last, it's testing files that are used above */
         /* do not do this for files used by external link tests */
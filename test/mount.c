@@ -4317,6 +4317,65 @@ error:
     return 1;
 } /* end test_multisharedclose() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_path_cache
+ *
+ * Purpose:	Check that paths resolved again across a mount point follow
+ *		the mount and unmount of a file.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_cache(hid_t fapl)
+{
+    hid_t	file1 = -1, file2 = -1;
+    char	filename1[1024], filename2[1024];
+    unsigned	u;
+
+    TESTING("path resolution across mount points");
+    h5_fixname(FILENAME[0], fapl, filename1, sizeof filename1);
+    h5_fixname(FILENAME[1], fapl, filename2, sizeof filename2);
+
+    /* Create file1 with /mnt/x and file2 with /y */
+    if((file1 = H5Fcreate(filename1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(H5Gcreate2(file1, "/mnt", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(H5Gcreate2(file1, "/mnt/x", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((file2 = H5Fcreate(filename2, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Gclose(H5Gcreate2(file2, "/y", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+
+    /* Resolve the paths before, while and after file2 is mounted on /mnt */
+    for(u = 0; u < 2; u++)
+        if(TRUE != H5Lexists(file1, "/mnt/x", H5P_DEFAULT)) TEST_ERROR
+    if(H5Fmount(file1, "/mnt", file2, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++) {
+        if(FALSE != H5Lexists(file1, "/mnt/x", H5P_DEFAULT)) TEST_ERROR
+        if(TRUE != H5Lexists(file1, "/mnt/y", H5P_DEFAULT)) TEST_ERROR
+    } /* end for */
+    if(H5Funmount(file1, "/mnt") < 0) FAIL_STACK_ERROR
+    for(u = 0; u < 2; u++) {
+        if(TRUE != H5Lexists(file1, "/mnt/x", H5P_DEFAULT)) TEST_ERROR
+        if(FALSE != H5Lexists(file1, "/mnt/y", H5P_DEFAULT)) TEST_ERROR
+    } /* end for */
+
+    if(H5Fclose(file1) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(file2) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+ error:
+    H5E_BEGIN_TRY {
+	H5Fclose(file1);
+	H5Fclose(file2);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	main
@@ -4375,6 +4434,7 @@ main(void)
     nerrors += test_sharedacc(fapl);
     nerrors += test_sharedclose(fapl);
     nerrors += test_multisharedclose(fapl);
+    nerrors += test_path_cache(fapl);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl) < 0 ? 1 : 0);
@@ -7999,6 +7999,298 @@ test_attr_create_by_name(hbool_t new_format, hid_t fcpl, hid_t fapl)
     CHECK(ret, FAIL, "H5Sclose");
 }   /* test_attr_create_by_name() */
 
+/****************************************************************
+**
+**  test_attr_read_all(): Test basic H5A (attribute) code.
+**      Tests reading all attributes of an object in one call
+**
+****************************************************************/
+static void
+test_attr_read_all(hbool_t new_format, hid_t fcpl, hid_t fapl)
+{
+    hid_t	fid;		/* HDF5 File ID			*/
+    hid_t	dataset;	/* Dataset ID			*/
+    hid_t	sid, sid3, nsid;	/* Dataspace IDs		*/
+    hid_t	attr;	        /* Attribute ID			*/
+    hid_t	dcpl;	        /* Dataset creation property list ID */
+    hid_t	str_tid, vlstr_tid, cmpd_tid;  /* Datatype IDs		*/
+    hsize_t     dims[1] = {3};  /* Attribute dimensions */
+    int         int_data = -7;  /* Data for "int" attribute */
+    unsigned short ushort_data[3] = {1, 2, 3};  /* Data for "ushort" attribute */
+    double      double_data = 2.5;      /* Data for "double" attribute */
+    const char *vlstr_data[3] = {"first", NULL, "third"};  /* Data for "vlstr" attribute */
+    H5A_packed_t entries[8];    /* Attribute descriptions */
+    void        *buf;           /* Buffer for names and values */
+    size_t      buf_size;       /* Size of buffer */
+    size_t      full_size;      /* Size needed for all attributes */
+    ssize_t     nattrs;         /* Number of attributes read */
+    unsigned    use_dense;      /* Whether attributes are stored densely */
+    unsigned    u;              /* Local index variable */
+    herr_t	ret;		/* Generic return value		*/
+
+    /* Create dataspaces for dataset & attributes */
+    sid = H5Screate(H5S_SCALAR);
+    CHECK(sid, FAIL, "H5Screate");
+    sid3 = H5Screate_simple(1, dims, NULL);
+    CHECK(sid3, FAIL, "H5Screate_simple");
+    nsid = H5Screate(H5S_NULL);
+    CHECK(nsid, FAIL, "H5Screate");
+
+    /* Create datatypes for attributes */
+    str_tid = H5Tcopy(H5T_C_S1);
+    CHECK(str_tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(str_tid, (size_t)6);
+    CHECK(ret, FAIL, "H5Tset_size");
+    vlstr_tid = H5Tcopy(H5T_C_S1);
+    CHECK(vlstr_tid, FAIL, "H5Tcopy");
+    ret = H5Tset_size(vlstr_tid, H5T_VARIABLE);
+    CHECK(ret, FAIL, "H5Tset_size");
+    cmpd_tid = H5Tcreate(H5T_COMPOUND, sizeof(int));
+    CHECK(cmpd_tid, FAIL, "H5Tcreate");
+    ret = H5Tinsert(cmpd_tid, "i", (size_t)0, H5T_NATIVE_INT);
+    CHECK(ret, FAIL, "H5Tinsert");
+
+    /* Create dataset creation property list */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+
+    /* Loop over compact and dense attribute storage */
+    for(use_dense = FALSE; use_dense <= (unsigned)new_format; use_dense++) {
+        /* Output message about test being performed */
+        if(use_dense)
+            MESSAGE(5, ("Testing Reading All Attributes in Dense Storage\n"))
+        else
+            MESSAGE(5, ("Testing Reading All Attributes in Compact Storage\n"))
+
+        /* Set attribute creation order tracking & storage for object */
+        if(new_format == TRUE) {
+            ret = H5Pset_attr_creation_order(dcpl, (H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED));
+            CHECK(ret, FAIL, "H5Pset_attr_creation_order");
+            ret = H5Pset_attr_phase_change(dcpl, (unsigned)(use_dense ? 0 : 8), (unsigned)(use_dense ? 0 : 6));
+            CHECK(ret, FAIL, "H5Pset_attr_phase_change");
+        } /* end if */
+
+        /* Create file and dataset */
+        fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl, fapl);
+        CHECK(fid, FAIL, "H5Fcreate");
+        dataset = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_UCHAR, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+        CHECK(dataset, FAIL, "H5Dcreate2");
+
+        /* Create attributes, in an order different from their names */
+        attr = H5Acreate2(dataset, "int", H5T_STD_I32BE, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, H5T_NATIVE_INT, &int_data);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        attr = H5Acreate2(dataset, "ushort", H5T_NATIVE_USHORT, sid3, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, H5T_NATIVE_USHORT, ushort_data);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        attr = H5Acreate2(dataset, "double", H5T_IEEE_F64BE, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, H5T_NATIVE_DOUBLE, &double_data);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        attr = H5Acreate2(dataset, "fixed", str_tid, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, str_tid, "hello");
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        attr = H5Acreate2(dataset, "vlstr", vlstr_tid, sid3, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, vlstr_tid, vlstr_data);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        attr = H5Acreate2(dataset, "compound", cmpd_tid, sid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Awrite(attr, cmpd_tid, &int_data);
+        CHECK(ret, FAIL, "H5Awrite");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        attr = H5Acreate2(dataset, "null", H5T_NATIVE_INT, nsid, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(attr, FAIL, "H5Acreate2");
+        ret = H5Aclose(attr);
+        CHECK(ret, FAIL, "H5Aclose");
+
+        /* Check on dataset's attribute storage status */
+        if(new_format == TRUE) {
+            ret = H5O_is_attr_dense_test(dataset);
+            VERIFY(ret, (htri_t)use_dense, "H5O_is_attr_dense_test");
+        } /* end if */
+
+        ret = H5Dclose(dataset);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Fclose(fid);
+        CHECK(ret, FAIL, "H5Fclose");
+
+        /* Re-open file, so the attributes are decoded from the file */
+        fid = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+        CHECK(fid, FAIL, "H5Fopen");
+
+        /* Query the number of attributes and the buffer size needed */
+        full_size = 0;
+        nattrs = H5Aread_all(fid, DSET1_NAME, H5_INDEX_CRT_ORDER, H5_ITER_INC, (size_t)0, NULL, &full_size, NULL, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        CHECK(full_size, 0, "H5Aread_all");
+        buf = HDmalloc(full_size);
+        CHECK(buf, NULL, "HDmalloc");
+
+        /* Read into a buffer that is too small */
+        HDmemset(entries, 0, sizeof(entries));
+        buf_size = full_size - 1;
+        nattrs = H5Aread_all(fid, DSET1_NAME, H5_INDEX_CRT_ORDER, H5_ITER_INC, (size_t)3, entries, &buf_size, buf, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        VERIFY(buf_size, full_size, "H5Aread_all");
+        VERIFY(HDstrcmp(entries[0].name, "int"), 0, "H5Aread_all");
+        VERIFY(*(const int *)entries[0].data, int_data, "H5Aread_all");
+        VERIFY(entries[3].name, NULL, "H5Aread_all");
+
+        /* Read into half the buffer, so the later attributes don't fit */
+        HDmemset(entries, 0, sizeof(entries));
+        buf_size = full_size / 2;
+        nattrs = H5Aread_all(fid, DSET1_NAME, H5_INDEX_CRT_ORDER, H5_ITER_INC, (size_t)8, entries, &buf_size, buf, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        VERIFY(buf_size, full_size, "H5Aread_all");
+        VERIFY(HDstrcmp(entries[0].name, "int"), 0, "H5Aread_all");
+        VERIFY(entries[4].name, NULL, "H5Aread_all");
+        VERIFY(entries[4].data, NULL, "H5Aread_all");
+        VERIFY(entries[4].nelmts, 3, "H5Aread_all");
+        VERIFY(entries[6].name, NULL, "H5Aread_all");
+
+        /* Read all the attributes, in creation order */
+        HDmemset(entries, 0, sizeof(entries));
+        buf_size = full_size;
+        dataset = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT);
+        CHECK(dataset, FAIL, "H5Dopen2");
+        nattrs = H5Aread_all(dataset, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (size_t)8, entries, &buf_size, buf, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        VERIFY(buf_size, full_size, "H5Aread_all");
+
+        /* Big-endian integer, converted to native */
+        VERIFY(HDstrcmp(entries[0].name, "int"), 0, "H5Aread_all");
+        VERIFY(entries[0].type_class, H5T_INTEGER, "H5Aread_all");
+        VERIFY(entries[0].sign, H5T_SGN_2, "H5Aread_all");
+        VERIFY(entries[0].type_size, sizeof(int), "H5Aread_all");
+        VERIFY(entries[0].nelmts, 1, "H5Aread_all");
+        VERIFY(*(const int *)entries[0].data, int_data, "H5Aread_all");
+
+        /* Array of unsigned integers */
+        VERIFY(HDstrcmp(entries[1].name, "ushort"), 0, "H5Aread_all");
+        VERIFY(entries[1].sign, H5T_SGN_NONE, "H5Aread_all");
+        VERIFY(entries[1].type_size, sizeof(unsigned short), "H5Aread_all");
+        VERIFY(entries[1].nelmts, 3, "H5Aread_all");
+        VERIFY(HDmemcmp(entries[1].data, ushort_data, sizeof(ushort_data)), 0, "H5Aread_all");
+
+        /* Big-endian double, converted to native */
+        VERIFY(HDstrcmp(entries[2].name, "double"), 0, "H5Aread_all");
+        VERIFY(entries[2].type_class, H5T_FLOAT, "H5Aread_all");
+        VERIFY(entries[2].type_size, sizeof(double), "H5Aread_all");
+        VERIFY(((const char *)entries[2].data - (const char *)buf) % (ptrdiff_t)sizeof(double), 0, "H5Aread_all");
+        VERIFY(*(const double *)entries[2].data, double_data, "H5Aread_all");
+
+        /* Fixed-length string */
+        VERIFY(HDstrcmp(entries[3].name, "fixed"), 0, "H5Aread_all");
+        VERIFY(entries[3].type_class, H5T_STRING, "H5Aread_all");
+        VERIFY(entries[3].is_vl_str, FALSE, "H5Aread_all");
+        VERIFY(entries[3].type_size, 6, "H5Aread_all");
+        VERIFY(HDstrcmp((const char *)entries[3].data, "hello"), 0, "H5Aread_all");
+
+        /* Variable-length strings */
+        VERIFY(HDstrcmp(entries[4].name, "vlstr"), 0, "H5Aread_all");
+        VERIFY(entries[4].type_class, H5T_STRING, "H5Aread_all");
+        VERIFY(entries[4].is_vl_str, TRUE, "H5Aread_all");
+        VERIFY(entries[4].type_size, sizeof(char *), "H5Aread_all");
+        VERIFY(entries[4].nelmts, 3, "H5Aread_all");
+        VERIFY(HDstrcmp(((char * const *)entries[4].data)[0], "first"), 0, "H5Aread_all");
+        VERIFY(((char * const *)entries[4].data)[1], NULL, "H5Aread_all");
+        VERIFY(HDstrcmp(((char * const *)entries[4].data)[2], "third"), 0, "H5Aread_all");
+
+        /* Compound values are not read */
+        VERIFY(HDstrcmp(entries[5].name, "compound"), 0, "H5Aread_all");
+        VERIFY(entries[5].type_class, H5T_COMPOUND, "H5Aread_all");
+        VERIFY(entries[5].type_size, sizeof(int), "H5Aread_all");
+        VERIFY(entries[5].data, NULL, "H5Aread_all");
+
+        /* Null dataspace has no values */
+        VERIFY(HDstrcmp(entries[6].name, "null"), 0, "H5Aread_all");
+        VERIFY(entries[6].nelmts, 0, "H5Aread_all");
+        VERIFY(entries[6].data, NULL, "H5Aread_all");
+
+        /* Read by name, in decreasing order */
+        buf_size = full_size;
+        nattrs = H5Aread_all(dataset, ".", H5_INDEX_NAME, H5_ITER_DEC, (size_t)8, entries, &buf_size, buf, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        VERIFY(HDstrcmp(entries[0].name, "vlstr"), 0, "H5Aread_all");
+        VERIFY(HDstrcmp(entries[6].name, "compound"), 0, "H5Aread_all");
+
+        /* Read in native order, straight from the object header */
+        /* (the padding between values, and so the size, depends on the order) */
+        HDfree(buf);
+        full_size = 0;
+        nattrs = H5Aread_all(dataset, ".", H5_INDEX_NAME, H5_ITER_NATIVE, (size_t)0, NULL, &full_size, NULL, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        buf = HDmalloc(full_size);
+        CHECK(buf, NULL, "HDmalloc");
+        HDmemset(entries, 0, sizeof(entries));
+        buf_size = full_size;
+        nattrs = H5Aread_all(dataset, ".", H5_INDEX_NAME, H5_ITER_NATIVE, (size_t)8, entries, &buf_size, buf, H5P_DEFAULT);
+        VERIFY(nattrs, 7, "H5Aread_all");
+        VERIFY(buf_size, full_size, "H5Aread_all");
+        for(u = 0; u < 7; u++) {
+            CHECK(entries[u].name, NULL, "H5Aread_all");
+            if(!HDstrcmp(entries[u].name, "double"))
+                VERIFY(*(const double *)entries[u].data, double_data, "H5Aread_all");
+            else if(!HDstrcmp(entries[u].name, "vlstr"))
+                VERIFY(HDstrcmp(((char * const *)entries[u].data)[2], "third"), 0, "H5Aread_all");
+        } /* end for */
+
+        /* Check that reading no attributes and a missing object fail */
+        H5E_BEGIN_TRY {
+            nattrs = H5Aread_all(fid, "missing", H5_INDEX_NAME, H5_ITER_INC, (size_t)0, NULL, &buf_size, NULL, H5P_DEFAULT);
+        } H5E_END_TRY;
+        VERIFY(nattrs, FAIL, "H5Aread_all");
+        H5E_BEGIN_TRY {
+            nattrs = H5Aread_all(dataset, ".", H5_INDEX_NAME, H5_ITER_INC, (size_t)1, NULL, &buf_size, buf, H5P_DEFAULT);
+        } H5E_END_TRY;
+        VERIFY(nattrs, FAIL, "H5Aread_all");
+
+        HDfree(buf);
+
+        ret = H5Dclose(dataset);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Fclose(fid);
+        CHECK(ret, FAIL, "H5Fclose");
+    } /* end for */
+
+    /* Close property list, datatypes and dataspaces */
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Tclose(cmpd_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(vlstr_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(str_tid);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(nsid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid3);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+}   /* test_attr_read_all() */
+
 /****************************************************************
 **
 **  test_attr_shared_write(): Test basic H5A (attribute) code.
@@ -10682,6 +10974,7 @@ test_attr(void)
                 test_attr_open_by_idx(new_format, my_fcpl, my_fapl);    /* Test opening attributes by index */
                 test_attr_open_by_name(new_format, my_fcpl, my_fapl);   /* Test opening attributes by name */
                 test_attr_create_by_name(new_format, my_fcpl, my_fapl); /* Test creating attributes by name */
+                test_attr_read_all(new_format, my_fcpl, my_fapl);       /* Test reading all attributes at once */
 
                 /* More complex tests with both "new format" and "shared" attributes */
                 if(use_shared == TRUE) {
@@ -10716,6 +11009,7 @@ test_attr(void)
             test_attr_open_by_idx(new_format, fcpl, my_fapl);   /* Test opening attributes by index */
             test_attr_open_by_name(new_format, fcpl, my_fapl);  /* Test opening attributes by name */
             test_attr_create_by_name(new_format, fcpl, my_fapl); /* Test creating attributes by name */
+            test_attr_read_all(new_format, fcpl, my_fapl);      /* Test reading all attributes at once */
 
             /* Tests that address specific bugs */
             test_attr_bug1(fcpl, my_fapl);                      /* Test odd allocation operations */
@@ -102,6 +102,27 @@
 /* Declaration for test_libver_macros2() */
 #define FILE5		"tfile5.h5"	/* Test file */
 
+/* Declarations for test_meta_prefetch() */
+#define PREFETCH_SIZE       ((size_t)(64 * 1024))
+#define PREFETCH_NGROUPS    200
+#define PREFETCH_DIM        16
+#define PREFETCH_NROWS      8
+#define PREFETCH_NCOLS      32
+#define PREFETCH_GROUP2     "Group2"
+
+/* Declarations for test_mdc_image() */
+#define MDCI_NGROUPS        100
+#define MDCI_DIM            16
+#define MDCI_IMAGE1         FILE1 ".mdci"
+#define MDCI_DIR            "tfile_mdci"
+
+/* Declarations for test_page_buffer() */
+#define PB_PAGE_SIZE        ((size_t)4096)
+#define PB_NGROUPS          100
+#define PB_DIM              16
+#define PB_BIG_DIM          4096
+#define PB_BIG_DSET         "big"
+
 
 static void
 create_objects(hid_t, hid_t, hid_t *, hid_t *, hid_t *, hid_t *);
@@ -2153,6 +2174,866 @@ test_cached_stab_info(void)
     CHECK(ret, FAIL, "H5Fclose");
 } /* end test_cached_stab_info() */
 
+/****************************************************************
+**
+**  test_meta_prefetch(): low-level file test routine.
+**      This test checks that a file opened with metadata prefetching
+**      enabled reads and updates objects correctly, including raw
+**      data that lives in the same prefetch windows as the metadata.
+**
+*****************************************************************/
+static void
+test_meta_prefetch(void)
+{
+    hid_t file_id;
+    hid_t fapl_id, fapl2_id;
+    hid_t group_id, dset_id, space_id;
+    hsize_t dims[1] = {PREFETCH_DIM};
+    int wdata[PREFETCH_DIM], rdata[PREFETCH_DIM];
+    char name[32];
+    size_t prefetch_size;
+    H5G_info_t ginfo;
+    int i, j;
+    herr_t ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing metadata prefetch\n"));
+
+    /* Check the default and setting the property */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl_id, FAIL, "H5Pcreate");
+    ret = H5Pget_meta_prefetch_size(fapl_id, &prefetch_size);
+    CHECK(ret, FAIL, "H5Pget_meta_prefetch_size");
+    VERIFY(prefetch_size, 0, "H5Pget_meta_prefetch_size");
+    ret = H5Pset_meta_prefetch_size(fapl_id, PREFETCH_SIZE);
+    CHECK(ret, FAIL, "H5Pset_meta_prefetch_size");
+
+    /* Create file with groups holding small datasets, so that raw data
+     *  is interleaved with metadata */
+    file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file_id, FAIL, "H5Fcreate");
+    space_id = H5Screate_simple(1, dims, NULL);
+    CHECK(space_id, FAIL, "H5Screate_simple");
+    for(i = 0; i < PREFETCH_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d", i);
+        group_id = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(group_id, FAIL, "H5Gcreate2");
+        dset_id = H5Dcreate2(group_id, DSET1, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dcreate2");
+        for(j = 0; j < PREFETCH_DIM; j++)
+            wdata[j] = i * PREFETCH_DIM + j;
+        ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Gclose(group_id);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Reopen the file with prefetching, check the data and overwrite it */
+    file_id = H5Fopen(FILE1, H5F_ACC_RDWR, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    fapl2_id = H5Fget_access_plist(file_id);
+    CHECK(fapl2_id, FAIL, "H5Fget_access_plist");
+    ret = H5Pget_meta_prefetch_size(fapl2_id, &prefetch_size);
+    CHECK(ret, FAIL, "H5Pget_meta_prefetch_size");
+    VERIFY(prefetch_size, PREFETCH_SIZE, "H5Pget_meta_prefetch_size");
+    ret = H5Pclose(fapl2_id);
+    CHECK(ret, FAIL, "H5Pclose");
+    for(i = 0; i < PREFETCH_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        dset_id = H5Dopen2(file_id, name, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dopen2");
+        ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+        for(j = 0; j < PREFETCH_DIM; j++)
+            VERIFY(rdata[j], i * PREFETCH_DIM + j, "H5Dread");
+        for(j = 0; j < PREFETCH_DIM; j++)
+            wdata[j] = -(i * PREFETCH_DIM + j);
+        ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    group_id = H5Gcreate2(file_id, GROUP1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(group_id, FAIL, "H5Gcreate2");
+    ret = H5Gclose(group_id);
+    CHECK(ret, FAIL, "H5Gclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Reopen the file without prefetching and verify the updates */
+    file_id = H5Fopen(FILE1, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file_id, FAIL, "H5Fopen");
+    ret = H5Gget_info(file_id, &ginfo);
+    CHECK(ret, FAIL, "H5Gget_info");
+    VERIFY(ginfo.nlinks, PREFETCH_NGROUPS + 1, "H5Gget_info");
+    for(i = 0; i < PREFETCH_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        dset_id = H5Dopen2(file_id, name, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dopen2");
+        ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+        for(j = 0; j < PREFETCH_DIM; j++)
+            VERIFY(rdata[j], -(i * PREFETCH_DIM + j), "H5Dread");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Sclose(space_id);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(fapl_id);
+    CHECK(ret, FAIL, "H5Pclose");
+} /* end test_meta_prefetch() */
+
+/****************************************************************
+**
+**  test_meta_prefetch_raw(): low-level file test routine.
+**      This test checks that raw data written inside a prefetch
+**      window with vectored writes is not overwritten with stale bytes
+**      when metadata in the same window is flushed later.
+**
+*****************************************************************/
+static void
+test_meta_prefetch_raw(void)
+{
+    hid_t file_id;
+    hid_t fapl_id, dcpl_id;
+    hid_t group_id, dset_id, attr_id, obj_id;
+    hid_t space_id, sspace_id;
+    hsize_t dims[2] = {PREFETCH_NROWS, PREFETCH_NCOLS};
+    hsize_t start[2], stride[2], count[2], block[2];
+    int wdata[PREFETCH_NROWS][PREFETCH_NCOLS];
+    int rdata[PREFETCH_NROWS][PREFETCH_NCOLS];
+    int value;
+    int i, j;
+    herr_t ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing raw data writes within metadata prefetch windows\n"));
+
+    /* Create a file with a contiguous dataset between two groups, each
+     *  object with an attribute, so the raw data sits between metadata */
+    file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file_id, FAIL, "H5Fcreate");
+    sspace_id = H5Screate(H5S_SCALAR);
+    CHECK(sspace_id, FAIL, "H5Screate");
+    space_id = H5Screate_simple(2, dims, NULL);
+    CHECK(space_id, FAIL, "H5Screate_simple");
+    dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl_id, FAIL, "H5Pcreate");
+    ret = H5Pset_alloc_time(dcpl_id, H5D_ALLOC_TIME_EARLY);
+    CHECK(ret, FAIL, "H5Pset_alloc_time");
+
+    value = 0;
+    group_id = H5Gcreate2(file_id, GROUP1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(group_id, FAIL, "H5Gcreate2");
+    attr_id = H5Acreate2(group_id, ATTR_NAME, H5T_NATIVE_INT, sspace_id, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr_id, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr_id, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr_id);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Gclose(group_id);
+    CHECK(ret, FAIL, "H5Gclose");
+
+    dset_id = H5Dcreate2(file_id, DSET1, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    CHECK(dset_id, FAIL, "H5Dcreate2");
+    attr_id = H5Acreate2(dset_id, ATTR_NAME, H5T_NATIVE_INT, sspace_id, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr_id, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr_id, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr_id);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Dclose(dset_id);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    group_id = H5Gcreate2(file_id, PREFETCH_GROUP2, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(group_id, FAIL, "H5Gcreate2");
+    attr_id = H5Acreate2(group_id, ATTR_NAME, H5T_NATIVE_INT, sspace_id, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(attr_id, FAIL, "H5Acreate2");
+    ret = H5Awrite(attr_id, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr_id);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Gclose(group_id);
+    CHECK(ret, FAIL, "H5Gclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Reopen the file with prefetching and a sieve buffer smaller than
+     *  a row, so strided writes go to the file as vectored writes */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl_id, FAIL, "H5Pcreate");
+    ret = H5Pset_meta_prefetch_size(fapl_id, PREFETCH_SIZE);
+    CHECK(ret, FAIL, "H5Pset_meta_prefetch_size");
+    ret = H5Pset_sieve_buf_size(fapl_id, (size_t)16);
+    CHECK(ret, FAIL, "H5Pset_sieve_buf_size");
+    file_id = H5Fopen(FILE1, H5F_ACC_RDWR, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    dset_id = H5Dopen2(file_id, DSET1, H5P_DEFAULT);
+    CHECK(dset_id, FAIL, "H5Dopen2");
+
+    /* Write every other row */
+    for(i = 0; i < PREFETCH_NROWS; i++)
+        for(j = 0; j < PREFETCH_NCOLS; j++)
+            wdata[i][j] = 1000 + i;
+    start[0] = 0; start[1] = 0;
+    stride[0] = 2; stride[1] = 1;
+    count[0] = PREFETCH_NROWS / 2; count[1] = 1;
+    block[0] = 1; block[1] = PREFETCH_NCOLS;
+    ret = H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dwrite(dset_id, H5T_NATIVE_INT, space_id, space_id, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Write the other rows */
+    start[0] = 1;
+    ret = H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, stride, count, block);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dwrite(dset_id, H5T_NATIVE_INT, space_id, space_id, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    ret = H5Dclose(dset_id);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Update the attributes on both sides of the raw data */
+    value = 2;
+    obj_id = H5Oopen(file_id, GROUP1, H5P_DEFAULT);
+    CHECK(obj_id, FAIL, "H5Oopen");
+    attr_id = H5Aopen(obj_id, ATTR_NAME, H5P_DEFAULT);
+    CHECK(attr_id, FAIL, "H5Aopen");
+    ret = H5Awrite(attr_id, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr_id);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Oclose(obj_id);
+    CHECK(ret, FAIL, "H5Oclose");
+    obj_id = H5Oopen(file_id, PREFETCH_GROUP2, H5P_DEFAULT);
+    CHECK(obj_id, FAIL, "H5Oopen");
+    attr_id = H5Aopen(obj_id, ATTR_NAME, H5P_DEFAULT);
+    CHECK(attr_id, FAIL, "H5Aopen");
+    ret = H5Awrite(attr_id, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Awrite");
+    ret = H5Aclose(attr_id);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Oclose(obj_id);
+    CHECK(ret, FAIL, "H5Oclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Reopen the file without prefetching and verify the data */
+    file_id = H5Fopen(FILE1, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file_id, FAIL, "H5Fopen");
+    dset_id = H5Dopen2(file_id, DSET1, H5P_DEFAULT);
+    CHECK(dset_id, FAIL, "H5Dopen2");
+    ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+    for(i = 0; i < PREFETCH_NROWS; i++)
+        for(j = 0; j < PREFETCH_NCOLS; j++)
+            VERIFY(rdata[i][j], wdata[i][j], "H5Dread");
+    ret = H5Dclose(dset_id);
+    CHECK(ret, FAIL, "H5Dclose");
+    obj_id = H5Oopen(file_id, PREFETCH_GROUP2, H5P_DEFAULT);
+    CHECK(obj_id, FAIL, "H5Oopen");
+    attr_id = H5Aopen(obj_id, ATTR_NAME, H5P_DEFAULT);
+    CHECK(attr_id, FAIL, "H5Aopen");
+    ret = H5Aread(attr_id, H5T_NATIVE_INT, &value);
+    CHECK(ret, FAIL, "H5Aread");
+    VERIFY(value, 2, "H5Aread");
+    ret = H5Aclose(attr_id);
+    CHECK(ret, FAIL, "H5Aclose");
+    ret = H5Oclose(obj_id);
+    CHECK(ret, FAIL, "H5Oclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    ret = H5Sclose(space_id);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(sspace_id);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(dcpl_id);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5Pclose(fapl_id);
+    CHECK(ret, FAIL, "H5Pclose");
+} /* end test_meta_prefetch_raw() */
+
+/****************************************************************
+**
+**  test_mdc_image_check(): Helper routine for test_mdc_image().
+**      Opens the file, checks whether it was opened with a metadata
+**      cache image and that the datasets hold the expected values
+**      (negated, if NEG is set), then closes it.
+**
+*****************************************************************/
+static void
+test_mdc_image_check(hid_t fapl_id, unsigned flags, hbool_t has_image,
+    hbool_t neg)
+{
+    hid_t file_id;
+    hid_t dset_id;
+    int rdata[MDCI_DIM];
+    char name[32];
+    size_t nruns;
+    int i, j;
+    herr_t ret;         /* Generic return value */
+
+    file_id = H5Fopen(FILE1, flags, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    ret = H5F_get_mdci_nruns_test(file_id, &nruns);
+    CHECK(ret, FAIL, "H5F_get_mdci_nruns_test");
+    VERIFY(nruns > 0, has_image, "H5F_get_mdci_nruns_test");
+    for(i = 0; i < MDCI_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        dset_id = H5Dopen2(file_id, name, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dopen2");
+        ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+        for(j = 0; j < MDCI_DIM; j++)
+            VERIFY(rdata[j], (neg ? -1 : 1) * (i * MDCI_DIM + j), "H5Dread");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+} /* end test_mdc_image_check() */
+
+/****************************************************************
+**
+**  test_mdc_image(): low-level file test routine.
+**      This test checks that a metadata cache image is recorded when
+**      requested, is used when the file is opened again with the
+**      property set, and is dropped once the file is opened for writing
+**      or a new file of the same name is created with it.  Opens
+**      without the property, and drivers which don't store the file
+**      as one file under its name, must ignore images.  A damaged image
+**      must be ignored too.
+**
+*****************************************************************/
+static void
+test_mdc_image(void)
+{
+    hid_t file_id;
+    hid_t fapl_id, fapl2_id, core_fapl_id;
+    hid_t group_id, dset_id, space_id;
+    hsize_t dims[1] = {MDCI_DIM};
+    int wdata[MDCI_DIM];
+    char name[32];
+    H5AC_cache_image_config_t config;
+    H5AC_cache_config_t mdc_config;
+    H5G_info_t ginfo;
+    htri_t exists;
+    FILE *fp;
+    size_t nruns;
+    int c;
+    unsigned u;
+    int i, j;
+    herr_t ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing metadata cache image\n"));
+
+    /* Check the default and setting the property */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl_id, FAIL, "H5Pcreate");
+    config.version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+    ret = H5Pget_mdc_image_config(fapl_id, &config);
+    CHECK(ret, FAIL, "H5Pget_mdc_image_config");
+    VERIFY(config.generate_image, FALSE, "H5Pget_mdc_image_config");
+    config.version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION + 1;
+    config.generate_image = TRUE;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_mdc_image_config(fapl_id, &config);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_mdc_image_config");
+    config.version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+    ret = H5Pset_mdc_image_config(fapl_id, &config);
+    CHECK(ret, FAIL, "H5Pset_mdc_image_config");
+
+    space_id = H5Screate_simple(1, dims, NULL);
+    CHECK(space_id, FAIL, "H5Screate_simple");
+
+    /* Images are kept out of the file, so files of any format get them */
+    for(u = 0; u < 2; u++) {
+        hbool_t latest = (hbool_t)(u > 0);
+
+        ret = H5Pset_libver_bounds(fapl_id, (latest ? H5F_LIBVER_LATEST : H5F_LIBVER_EARLIEST), H5F_LIBVER_LATEST);
+        CHECK(ret, FAIL, "H5Pset_libver_bounds");
+
+        /* Create file with groups holding small datasets */
+        file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+        CHECK(file_id, FAIL, "H5Fcreate");
+        for(i = 0; i < MDCI_NGROUPS; i++) {
+            HDsnprintf(name, sizeof(name), "group%03d", i);
+            group_id = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(group_id, FAIL, "H5Gcreate2");
+            dset_id = H5Dcreate2(group_id, DSET1, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            CHECK(dset_id, FAIL, "H5Dcreate2");
+            for(j = 0; j < MDCI_DIM; j++)
+                wdata[j] = i * MDCI_DIM + j;
+            ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+            CHECK(ret, FAIL, "H5Dwrite");
+            ret = H5Dclose(dset_id);
+            CHECK(ret, FAIL, "H5Dclose");
+            ret = H5Gclose(group_id);
+            CHECK(ret, FAIL, "H5Gclose");
+        } /* end for */
+        ret = H5Fclose(file_id);
+        CHECK(ret, FAIL, "H5Fclose");
+
+        /* The image is used, and kept, when the file is opened read-only */
+        test_mdc_image_check(fapl_id, H5F_ACC_RDONLY, TRUE, FALSE);
+        test_mdc_image_check(fapl_id, H5F_ACC_RDONLY, TRUE, FALSE);
+
+        /* The image isn't looked for without the property */
+        test_mdc_image_check(H5P_DEFAULT, H5F_ACC_RDONLY, FALSE, FALSE);
+    } /* end for */
+
+    /* A damaged image is ignored */
+    fp = HDfopen(MDCI_IMAGE1, "r+b");
+    CHECK(fp, NULL, "HDfopen");
+    ret = HDfseek(fp, -1, SEEK_END);
+    CHECK(ret, FAIL, "HDfseek");
+    c = HDfgetc(fp);
+    CHECK(c, EOF, "HDfgetc");
+    ret = HDfseek(fp, -1, SEEK_END);
+    CHECK(ret, FAIL, "HDfseek");
+    c = HDfputc(c ^ 0xff, fp);
+    CHECK(c, EOF, "HDfputc");
+    ret = HDfclose(fp);
+    CHECK(ret, FAIL, "HDfclose");
+    test_mdc_image_check(fapl_id, H5F_ACC_RDONLY, FALSE, FALSE);
+
+    /* Check that the image's property is kept with the file.  (A tiny
+     *  metadata cache is used, so metadata is evicted & read again after
+     *  it has been modified) */
+    mdc_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    ret = H5Pget_mdc_config(fapl_id, &mdc_config);
+    CHECK(ret, FAIL, "H5Pget_mdc_config");
+    mdc_config.set_initial_size = TRUE;
+    mdc_config.initial_size = H5C__MIN_MAX_CACHE_SIZE;
+    mdc_config.min_size = H5C__MIN_MAX_CACHE_SIZE;
+    mdc_config.max_size = H5C__MIN_MAX_CACHE_SIZE;
+    mdc_config.incr_mode = H5C_incr__off;
+    mdc_config.flash_incr_mode = H5C_flash_incr__off;
+    mdc_config.decr_mode = H5C_decr__off;
+    ret = H5Pset_mdc_config(fapl_id, &mdc_config);
+    CHECK(ret, FAIL, "H5Pset_mdc_config");
+    file_id = H5Fopen(FILE1, H5F_ACC_RDWR, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    fapl2_id = H5Fget_access_plist(file_id);
+    CHECK(fapl2_id, FAIL, "H5Fget_access_plist");
+    config.generate_image = FALSE;
+    ret = H5Pget_mdc_image_config(fapl2_id, &config);
+    CHECK(ret, FAIL, "H5Pget_mdc_image_config");
+    VERIFY(config.generate_image, TRUE, "H5Pget_mdc_image_config");
+    ret = H5Pclose(fapl2_id);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Overwrite the data & add a group, with the image in use */
+    for(i = 0; i < MDCI_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        dset_id = H5Dopen2(file_id, name, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dopen2");
+        for(j = 0; j < MDCI_DIM; j++)
+            wdata[j] = -(i * MDCI_DIM + j);
+        ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    group_id = H5Gcreate2(file_id, GROUP1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(group_id, FAIL, "H5Gcreate2");
+    ret = H5Gclose(group_id);
+    CHECK(ret, FAIL, "H5Gclose");
+    for(i = 0; i < MDCI_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        exists = H5Lexists(file_id, name, H5P_DEFAULT);
+        VERIFY(exists, TRUE, "H5Lexists");
+    } /* end for */
+    exists = H5Lexists(file_id, GROUP1, H5P_DEFAULT);
+    VERIFY(exists, TRUE, "H5Lexists");
+    ret = H5Gget_info(file_id, &ginfo);
+    CHECK(ret, FAIL, "H5Gget_info");
+    VERIFY(ginfo.nlinks, MDCI_NGROUPS + 1, "H5Gget_info");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* The image was recorded again at close */
+    test_mdc_image_check(fapl_id, H5F_ACC_RDONLY, TRUE, TRUE);
+
+    /* Opening the file for writing without the property ignores the image */
+    test_mdc_image_check(H5P_DEFAULT, H5F_ACC_RDWR, FALSE, TRUE);
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, 0, "HDaccess");
+
+    /* Opening the file for writing with the property drops the image until
+     *  it's recorded again at close */
+    file_id = H5Fopen(FILE1, H5F_ACC_RDWR, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    ret = H5F_get_mdci_nruns_test(file_id, &nruns);
+    CHECK(ret, FAIL, "H5F_get_mdci_nruns_test");
+    VERIFY(nruns > 0, TRUE, "H5F_get_mdci_nruns_test");
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, FAIL, "HDaccess");
+    exists = H5Lexists(file_id, GROUP1, H5P_DEFAULT);
+    VERIFY(exists, TRUE, "H5Lexists");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, 0, "HDaccess");
+
+    /* Creating a new file of the same name with the property drops the old
+     *  file's image */
+    file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file_id, FAIL, "H5Fcreate");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, 0, "HDaccess");
+    file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    CHECK(file_id, FAIL, "H5Fcreate");
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, FAIL, "HDaccess");
+
+    /* The image is recorded next to the file, even after changing the
+     *  working directory */
+    ret = HDmkdir(MDCI_DIR, (mode_t)0755);
+    CHECK(ret, FAIL, "HDmkdir");
+    ret = HDchdir(MDCI_DIR);
+    CHECK(ret, FAIL, "HDchdir");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = HDchdir("..");
+    CHECK(ret, FAIL, "HDchdir");
+    ret = HDaccess(MDCI_DIR "/" MDCI_IMAGE1, F_OK);
+    VERIFY(ret, FAIL, "HDaccess");
+    ret = HDrmdir(MDCI_DIR);
+    CHECK(ret, FAIL, "HDrmdir");
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, 0, "HDaccess");
+
+    /* Drivers which don't store the file as one file under its name don't
+     *  keep images */
+    ret = HDremove(MDCI_IMAGE1);
+    CHECK(ret, FAIL, "HDremove");
+    core_fapl_id = H5Pcopy(fapl_id);
+    CHECK(core_fapl_id, FAIL, "H5Pcopy");
+    ret = H5Pset_fapl_core(core_fapl_id, (size_t)1024, TRUE);
+    CHECK(ret, FAIL, "H5Pset_fapl_core");
+    file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, core_fapl_id);
+    CHECK(file_id, FAIL, "H5Fcreate");
+    group_id = H5Gcreate2(file_id, GROUP1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(group_id, FAIL, "H5Gcreate2");
+    ret = H5Gclose(group_id);
+    CHECK(ret, FAIL, "H5Gclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+    ret = HDaccess(MDCI_IMAGE1, F_OK);
+    VERIFY(ret, FAIL, "HDaccess");
+    ret = H5Pclose(core_fapl_id);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    ret = H5Sclose(space_id);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(fapl_id);
+    CHECK(ret, FAIL, "H5Pclose");
+} /* end test_mdc_image() */
+
+/****************************************************************
+**
+**  test_page_buffer_check(): Helper routine for test_page_buffer().
+**      Opens the file, checks that the datasets hold the expected
+**      values (negated, and with the group added, if NEG is set),
+**      then closes it.
+**
+*****************************************************************/
+static void
+test_page_buffer_check(hid_t fapl_id, hbool_t neg)
+{
+    hid_t file_id;
+    hid_t group_id, dset_id;
+    int rdata[PB_DIM];
+    int *big;
+    char name[32];
+    H5G_info_t ginfo;
+    int i, j;
+    herr_t ret;         /* Generic return value */
+
+    big = (int *)HDmalloc(PB_BIG_DIM * sizeof(int));
+    CHECK(big, NULL, "HDmalloc");
+
+    file_id = H5Fopen(FILE1, H5F_ACC_RDONLY, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    ret = H5Gget_info(file_id, &ginfo);
+    CHECK(ret, FAIL, "H5Gget_info");
+    VERIFY(ginfo.nlinks, PB_NGROUPS + (neg ? 2 : 1), "H5Gget_info");
+    if(neg) {
+        group_id = H5Gopen2(file_id, GROUP1, H5P_DEFAULT);
+        CHECK(group_id, FAIL, "H5Gopen2");
+        ret = H5Gclose(group_id);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end if */
+    for(i = 0; i < PB_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        dset_id = H5Dopen2(file_id, name, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dopen2");
+        ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+        CHECK(ret, FAIL, "H5Dread");
+        for(j = 0; j < PB_DIM; j++)
+            VERIFY(rdata[j], (neg ? -1 : 1) * (i * PB_DIM + j), "H5Dread");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    dset_id = H5Dopen2(file_id, PB_BIG_DSET, H5P_DEFAULT);
+    CHECK(dset_id, FAIL, "H5Dopen2");
+    ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big);
+    CHECK(ret, FAIL, "H5Dread");
+    for(j = 0; j < PB_BIG_DIM; j++)
+        VERIFY(big[j], neg ? -j : j, "H5Dread");
+    ret = H5Dclose(dset_id);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    HDfree(big);
+} /* end test_page_buffer_check() */
+
+/****************************************************************
+**
+**  test_page_buffer(): low-level file test routine.
+**      This test checks that a file can be created, read and
+**      modified through a page buffer small enough that pages are
+**      evicted, and that the file reads back correctly without it.
+**
+*****************************************************************/
+static void
+test_page_buffer(void)
+{
+    hid_t file_id;
+    hid_t fapl_id, fapl2_id;
+    hid_t group_id, dset_id, space_id, big_space_id;
+    hsize_t dims[1] = {PB_DIM};
+    hsize_t big_dims[1] = {PB_BIG_DIM};
+    hsize_t start[1] = {0};
+    hsize_t count[1] = {PB_DIM};
+    int wdata[PB_DIM];
+    int *big;
+    char name[32];
+    size_t buf_size, page_size;
+    unsigned min_meta_perc, min_raw_perc;
+    unsigned accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    int i, j;
+    herr_t ret;         /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing page buffer\n"));
+
+    big = (int *)HDmalloc(PB_BIG_DIM * sizeof(int));
+    CHECK(big, NULL, "HDmalloc");
+
+    /* Check the defaults and setting the properties */
+    fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl_id, FAIL, "H5Pcreate");
+    ret = H5Pget_page_buffer_size(fapl_id, &buf_size, &min_meta_perc, &min_raw_perc);
+    CHECK(ret, FAIL, "H5Pget_page_buffer_size");
+    VERIFY(buf_size, 0, "H5Pget_page_buffer_size");
+    VERIFY(min_meta_perc, 0, "H5Pget_page_buffer_size");
+    VERIFY(min_raw_perc, 0, "H5Pget_page_buffer_size");
+    ret = H5Pget_page_buffer_page_size(fapl_id, &page_size);
+    CHECK(ret, FAIL, "H5Pget_page_buffer_page_size");
+    VERIFY(page_size, 64 * 1024, "H5Pget_page_buffer_page_size");
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(fapl_id, 4 * PB_PAGE_SIZE, 101, 0);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_page_buffer_size");
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(fapl_id, 4 * PB_PAGE_SIZE, 60, 50);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_page_buffer_size");
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_page_size(fapl_id, 0);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Pset_page_buffer_page_size");
+
+    /* A page buffer smaller than a page can't be used */
+    ret = H5Pset_page_buffer_size(fapl_id, PB_PAGE_SIZE / 2, 0, 0);
+    CHECK(ret, FAIL, "H5Pset_page_buffer_size");
+    H5E_BEGIN_TRY {
+        file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    } H5E_END_TRY;
+    VERIFY(file_id, FAIL, "H5Fcreate");
+
+    /* Use a page buffer of only 4 small pages, with 2 kept for metadata
+     *  and 1 for raw data */
+    ret = H5Pset_page_buffer_page_size(fapl_id, PB_PAGE_SIZE);
+    CHECK(ret, FAIL, "H5Pset_page_buffer_page_size");
+    ret = H5Pset_page_buffer_size(fapl_id, 4 * PB_PAGE_SIZE, 50, 25);
+    CHECK(ret, FAIL, "H5Pset_page_buffer_size");
+
+    /* Create file with groups holding small datasets, and a dataset
+     *  larger than a page */
+    file_id = H5Fcreate(FILE1, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    CHECK(file_id, FAIL, "H5Fcreate");
+    fapl2_id = H5Fget_access_plist(file_id);
+    CHECK(fapl2_id, FAIL, "H5Fget_access_plist");
+    ret = H5Pget_page_buffer_size(fapl2_id, &buf_size, &min_meta_perc, &min_raw_perc);
+    CHECK(ret, FAIL, "H5Pget_page_buffer_size");
+    VERIFY(buf_size, 4 * PB_PAGE_SIZE, "H5Pget_page_buffer_size");
+    VERIFY(min_meta_perc, 50, "H5Pget_page_buffer_size");
+    VERIFY(min_raw_perc, 25, "H5Pget_page_buffer_size");
+    ret = H5Pget_page_buffer_page_size(fapl2_id, &page_size);
+    CHECK(ret, FAIL, "H5Pget_page_buffer_page_size");
+    VERIFY(page_size, PB_PAGE_SIZE, "H5Pget_page_buffer_page_size");
+    ret = H5Pclose(fapl2_id);
+    CHECK(ret, FAIL, "H5Pclose");
+    space_id = H5Screate_simple(1, dims, NULL);
+    CHECK(space_id, FAIL, "H5Screate_simple");
+    for(i = 0; i < PB_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d", i);
+        group_id = H5Gcreate2(file_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(group_id, FAIL, "H5Gcreate2");
+        dset_id = H5Dcreate2(group_id, DSET1, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dcreate2");
+        for(j = 0; j < PB_DIM; j++)
+            wdata[j] = i * PB_DIM + j;
+        ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+        ret = H5Gclose(group_id);
+        CHECK(ret, FAIL, "H5Gclose");
+    } /* end for */
+    big_space_id = H5Screate_simple(1, big_dims, NULL);
+    CHECK(big_space_id, FAIL, "H5Screate_simple");
+    dset_id = H5Dcreate2(file_id, PB_BIG_DSET, H5T_NATIVE_INT, big_space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dset_id, FAIL, "H5Dcreate2");
+    for(j = 0; j < PB_BIG_DIM; j++)
+        big[j] = j;
+    ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dclose(dset_id);
+    CHECK(ret, FAIL, "H5Dclose");
+
+    /* Check the statistics, once the metadata has been flushed: the small
+     *  I/Os went through the pages, which were evicted, and the large
+     *  dataset's I/O bypassed them */
+    ret = H5Fflush(file_id, H5F_SCOPE_LOCAL);
+    CHECK(ret, FAIL, "H5Fflush");
+    ret = H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses);
+    CHECK(ret, FAIL, "H5Fget_page_buffering_stats");
+    for(i = 0; i < 2; i++) {
+        VERIFY(accesses[i] > 0, TRUE, "H5Fget_page_buffering_stats");
+        VERIFY(hits[i] + misses[i], accesses[i], "H5Fget_page_buffering_stats");
+        VERIFY(evictions[i] > 0, TRUE, "H5Fget_page_buffering_stats");
+    } /* end for */
+    VERIFY(bypasses[1] > 0, TRUE, "H5Fget_page_buffering_stats");
+    ret = H5Freset_page_buffering_stats(file_id);
+    CHECK(ret, FAIL, "H5Freset_page_buffering_stats");
+    ret = H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses);
+    CHECK(ret, FAIL, "H5Fget_page_buffering_stats");
+    for(i = 0; i < 2; i++) {
+        VERIFY(accesses[i], 0, "H5Fget_page_buffering_stats");
+        VERIFY(hits[i], 0, "H5Fget_page_buffering_stats");
+        VERIFY(misses[i], 0, "H5Fget_page_buffering_stats");
+        VERIFY(evictions[i], 0, "H5Fget_page_buffering_stats");
+        VERIFY(bypasses[i], 0, "H5Fget_page_buffering_stats");
+    } /* end for */
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Check the file, without and with the page buffer */
+    test_page_buffer_check(H5P_DEFAULT, FALSE);
+    test_page_buffer_check(fapl_id, FALSE);
+
+    /* There are no statistics without a page buffer */
+    file_id = H5Fopen(FILE1, H5F_ACC_RDONLY, H5P_DEFAULT);
+    CHECK(file_id, FAIL, "H5Fopen");
+    H5E_BEGIN_TRY {
+        ret = H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses);
+    } H5E_END_TRY;
+    VERIFY(ret, FAIL, "H5Fget_page_buffering_stats");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Overwrite the data & add a group through a page buffer large enough
+     *  to keep the superblock's page, which is written back after the
+     *  superblock.  (Without a data sieve buffer, so that small raw data
+     *  I/Os on the large dataset go through the pages and large ones must
+     *  be kept consistent with them) */
+    ret = H5Pset_page_buffer_size(fapl_id, 64 * PB_PAGE_SIZE, 0, 0);
+    CHECK(ret, FAIL, "H5Pset_page_buffer_size");
+    ret = H5Pset_sieve_buf_size(fapl_id, (size_t)0);
+    CHECK(ret, FAIL, "H5Pset_sieve_buf_size");
+    file_id = H5Fopen(FILE1, H5F_ACC_RDWR, fapl_id);
+    CHECK(file_id, FAIL, "H5Fopen");
+    for(i = 0; i < PB_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group%03d/%s", i, DSET1);
+        dset_id = H5Dopen2(file_id, name, H5P_DEFAULT);
+        CHECK(dset_id, FAIL, "H5Dopen2");
+        for(j = 0; j < PB_DIM; j++)
+            wdata[j] = -(i * PB_DIM + j);
+        ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dset_id);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    group_id = H5Gcreate2(file_id, GROUP1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(group_id, FAIL, "H5Gcreate2");
+    ret = H5Gclose(group_id);
+    CHECK(ret, FAIL, "H5Gclose");
+    dset_id = H5Dopen2(file_id, PB_BIG_DSET, H5P_DEFAULT);
+    CHECK(dset_id, FAIL, "H5Dopen2");
+
+    /* A small write to the start of the dataset dirties its first page, so
+     *  a read of the whole dataset must pick up the new values */
+    ret = H5Sselect_hyperslab(big_space_id, H5S_SELECT_SET, start, NULL, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    for(j = 0; j < PB_DIM; j++)
+        wdata[j] = -j;
+    ret = H5Dwrite(dset_id, H5T_NATIVE_INT, space_id, big_space_id, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big);
+    CHECK(ret, FAIL, "H5Dread");
+    for(j = 0; j < PB_BIG_DIM; j++)
+        VERIFY(big[j], j < PB_DIM ? -j : j, "H5Dread");
+
+    /* A write of the whole dataset must update that page, so neither a
+     *  small read nor writing the page back gets the old values */
+    for(j = 0; j < PB_BIG_DIM; j++)
+        big[j] = -j;
+    ret = H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, big);
+    CHECK(ret, FAIL, "H5Dwrite");
+    start[0] = PB_DIM;
+    ret = H5Sselect_hyperslab(big_space_id, H5S_SELECT_SET, start, NULL, count, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dread(dset_id, H5T_NATIVE_INT, space_id, big_space_id, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dread");
+    for(j = 0; j < PB_DIM; j++)
+        VERIFY(wdata[j], -(PB_DIM + j), "H5Dread");
+    ret = H5Dclose(dset_id);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(file_id);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    /* Check the updates, without and with the page buffer */
+    test_page_buffer_check(H5P_DEFAULT, TRUE);
+    test_page_buffer_check(fapl_id, TRUE);
+
+    ret = H5Sclose(space_id);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(big_space_id);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Pclose(fapl_id);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    HDfree(big);
+} /* end test_page_buffer() */
+
 /****************************************************************
 **
 **  test_rw_noupdate(): low-level file test routine.
@@ -2850,6 +3731,10 @@ test_file(void)
     test_userblock_file_size(); /* Tests that files created with a userblock have the correct size */
     test_cached_stab_info();    /* Tests that files are created with cached stab info in the superblock */
     test_rw_noupdate();         /* Test to ensure that RW permissions don't write the file unless dirtied */
+    test_meta_prefetch();       /* Test reading & writing a file with metadata prefetching */
+    test_meta_prefetch_raw();   /* Test raw data writes within metadata prefetch windows */
+    test_mdc_image();           /* Test recording & using a metadata cache image */
+    test_page_buffer();         /* Test reading & writing a file through a page buffer */
     test_userblock_alignment(); /* Tests that files created with a userblock and alignment interact properly */
     test_libver_bounds();       /* Test compatibility for file space management */
     test_libver_macros();       /* Test the macros for library version comparison */
@@ -2876,6 +3761,9 @@ cleanup_file(void)
 {
     HDremove(SFILE1);
     HDremove(FILE1);
+    HDremove(MDCI_IMAGE1);
+    HDremove(MDCI_DIR "/" MDCI_IMAGE1);
+    HDrmdir(MDCI_DIR);
     HDremove(FILE2);
     HDremove(FILE3);
     HDremove(FILE4);
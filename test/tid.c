@@ -449,6 +449,122 @@ out:
     return -1;
 }
 
+	/* Test a type holding many IDs at once */
+#define MANY_IDS	3000
+
+static int many_ids_freed;
+
+static herr_t many_ids_free(void UNUSED *obj)
+{
+	many_ids_freed++;
+	return 0;
+}
+
+static int many_ids_count(void UNUSED *obj, hid_t UNUSED id, void *udata)
+{
+	(*(int *)udata)++;
+	return 0;
+}
+
+static int test_many_ids(void)
+{
+	H5I_type_t myType = H5I_BADID;
+	hid_t *ids = NULL;
+	int *objs = NULL;
+	void *testPtr;
+	hsize_t num_members;
+	int visited;
+	herr_t err;
+	int i;
+
+	ids = (hid_t *)HDmalloc(MANY_IDS * sizeof(hid_t));
+	objs = (int *)HDmalloc(MANY_IDS * sizeof(int));
+	CHECK(ids, NULL, "HDmalloc");
+	CHECK(objs, NULL, "HDmalloc");
+	if(ids == NULL || objs == NULL)
+		goto out;
+
+	many_ids_freed = 0;
+	myType = H5Iregister_type((size_t)8, 0, (H5I_free_t) many_ids_free);
+	CHECK(myType, H5I_BADID, "H5Iregister_type");
+	if(myType == H5I_BADID)
+		goto out;
+
+		/* Register many more IDs than the hash size */
+	for(i = 0; i < MANY_IDS; i++) {
+		objs[i] = i;
+		ids[i] = H5Iregister(myType, &objs[i]);
+		CHECK(ids[i], H5I_INVALID_HID, "H5Iregister");
+		if(ids[i] == H5I_INVALID_HID)
+			goto out;
+	}
+	for(i = 0; i < MANY_IDS; i++) {
+		testPtr = H5Iobject_verify(ids[i], myType);
+		VERIFY(testPtr, &objs[i], "H5Iobject_verify");
+		if(testPtr != &objs[i])
+			goto out;
+	}
+
+		/* Remove every other ID */
+	for(i = 0; i < MANY_IDS; i += 2) {
+		testPtr = H5Iremove_verify(ids[i], myType);
+		VERIFY(testPtr, &objs[i], "H5Iremove_verify");
+		if(testPtr != &objs[i])
+			goto out;
+	}
+	for(i = 0; i < MANY_IDS; i++) {
+		H5E_BEGIN_TRY
+			testPtr = H5Iobject_verify(ids[i], myType);
+		H5E_END_TRY
+		VERIFY(testPtr, (i % 2 ? &objs[i] : NULL), "H5Iobject_verify");
+		if(testPtr != (i % 2 ? &objs[i] : NULL))
+			goto out;
+	}
+	err = H5Inmembers(myType, &num_members);
+	CHECK(err, -1, "H5Inmembers");
+	VERIFY(num_members, MANY_IDS / 2, "H5Inmembers");
+
+		/* Every remaining ID is visited once */
+	visited = 0;
+	testPtr = H5Isearch(myType, (H5I_search_func_t) many_ids_count, &visited);
+	VERIFY(testPtr, NULL, "H5Isearch");
+	VERIFY(visited, MANY_IDS / 2, "H5Isearch");
+
+		/* Re-register the removed objects */
+	for(i = 0; i < MANY_IDS; i += 2) {
+		ids[i] = H5Iregister(myType, &objs[i]);
+		CHECK(ids[i], H5I_INVALID_HID, "H5Iregister");
+		if(ids[i] == H5I_INVALID_HID)
+			goto out;
+	}
+	for(i = 0; i < MANY_IDS; i++) {
+		testPtr = H5Iobject_verify(ids[i], myType);
+		VERIFY(testPtr, &objs[i], "H5Iobject_verify");
+		if(testPtr != &objs[i])
+			goto out;
+	}
+
+		/* Destroying the type frees every object */
+	err = H5Idestroy_type(myType);
+	VERIFY(err, 0, "H5Idestroy_type");
+	VERIFY(many_ids_freed, MANY_IDS, "H5Idestroy_type");
+
+	HDfree(ids);
+	HDfree(objs);
+	return 0;
+
+out:
+	H5E_BEGIN_TRY
+		H5Idestroy_type(myType);
+	H5E_END_TRY
+	if(ids)
+		HDfree(ids);
+	if(objs)
+		HDfree(objs);
+	return -1;
+}
+
+
 	/* Test boundary cases with lots of types */
 
 /* Type IDs range from H5I_NTYPES to H5I_MAX_NUM_TYPES.  The system will assign */
@@ -540,5 +656,6 @@ void test_ids(void)
 	if (test_is_valid() < 0) TestErrPrintf("H5Iis_valid test failed\n");
 	if (test_get_type() < 0) TestErrPrintf("H5Iget_type test failed\n");
 	if (test_id_type_list() < 0) TestErrPrintf("ID type list test failed\n");
+	if (test_many_ids() < 0) TestErrPrintf("Many IDs test failed\n");
 
 }
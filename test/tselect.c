@@ -137,6 +137,15 @@
 #define SPACE12_DIM0            25
 #define SPACE12_CHUNK_DIM0      5
 
+/* Information for offsets w/chunks test #3 */
+#define SPACE13_RANK	        2
+#define SPACE13_DIM0            30
+#define SPACE13_DIM1            30
+#define SPACE13_CHUNK_DIM0      6
+#define SPACE13_CHUNK_DIM1      4
+#define SPACE13_MEM_DIM0        20
+#define SPACE13_MEM_DIM1        20
+
 /* Information for Space rebuild test */
 #define SPACERE1_RANK            1
 #define SPACERE1_DIM0            20
@@ -12860,6 +12869,205 @@ test_select_hyper_chunk_offset2(void)
     CHECK(status, FAIL, "H5Fclose");
 }   /* test_select_hyper_chunk_offset2() */
 
+/****************************************************************
+**
+**  test_select_hyper_chunk_offset3(): Tests selections on dataspace,
+**      verify that reading & writing the same regular hyperslab
+**      selections over and over, at offsets that move them by whole
+**      chunks or not, is working in chunked datasets.
+**
+****************************************************************/
+static void
+test_select_hyper_chunk_offset3(void)
+{
+    hid_t       fid;            /* File ID */
+    hid_t       did;            /* Dataset ID */
+    hid_t       sid;            /* File dataspace ID */
+    hid_t       msid;           /* Memory dataspace ID */
+    hid_t       full_msid;      /* Memory dataspace ID for whole dataset */
+    hid_t       dcpl;           /* Dataset creation property list ID */
+    hsize_t     dims[SPACE13_RANK] = {SPACE13_DIM0, SPACE13_DIM1};     /* Dataset dimensions */
+    const hsize_t maxdims[SPACE13_RANK] = {H5S_UNLIMITED, H5S_UNLIMITED};
+    const hsize_t chunk_dims[SPACE13_RANK] = {SPACE13_CHUNK_DIM0, SPACE13_CHUNK_DIM1};
+    const hsize_t mem_dims[SPACE13_RANK] = {SPACE13_MEM_DIM0, SPACE13_MEM_DIM1};
+    const hsize_t full_dims[SPACE13_RANK] = {SPACE13_DIM0 + SPACE13_CHUNK_DIM0, SPACE13_DIM1 + SPACE13_CHUNK_DIM1};
+    const hsize_t zero[SPACE13_RANK] = {0, 0};
+    /* Start, stride, count & block of the selections: a single block, blocks
+     * that some chunk boundaries cut at some offsets, and a block that is
+     * mostly in one chunk */
+    const hsize_t sel[3][4][SPACE13_RANK] = {
+            {{1, 2}, {1, 1}, {5, 7}, {1, 1}},
+            {{0, 1}, {3, 2}, {4, 5}, {2, 1}},
+            {{1, 1}, {1, 1}, {3, 2}, {1, 1}}
+        };
+    /* Offsets of the file selection: repeated, moved by whole chunks & not */
+    const hssize_t offsets[][SPACE13_RANK] = {{0, 0}, {0, 0}, {6, 4}, {6, 4},
+            {1, 3}, {7, 7}, {13, 11}, {2, 2}, {8, 6}, {2, 2}};
+    hsize_t     mstart[SPACE13_RANK];   /* Start of memory selection */
+    hsize_t     mdims[SPACE13_RANK];    /* Memory dataspace dimensions */
+    int         model[SPACE13_DIM0 + SPACE13_CHUNK_DIM0][SPACE13_DIM1 + SPACE13_CHUNK_DIM1];   /* Expected dataset */
+    int         full[SPACE13_DIM0 + SPACE13_CHUNK_DIM0][SPACE13_DIM1 + SPACE13_CHUNK_DIM1];    /* Dataset read in */
+    int         buf[SPACE13_MEM_DIM0][SPACE13_MEM_DIM1];    /* Buffer for selections */
+    int         rbuf[SPACE13_MEM_DIM0 * SPACE13_MEM_DIM1];  /* Buffer for reading selections */
+    unsigned    pass, s, o, i, j;       /* Local index variables */
+    herr_t      ret;                    /* Generic return value */
+
+    /* Output message about test being performed */
+    MESSAGE(6, ("Testing repeated hyperslab selections using offsets in chunked datasets\n"));
+
+    /* Initialize data to write out (the area the dataset is extended into
+     * later reads back as the fill value) */
+    HDmemset(model, 0, sizeof(model));
+    for(i = 0; i < SPACE13_DIM0; i++)
+        for(j = 0; j < SPACE13_DIM1; j++)
+            model[i][j] = (int)((i * 1000) + j + 1);
+
+    /* Create file */
+    fid = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid, FAIL, "H5Fcreate");
+
+    /* Create a chunked dataset */
+    dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK(dcpl, FAIL, "H5Pcreate");
+    ret = H5Pset_chunk(dcpl, SPACE13_RANK, chunk_dims);
+    CHECK(ret, FAIL, "H5Pset_chunk");
+    sid = H5Screate_simple(SPACE13_RANK, dims, maxdims);
+    CHECK(sid, FAIL, "H5Screate_simple");
+    did = H5Dcreate2(fid, DATASETNAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    CHECK(did, FAIL, "H5Dcreate2");
+    ret = H5Pclose(dcpl);
+    CHECK(ret, FAIL, "H5Pclose");
+
+    /* Write the dataset out of the larger buffer */
+    full_msid = H5Screate_simple(SPACE13_RANK, full_dims, NULL);
+    CHECK(full_msid, FAIL, "H5Screate_simple");
+    ret = H5Sselect_hyperslab(full_msid, H5S_SELECT_SET, zero, NULL, dims, NULL);
+    CHECK(ret, FAIL, "H5Sselect_hyperslab");
+    ret = H5Dwrite(did, H5T_NATIVE_INT, full_msid, sid, H5P_DEFAULT, model);
+    CHECK(ret, FAIL, "H5Dwrite");
+    ret = H5Sclose(sid);
+    CHECK(ret, FAIL, "H5Sclose");
+
+    /* Create dataspace for memory */
+    msid = H5Screate_simple(SPACE13_RANK, mem_dims, NULL);
+    CHECK(msid, FAIL, "H5Screate_simple");
+
+    for(pass = 0; pass < 2; pass++) {
+        /* Extend the dataset for the second pass, which renumbers its chunks.
+         * Read with the first selection just before, a whole chunk away from
+         * the first read after it. */
+        if(pass) {
+            sid = H5Dget_space(did);
+            CHECK(sid, FAIL, "H5Dget_space");
+            ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, sel[0][0], sel[0][1], sel[0][2], sel[0][3]);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            ret = H5Soffset_simple(sid, offsets[2]);
+            CHECK(ret, FAIL, "H5Soffset_simple");
+            ret = H5Sselect_hyperslab(msid, H5S_SELECT_SET, zero, sel[0][1], sel[0][2], sel[0][3]);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            ret = H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, buf);
+            CHECK(ret, FAIL, "H5Dread");
+            ret = H5Sclose(sid);
+            CHECK(ret, FAIL, "H5Sclose");
+
+            dims[0] = full_dims[0];
+            dims[1] = full_dims[1];
+            ret = H5Dset_extent(did, dims);
+            CHECK(ret, FAIL, "H5Dset_extent");
+        } /* end if */
+        sid = H5Dget_space(did);
+        CHECK(sid, FAIL, "H5Dget_space");
+
+        for(s = 0; s < NELMTS(sel); s++) {
+            ret = H5Sselect_hyperslab(sid, H5S_SELECT_SET, sel[s][0], sel[s][1], sel[s][2], sel[s][3]);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+
+            /* Read the selection at each offset, into one of a few places
+             * in memory (kept for several offsets in a row), and into a
+             * narrower memory dataspace for the last offset */
+            for(o = 0; o < NELMTS(offsets); o++) {
+                mdims[0] = SPACE13_MEM_DIM0;
+                mdims[1] = (o == NELMTS(offsets) - 1) ? SPACE13_MEM_DIM1 - 1 : SPACE13_MEM_DIM1;
+                ret = H5Sset_extent_simple(msid, SPACE13_RANK, mdims, NULL);
+                CHECK(ret, FAIL, "H5Sset_extent_simple");
+                mstart[0] = (hsize_t)((o / 4) % 2);
+                mstart[1] = (hsize_t)((o / 4) % 3);
+                ret = H5Sselect_hyperslab(msid, H5S_SELECT_SET, mstart, sel[s][1], sel[s][2], sel[s][3]);
+                CHECK(ret, FAIL, "H5Sselect_hyperslab");
+                ret = H5Soffset_simple(sid, offsets[o]);
+                CHECK(ret, FAIL, "H5Soffset_simple");
+
+                HDmemset(rbuf, 0, sizeof(rbuf));
+                ret = H5Dread(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf);
+                CHECK(ret, FAIL, "H5Dread");
+
+                /* Check data read in, and that nothing else was touched */
+                for(i = 0; i < mdims[0]; i++)
+                    for(j = 0; j < mdims[1]; j++) {
+                        hsize_t di = i - mstart[0], dj = j - mstart[1];
+                        int expect = 0;
+
+                        if(i >= mstart[0] && (di % sel[s][1][0]) < sel[s][3][0] && (di / sel[s][1][0]) < sel[s][2][0]
+                                && j >= mstart[1] && (dj % sel[s][1][1]) < sel[s][3][1] && (dj / sel[s][1][1]) < sel[s][2][1])
+                            expect = model[sel[s][0][0] + (hsize_t)offsets[o][0] + di][sel[s][0][1] + (hsize_t)offsets[o][1] + dj];
+                        if(rbuf[(i * mdims[1]) + j] != expect)
+                            TestErrPrintf("Line: %d - Error! pass=%u, s=%u, o=%u, rbuf[%u][%u]=%d, expected %d\n", __LINE__, pass, s, o, i, j, rbuf[(i * mdims[1]) + j], expect);
+                    } /* end for */
+            } /* end for */
+
+            /* Write new data with the selection at each offset, from one of
+             * a few places in memory */
+            ret = H5Sset_extent_simple(msid, SPACE13_RANK, mem_dims, NULL);
+            CHECK(ret, FAIL, "H5Sset_extent_simple");
+            for(o = 0; o < NELMTS(offsets); o++) {
+                mstart[0] = (hsize_t)(((o / 4) + 1) % 2);
+                mstart[1] = (hsize_t)(((o / 4) + 1) % 3);
+                ret = H5Sselect_hyperslab(msid, H5S_SELECT_SET, mstart, sel[s][1], sel[s][2], sel[s][3]);
+                CHECK(ret, FAIL, "H5Sselect_hyperslab");
+                ret = H5Soffset_simple(sid, offsets[o]);
+                CHECK(ret, FAIL, "H5Soffset_simple");
+
+                for(i = 0; i < SPACE13_MEM_DIM0; i++)
+                    for(j = 0; j < SPACE13_MEM_DIM1; j++) {
+                        hsize_t di = i - mstart[0], dj = j - mstart[1];
+
+                        buf[i][j] = -(int)((pass * 1000000) + (s * 100000) + (o * 1000) + (i * 20) + j + 1);
+                        if(i >= mstart[0] && (di % sel[s][1][0]) < sel[s][3][0] && (di / sel[s][1][0]) < sel[s][2][0]
+                                && j >= mstart[1] && (dj % sel[s][1][1]) < sel[s][3][1] && (dj / sel[s][1][1]) < sel[s][2][1])
+                            model[sel[s][0][0] + (hsize_t)offsets[o][0] + di][sel[s][0][1] + (hsize_t)offsets[o][1] + dj] = buf[i][j];
+                    } /* end for */
+
+                ret = H5Dwrite(did, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, buf);
+                CHECK(ret, FAIL, "H5Dwrite");
+            } /* end for */
+
+            /* Read the whole dataset back in & verify it */
+            ret = H5Sselect_hyperslab(full_msid, H5S_SELECT_SET, zero, NULL, dims, NULL);
+            CHECK(ret, FAIL, "H5Sselect_hyperslab");
+            HDmemset(full, 0, sizeof(full));
+            ret = H5Dread(did, H5T_NATIVE_INT, full_msid, H5S_ALL, H5P_DEFAULT, full);
+            CHECK(ret, FAIL, "H5Dread");
+            for(i = 0; i < dims[0]; i++)
+                for(j = 0; j < dims[1]; j++)
+                    if(full[i][j] != model[i][j])
+                        TestErrPrintf("Line: %d - Error! pass=%u, s=%u, full[%u][%u]=%d, expected %d\n", __LINE__, pass, s, i, j, full[i][j], model[i][j]);
+        } /* end for */
+
+        ret = H5Sclose(sid);
+        CHECK(ret, FAIL, "H5Sclose");
+    } /* end for */
+
+    /* Close everything */
+    ret = H5Sclose(msid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Sclose(full_msid);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Dclose(did);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Fclose(fid);
+    CHECK(ret, FAIL, "H5Fclose");
+}   /* test_select_hyper_chunk_offset3() */
+
 /****************************************************************
 **
 **  test_select_bounds(): Tests selection bounds on dataspaces,
@@ -13221,6 +13429,7 @@ test_select(void)
     /* Test using selection offset on hyperslab in chunked dataset */
     test_select_hyper_chunk_offset();
     test_select_hyper_chunk_offset2();
+    test_select_hyper_chunk_offset3();
 
     /* Test selection bounds with & without offsets */
     test_select_bounds();
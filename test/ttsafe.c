@@ -97,6 +97,10 @@ int main(int argc, char *argv[])
         AddTest("cancel", tts_cancel, cleanup_cancel, "thread cancellation safety test", NULL);
 #endif /* H5_HAVE_PTHREAD_H */
         AddTest("acreate", tts_acreate, cleanup_acreate, "multi-attribute creation", NULL);
+#if defined(H5_HAVE_PTHREAD_H) && !defined(H5_HAVE_WIN_THREADS)
+        /* Reads without the global lock are only supported with pthreads */
+        AddTest("dread", tts_dread, cleanup_dread, "concurrent raw data reads", NULL);
+#endif /* H5_HAVE_PTHREAD_H && !H5_HAVE_WIN_THREADS */
 
         /* Display testing information */
         TestInfo(argv[0]);
@@ -0,0 +1,378 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/********************************************************************
+ *
+ * Testing concurrent raw data reads in the HDF5 library
+ * -----------------------------------------------------
+ *
+ * Multiple threads each read their own dataset from a file opened
+ * read-only.  The file is opened through a small test driver whose raw
+ * data reads sleep for a fixed time, so the elapsed time shows whether
+ * the reads overlapped (they should, when the driver advertises
+ * H5FD_FEAT_CONCURRENT_READ) or ran one after another under the global
+ * lock (they must, when it doesn't).  Sleeping rather than computing keeps
+ * the result independent of the number of processors.
+ *
+ * Temporary files generated:
+ *   ttsafe_dread.h5
+ *
+ * HDF5 APIs exercised in thread:
+ * H5Dopen2, H5Dread, H5Dclose.
+ *
+ ********************************************************************/
+#include "ttsafe.h"
+
+#if defined(H5_HAVE_THREADSAFE) && defined(H5_HAVE_PTHREAD_H) && !defined(H5_HAVE_WIN_THREADS)
+
+#define FILENAME        "ttsafe_dread.h5"
+#define NUM_THREAD      4
+#define NUM_READ        5
+#define NUM_ELMT        (64 * 1024)
+#define READ_DELAY      20000           /* Microseconds per raw data read */
+
+void *tts_dread_reader(void *);
+
+typedef struct thread_info {
+    int id;
+    hid_t file;
+    int nerrors;
+} thread_info;
+
+thread_info dread_thread_out[NUM_THREAD];
+
+/*
+ * The "slow" test driver: a read-only POSIX driver whose raw data reads
+ * take at least READ_DELAY microseconds.
+ */
+typedef struct H5FD_slow_t {
+    H5FD_t      pub;            /* Public stuff, must be first */
+    int         fd;             /* File descriptor */
+    haddr_t     eoa;            /* End of allocated region */
+    haddr_t     eof;            /* End of file */
+    dev_t       device;         /* File device number */
+    ino_t       inode;          /* File i-node number */
+} H5FD_slow_t;
+
+/* Whether the driver advertises concurrent reads */
+static hbool_t slow_concurrent_g = TRUE;
+
+static H5FD_t *slow_open(const char *name, unsigned flags, hid_t fapl_id,
+    haddr_t maxaddr);
+static herr_t slow_close(H5FD_t *_file);
+static int slow_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t slow_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t slow_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t slow_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t slow_get_eof(const H5FD_t *_file);
+static herr_t slow_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+    haddr_t addr, size_t size, void *buf);
+static herr_t slow_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id,
+    haddr_t addr, size_t size, const void *buf);
+
+static const H5FD_class_t H5FD_slow_g = {
+    "slow",                     /* name                 */
+    HADDR_MAX,                  /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    0,                          /* fapl_size            */
+    NULL,                       /* fapl_get             */
+    NULL,                       /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    slow_open,                  /* open                 */
+    slow_close,                 /* close                */
+    slow_cmp,                   /* cmp                  */
+    slow_query,                 /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    slow_get_eoa,               /* get_eoa              */
+    slow_set_eoa,               /* set_eoa              */
+    slow_get_eof,               /* get_eof              */
+    NULL,                       /* get_handle           */
+    slow_read,                  /* read                 */
+    slow_write,                 /* write                */
+    NULL,                       /* flush                */
+    NULL,                       /* truncate             */
+    NULL,                       /* lock                 */
+    NULL,                       /* unlock               */
+    H5FD_FLMAP_SINGLE,          /* fl_map               */
+    NULL,                       /* readv                */
+    NULL,                       /* writev               */
+    NULL                        /* map                  */
+};
+
+static H5FD_t *
+slow_open(const char *name, unsigned flags, hid_t UNUSED fapl_id,
+    haddr_t UNUSED maxaddr)
+{
+    H5FD_slow_t *file;
+    h5_stat_t   sb;
+    int         fd;
+
+    if(flags & H5F_ACC_RDWR)
+        return NULL;
+    if((fd = HDopen(name, O_RDONLY, 0)) < 0)
+        return NULL;
+    if(HDfstat(fd, &sb) < 0 || NULL == (file = (H5FD_slow_t *)HDcalloc((size_t)1, sizeof(H5FD_slow_t)))) {
+        HDclose(fd);
+        return NULL;
+    } /* end if */
+    file->fd = fd;
+    file->eof = (haddr_t)sb.st_size;
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+
+    return (H5FD_t *)file;
+}
+
+static herr_t
+slow_close(H5FD_t *_file)
+{
+    H5FD_slow_t *file = (H5FD_slow_t *)_file;
+    int ret = HDclose(file->fd);
+
+    HDfree(file);
+
+    return ret < 0 ? -1 : 0;
+}
+
+static int
+slow_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_slow_t *f1 = (const H5FD_slow_t *)_f1;
+    const H5FD_slow_t *f2 = (const H5FD_slow_t *)_f2;
+
+    if(f1->device != f2->device)
+        return f1->device < f2->device ? -1 : 1;
+    if(f1->inode != f2->inode)
+        return f1->inode < f2->inode ? -1 : 1;
+
+    return 0;
+}
+
+static herr_t
+slow_query(const H5FD_t UNUSED *_f, unsigned long *flags)
+{
+    *flags = H5FD_FEAT_ACCUMULATE_METADATA;
+    if(slow_concurrent_g)
+        *flags |= H5FD_FEAT_CONCURRENT_READ;
+
+    return 0;
+}
+
+static haddr_t
+slow_get_eoa(const H5FD_t *_file, H5FD_mem_t UNUSED type)
+{
+    return ((const H5FD_slow_t *)_file)->eoa;
+}
+
+static herr_t
+slow_set_eoa(H5FD_t *_file, H5FD_mem_t UNUSED type, haddr_t addr)
+{
+    ((H5FD_slow_t *)_file)->eoa = addr;
+
+    return 0;
+}
+
+static haddr_t
+slow_get_eof(const H5FD_t *_file)
+{
+    return ((const H5FD_slow_t *)_file)->eof;
+}
+
+static herr_t
+slow_read(H5FD_t *_file, H5FD_mem_t type, hid_t UNUSED dxpl_id, haddr_t addr,
+    size_t size, void *buf)
+{
+    H5FD_slow_t *file = (H5FD_slow_t *)_file;
+    unsigned char *p = (unsigned char *)buf;
+
+    if(H5FD_MEM_DRAW == type)
+        HDusleep(READ_DELAY);
+
+    while(size > 0) {
+        ssize_t nbytes = HDpread(file->fd, p, size, (HDoff_t)addr);
+
+        if(nbytes < 0)
+            return -1;
+        if(0 == nbytes) {
+            /* Reads past the end of the file return zeros */
+            HDmemset(p, 0, size);
+            break;
+        } /* end if */
+        size -= (size_t)nbytes;
+        addr += (haddr_t)nbytes;
+        p += nbytes;
+    } /* end while */
+
+    return 0;
+}
+
+static herr_t
+slow_write(H5FD_t UNUSED *_file, H5FD_mem_t UNUSED type, hid_t UNUSED dxpl_id,
+    haddr_t UNUSED addr, size_t UNUSED size, const void UNUSED *buf)
+{
+    return -1;
+}
+
+/* Elapsed time, in seconds, of NUM_THREAD threads reading the file */
+static double
+tts_dread_run(hid_t fapl)
+{
+    H5TS_thread_t threads[NUM_THREAD];
+    struct timeval start, finish;
+    hid_t file;
+    int i;
+    herr_t ret;
+
+    file = H5Fopen(FILENAME, H5F_ACC_RDONLY, fapl);
+    CHECK(file, FAIL, "H5Fopen");
+
+    HDgettimeofday(&start, NULL);
+    for(i = 0; i < NUM_THREAD; i++) {
+        dread_thread_out[i].id = i;
+        dread_thread_out[i].file = file;
+        dread_thread_out[i].nerrors = 0;
+        threads[i] = H5TS_create_thread(tts_dread_reader, NULL, &dread_thread_out[i]);
+    } /* end for */
+    for(i = 0; i < NUM_THREAD; i++)
+        H5TS_wait_for_thread(threads[i]);
+    HDgettimeofday(&finish, NULL);
+
+    for(i = 0; i < NUM_THREAD; i++)
+        if(dread_thread_out[i].nerrors)
+            TestErrPrintf("Thread %d read wrong data - test failed\n", i);
+
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    return (double)(finish.tv_sec - start.tv_sec) +
+        (double)(finish.tv_usec - start.tv_usec) / 1000000.0F;
+}
+
+/*
+ **********************************************************************
+ * Thread safe test - concurrent raw data reads
+ **********************************************************************
+ */
+void tts_dread(void)
+{
+    hid_t file, space, dset, fapl;
+    hid_t driver;
+    hsize_t dims[1] = {NUM_ELMT};
+    char name[16];
+    int *data;
+    double serial, elapsed;
+    int i, j;
+    herr_t ret;
+
+    /* Create the file, with one dataset per thread */
+    data = (int *)HDmalloc(NUM_ELMT * sizeof(int));
+    CHECK(data, NULL, "HDmalloc");
+    file = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(file, FAIL, "H5Fcreate");
+    space = H5Screate_simple(1, dims, NULL);
+    CHECK(space, FAIL, "H5Screate_simple");
+    for(i = 0; i < NUM_THREAD; i++) {
+        for(j = 0; j < NUM_ELMT; j++)
+            data[j] = i * NUM_ELMT + j;
+        HDsnprintf(name, sizeof(name), "dset%d", i);
+        dset = H5Dcreate2(file, name, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        CHECK(dset, FAIL, "H5Dcreate2");
+        ret = H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        CHECK(ret, FAIL, "H5Dwrite");
+        ret = H5Dclose(dset);
+        CHECK(ret, FAIL, "H5Dclose");
+    } /* end for */
+    ret = H5Sclose(space);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(file);
+    CHECK(ret, FAIL, "H5Fclose");
+    HDfree(data);
+
+    /* Read it back through the slow driver */
+    driver = H5FDregister(&H5FD_slow_g);
+    CHECK(driver, FAIL, "H5FDregister");
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    CHECK(fapl, FAIL, "H5Pcreate");
+    ret = H5Pset_driver(fapl, driver, NULL);
+    CHECK(ret, FAIL, "H5Pset_driver");
+
+    /* Without the feature flag, the reads hold the global lock throughout */
+    slow_concurrent_g = FALSE;
+    serial = (double)(NUM_THREAD * NUM_READ * READ_DELAY) / 1000000.0F;
+    elapsed = tts_dread_run(fapl);
+    if(elapsed < serial)
+        TestErrPrintf("Locked reads took %.3fs, expected at least %.3fs - test failed\n",
+            elapsed, serial);
+
+    /* With it, reads of different datasets overlap */
+    slow_concurrent_g = TRUE;
+    elapsed = tts_dread_run(fapl);
+    if(elapsed >= serial / 2)
+        TestErrPrintf("Concurrent reads took %.3fs, expected under %.3fs - test failed\n",
+            elapsed, serial / 2);
+
+    ret = H5Pclose(fapl);
+    CHECK(ret, FAIL, "H5Pclose");
+    ret = H5FDunregister(driver);
+    CHECK(ret, FAIL, "H5FDunregister");
+}
+
+void *tts_dread_reader(void *_thread_data)
+{
+    thread_info *thread_data = (thread_info *)_thread_data;
+    hid_t dset;
+    char name[16];
+    int *data;
+    int i, j;
+    herr_t ret;
+
+    data = (int *)HDmalloc(NUM_ELMT * sizeof(int));
+    assert(data);
+
+    HDsnprintf(name, sizeof(name), "dset%d", thread_data->id);
+    dset = H5Dopen2(thread_data->file, name, H5P_DEFAULT);
+    assert(dset >= 0);
+
+    for(i = 0; i < NUM_READ; i++) {
+        HDmemset(data, 0, NUM_ELMT * sizeof(int));
+        ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+        assert(ret >= 0);
+        for(j = 0; j < NUM_ELMT; j++)
+            if(data[j] != thread_data->id * NUM_ELMT + j) {
+                thread_data->nerrors++;
+                break;
+            } /* end if */
+    } /* end for */
+
+    ret = H5Dclose(dset);
+    assert(ret >= 0);
+    HDfree(data);
+
+    return NULL;
+}
+
+void cleanup_dread(void)
+{
+    HDunlink(FILENAME);
+}
+#endif /* H5_HAVE_THREADSAFE && H5_HAVE_PTHREAD_H && !H5_HAVE_WIN_THREADS */
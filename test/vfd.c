@@ -43,6 +43,33 @@
 #define DSET2_DIM    4
 #endif /* H5_HAVE_DIRECT */
 
+/* Macros for the sec2 vectored I/O test */
+#define SEC2_DSET_NAME  "sec2_dset"
+#define SEC2_ROWS       64
+#define SEC2_COLS       256
+#define SEC2_PAD        16
+
+/* Macros for the io_uring VFD */
+#define IOURING_DEPTH       4
+#define IOURING_DSET_NAME   "iouring_dset"
+#define IOURING_DIM1        64
+#define IOURING_DIM2        256
+#define IOURING_CHUNK1      4
+
+/* Macros for core VFD write tracking */
+#define CORE_PAGE_SIZE      512
+#define CORE_TRACK_NAME     "core_track_dset"
+#define CORE_TRACK_DIM      16384
+#define CORE_TRACK_COUNT    10
+#define CORE_TRACK_STAMP    7777
+
+/* Macros for the mmap VFD */
+#define MMAP_CONTIG_NAME    "mmap_contig"
+#define MMAP_CHUNKED_NAME   "mmap_chunked"
+#define MMAP_DIM1           32
+#define MMAP_DIM2           100
+#define MMAP_CHUNK1         8
+
 const char *FILENAME[] = {
     "sec2_file",         /*0*/
     "core_file",         /*1*/
@@ -54,6 +81,9 @@ const char *FILENAME[] = {
     "stdio_file",        /*7*/
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
+    "iouring_file",      /*10*/
+    "mmap_file",         /*11*/
+    "core_track_file",   /*12*/
     NULL
 };
 
@@ -82,9 +112,18 @@ test_sec2(void)
   hid_t        file            = -1;
   hid_t        fapl            = -1;
   hid_t        access_fapl     = -1;
+    hid_t        dset            = -1;
+    hid_t        fspace          = -1;
+    hid_t        mspace          = -1;
     char         filename[1024];
     int          *fhandle        = NULL;
     hsize_t      file_size       = 0;
+    hsize_t      dims[2]         = {SEC2_ROWS, SEC2_COLS};
+    hsize_t      mem_dims[2]     = {SEC2_ROWS, SEC2_COLS + SEC2_PAD};
+    hsize_t      start[2], stride[2], count[2];
+    int          *wbuf           = NULL;
+    int          *rbuf           = NULL;
+    int          i, j;
 
     TESTING("SEC2 file driver");
 
@@ -92,6 +131,11 @@ test_sec2(void)
     fapl = h5_fileaccess();
     if(H5Pset_fapl_sec2(fapl) < 0)
         TEST_ERROR;
+
+    /* Use a sieve buffer smaller than a row of the dataset below, so that
+     * the rows are passed straight to the driver */
+    if(H5Pset_sieve_buf_size(fapl, (size_t)64) < 0)
+        TEST_ERROR;
     h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
 
     if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
@@ -125,6 +169,64 @@ test_sec2(void)
     if(file_size < 1 * KB || file_size > 4 * KB)
         TEST_ERROR;
 
+    /* Write and read rows which aren't adjacent in memory, so that the
+     * raw data requests are passed to the driver as lists */
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * SEC2_ROWS * (SEC2_COLS + SEC2_PAD))))
+        TEST_ERROR;
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * SEC2_ROWS * (SEC2_COLS + SEC2_PAD))))
+        TEST_ERROR;
+    for(i = 0; i < SEC2_ROWS; i++)
+        for(j = 0; j < SEC2_COLS + SEC2_PAD; j++)
+            wbuf[i * (SEC2_COLS + SEC2_PAD) + j] = i * 1000 + j;
+
+    if((fspace = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((mspace = H5Screate_simple(2, mem_dims, NULL)) < 0)
+        TEST_ERROR;
+    start[0] = 0; start[1] = SEC2_PAD / 2;
+    count[0] = SEC2_ROWS; count[1] = SEC2_COLS;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, SEC2_DSET_NAME, H5T_NATIVE_INT, fspace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+
+    HDmemset(rbuf, 0, sizeof(int) * SEC2_ROWS * (SEC2_COLS + SEC2_PAD));
+    if(H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for(i = 0; i < SEC2_ROWS; i++)
+        for(j = SEC2_PAD / 2; j < SEC2_COLS + SEC2_PAD / 2; j++)
+            if(rbuf[i * (SEC2_COLS + SEC2_PAD) + j] != wbuf[i * (SEC2_COLS + SEC2_PAD) + j])
+                TEST_ERROR;
+
+    /* Read every other row, so that the requests aren't adjacent in the
+     * file either */
+    start[0] = 0; start[1] = 0;
+    stride[0] = 2; stride[1] = 1;
+    count[0] = SEC2_ROWS / 2; count[1] = SEC2_COLS;
+    if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        TEST_ERROR;
+    start[1] = SEC2_PAD / 2;
+    if(H5Sselect_hyperslab(mspace, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, sizeof(int) * SEC2_ROWS * (SEC2_COLS + SEC2_PAD));
+    if(H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for(i = 0; i < SEC2_ROWS / 2; i++)
+        for(j = SEC2_PAD / 2; j < SEC2_COLS + SEC2_PAD / 2; j++)
+            if(rbuf[i * (SEC2_COLS + SEC2_PAD) + j] != wbuf[2 * i * (SEC2_COLS + SEC2_PAD) + j])
+                TEST_ERROR;
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(fspace) < 0)
+        TEST_ERROR;
+    if(H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
     if(H5Fclose(file) < 0)
         TEST_ERROR;
 
@@ -134,9 +236,16 @@ test_sec2(void)
 
 error:
     H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(fspace);
+        H5Sclose(mspace);
         H5Pclose(fapl);
         H5Fclose(file);
     } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
     return -1;
 }
 
@@ -571,6 +680,186 @@ error:
     return -1;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_core_write_tracking
+ *
+ * Purpose:     Tests that the CORE driver, with write tracking enabled,
+ *              only writes the modified pages back to the backing store.
+ *
+ *              The backing store is modified behind the library's back
+ *              in a page that the library leaves alone; that change must
+ *              survive closing the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_core_write_tracking(void)
+{
+    hid_t       file = -1, fapl = -1, sec2_fapl = -1;
+    hid_t       dset = -1, space = -1, mspace = -1;
+    char        filename[1024];
+    hbool_t     is_enabled;
+    size_t      page_size;
+    haddr_t     offset;
+    hsize_t     dims[1] = {CORE_TRACK_DIM};
+    hsize_t     start[1], count[1] = {CORE_TRACK_COUNT};
+    int         *buf = NULL;
+    int         stamp[CORE_TRACK_COUNT];
+    int         fd = -1;
+    herr_t      ret;
+    int         i;
+
+    TESTING("CORE file driver write tracking");
+
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_core(fapl, (size_t)CORE_INCREMENT, TRUE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[12], fapl, filename, sizeof filename);
+
+    /* Check the default settings */
+    if(H5Pget_core_write_tracking(fapl, &is_enabled, &page_size) < 0)
+        TEST_ERROR;
+    if(is_enabled || 524288 != page_size)
+        TEST_ERROR;
+
+    /* A zero page size is not allowed */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_core_write_tracking(fapl, TRUE, (size_t)0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+
+    if(H5Pset_core_write_tracking(fapl, TRUE, (size_t)CORE_PAGE_SIZE) < 0)
+        TEST_ERROR;
+    if(H5Pget_core_write_tracking(fapl, &is_enabled, &page_size) < 0)
+        TEST_ERROR;
+    if(!is_enabled || CORE_PAGE_SIZE != page_size)
+        TEST_ERROR;
+
+    if(NULL == (buf = (int *)HDmalloc(CORE_TRACK_DIM * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < CORE_TRACK_DIM; i++)
+        buf[i] = i;
+
+    /* Create the file with a contiguous dataset */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if((space = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, CORE_TRACK_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    if(HADDR_UNDEF == (offset = H5Dget_offset(dset)))
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Reopen the file and overwrite the first few elements */
+    if((file = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, CORE_TRACK_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for(i = 0; i < CORE_TRACK_COUNT; i++)
+        stamp[i] = -i;
+    start[0] = 0;
+    if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if((mspace = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, stamp) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    /* Stamp the last few elements directly in the backing store, which
+     * the library's in-memory image doesn't know about.
+     */
+    for(i = 0; i < CORE_TRACK_COUNT; i++)
+        stamp[i] = CORE_TRACK_STAMP;
+    if((fd = HDopen(filename, O_RDWR, 0)) < 0)
+        TEST_ERROR;
+    if(HDlseek(fd, (HDoff_t)(offset + (CORE_TRACK_DIM - CORE_TRACK_COUNT) * sizeof(int)), SEEK_SET) < 0)
+        TEST_ERROR;
+    if(HDwrite(fd, stamp, sizeof(stamp)) != (ssize_t)sizeof(stamp))
+        TEST_ERROR;
+    if(HDclose(fd) < 0)
+        TEST_ERROR;
+    fd = -1;
+
+    /* Closing flushes only the dirty pages */
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Check the file contents through a different driver */
+    if((sec2_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(sec2_fapl) < 0)
+        TEST_ERROR;
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, sec2_fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, CORE_TRACK_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    for(i = 0; i < CORE_TRACK_DIM; i++) {
+        int expect;
+
+        if(i < CORE_TRACK_COUNT)
+            expect = -i;
+        else if(i >= CORE_TRACK_DIM - CORE_TRACK_COUNT)
+            expect = CORE_TRACK_STAMP;
+        else
+            expect = i;
+        if(buf[i] != expect) {
+            H5_FAILED();
+            printf("    Read %d instead of %d at index %d.\n", buf[i], expect, i);
+            goto error;
+        } /* end if */
+    } /* end for */
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    if(H5Sclose(mspace) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Pclose(sec2_fapl) < 0)
+        TEST_ERROR;
+    HDfree(buf);
+
+    h5_cleanup(FILENAME, fapl);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Pclose(sec2_fapl);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    if(fd >= 0)
+        HDclose(fd);
+    if(buf)
+        HDfree(buf);
+
+    return -1;
+}
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_family_opens
@@ -1559,6 +1848,385 @@ error:
 #endif /* H5_HAVE_WINDOWS */
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the file handle interface for the io_uring driver,
+ *              and that data written through its queue of asynchronous
+ *              requests reads back correctly, both before and after the
+ *              file is closed.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    hid_t        file            = -1;
+    hid_t        fapl            = -1;
+    hid_t        access_fapl     = -1;
+    hid_t        dcpl            = -1;
+    hid_t        dset            = -1;
+    hid_t        space           = -1;
+    char         filename[1024];
+    int          *fhandle        = NULL;
+    hsize_t      file_size       = 0;
+    hsize_t      dims[2]         = {IOURING_DIM1, IOURING_DIM2};
+    hsize_t      chunk_dims[2]   = {IOURING_CHUNK1, IOURING_DIM2};
+    hsize_t      start[2], count[2];
+    unsigned     depth           = 0;
+    int          *wbuf           = NULL;
+    int          *rbuf           = NULL;
+    int          i;
+#endif /* H5_HAVE_IOURING */
+
+    TESTING("IO_URING file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING */
+
+    /* Set property list and file name for the io_uring driver.  Use a
+     * short queue so that writes have to wait for free requests. */
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_iouring(fapl, IOURING_DEPTH) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[10], fapl, filename, sizeof filename);
+
+    /* Verify the file access properties */
+    if(H5Pget_fapl_iouring(fapl, &depth) < 0)
+        TEST_ERROR;
+    if(depth != IOURING_DEPTH)
+        TEST_ERROR;
+
+    /* Disable the chunk cache, so that each chunk is written as soon as
+     * it's ready */
+    if(H5Pset_cache(fapl, 0, (size_t)0, (size_t)0, 0.0) < 0)
+        TEST_ERROR;
+
+    H5E_BEGIN_TRY {
+        file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    } H5E_END_TRY;
+    if(file < 0) {
+        H5Pclose(fapl);
+        SKIPPED();
+        printf("  Probably the kernel doesn't support io_uring\n");
+        return 0;
+    } /* end if */
+
+    /* Retrieve the access property list... */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if(H5FD_IOURING != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+
+    /* ...and close the property list */
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Check file handle API */
+    if(H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if(*fhandle < 0)
+        TEST_ERROR;
+
+    /* Check file size API */
+    if(H5Fget_filesize(file, &file_size) < 0)
+        TEST_ERROR;
+
+    /* There is no guarantee the size of metadata in file is constant.
+     * Just try to check if it's reasonable.  It's 2KB right now.
+     */
+    if(file_size < 1 * KB || file_size > 4 * KB)
+        TEST_ERROR;
+
+    /* Write more chunks than there are requests in the queue */
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * IOURING_DIM1 * IOURING_DIM2)))
+        TEST_ERROR;
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * IOURING_DIM1 * IOURING_DIM2)))
+        TEST_ERROR;
+    for(i = 0; i < IOURING_DIM1 * IOURING_DIM2; i++)
+        wbuf[i] = i;
+
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, IOURING_DSET_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+
+    /* Overwrite some of the rows while the first writes may still be in
+     * flight, then read everything back before closing the file */
+    start[0] = IOURING_CHUNK1 / 2; start[1] = 0;
+    count[0] = IOURING_DIM1 / 2; count[1] = IOURING_DIM2;
+    if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    for(i = 0; i < (int)(count[0] * count[1]); i++)
+        wbuf[start[0] * IOURING_DIM2 + (hsize_t)i] = -i;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, space, space, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+
+    HDmemset(rbuf, 0, sizeof(int) * IOURING_DIM1 * IOURING_DIM2);
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, wbuf, sizeof(int) * IOURING_DIM1 * IOURING_DIM2))
+        TEST_ERROR;
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Check the data once more after reopening the file */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, IOURING_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, sizeof(int) * IOURING_DIM1 * IOURING_DIM2);
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, wbuf, sizeof(int) * IOURING_DIM1 * IOURING_DIM2))
+        TEST_ERROR;
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    h5_cleanup(FILENAME, fapl);
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(dcpl);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+#endif /* H5_HAVE_IOURING */
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the file handle interface for the read-only mmap
+ *              driver, that data written with the sec2 driver reads back
+ *              correctly through it, and that files can't be created or
+ *              opened for writing with it.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP_VFD
+    hid_t        file            = -1;
+    hid_t        fapl            = -1;
+    hid_t        sec2_fapl       = -1;
+    hid_t        access_fapl     = -1;
+    hid_t        dcpl            = -1;
+    hid_t        dset            = -1;
+    hid_t        space           = -1;
+    char         filename[1024];
+    int          *fhandle        = NULL;
+    hsize_t      file_size       = 0;
+    hsize_t      dims[2]         = {MMAP_DIM1, MMAP_DIM2};
+    hsize_t      chunk_dims[2]   = {MMAP_CHUNK1, MMAP_DIM2};
+    hsize_t      start[2], count[2];
+    int          *wbuf           = NULL;
+    int          *rbuf           = NULL;
+    int          i;
+#endif /* H5_HAVE_MMAP_VFD */
+
+    TESTING("MMAP file driver");
+
+#ifndef H5_HAVE_MMAP_VFD
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_MMAP_VFD */
+
+    /* Set property lists and file name: the file is written with the sec2
+     * driver and read with the mmap driver */
+    fapl = h5_fileaccess();
+    if(H5Pset_fapl_mmap(fapl) < 0)
+        TEST_ERROR;
+    if((sec2_fapl = H5Pcopy(fapl)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(sec2_fapl) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[11], fapl, filename, sizeof filename);
+
+    /* Creating a file with the driver must fail */
+    H5E_BEGIN_TRY {
+        file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR;
+
+    /* Write a contiguous and a chunked dataset */
+    if(NULL == (wbuf = (int *)HDmalloc(sizeof(int) * MMAP_DIM1 * MMAP_DIM2)))
+        TEST_ERROR;
+    if(NULL == (rbuf = (int *)HDmalloc(sizeof(int) * MMAP_DIM1 * MMAP_DIM2)))
+        TEST_ERROR;
+    for(i = 0; i < MMAP_DIM1 * MMAP_DIM2; i++)
+        wbuf[i] = i;
+
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, sec2_fapl)) < 0)
+        TEST_ERROR;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, MMAP_CONTIG_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, MMAP_CHUNKED_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Opening the file for writing with the driver must fail */
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDWR, fapl);
+    } H5E_END_TRY;
+    if(file >= 0)
+        TEST_ERROR;
+
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+
+    /* Retrieve the access property list... */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+
+    /* Check that the driver is correct */
+    if(H5FD_MMAP != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+
+    /* ...and close the property list */
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    /* Check file handle API */
+    if(H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if(*fhandle < 0)
+        TEST_ERROR;
+
+    /* Check file size API */
+    if(H5Fget_filesize(file, &file_size) < 0)
+        TEST_ERROR;
+    if((h5_stat_size_t)file_size != h5_get_file_size(filename, fapl))
+        TEST_ERROR;
+
+    /* Read both datasets whole */
+    if((dset = H5Dopen2(file, MMAP_CONTIG_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, sizeof(int) * MMAP_DIM1 * MMAP_DIM2);
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, wbuf, sizeof(int) * MMAP_DIM1 * MMAP_DIM2))
+        TEST_ERROR;
+
+    /* Read a column of the contiguous dataset, one element per row */
+    start[0] = 0; start[1] = MMAP_DIM2 / 2;
+    count[0] = MMAP_DIM1; count[1] = 1;
+    if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, sizeof(int) * MMAP_DIM1 * MMAP_DIM2);
+    if(H5Dread(dset, H5T_NATIVE_INT, space, space, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for(i = 0; i < MMAP_DIM1; i++)
+        if(rbuf[i * MMAP_DIM2 + MMAP_DIM2 / 2] != wbuf[i * MMAP_DIM2 + MMAP_DIM2 / 2])
+            TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if((dset = H5Dopen2(file, MMAP_CHUNKED_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    HDmemset(rbuf, 0, sizeof(int) * MMAP_DIM1 * MMAP_DIM2);
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, wbuf, sizeof(int) * MMAP_DIM1 * MMAP_DIM2))
+        TEST_ERROR;
+
+    /* Writing must fail */
+    H5E_BEGIN_TRY {
+        i = (int)H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf);
+    } H5E_END_TRY;
+    if(i >= 0)
+        TEST_ERROR;
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Pclose(dcpl) < 0)
+        TEST_ERROR;
+    if(H5Pclose(sec2_fapl) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    h5_cleanup(FILENAME, fapl);
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Sclose(space);
+        H5Pclose(dcpl);
+        H5Pclose(sec2_fapl);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+#endif /* H5_HAVE_MMAP_VFD */
+}
 
 
 /*-------------------------------------------------------------------------
@@ -1585,6 +2253,7 @@ main(void)
 
     nerrors += test_sec2() < 0           ? 1 : 0;
     nerrors += test_core() < 0           ? 1 : 0;
+    nerrors += test_core_write_tracking() < 0 ? 1 : 0;
     nerrors += test_family() < 0         ? 1 : 0;
     nerrors += test_family_compat() < 0  ? 1 : 0;
     nerrors += test_multi() < 0          ? 1 : 0;
@@ -1593,6 +2262,8 @@ main(void)
     nerrors += test_log() < 0            ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
+    nerrors += test_iouring() < 0        ? 1 : 0;
+    nerrors += test_mmap() < 0           ? 1 : 0;
 
     if(nerrors) {
   printf("***** %d Virtual File Driver TEST%s FAILED! *****\n",